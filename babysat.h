@@ -0,0 +1,2092 @@
+/*
+Copyright (c) 2015-2021, the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+http://selfie.cs.uni-salzburg.at
+
+Babysat is a simple implementation of a SAT solver for educational
+purposes. Babysat assigns variables in index order, first to true
+and then to false, and backtracks chronologically. After each
+assignment, unit clauses are propagated using two watched literals
+per clause and a trail of assigned literals, as in Knuth's sat3.
+Clauses are stored sparsely as arrays of literals.
+
+With option --cdcl, babysat instead performs conflict-driven clause
+learning as in MiniSat: conflicts are analyzed for the first unique
+implication point, the learnt clause is added to the instance, and
+search backjumps non-chronologically to the second highest decision
+level of the learnt clause. Decisions are made on variables with
+highest activity, kept in a binary heap, where variables involved in
+recent conflicts have higher activity (VSIDS), and in the value the
+variable had most recently (phase saving). Search restarts after a
+number of conflicts that follows the Luby sequence. Learnt clauses
+with many different decision levels (LBD as in Glucose) are deleted
+periodically to keep propagation fast.
+
+With option --portfolio n, babysat runs n differently configured CDCL
+solvers on the same instance. C* has no threads, so the solvers take
+turns on a single core, each for a fixed number of conflicts, similar
+to how mipster schedules machine contexts. The first solver that
+finishes wins. Learnt unit and binary clauses are shared with the
+other solvers through an append-only queue which each solver reads
+from its own position whenever it restarts.
+
+Babysat may also be included as a library by other tools such as
+monster. Its incremental interface adds variables and clauses to a
+single CDCL solver at any time and decides satisfiability under an
+assumption literal which is always the first decision, as in MiniSat,
+so that clauses learnt under one assumption remain valid under others.
+
+Babysat comes with a DIMACS CNF parser, is written in C*, and
+uses code from the selfie system. See selfie's Makefile for
+details on how to build babysat.
+*/
+
+// -----------------------------------------------------------------
+// -------------------------- SAT Solver ---------------------------
+// -----------------------------------------------------------------
+
+uint64_t get_variable(uint64_t literal);
+uint64_t negate(uint64_t literal);
+uint64_t get_literal_value(uint64_t literal);
+
+void      watch_literal(uint64_t* watch, uint64_t literal);
+uint64_t* new_clause(uint64_t* literals, uint64_t size, uint64_t lbd);
+void      store_clause(uint64_t clause, uint64_t size);
+void      assert_unit_clause(uint64_t literal);
+void      assign_literal(uint64_t literal, uint64_t* reason);
+void      undo_assignments(uint64_t mark);
+uint64_t* propagate();
+
+uint64_t babysat(uint64_t depth);
+
+void init_sat_solver();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t FALSE      = 0;
+uint64_t TRUE       = 1;
+uint64_t UNASSIGNED = 2;
+
+uint64_t UNSAT   = 0;
+uint64_t SAT     = 1;
+uint64_t UNKNOWN = 2;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* dimacs_name = (char*) 0;
+
+uint64_t number_of_sat_variables = 0;
+
+// number_of_sat_variables
+uint64_t* sat_assignment = (uint64_t*) 0;
+
+uint64_t number_of_sat_clauses = 0;
+
+// number_of_sat_clauses pointers to clauses,
+// see clause struct below
+uint64_t* sat_instance = (uint64_t*) 0;
+
+// 2 * number_of_sat_variables watch lists,
+// one per literal, see watch struct below
+uint64_t* sat_watches = (uint64_t*) 0;
+
+// number_of_sat_variables literals in order of assignment
+uint64_t* sat_trail = (uint64_t*) 0;
+
+uint64_t trail_size = 0; // number of literals on trail
+uint64_t trail_head = 0; // index of next literal to propagate
+
+// number_of_sat_variables pointers to the clauses that
+// implied the assignment of each variable, if any, and
+// the decision levels at which variables were assigned
+uint64_t* sat_reasons = (uint64_t*) 0;
+uint64_t* sat_levels  = (uint64_t*) 0;
+
+uint64_t decision_level = 0;
+
+// satisfiability is known without search if the instance
+// contains an empty clause or conflicting unit clauses
+uint64_t sat_unsat = 0;
+
+// search statistics
+
+uint64_t number_of_decisions    = 0;
+uint64_t number_of_propagations = 0;
+uint64_t number_of_conflicts    = 0;
+
+// -----------------------------------------------------------------
+// -------------------------- CDCL Solver --------------------------
+// -----------------------------------------------------------------
+
+uint64_t get_activity(uint64_t variable);
+void     bump_activity(uint64_t variable);
+void     decay_activities();
+
+void     heap_swap(uint64_t i, uint64_t j);
+void     heap_percolate_up(uint64_t i);
+void     heap_percolate_down(uint64_t i);
+void     heap_insert(uint64_t variable);
+uint64_t heap_remove_max();
+
+uint64_t luby(uint64_t i);
+
+uint64_t analyze(uint64_t* conflict);
+uint64_t is_redundant(uint64_t literal);
+void     backjump(uint64_t level);
+void     learn_clause();
+uint64_t is_locked(uint64_t* clause);
+void     reduce_learnt_clauses();
+uint64_t pick_branching_literal();
+
+uint64_t cdcl();
+
+void init_cdcl();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t NOT_IN_HEAP = -1;
+
+// activity increment grows by 1/19 per conflict, that is,
+// activities decay by a factor of 0.95 relative to it
+uint64_t ACTIVITY_DECAY     = 19;
+uint64_t ACTIVITY_INCREMENT = 1048576; // 2^20, large enough to grow by 1/19
+uint64_t ACTIVITY_LIMIT     = 1125899906842624; // 2^50
+uint64_t ACTIVITY_RESCALE   = 1073741824;       // 2^30
+
+uint64_t RESTART_INTERVAL = 100; // default conflicts per unit of Luby sequence
+
+uint64_t MAX_LBD = 64; // learnt clauses with LBD > MAX_LBD count as MAX_LBD
+
+uint64_t MIN_LEARNT_CLAUSES = 2000; // initial limit of learnt clauses
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t cdcl_enabled = 0;
+
+// number_of_sat_variables activities and saved values
+uint64_t* sat_activities = (uint64_t*) 0;
+uint64_t* sat_phases     = (uint64_t*) 0;
+
+// number_of_sat_variables flags whether variables may be decided
+uint64_t* sat_decisions = (uint64_t*) 0;
+
+uint64_t activity_increment = 0;
+
+// binary max-heap of unassigned variables ordered by activity
+// with the heap position of each variable or NOT_IN_HEAP
+uint64_t* sat_heap       = (uint64_t*) 0;
+uint64_t* heap_positions = (uint64_t*) 0;
+
+uint64_t heap_size = 0;
+
+// number_of_sat_variables + 1 trail indices where decision levels start
+uint64_t* level_starts = (uint64_t*) 0;
+
+// conflict analysis: variables seen, learnt clause under construction,
+// and decision levels stamped by conflict for computing the LBD
+uint64_t* sat_seen       = (uint64_t*) 0;
+uint64_t* learnt_buffer  = (uint64_t*) 0;
+uint64_t* level_stamps   = (uint64_t*) 0;
+uint64_t* analyze_buffer = (uint64_t*) 0;
+
+uint64_t learnt_size = 0;
+
+// pointers to learnt clauses, see clause struct below
+uint64_t* sat_learnts = (uint64_t*) 0;
+
+uint64_t number_of_learnts = 0;
+uint64_t learnts_capacity  = 0;
+uint64_t max_learnts       = 0;
+
+uint64_t restart_interval        = 0;
+uint64_t conflicts_until_restart = 0;
+
+// number of conflicts after which cdcl returns UNKNOWN
+uint64_t conflict_budget = -1;
+
+// CDCL statistics
+
+uint64_t number_of_restarts        = 0;
+uint64_t number_of_learnt_clauses  = 0;
+uint64_t number_of_learnt_literals = 0;
+uint64_t number_of_deleted_clauses = 0;
+
+// -----------------------------------------------------------------
+// --------------------------- PORTFOLIO ---------------------------
+// -----------------------------------------------------------------
+
+uint64_t* allocate_solver();
+void      save_solver(uint64_t* solver);
+void      restore_solver(uint64_t* solver);
+
+uint64_t next_random();
+
+void     configure_solver(uint64_t index);
+void     share_clause(uint64_t* literals, uint64_t size);
+uint64_t import_shared_clauses();
+
+uint64_t portfolio();
+
+void init_portfolio(uint64_t solvers);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t SOLVERSIZE = 33; // number of saved solver variables, see solver struct below
+
+uint64_t CONFLICTS_PER_SLICE = 100; // conflicts before switching to the next solver
+
+uint64_t MAX_SHARED_SIZE = 2; // only learnt unit and binary clauses are shared
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t number_of_solvers = 0;
+
+// number_of_solvers pointers to solver structs
+uint64_t* sat_solvers = (uint64_t*) 0;
+
+uint64_t current_solver = 0;
+
+// state of the pseudo-random number generator
+uint64_t random_state = 0;
+
+// append-only queue of learnt clauses shared among solvers,
+// see shared clause struct below, with the index in the queue
+// from which the current solver imports clauses next
+uint64_t* shared_clauses = (uint64_t*) 0;
+
+uint64_t number_of_shared_clauses = 0;
+uint64_t shared_capacity          = 0;
+uint64_t shared_head              = 0;
+
+// portfolio statistics
+
+uint64_t number_of_imported_clauses = 0;
+
+// -----------------------------------------------------------------
+// ---------------------- INCREMENTAL SOLVER -----------------------
+// -----------------------------------------------------------------
+
+uint64_t* grow_array(uint64_t* array, uint64_t size, uint64_t capacity);
+void      grow_sat_solver();
+
+uint64_t new_sat_variable();
+void     set_decision_variable(uint64_t variable, uint64_t decision);
+void     add_sat_clause(uint64_t* literals, uint64_t size);
+uint64_t solve_under_assumption(uint64_t literal);
+
+void init_incremental_solver();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t NO_ASSUMPTION = -1;
+
+uint64_t INITIAL_VARIABLES_CAPACITY = 1024;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// number of variables the solver is allocated for
+uint64_t variables_capacity = 0;
+
+// literal assumed true as first decision, if any
+uint64_t sat_assumption = -1;
+
+// -----------------------------------------------------------------
+// ----------------------- DIMACS CNF PARSER -----------------------
+// -----------------------------------------------------------------
+
+void selfie_print_dimacs();
+
+void     dimacs_find_next_character(uint64_t new_line);
+void     dimacs_get_symbol();
+void     dimacs_word(char* word);
+uint64_t dimacs_number();
+void     dimacs_get_clause(uint64_t clause);
+void     dimacs_get_instance();
+
+void selfie_load_dimacs();
+
+void selfie_sat();
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// literals of the clause being parsed
+uint64_t* clause_buffer = (uint64_t*) 0;
+
+// clause in which a literal was most recently seen, plus 1
+uint64_t* literal_seen = (uint64_t*) 0;
+
+// -----------------------------------------------------------------
+// -------------------------- SAT Solver ---------------------------
+// -----------------------------------------------------------------
+
+// a literal of variable v (starting at 0) is encoded as 2 * v if
+// positive and as 2 * v + 1 if negative
+
+// clause struct:
+// +---+---------+
+// | 0 | size    | number of literals, 0 if deleted
+// | 1 | lbd     | number of decision levels of a learnt clause, 0 if not learnt
+// | 2 | literal | first watched literal, implied literal if reason
+// | 3 | literal | second watched literal
+// | 4 | literal | remaining literals, if any
+// | . | ...     |
+// +---+---------+
+
+// watch struct:
+// +---+---------+
+// | 0 | next    | pointer to next watch of the same literal
+// | 1 | clause  | pointer to clause watching the literal
+// | 2 | blocker | some other literal of the clause
+// +---+---------+
+
+// if the blocker is true, the clause is true and
+// need not be accessed during propagation
+
+// each clause with at least two literals has exactly two watches
+// which move between the watch lists of its first two literals,
+// watches of deleted clauses are removed during propagation
+
+uint64_t* get_next_watch(uint64_t* watch) { return (uint64_t*) *watch; }
+uint64_t* get_clause(uint64_t* watch)     { return (uint64_t*) *(watch + 1); }
+uint64_t  get_blocker(uint64_t* watch)    { return *(watch + 2); }
+
+void set_next_watch(uint64_t* watch, uint64_t* next) { *watch       = (uint64_t) next; }
+void set_clause(uint64_t* watch, uint64_t* clause)   { *(watch + 1) = (uint64_t) clause; }
+void set_blocker(uint64_t* watch, uint64_t blocker)  { *(watch + 2) = blocker; }
+
+uint64_t get_variable(uint64_t literal) {
+  return literal / 2;
+}
+
+uint64_t negate(uint64_t literal) {
+  if (literal % 2 == 0)
+    return literal + 1;
+  else
+    return literal - 1;
+}
+
+uint64_t get_literal_value(uint64_t literal) {
+  uint64_t value;
+
+  value = *(sat_assignment + get_variable(literal));
+
+  if (value == UNASSIGNED)
+    return UNASSIGNED;
+  else if (literal % 2 == 0)
+    return value;
+  else
+    return 1 - value;
+}
+
+void watch_literal(uint64_t* watch, uint64_t literal) {
+  set_next_watch(watch, (uint64_t*) *(sat_watches + literal));
+
+  *(sat_watches + literal) = (uint64_t) watch;
+}
+
+uint64_t* new_clause(uint64_t* literals, uint64_t size, uint64_t lbd) {
+  uint64_t* clause;
+  uint64_t* watch;
+  uint64_t i;
+
+  // store literals of clause in memory proportional to its size
+  clause = smalloc((size + 2) * SIZEOFUINT64);
+
+  *clause       = size;
+  *(clause + 1) = lbd;
+
+  i = 0;
+
+  while (i < size) {
+    *(clause + 2 + i) = *(literals + i);
+
+    i = i + 1;
+  }
+
+  if (size > 1) {
+    watch = smalloc(3 * SIZEOFUINT64STAR);
+
+    set_clause(watch, clause);
+    set_blocker(watch, *(clause + 3));
+    watch_literal(watch, *(clause + 2));
+
+    watch = smalloc(3 * SIZEOFUINT64STAR);
+
+    set_clause(watch, clause);
+    set_blocker(watch, *(clause + 2));
+    watch_literal(watch, *(clause + 3));
+  }
+
+  return clause;
+}
+
+void store_clause(uint64_t clause, uint64_t size) {
+  uint64_t* literals;
+
+  literals = new_clause(clause_buffer, size, 0);
+
+  *(sat_instance + clause) = (uint64_t) literals;
+
+  if (size == 0)
+    // empty clause is false
+    sat_unsat = 1;
+  else if (size == 1)
+    assert_unit_clause(*(literals + 2));
+}
+
+void assert_unit_clause(uint64_t literal) {
+  // unit clause is assigned before search
+  if (get_literal_value(literal) == FALSE)
+    sat_unsat = 1;
+  else if (get_literal_value(literal) == UNASSIGNED)
+    assign_literal(literal, (uint64_t*) 0);
+}
+
+void assign_literal(uint64_t literal, uint64_t* reason) {
+  uint64_t variable;
+
+  // assert: literal is unassigned
+  variable = get_variable(literal);
+
+  *(sat_assignment + variable) = 1 - literal % 2;
+
+  *(sat_reasons + variable) = (uint64_t) reason;
+  *(sat_levels + variable)  = decision_level;
+
+  *(sat_trail + trail_size) = literal;
+
+  trail_size = trail_size + 1;
+}
+
+void undo_assignments(uint64_t mark) {
+  uint64_t variable;
+
+  while (trail_size > mark) {
+    trail_size = trail_size - 1;
+
+    variable = get_variable(*(sat_trail + trail_size));
+
+    if (cdcl_enabled) {
+      // save value for next decision on variable
+      *(sat_phases + variable) = *(sat_assignment + variable);
+
+      heap_insert(variable);
+    }
+
+    *(sat_assignment + variable) = UNASSIGNED;
+  }
+
+  trail_head = trail_size;
+}
+
+uint64_t* propagate() {
+  uint64_t false_literal;
+  uint64_t* previous;
+  uint64_t* watch;
+  uint64_t* next;
+  uint64_t* clause;
+  uint64_t other_literal;
+  uint64_t i;
+
+  while (trail_head < trail_size) {
+    // literal that has just become false
+    false_literal = negate(*(sat_trail + trail_head));
+
+    trail_head = trail_head + 1;
+
+    number_of_propagations = number_of_propagations + 1;
+
+    previous = (uint64_t*) 0;
+
+    watch = (uint64_t*) *(sat_watches + false_literal);
+
+    while (watch != (uint64_t*) 0) {
+      next = get_next_watch(watch);
+
+      clause = get_clause(watch);
+
+      if (get_literal_value(get_blocker(watch)) == TRUE)
+        // clause is already true
+        previous = watch;
+      else if (*clause == 0) {
+        // clause is deleted, remove its watch
+        if (previous == (uint64_t*) 0)
+          *(sat_watches + false_literal) = (uint64_t) next;
+        else
+          set_next_watch(previous, next);
+      } else {
+        // make sure the false literal is the second watched literal
+        if (*(clause + 2) == false_literal) {
+          *(clause + 2) = *(clause + 3);
+          *(clause + 3) = false_literal;
+        }
+
+        other_literal = *(clause + 2);
+
+        if (get_literal_value(other_literal) != TRUE) {
+          // look for a literal that is not false to watch instead
+          i = 4;
+
+          while (i < *clause + 2) {
+            if (get_literal_value(*(clause + i)) != FALSE) {
+              *(clause + 3) = *(clause + i);
+              *(clause + i) = false_literal;
+
+              i = *clause + 3;
+            } else
+              i = i + 1;
+          }
+
+          if (i == *clause + 3) {
+            // move watch from the list of the false literal
+            // to the list of the new second watched literal
+            if (previous == (uint64_t*) 0)
+              *(sat_watches + false_literal) = (uint64_t) next;
+            else
+              set_next_watch(previous, next);
+
+            set_blocker(watch, other_literal);
+            watch_literal(watch, *(clause + 3));
+          } else if (get_literal_value(other_literal) == FALSE) {
+            // all literals are false
+            number_of_conflicts = number_of_conflicts + 1;
+
+            trail_head = trail_size;
+
+            return clause;
+          } else {
+            // clause is unit
+            assign_literal(other_literal, clause);
+
+            previous = watch;
+          }
+        } else {
+          // clause is already true
+          set_blocker(watch, other_literal);
+
+          previous = watch;
+        }
+      }
+
+      watch = next;
+    }
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t babysat(uint64_t depth) {
+  uint64_t mark;
+
+  // skip variables that are already assigned by propagation
+  while (depth < number_of_sat_variables)
+    if (*(sat_assignment + depth) != UNASSIGNED)
+      depth = depth + 1;
+    else {
+      mark = trail_size;
+
+      number_of_decisions = number_of_decisions + 1;
+
+      assign_literal(2 * depth, (uint64_t*) 0);
+
+      if (propagate() == (uint64_t*) 0) if (babysat(depth + 1) == SAT)
+        return SAT;
+
+      undo_assignments(mark);
+
+      assign_literal(2 * depth + 1, (uint64_t*) 0);
+
+      if (propagate() == (uint64_t*) 0) if (babysat(depth + 1) == SAT)
+        return SAT;
+
+      undo_assignments(mark);
+
+      return UNSAT;
+    }
+
+  return SAT;
+}
+
+void init_sat_solver() {
+  uint64_t variable;
+
+  sat_assignment = (uint64_t*) smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  variable = 0;
+
+  while (variable < number_of_sat_variables) {
+    *(sat_assignment + variable) = UNASSIGNED;
+
+    variable = variable + 1;
+  }
+
+  sat_watches = (uint64_t*) zmalloc(2 * number_of_sat_variables * SIZEOFUINT64STAR);
+
+  sat_trail = (uint64_t*) smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  trail_size = 0;
+  trail_head = 0;
+
+  sat_reasons = (uint64_t*) smalloc(number_of_sat_variables * SIZEOFUINT64STAR);
+  sat_levels  = (uint64_t*) smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  decision_level = 0;
+
+  number_of_decisions    = 0;
+  number_of_propagations = 0;
+  number_of_conflicts    = 0;
+}
+
+// -----------------------------------------------------------------
+// -------------------------- CDCL Solver --------------------------
+// -----------------------------------------------------------------
+
+uint64_t get_activity(uint64_t variable) {
+  return *(sat_activities + variable);
+}
+
+void bump_activity(uint64_t variable) {
+  uint64_t i;
+
+  *(sat_activities + variable) = get_activity(variable) + activity_increment;
+
+  if (get_activity(variable) > ACTIVITY_LIMIT) {
+    // rescale all activities, preserving their order mostly
+    i = 0;
+
+    while (i < number_of_sat_variables) {
+      *(sat_activities + i) = get_activity(i) / ACTIVITY_RESCALE;
+
+      i = i + 1;
+    }
+
+    activity_increment = activity_increment / ACTIVITY_RESCALE + 1;
+  }
+
+  if (*(heap_positions + variable) != NOT_IN_HEAP)
+    heap_percolate_up(*(heap_positions + variable));
+}
+
+void decay_activities() {
+  // instead of decreasing all activities, the increment grows
+  activity_increment = activity_increment + activity_increment / ACTIVITY_DECAY;
+}
+
+void heap_swap(uint64_t i, uint64_t j) {
+  uint64_t variable;
+
+  variable = *(sat_heap + i);
+
+  *(sat_heap + i) = *(sat_heap + j);
+  *(sat_heap + j) = variable;
+
+  *(heap_positions + *(sat_heap + i)) = i;
+  *(heap_positions + *(sat_heap + j)) = j;
+}
+
+void heap_percolate_up(uint64_t i) {
+  uint64_t parent;
+
+  while (i > 0) {
+    parent = (i - 1) / 2;
+
+    if (get_activity(*(sat_heap + i)) > get_activity(*(sat_heap + parent))) {
+      heap_swap(i, parent);
+
+      i = parent;
+    } else
+      return;
+  }
+}
+
+void heap_percolate_down(uint64_t i) {
+  uint64_t child;
+
+  // left child
+  child = 2 * i + 1;
+
+  while (child < heap_size) {
+    // choose the more active of both children
+    if (child + 1 < heap_size)
+      if (get_activity(*(sat_heap + child + 1)) > get_activity(*(sat_heap + child)))
+        child = child + 1;
+
+    if (get_activity(*(sat_heap + child)) > get_activity(*(sat_heap + i))) {
+      heap_swap(i, child);
+
+      i = child;
+
+      child = 2 * i + 1;
+    } else
+      return;
+  }
+}
+
+void heap_insert(uint64_t variable) {
+  if (*(heap_positions + variable) == NOT_IN_HEAP) {
+    *(sat_heap + heap_size)           = variable;
+    *(heap_positions + variable) = heap_size;
+
+    heap_size = heap_size + 1;
+
+    heap_percolate_up(heap_size - 1);
+  }
+}
+
+uint64_t heap_remove_max() {
+  uint64_t variable;
+
+  // assert: heap_size > 0
+  variable = *sat_heap;
+
+  heap_size = heap_size - 1;
+
+  if (heap_size > 0) {
+    heap_swap(0, heap_size);
+
+    heap_percolate_down(0);
+  }
+
+  *(heap_positions + variable) = NOT_IN_HEAP;
+
+  return variable;
+}
+
+uint64_t luby(uint64_t i) {
+  uint64_t size;
+  uint64_t exponent;
+
+  // returns the i-th element of 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...
+  // by locating i in the smallest complete subsequence containing it
+  size     = 1;
+  exponent = 0;
+
+  while (size < i + 1) {
+    size     = 2 * size + 1;
+    exponent = exponent + 1;
+  }
+
+  while (size - 1 != i) {
+    size     = (size - 1) / 2;
+    exponent = exponent - 1;
+
+    i = i % size;
+  }
+
+  return two_to_the_power_of(exponent);
+}
+
+uint64_t analyze(uint64_t* conflict) {
+  uint64_t* clause;
+  uint64_t open;
+  uint64_t index;
+  uint64_t literal;
+  uint64_t variable;
+  uint64_t i;
+  uint64_t j;
+  uint64_t level;
+
+  // resolve the conflict clause with the reasons of literals assigned
+  // at the current decision level in reverse order of assignment until
+  // a single literal of the current level remains, the first UIP
+
+  // slot 0 is reserved for the negation of the first UIP
+  learnt_size = 1;
+
+  open  = 0;
+  index = trail_size;
+
+  clause = conflict;
+
+  // reason clauses imply their first literal which is skipped
+  i = 0;
+
+  while (1) {
+    while (i < *clause) {
+      literal  = *(clause + 2 + i);
+      variable = get_variable(literal);
+
+      if (*(sat_seen + variable) == 0)
+        if (*(sat_levels + variable) > 0) {
+          *(sat_seen + variable) = 1;
+
+          bump_activity(variable);
+
+          if (*(sat_levels + variable) == decision_level)
+            open = open + 1;
+          else {
+            *(learnt_buffer + learnt_size) = literal;
+
+            learnt_size = learnt_size + 1;
+          }
+        }
+
+      i = i + 1;
+    }
+
+    // find the most recently assigned literal that has been seen
+    index = index - 1;
+
+    while (*(sat_seen + get_variable(*(sat_trail + index))) == 0)
+      index = index - 1;
+
+    literal  = *(sat_trail + index);
+    variable = get_variable(literal);
+
+    *(sat_seen + variable) = 0;
+
+    open = open - 1;
+
+    if (open == 0) {
+      *learnt_buffer = negate(literal);
+
+      // remove literals implied by other literals of the learnt clause,
+      // keeping the original clause in analyze_buffer to clear sat_seen
+      i = 1;
+      j = 1;
+
+      while (i < learnt_size) {
+        literal = *(learnt_buffer + i);
+
+        *(analyze_buffer + i) = literal;
+
+        if (is_redundant(literal) == 0) {
+          *(learnt_buffer + j) = literal;
+
+          j = j + 1;
+        }
+
+        i = i + 1;
+      }
+
+      i = 1;
+
+      while (i < learnt_size) {
+        *(sat_seen + get_variable(*(analyze_buffer + i))) = 0;
+
+        i = i + 1;
+      }
+
+      number_of_learnt_literals = number_of_learnt_literals + j;
+
+      learnt_size = j;
+
+      // the second literal has the highest decision level below
+      // the current level and determines where to backjump to
+      level = 0;
+
+      i = 1;
+      j = 1;
+
+      while (i < learnt_size) {
+        if (*(sat_levels + get_variable(*(learnt_buffer + i))) > level) {
+          level = *(sat_levels + get_variable(*(learnt_buffer + i)));
+
+          j = i;
+        }
+
+        i = i + 1;
+      }
+
+      literal = *(learnt_buffer + 1);
+
+      *(learnt_buffer + 1) = *(learnt_buffer + j);
+      *(learnt_buffer + j) = literal;
+
+      return level;
+    }
+
+    clause = (uint64_t*) *(sat_reasons + variable);
+
+    i = 1;
+  }
+}
+
+uint64_t is_redundant(uint64_t literal) {
+  uint64_t* reason;
+  uint64_t variable;
+  uint64_t i;
+
+  // a literal is redundant if it is implied by a reason whose
+  // other literals are all in the learnt clause or at level 0
+  reason = (uint64_t*) *(sat_reasons + get_variable(literal));
+
+  if (reason == (uint64_t*) 0)
+    return 0;
+
+  i = 1;
+
+  while (i < *reason) {
+    variable = get_variable(*(reason + 2 + i));
+
+    if (*(sat_seen + variable) == 0)
+      if (*(sat_levels + variable) > 0)
+        return 0;
+
+    i = i + 1;
+  }
+
+  return 1;
+}
+
+void backjump(uint64_t level) {
+  if (decision_level > level) {
+    undo_assignments(*(level_starts + level + 1));
+
+    decision_level = level;
+  }
+}
+
+void learn_clause() {
+  uint64_t* clause;
+  uint64_t lbd;
+  uint64_t i;
+  uint64_t level;
+  uint64_t* learnts;
+
+  if (number_of_solvers > 1)
+    if (learnt_size <= MAX_SHARED_SIZE)
+      share_clause(learnt_buffer, learnt_size);
+
+  if (learnt_size == 1) {
+    // learnt unit clauses are assigned at level 0 without reason
+    assign_literal(*learnt_buffer, (uint64_t*) 0);
+
+    return;
+  }
+
+  // literal block distance: number of different decision levels
+  lbd = 0;
+
+  i = 0;
+
+  while (i < learnt_size) {
+    level = *(sat_levels + get_variable(*(learnt_buffer + i)));
+
+    if (*(level_stamps + level) != number_of_conflicts) {
+      *(level_stamps + level) = number_of_conflicts;
+
+      lbd = lbd + 1;
+    }
+
+    i = i + 1;
+  }
+
+  clause = new_clause(learnt_buffer, learnt_size, lbd);
+
+  if (number_of_learnts == learnts_capacity) {
+    // double capacity of array of learnt clauses
+    learnts_capacity = 2 * learnts_capacity;
+
+    learnts = smalloc(learnts_capacity * SIZEOFUINT64STAR);
+
+    i = 0;
+
+    while (i < number_of_learnts) {
+      *(learnts + i) = *(sat_learnts + i);
+
+      i = i + 1;
+    }
+
+    sat_learnts = learnts;
+  }
+
+  *(sat_learnts + number_of_learnts) = (uint64_t) clause;
+
+  number_of_learnts = number_of_learnts + 1;
+
+  number_of_learnt_clauses = number_of_learnt_clauses + 1;
+
+  assign_literal(*learnt_buffer, clause);
+}
+
+uint64_t is_locked(uint64_t* clause) {
+  // a clause is locked if it is the reason of an assignment
+  if (get_literal_value(*(clause + 2)) == TRUE)
+    if (*(sat_reasons + get_variable(*(clause + 2))) == (uint64_t) clause)
+      return 1;
+
+  return 0;
+}
+
+void reduce_learnt_clauses() {
+  uint64_t* quotas;
+  uint64_t* clause;
+  uint64_t lbd;
+  uint64_t deletions;
+  uint64_t i;
+  uint64_t j;
+
+  // delete about half of the learnt clauses, those with highest LBD,
+  // except clauses that are locked or have LBD 2 or less (glue clauses)
+  quotas = zmalloc((MAX_LBD + 1) * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < number_of_learnts) {
+    lbd = *((uint64_t*) *(sat_learnts + i) + 1);
+
+    if (lbd > MAX_LBD)
+      lbd = MAX_LBD;
+
+    *(quotas + lbd) = *(quotas + lbd) + 1;
+
+    i = i + 1;
+  }
+
+  // turn numbers of clauses per LBD into numbers of
+  // clauses per LBD to delete, highest LBD first
+  deletions = number_of_learnts / 2;
+
+  lbd = MAX_LBD;
+
+  while (lbd > 2) {
+    if (*(quotas + lbd) > deletions)
+      *(quotas + lbd) = deletions;
+
+    deletions = deletions - *(quotas + lbd);
+
+    lbd = lbd - 1;
+  }
+
+  i = 0;
+  j = 0;
+
+  while (i < number_of_learnts) {
+    clause = (uint64_t*) *(sat_learnts + i);
+
+    lbd = *(clause + 1);
+
+    if (lbd > MAX_LBD)
+      lbd = MAX_LBD;
+
+    if (lbd > 2)
+      if (*(quotas + lbd) > 0)
+        if (is_locked(clause) == 0) {
+          // watches are removed lazily during propagation
+          *clause = 0;
+
+          *(quotas + lbd) = *(quotas + lbd) - 1;
+
+          number_of_deleted_clauses = number_of_deleted_clauses + 1;
+        }
+
+    if (*clause != 0) {
+      *(sat_learnts + j) = (uint64_t) clause;
+
+      j = j + 1;
+    }
+
+    i = i + 1;
+  }
+
+  number_of_learnts = j;
+
+  max_learnts = max_learnts + max_learnts / 10;
+}
+
+uint64_t pick_branching_literal() {
+  uint64_t variable;
+
+  while (heap_size > 0) {
+    variable = heap_remove_max();
+
+    if (*(sat_assignment + variable) == UNASSIGNED)
+      if (*(sat_decisions + variable)) {
+        if (*(sat_phases + variable) == TRUE)
+          return 2 * variable;
+        else
+          return 2 * variable + 1;
+      }
+  }
+
+  // all decision variables are assigned
+  return 2 * number_of_sat_variables;
+}
+
+uint64_t cdcl() {
+  uint64_t* conflict;
+  uint64_t literal;
+
+  // search resumes where it returned UNKNOWN most recently
+  while (1) {
+    conflict = propagate();
+
+    if (conflict != (uint64_t*) 0) {
+      if (decision_level == 0) {
+        // unsatisfiable without any decisions, including assumptions
+        sat_unsat = 1;
+
+        return UNSAT;
+      }
+
+      backjump(analyze(conflict));
+
+      learn_clause();
+
+      decay_activities();
+
+      if (conflicts_until_restart > 0)
+        conflicts_until_restart = conflicts_until_restart - 1;
+
+      if (conflict_budget > 0)
+        conflict_budget = conflict_budget - 1;
+    } else if (conflict_budget == 0)
+      return UNKNOWN;
+    else if (conflicts_until_restart == 0) {
+      backjump(0);
+
+      number_of_restarts = number_of_restarts + 1;
+
+      conflicts_until_restart = luby(number_of_restarts) * restart_interval;
+
+      if (number_of_solvers > 1)
+        // clauses shared by other solvers are added at level 0
+        if (import_shared_clauses() == UNSAT)
+          return UNSAT;
+    } else {
+      if (number_of_learnts >= max_learnts + trail_size)
+        reduce_learnt_clauses();
+
+      literal = NO_ASSUMPTION;
+
+      // the assumption, if any, is the first decision
+      if (decision_level == 0)
+        if (sat_assumption != NO_ASSUMPTION) {
+          if (get_literal_value(sat_assumption) == FALSE)
+            // clauses learnt so far refute the assumption
+            return UNSAT;
+          else if (get_literal_value(sat_assumption) == UNASSIGNED)
+            literal = sat_assumption;
+        }
+
+      if (literal == NO_ASSUMPTION) {
+        literal = pick_branching_literal();
+
+        if (literal == 2 * number_of_sat_variables)
+          return SAT;
+      }
+
+      decision_level = decision_level + 1;
+
+      *(level_starts + decision_level) = trail_size;
+
+      number_of_decisions = number_of_decisions + 1;
+
+      assign_literal(literal, (uint64_t*) 0);
+    }
+  }
+}
+
+void init_cdcl() {
+  uint64_t variable;
+
+  cdcl_enabled = 1;
+
+  sat_activities = zmalloc(number_of_sat_variables * SIZEOFUINT64);
+  sat_phases     = zmalloc(number_of_sat_variables * SIZEOFUINT64);
+  sat_decisions  = smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  activity_increment = ACTIVITY_INCREMENT;
+
+  sat_heap       = smalloc(number_of_sat_variables * SIZEOFUINT64);
+  heap_positions = smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  heap_size = 0;
+
+  variable = 0;
+
+  while (variable < number_of_sat_variables) {
+    *(sat_decisions + variable)  = 1;
+    *(heap_positions + variable) = NOT_IN_HEAP;
+
+    // variables assigned at level 0 never need a decision
+    if (*(sat_assignment + variable) == UNASSIGNED)
+      heap_insert(variable);
+
+    variable = variable + 1;
+  }
+
+  level_starts = smalloc((number_of_sat_variables + 1) * SIZEOFUINT64);
+
+  sat_seen       = zmalloc(number_of_sat_variables * SIZEOFUINT64);
+  learnt_buffer  = smalloc(number_of_sat_variables * SIZEOFUINT64);
+  analyze_buffer = smalloc(number_of_sat_variables * SIZEOFUINT64);
+
+  // conflicts are counted from 1, so stamps of 0 are outdated
+  level_stamps = zmalloc((number_of_sat_variables + 1) * SIZEOFUINT64);
+
+  learnts_capacity = MIN_LEARNT_CLAUSES;
+
+  sat_learnts = smalloc(learnts_capacity * SIZEOFUINT64STAR);
+
+  max_learnts = max(number_of_sat_clauses / 3, MIN_LEARNT_CLAUSES);
+
+  number_of_learnts = 0;
+
+  restart_interval = RESTART_INTERVAL;
+
+  number_of_restarts = 0;
+
+  conflicts_until_restart = luby(number_of_restarts) * restart_interval;
+
+  number_of_learnt_clauses  = 0;
+  number_of_learnt_literals = 0;
+  number_of_deleted_clauses = 0;
+}
+
+// -----------------------------------------------------------------
+// --------------------------- PORTFOLIO ---------------------------
+// -----------------------------------------------------------------
+
+// solver struct:
+// +----+----------------------------+
+// |  0 | sat_assignment             |
+// |  1 | sat_watches                |
+// |  2 | sat_trail                  |
+// |  3 | trail_size                 |
+// |  4 | trail_head                 |
+// |  5 | sat_reasons                |
+// |  6 | sat_levels                 |
+// |  7 | decision_level             |
+// |  8 | number_of_decisions        |
+// |  9 | number_of_propagations     |
+// | 10 | number_of_conflicts        |
+// | 11 | sat_activities             |
+// | 12 | sat_phases                 |
+// | 13 | activity_increment         |
+// | 14 | sat_heap                   |
+// | 15 | heap_positions             |
+// | 16 | heap_size                  |
+// | 17 | level_starts               |
+// | 18 | sat_seen                   |
+// | 19 | learnt_buffer              |
+// | 20 | level_stamps               |
+// | 21 | analyze_buffer             |
+// | 22 | sat_learnts                |
+// | 23 | number_of_learnts          |
+// | 24 | learnts_capacity           |
+// | 25 | max_learnts                |
+// | 26 | restart_interval           |
+// | 27 | conflicts_until_restart    |
+// | 28 | number_of_restarts         |
+// | 29 | number_of_learnt_clauses   |
+// | 30 | number_of_learnt_literals  |
+// | 31 | number_of_deleted_clauses  |
+// | 32 | shared_head                |
+// +----+----------------------------+
+
+// solvers share the clauses of the instance in sat_instance
+// which are copied by each solver except the first one, and
+// the learnt clauses in the shared clause queue
+
+// shared clause struct:
+// +---+----------+
+// | 0 | solver   | index of solver that learnt the clause
+// | 1 | size     | number of literals, at most MAX_SHARED_SIZE
+// | 2 | literals | MAX_SHARED_SIZE literals
+// | . | ...      |
+// +---+----------+
+
+uint64_t* allocate_solver() {
+  return smalloc(SOLVERSIZE * SIZEOFUINT64);
+}
+
+void save_solver(uint64_t* solver) {
+  *solver        = (uint64_t) sat_assignment;
+  *(solver + 1)  = (uint64_t) sat_watches;
+  *(solver + 2)  = (uint64_t) sat_trail;
+  *(solver + 3)  = trail_size;
+  *(solver + 4)  = trail_head;
+  *(solver + 5)  = (uint64_t) sat_reasons;
+  *(solver + 6)  = (uint64_t) sat_levels;
+  *(solver + 7)  = decision_level;
+  *(solver + 8)  = number_of_decisions;
+  *(solver + 9)  = number_of_propagations;
+  *(solver + 10) = number_of_conflicts;
+  *(solver + 11) = (uint64_t) sat_activities;
+  *(solver + 12) = (uint64_t) sat_phases;
+  *(solver + 13) = activity_increment;
+  *(solver + 14) = (uint64_t) sat_heap;
+  *(solver + 15) = (uint64_t) heap_positions;
+  *(solver + 16) = heap_size;
+  *(solver + 17) = (uint64_t) level_starts;
+  *(solver + 18) = (uint64_t) sat_seen;
+  *(solver + 19) = (uint64_t) learnt_buffer;
+  *(solver + 20) = (uint64_t) level_stamps;
+  *(solver + 21) = (uint64_t) analyze_buffer;
+  *(solver + 22) = (uint64_t) sat_learnts;
+  *(solver + 23) = number_of_learnts;
+  *(solver + 24) = learnts_capacity;
+  *(solver + 25) = max_learnts;
+  *(solver + 26) = restart_interval;
+  *(solver + 27) = conflicts_until_restart;
+  *(solver + 28) = number_of_restarts;
+  *(solver + 29) = number_of_learnt_clauses;
+  *(solver + 30) = number_of_learnt_literals;
+  *(solver + 31) = number_of_deleted_clauses;
+  *(solver + 32) = shared_head;
+}
+
+void restore_solver(uint64_t* solver) {
+  sat_assignment            = (uint64_t*) *solver;
+  sat_watches               = (uint64_t*) *(solver + 1);
+  sat_trail                 = (uint64_t*) *(solver + 2);
+  trail_size                = *(solver + 3);
+  trail_head                = *(solver + 4);
+  sat_reasons               = (uint64_t*) *(solver + 5);
+  sat_levels                = (uint64_t*) *(solver + 6);
+  decision_level            = *(solver + 7);
+  number_of_decisions       = *(solver + 8);
+  number_of_propagations    = *(solver + 9);
+  number_of_conflicts       = *(solver + 10);
+  sat_activities            = (uint64_t*) *(solver + 11);
+  sat_phases                = (uint64_t*) *(solver + 12);
+  activity_increment        = *(solver + 13);
+  sat_heap                  = (uint64_t*) *(solver + 14);
+  heap_positions            = (uint64_t*) *(solver + 15);
+  heap_size                 = *(solver + 16);
+  level_starts              = (uint64_t*) *(solver + 17);
+  sat_seen                  = (uint64_t*) *(solver + 18);
+  learnt_buffer             = (uint64_t*) *(solver + 19);
+  level_stamps              = (uint64_t*) *(solver + 20);
+  analyze_buffer            = (uint64_t*) *(solver + 21);
+  sat_learnts               = (uint64_t*) *(solver + 22);
+  number_of_learnts         = *(solver + 23);
+  learnts_capacity          = *(solver + 24);
+  max_learnts               = *(solver + 25);
+  restart_interval          = *(solver + 26);
+  conflicts_until_restart   = *(solver + 27);
+  number_of_restarts        = *(solver + 28);
+  number_of_learnt_clauses  = *(solver + 29);
+  number_of_learnt_literals = *(solver + 30);
+  number_of_deleted_clauses = *(solver + 31);
+  shared_head               = *(solver + 32);
+}
+
+uint64_t next_random() {
+  // linear congruential generator with Knuth's MMIX constants,
+  // using the more random upper 32 bits
+  random_state = random_state * 6364136223846793005 + 1442695040888963407;
+
+  return right_shift(random_state, 32);
+}
+
+void configure_solver(uint64_t index) {
+  uint64_t variable;
+  uint64_t i;
+
+  // the first solver uses the default configuration,
+  // the others differ in restart interval, initial
+  // values, and initial order of decisions
+  restart_interval = RESTART_INTERVAL + RESTART_INTERVAL / 2 * (index % 3);
+
+  random_state = index;
+
+  variable = 0;
+
+  while (variable < number_of_sat_variables) {
+    // initial activities are below the first increment
+    *(sat_activities + variable) = next_random() % ACTIVITY_INCREMENT;
+
+    if (index % 2 == 1)
+      *(sat_phases + variable) = TRUE;
+    else if (index % 4 == 2)
+      *(sat_phases + variable) = next_random() % 2;
+
+    variable = variable + 1;
+  }
+
+  // restore heap order by inserting variables one by one
+  i = 0;
+
+  while (i < heap_size) {
+    heap_percolate_up(i);
+
+    i = i + 1;
+  }
+
+  conflicts_until_restart = luby(number_of_restarts) * restart_interval;
+}
+
+void share_clause(uint64_t* literals, uint64_t size) {
+  uint64_t* clauses;
+  uint64_t* clause;
+  uint64_t i;
+
+  if (number_of_shared_clauses == shared_capacity) {
+    // double capacity of shared clause queue
+    shared_capacity = 2 * shared_capacity;
+
+    clauses = smalloc(shared_capacity * (2 + MAX_SHARED_SIZE) * SIZEOFUINT64);
+
+    i = 0;
+
+    while (i < number_of_shared_clauses * (2 + MAX_SHARED_SIZE)) {
+      *(clauses + i) = *(shared_clauses + i);
+
+      i = i + 1;
+    }
+
+    shared_clauses = clauses;
+  }
+
+  clause = shared_clauses + number_of_shared_clauses * (2 + MAX_SHARED_SIZE);
+
+  *clause       = current_solver;
+  *(clause + 1) = size;
+
+  i = 0;
+
+  while (i < size) {
+    *(clause + 2 + i) = *(literals + i);
+
+    i = i + 1;
+  }
+
+  number_of_shared_clauses = number_of_shared_clauses + 1;
+}
+
+uint64_t import_shared_clauses() {
+  uint64_t* clause;
+  uint64_t first;
+  uint64_t second;
+
+  // assert: decision_level == 0 and no conflict at level 0
+  while (shared_head < number_of_shared_clauses) {
+    clause = shared_clauses + shared_head * (2 + MAX_SHARED_SIZE);
+
+    shared_head = shared_head + 1;
+
+    if (*clause != current_solver) {
+      number_of_imported_clauses = number_of_imported_clauses + 1;
+
+      first = *(clause + 2);
+
+      if (*(clause + 1) == 1) {
+        if (get_literal_value(first) == FALSE)
+          return UNSAT;
+        else if (get_literal_value(first) == UNASSIGNED)
+          assign_literal(first, (uint64_t*) 0);
+      } else {
+        second = *(clause + 3);
+
+        // clauses that are true at level 0 are ignored
+        if (get_literal_value(first) == FALSE) {
+          if (get_literal_value(second) == FALSE)
+            return UNSAT;
+          else if (get_literal_value(second) == UNASSIGNED)
+            assign_literal(second, (uint64_t*) 0);
+        } else if (get_literal_value(first) == UNASSIGNED) {
+          if (get_literal_value(second) == FALSE)
+            assign_literal(first, (uint64_t*) 0);
+          else if (get_literal_value(second) == UNASSIGNED)
+            new_clause(clause + 2, 2, 2);
+        }
+      }
+    }
+  }
+
+  return UNKNOWN;
+}
+
+uint64_t portfolio() {
+  uint64_t result;
+
+  // solvers take turns, each until it encounters a number of
+  // conflicts, and the first solver that finishes wins
+  while (1) {
+    current_solver = 0;
+
+    while (current_solver < number_of_solvers) {
+      restore_solver((uint64_t*) *(sat_solvers + current_solver));
+
+      conflict_budget = CONFLICTS_PER_SLICE;
+
+      result = cdcl();
+
+      save_solver((uint64_t*) *(sat_solvers + current_solver));
+
+      if (result != UNKNOWN)
+        return result;
+
+      current_solver = current_solver + 1;
+    }
+  }
+}
+
+void init_portfolio(uint64_t solvers) {
+  uint64_t* clause;
+  uint64_t i;
+
+  number_of_solvers = solvers;
+
+  sat_solvers = smalloc(number_of_solvers * SIZEOFUINT64STAR);
+
+  shared_capacity = MIN_LEARNT_CLAUSES;
+
+  shared_clauses = smalloc(shared_capacity * (2 + MAX_SHARED_SIZE) * SIZEOFUINT64);
+
+  // the first solver works on the instance as loaded
+  init_cdcl();
+
+  *sat_solvers = (uint64_t) allocate_solver();
+
+  save_solver((uint64_t*) *sat_solvers);
+
+  current_solver = 1;
+
+  while (current_solver < number_of_solvers) {
+    init_sat_solver();
+
+    i = 0;
+
+    while (i < number_of_sat_clauses) {
+      clause = (uint64_t*) *(sat_instance + i);
+
+      // assert: instance contains no empty clauses
+      clause = new_clause(clause + 2, *clause, 0);
+
+      if (*clause == 1)
+        assert_unit_clause(*(clause + 2));
+
+      i = i + 1;
+    }
+
+    init_cdcl();
+
+    configure_solver(current_solver);
+
+    *(sat_solvers + current_solver) = (uint64_t) allocate_solver();
+
+    save_solver((uint64_t*) *(sat_solvers + current_solver));
+
+    current_solver = current_solver + 1;
+  }
+}
+
+// -----------------------------------------------------------------
+// ---------------------- INCREMENTAL SOLVER -----------------------
+// -----------------------------------------------------------------
+
+uint64_t* grow_array(uint64_t* array, uint64_t size, uint64_t capacity) {
+  uint64_t* grown;
+  uint64_t i;
+
+  grown = zmalloc(capacity * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < size) {
+    *(grown + i) = *(array + i);
+
+    i = i + 1;
+  }
+
+  return grown;
+}
+
+void grow_sat_solver() {
+  uint64_t capacity;
+  uint64_t variable;
+
+  // double capacity of all arrays indexed by variables or literals
+  capacity = 2 * variables_capacity;
+
+  sat_assignment = grow_array(sat_assignment, variables_capacity, capacity);
+  sat_watches    = grow_array(sat_watches, 2 * variables_capacity, 2 * capacity);
+  sat_trail      = grow_array(sat_trail, variables_capacity, capacity);
+  sat_reasons    = grow_array(sat_reasons, variables_capacity, capacity);
+  sat_levels     = grow_array(sat_levels, variables_capacity, capacity);
+
+  sat_activities = grow_array(sat_activities, variables_capacity, capacity);
+  sat_phases     = grow_array(sat_phases, variables_capacity, capacity);
+  sat_decisions  = grow_array(sat_decisions, variables_capacity, capacity);
+  sat_heap       = grow_array(sat_heap, variables_capacity, capacity);
+  heap_positions = grow_array(heap_positions, variables_capacity, capacity);
+  level_starts   = grow_array(level_starts, variables_capacity + 1, capacity + 1);
+  sat_seen       = grow_array(sat_seen, variables_capacity, capacity);
+  learnt_buffer  = grow_array(learnt_buffer, variables_capacity, capacity);
+  analyze_buffer = grow_array(analyze_buffer, variables_capacity, capacity);
+  level_stamps   = grow_array(level_stamps, variables_capacity + 1, capacity + 1);
+
+  variable = variables_capacity;
+
+  while (variable < capacity) {
+    *(sat_assignment + variable) = UNASSIGNED;
+
+    variable = variable + 1;
+  }
+
+  variables_capacity = capacity;
+}
+
+uint64_t new_sat_variable() {
+  uint64_t variable;
+
+  if (number_of_sat_variables == variables_capacity)
+    grow_sat_solver();
+
+  variable = number_of_sat_variables;
+
+  number_of_sat_variables = number_of_sat_variables + 1;
+
+  // assert: variable is unassigned, has no watches, and is not seen
+  *(sat_activities + variable) = 0;
+  *(sat_phases + variable)     = FALSE;
+  *(sat_decisions + variable)  = 1;
+  *(heap_positions + variable) = NOT_IN_HEAP;
+
+  heap_insert(variable);
+
+  return variable;
+}
+
+void set_decision_variable(uint64_t variable, uint64_t decision) {
+  // a model is found when all decision variables are assigned,
+  // which is only sound if the clauses over the decision variables
+  // determine the values of all other variables, as in circuits
+  *(sat_decisions + variable) = decision;
+
+  // variables are removed from the heap lazily by pick_branching_literal
+  if (decision)
+    if (*(sat_assignment + variable) == UNASSIGNED)
+      heap_insert(variable);
+}
+
+void add_sat_clause(uint64_t* literals, uint64_t size) {
+  uint64_t i;
+  uint64_t j;
+
+  // clauses are added at level 0 where some literals may be
+  // assigned already: true literals satisfy the clause,
+  // false literals are removed from the clause
+  backjump(0);
+
+  i = 0;
+  j = 0;
+
+  while (i < size) {
+    if (get_literal_value(*(literals + i)) == TRUE)
+      return;
+    else if (get_literal_value(*(literals + i)) == UNASSIGNED) {
+      *(literals + j) = *(literals + i);
+
+      j = j + 1;
+    }
+
+    i = i + 1;
+  }
+
+  number_of_sat_clauses = number_of_sat_clauses + 1;
+
+  if (j == 0)
+    // empty clause is false
+    sat_unsat = 1;
+  else if (j == 1)
+    assign_literal(*literals, (uint64_t*) 0);
+  else
+    // assert: literals are unassigned and different
+    new_clause(literals, j, 0);
+}
+
+uint64_t solve_under_assumption(uint64_t literal) {
+  uint64_t result;
+
+  if (sat_unsat)
+    return UNSAT;
+
+  // the model of the previous call, if any, is discarded
+  backjump(0);
+
+  sat_assumption = literal;
+
+  result = cdcl();
+
+  sat_assumption = NO_ASSUMPTION;
+
+  return result;
+}
+
+void init_incremental_solver() {
+  // allocate the solver for an initial number of variables
+  // which grows as new variables are added
+  number_of_sat_variables = INITIAL_VARIABLES_CAPACITY;
+  number_of_sat_clauses   = 0;
+
+  init_sat_solver();
+  init_cdcl();
+
+  variables_capacity = number_of_sat_variables;
+
+  number_of_sat_variables = 0;
+
+  heap_size = 0;
+
+  sat_unsat = 0;
+}
+
+// -----------------------------------------------------------------
+// ----------------------- DIMACS CNF PARSER -----------------------
+// -----------------------------------------------------------------
+
+void selfie_print_dimacs() {
+  uint64_t clause;
+  uint64_t* literals;
+  uint64_t i;
+
+  printf("p cnf %lu %lu\n", number_of_sat_variables, number_of_sat_clauses);
+
+  clause = 0;
+
+  while (clause < number_of_sat_clauses) {
+    literals = (uint64_t*) *(sat_instance + clause);
+
+    i = 0;
+
+    while (i < *literals) {
+      if (*(literals + 2 + i) % 2 == 0)
+        print_integer(get_variable(*(literals + 2 + i)) + 1);
+      else
+        print_integer(-(get_variable(*(literals + 2 + i)) + 1));
+
+      print(" ");
+
+      i = i + 1;
+    }
+
+    print("0\n");
+
+    clause = clause + 1;
+  }
+}
+
+void dimacs_find_next_character(uint64_t new_line) {
+  uint64_t in_comment;
+
+  // assuming we are not in a comment
+  in_comment = 0;
+
+  // read and discard all whitespace and comments until a character is found
+  // that is not whitespace and does not occur in a comment, or the file ends
+  while (1) {
+    if (in_comment) {
+      get_character();
+
+      if (is_character_new_line())
+        // comments end with new line
+        in_comment = 0;
+      else if (character == CHAR_EOF)
+        return;
+      else
+        // count the characters in comments as ignored characters
+        // line feed and carriage return are counted below
+        number_of_ignored_characters = number_of_ignored_characters + 1;
+    } else if (new_line) {
+      new_line = 0;
+
+      if (character == 'c') {
+        // 'c' at beginning of a line begins a comment
+        in_comment = 1;
+
+        // count the number of comments
+        number_of_comments = number_of_comments + 1;
+      }
+    } else if (is_character_whitespace()) {
+      if (is_character_new_line())
+        new_line = 1;
+      else
+        new_line = 0;
+
+      // count whitespace as ignored characters
+      number_of_ignored_characters = number_of_ignored_characters + 1;
+
+      get_character();
+    } else
+      // character found that is not whitespace and not occurring in a comment
+      return;
+  }
+}
+
+void dimacs_get_symbol() {
+  dimacs_find_next_character(0);
+
+  get_symbol();
+}
+
+void dimacs_word(char* word) {
+  if (symbol == SYM_IDENTIFIER) {
+    if (string_compare(identifier, word)) {
+      dimacs_get_symbol();
+
+      return;
+    } else
+      syntax_error_unexpected_identifier(word);
+  } else
+    syntax_error_symbol(SYM_IDENTIFIER);
+
+  exit(EXITCODE_PARSERERROR);
+}
+
+uint64_t dimacs_number() {
+  uint64_t number;
+
+  if (symbol == SYM_INTEGER) {
+    number = literal;
+
+    dimacs_get_symbol();
+
+    return number;
+  } else
+    syntax_error_symbol(SYM_INTEGER);
+
+  exit(EXITCODE_PARSERERROR);
+}
+
+void dimacs_get_clause(uint64_t clause) {
+  uint64_t not;
+  uint64_t size;
+
+  size = 0;
+
+  while (1) {
+    not = 0;
+
+    if (symbol == SYM_MINUS) {
+      not = 1;
+
+      dimacs_get_symbol();
+    }
+
+    if (symbol == SYM_INTEGER) {
+      if (literal == 0) {
+        dimacs_get_symbol();
+
+        store_clause(clause, size);
+
+        return;
+      } else if (literal > number_of_sat_variables) {
+        syntax_error_message("clause exceeds declared number of variables");
+
+        exit(EXITCODE_PARSERERROR);
+      }
+
+      // literal encoding starts at 0
+      literal = 2 * (literal - 1) + not;
+
+      // ignore repeated occurrences of a literal in a clause
+      if (*(literal_seen + literal) != clause + 1) {
+        *(literal_seen + literal) = clause + 1;
+
+        *(clause_buffer + size) = literal;
+
+        size = size + 1;
+      }
+    } else if (symbol == SYM_EOF) {
+      store_clause(clause, size);
+
+      return;
+    } else
+      syntax_error_symbol(SYM_INTEGER);
+
+    dimacs_get_symbol();
+  }
+}
+
+void dimacs_get_instance() {
+  uint64_t clauses;
+
+  clauses = 0;
+
+  while (clauses < number_of_sat_clauses)
+    if (symbol != SYM_EOF) {
+      dimacs_get_clause(clauses);
+
+      clauses = clauses + 1;
+    } else {
+      syntax_error_message("instance has fewer clauses than declared");
+
+      exit(EXITCODE_PARSERERROR);
+    }
+
+  if (symbol != SYM_EOF) {
+    syntax_error_message("instance has more clauses than declared");
+
+    exit(EXITCODE_PARSERERROR);
+  }
+}
+
+void selfie_load_dimacs() {
+  source_name = get_argument();
+
+  printf("%s: babysat loading SAT instance %s\n", selfie_name, source_name);
+
+  // assert: source_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  source_fd = open_read_only(source_name);
+
+  if (signed_less_than(source_fd, 0)) {
+    printf("%s: could not open input file %s\n", selfie_name, source_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  reset_scanner();
+
+  // ignore all comments before problem
+  dimacs_find_next_character(1);
+
+  dimacs_get_symbol();
+
+  dimacs_word("p");
+  dimacs_word("cnf");
+
+  number_of_sat_variables = dimacs_number();
+
+  init_sat_solver();
+
+  clause_buffer = (uint64_t*) smalloc(2 * number_of_sat_variables * SIZEOFUINT64);
+  literal_seen  = (uint64_t*) zmalloc(2 * number_of_sat_variables * SIZEOFUINT64);
+
+  number_of_sat_clauses = dimacs_number();
+
+  sat_instance = (uint64_t*) smalloc(number_of_sat_clauses * SIZEOFUINT64STAR);
+
+  dimacs_get_instance();
+
+  printf("%s: %lu clauses with %lu declared variables loaded from %s\n", selfie_name,
+    number_of_sat_clauses,
+    number_of_sat_variables,
+    source_name);
+
+  dimacs_name = source_name;
+}
+
+void selfie_sat() {
+  uint64_t start;
+  uint64_t time;
+  uint64_t variable;
+  uint64_t result;
+  uint64_t conflicts;
+
+  init_scanner();
+
+  selfie_load_dimacs();
+
+  if (dimacs_name == (char*) 0) {
+    printf("%s: nothing to SAT solve\n", selfie_name);
+
+    return;
+  }
+
+  if (number_of_remaining_arguments() > 0) {
+    if (string_compare(peek_argument(0), "--cdcl")) {
+      get_argument();
+
+      init_cdcl();
+    } else if (string_compare(peek_argument(0), "--portfolio")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() > 0)
+        if (atoi(peek_argument(0)) > 0)
+          init_portfolio(atoi(get_argument()));
+
+      if (number_of_solvers == 0) {
+        printf("%s: number of solvers missing after --portfolio\n", selfie_name);
+
+        exit(EXITCODE_BADARGUMENTS);
+      }
+    }
+  }
+
+  selfie_print_dimacs();
+
+  start = read_clock(CLOCK_MONOTONIC);
+
+  result = UNSAT;
+
+  if (sat_unsat == 0) {
+    if (number_of_solvers > 0)
+      result = portfolio();
+    else if (cdcl_enabled)
+      result = cdcl();
+    else if (propagate() == (uint64_t*) 0)
+      // unit clauses are assigned at the bottom of the search
+      result = babysat(0);
+  }
+
+  // wall-clock time in microseconds, at least 1
+  time = (read_clock(CLOCK_MONOTONIC) - start) / 1000 + 1;
+
+  printf("%s: %lu decisions, %lu conflicts, %lu propagations (%lu per second) in %lu.%.3lu milliseconds\n", selfie_name,
+    number_of_decisions,
+    number_of_conflicts,
+    number_of_propagations,
+    number_of_propagations * 1000000 / time,
+    time / 1000,
+    time % 1000);
+
+  if (cdcl_enabled)
+    printf("%s: %lu restarts, %lu learnt clauses with %lu literals, %lu learnt clauses deleted\n", selfie_name,
+      number_of_restarts,
+      number_of_learnt_clauses,
+      number_of_learnt_literals,
+      number_of_deleted_clauses);
+
+  if (number_of_solvers > 0) {
+    conflicts = 0;
+
+    variable = 0;
+
+    while (variable < number_of_solvers) {
+      conflicts = conflicts + *((uint64_t*) *(sat_solvers + variable) + 10);
+
+      variable = variable + 1;
+    }
+
+    printf("%s: solver %lu of %lu finished first, %lu conflicts of all solvers, %lu learnt clauses shared, %lu imported\n", selfie_name,
+      current_solver + 1,
+      number_of_solvers,
+      conflicts,
+      number_of_shared_clauses,
+      number_of_imported_clauses);
+  }
+
+  if (result == SAT) {
+    printf("%s: %s is satisfiable with ", selfie_name, dimacs_name);
+
+    variable = 0;
+
+    while (variable < number_of_sat_variables) {
+      if (*(sat_assignment + variable) == FALSE)
+        printf("-%lu ", variable + 1);
+      else
+        printf("%lu ", variable + 1);
+
+      variable = variable + 1;
+    }
+  } else
+    printf("%s: %s is unsatisfiable", selfie_name, dimacs_name);
+
+  println();
+}
+
+// -----------------------------------------------------------------
+// ----------------------------- MAIN ------------------------------
+// -----------------------------------------------------------------
+
+int babysat_main(int argc, char** argv) {
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+
+  selfie_sat();
+
+  return EXITCODE_NOERROR;
+}
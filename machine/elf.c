@@ -119,7 +119,11 @@ int load_elf(struct context* context, const char* elf, uint64_t len) {
       lowest_lo_page = MIN(lowest_lo_page, vaddr_to_vpn(vaddr));
       highest_lo_page = MAX(highest_lo_page, vaddr_to_vpn(vaddr));
 
-      memcpy((void *) ppn_to_paddr(ppn), (void *) (elf + faddr), PAGESIZE);
+      // Only copy the file part of the last page, the rest belongs to bss and must be zero
+      uint64_t bytes = MIN(PAGESIZE, pheader[i].file_size - (PAGESIZE * page));
+
+      memcpy((void *) ppn_to_paddr(ppn), (void *) (elf + faddr), bytes);
+      memset((void *) (ppn_to_paddr(ppn) + bytes), 0, PAGESIZE - bytes);
     }
 
     uint64_t segment_mem_pages = (pheader[i].mem_size + (PAGESIZE - 1)) / PAGESIZE;
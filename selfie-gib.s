@@ -0,0 +1,47451 @@
+lui t0,0x41
+addi t0,t0,-920
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+addi a0,zero,0
+ld a0,0(sp)
+addi a1,sp,8
+jal ra,45463
+nop
+nop
+nop
+nop
+nop
+addi a7,zero,93
+ecall
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+addi a3,a2,0
+addi a2,a1,0
+addi a1,a0,0
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+addi t0,a0,0
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi t0,zero,-504
+add t0,gp,t0
+sd t0,-16(gp)
+ld t0,-16(gp)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(gp)
+sub t0,t0,t1
+sd t0,-24(gp)
+ld t0,-24(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-32(gp)
+ld t0,-16(gp)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(gp)
+sub t0,t0,t1
+sd t0,-40(gp)
+ld t0,-40(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-48(gp)
+ld t0,-24(gp)
+sd t0,-56(gp)
+ld t0,-56(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-64(gp)
+ld t0,-32(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,6808
+addi t0,a0,0
+sd t0,-80(gp)
+ld t0,-80(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-80(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-80(gp)
+addi t2,s1,0
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sd t0,-88(gp)
+ld t0,-32(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,3970
+addi t0,a0,0
+sd t0,-104(gp)
+ld t0,-104(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-96(gp)
+ld t0,-24(gp)
+addi a0,t0,0
+jal ra,6759
+addi t0,a0,0
+sd t0,-320(gp)
+ld t0,-320(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-32(gp)
+addi a0,t0,0
+jal ra,4536
+addi t0,a0,0
+sd t0,-328(gp)
+ld t0,-336(gp)
+addi a0,t0,0
+jal ra,4531
+addi t0,a0,0
+sd t0,-344(gp)
+ld t0,-352(gp)
+addi a0,t0,0
+jal ra,4526
+addi t0,a0,0
+sd t0,-360(gp)
+ld t0,-24(gp)
+addi a0,t0,0
+jal ra,6736
+addi t0,a0,0
+sd t0,-368(gp)
+ld t0,-368(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-432(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-776(gp)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,6707
+addi t0,a0,0
+sd t0,-784(gp)
+ld t0,-784(gp)
+ld t1,-520(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-528(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-536(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1128
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1136
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1144
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1152
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1160
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1168
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1176
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1184
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1192
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1200
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1216
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1224
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-112(gp)
+sd t0,-864(gp)
+ld t0,-512(gp)
+sd t0,-880(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+sd t0,-816(gp)
+addi t0,zero,0
+sd t0,-872(gp)
+jal ra,6805
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-888(gp)
+addi t0,zero,0
+sd t0,-896(gp)
+addi t0,zero,0
+sd t0,-904(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,7
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,6396
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1328(gp)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,6261
+addi t0,a0,0
+sd t0,-1336(gp)
+addi t0,zero,0
+sd t0,-1344(gp)
+addi t0,zero,0
+sd t0,-1352(gp)
+addi t0,zero,0
+sd t0,-1360(gp)
+addi t0,zero,0
+sd t0,-1368(gp)
+addi t0,zero,0
+sd t0,-1376(gp)
+addi t0,zero,0
+sd t0,-1384(gp)
+addi t0,zero,0
+sd t0,-1392(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-1480(gp)
+addi t0,zero,0
+sd t0,-1488(gp)
+addi t0,zero,0
+sd t0,-1496(gp)
+addi t0,zero,0
+sd t0,-1504(gp)
+addi t0,zero,0
+sd t0,-1512(gp)
+addi t0,zero,0
+sd t0,-1520(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+jal ra,7057
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a0,0
+ld t1,0(t1)
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a0,0
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,zero,-1528
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a0,0
+ld t1,0(t1)
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-1552
+add t0,gp,t0
+addi a0,t0,0
+jal ra,3874
+addi t0,a0,0
+sd t0,-1536(gp)
+addi t0,zero,-1560
+add t0,gp,t0
+addi a0,t0,0
+jal ra,3868
+addi t0,a0,0
+sd t0,-1544(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1568(gp)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,6014
+addi t0,a0,0
+sd t0,-1856(gp)
+ld t0,-1856(gp)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1864
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1872
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1880
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1888
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1896
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1904
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1912
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1920
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1928
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1944
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1968
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1832(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1840(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1856(gp)
+ld t1,-1848(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1984
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1280(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,6
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,5669
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,3
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,5588
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+addi a0,t0,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+mul t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,928(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+ld t1,-40(gp)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,944(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,920(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1112(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,912(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,904(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,896(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,27969
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,760(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,752(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,744(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,736(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,728(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,720(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,712(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,704(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,696(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,688(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,5059
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,568(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,544
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,536
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,528
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,520
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,512
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,504
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,496
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,488
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-72(gp)
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,480
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,472
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,464
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,456
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,448
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,440
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,432
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,424
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4964
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,400(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4953
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,392(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,3
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,2
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,4931
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4636
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,296(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-184
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-200
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-224
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-232
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-248
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-272
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-288
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-312
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-336
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,168(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,160(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,136(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,128(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,120(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,112(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,104(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,96(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,88(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,80(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,72(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,64(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,56(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,48(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,40(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,32(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4535
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,24(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,16(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4516
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,8(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4501
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,0(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4486
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-8(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+addi t0,zero,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+addi a1,t0,0
+jal ra,36813
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-24(t1)
+jal zero,5
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-24(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-32(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-1568(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4437
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-48(t1)
+ld t0,-1568(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,4428
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-56(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,s1,0
+addi a0,t0,0
+jal ra,16128
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-22
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-64(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-72(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-80(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-88(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-96(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-104(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-112(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-120(t1)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-128(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-136(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-144(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-152(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-160(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-168(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1574
+addi t0,a0,0
+jal ra,-1138
+addi t0,a0,0
+jal ra,-310
+addi t0,a0,0
+jal ra,-259
+addi t0,a0,0
+jal ra,-155
+addi t0,a0,0
+jal ra,-39
+addi t0,a0,0
+jal ra,23667
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,9
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,16
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,4133
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-360(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi a1,t0,0
+jal ra,36580
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-368(t1)
+jal zero,-20
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-664(t1)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-672(t1)
+jal ra,41004
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-688(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-24(gp)
+ld t1,-40(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+addi a0,t0,0
+jal ra,-3900
+addi t0,a0,0
+ld t0,-32(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,-32(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,zero,0
+sd t0,-72(gp)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1600(t1)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1520(t1)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1496(t1)
+addi t0,zero,32
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1488(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+addi a0,t0,0
+jal ra,-3936
+addi t0,a0,0
+jal ra,22086
+addi t0,a0,0
+beq t0,zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+addi a0,t0,0
+jal ra,14163
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,349
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-736(t1)
+jal zero,47
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-368(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-3966
+addi t0,a0,0
+ld t0,-368(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-736(t1)
+jal zero,23
+ld t0,-368(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-736(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-736(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-736(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-392(gp)
+sd t0,-408(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-400(gp)
+sd t0,-408(gp)
+jal zero,3
+ld t0,-384(gp)
+sd t0,-408(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2442
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi a0,t0,0
+jal ra,25072
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,856(t1)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-688(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-80(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-19
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi a0,t0,0
+jal ra,-17
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-81
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-105
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-39
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-139
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,11
+jal zero,9
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-57
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,42
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,a1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-104(gp)
+add t0,t0,t1
+addi t1,a1,0
+ld t2,-104(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,24(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,106
+jal zero,27
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-37
+addi t0,a0,0
+beq t0,zero,14
+ld t0,-104(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-96
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,86
+jal zero,7
+ld t0,-104(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+ld t0,24(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,69
+jal zero,67
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-74
+addi t0,a0,0
+beq t0,zero,34
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-81
+addi t0,a0,0
+beq t0,zero,17
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-137
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-143
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,39
+jal zero,10
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-153
+addi t0,a0,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,29
+jal zero,27
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-114
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-173
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-367
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-384
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-419
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-434
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-341
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi a1,t0,0
+addi t0,zero,8
+addi a2,t0,0
+jal ra,-378
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-68
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi a1,t0,0
+jal ra,-477
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi a1,t0,0
+jal ra,-496
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal ra,2342
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-145
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-14
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-45
+addi t0,a0,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-190
+addi t0,a0,0
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,s2,0
+addi s1,t0,0
+jal zero,5
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-22
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-94
+addi t0,a0,0
+addi s3,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,25
+addi t0,s3,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-227
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-196
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-27
+addi t0,s3,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-209
+addi t0,a0,0
+addi t0,s3,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-141
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-286
+addi t0,a0,0
+addi s3,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-300
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-269
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi t0,s3,0
+addi a2,t0,0
+jal ra,-277
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s2,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+jal zero,-46
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,1
+beq t0,zero,60
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-349
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-360
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,32
+jal zero,29
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-379
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-387
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-60
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-428
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,118
+addi t0,s3,0
+addi t1,zero,48
+sub t0,t0,t1
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+addi t0,t0,-784
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1577
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-5021
+addi t0,a0,0
+addi t0,s2,0
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+addi t0,s2,0
+addi t1,zero,10
+mul t0,t0,t1
+addi t1,s3,0
+add t0,t0,t1
+addi s2,t0,0
+jal zero,65
+addi t0,s2,0
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+addi t0,s3,0
+ld t1,-88(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+addi t0,s2,0
+addi t1,zero,10
+mul t0,t0,t1
+addi t1,s3,0
+add t0,t0,t1
+addi s2,t0,0
+jal zero,21
+lui t0,0xFFFFF
+addi t0,t0,-832
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1521
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-5077
+addi t0,a0,0
+jal zero,21
+lui t0,0xFFFFF
+addi t0,t0,-880
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1500
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-5098
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-549
+addi t0,a0,0
+addi s3,t0,0
+jal zero,-121
+addi t0,s2,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,48
+addi a2,t0,0
+jal ra,-556
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+jal zero,21
+ld t0,40(s0)
+beq t0,zero,19
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-862
+addi t0,a0,0
+beq t0,zero,12
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+addi a2,t0,0
+jal ra,-604
+addi t0,a0,0
+jal zero,13
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+addi a2,t0,0
+jal ra,-617
+addi t0,a0,0
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-46
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-16(s0)
+beq t0,zero,13
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,45
+addi a2,t0,0
+jal ra,-642
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,32
+addi a2,t0,0
+jal ra,-658
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-16
+jal zero,18
+addi t0,s1,0
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,48
+addi a2,t0,0
+jal ra,-676
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-16
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-689
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-470
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-1216
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-1230
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+addi t0,zero,4
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-1263
+addi t0,a0,0
+ld t1,16(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-1290
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-1314
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+addi t0,zero,2
+addi a2,t0,0
+jal ra,-137
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,2
+addi a1,t0,0
+jal ra,-65
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+addi t0,zero,2
+addi a2,t0,0
+jal ra,-164
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,2
+addi a1,t0,0
+jal ra,-68
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+addi t0,zero,4
+addi a2,t0,0
+jal ra,-196
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,4
+addi a1,t0,0
+jal ra,-155
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,2
+addi a1,t0,0
+jal ra,-129
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+addi t0,zero,4
+addi a2,t0,0
+jal ra,-237
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,4
+addi a1,t0,0
+jal ra,-196
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,2
+addi a1,t0,0
+jal ra,-146
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-464(gp)
+beq t0,zero,14
+ld t0,-464(gp)
+addi a0,t0,0
+ld t0,-472(gp)
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+jal ra,-981
+addi t0,a0,0
+ld t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-472(gp)
+jal zero,91
+ld t0,-320(gp)
+beq t0,zero,83
+ld t0,-320(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-696(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-888
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,980
+addi sp,sp,8
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,10
+ld t0,-456(gp)
+addi a0,t0,0
+ld t0,-320(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-5617
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,10
+ld t0,-456(gp)
+addi a0,t0,0
+ld t0,-320(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-5627
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFF
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-448(gp)
+sd t0,16(sp)
+jal ra,933
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-5665
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-5672
+addi t0,a0,0
+ld t0,-440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-440(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-17
+addi t0,a0,0
+jal zero,27
+addi t0,zero,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1150
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1160
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-159
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-23
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-136(gp)
+addi a0,t0,0
+jal ra,-178
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-168(gp)
+addi a0,t0,0
+jal ra,-192
+addi t0,a0,0
+ld t0,16(s0)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-968
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-84
+addi t0,a0,0
+jal zero,44
+ld t0,16(s0)
+ld t1,-128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-984
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-97
+addi t0,a0,0
+jal zero,31
+ld t0,16(s0)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1000
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-110
+addi t0,a0,0
+jal zero,18
+ld t0,16(s0)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1016
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-123
+addi t0,a0,0
+jal zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-248
+addi t0,a0,0
+ld t0,-168(gp)
+addi a0,t0,0
+jal ra,-252
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-176(gp)
+addi a0,t0,0
+jal ra,-266
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-150
+addi t0,a0,0
+ld t0,-176(gp)
+addi a0,t0,0
+jal ra,-274
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+addi t0,zero,0
+addi a4,t0,0
+jal ra,-734
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-179
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+addi t0,zero,1
+addi a3,t0,0
+addi t0,zero,0
+addi a4,t0,0
+jal ra,-759
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-204
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+addi t0,zero,1
+addi a3,t0,0
+addi t0,zero,0
+addi a4,t0,0
+jal ra,-784
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-1221
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+ld t0,-120(gp)
+addi a0,t0,0
+jal ra,-358
+addi t0,a0,0
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(s0)
+jal zero,-12
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,16
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+ld t0,24(s0)
+addi a4,t0,0
+jal ra,-824
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-269
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1024
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-286
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-42
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,8
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+ld t0,24(s0)
+addi a4,t0,0
+jal ra,-873
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-318
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1032
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-335
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-42
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,2
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+ld t0,24(s0)
+addi a4,t0,0
+jal ra,-922
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-367
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1040
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-384
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-42
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1534
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-419
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,354
+jal zero,349
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1555
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-560
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,333
+jal zero,328
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1576
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,124
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1589
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,108
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1604
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1617
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+addi t0,zero,0
+addi a4,t0,0
+jal ra,-1068
+addi t0,a0,0
+jal zero,32
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1643
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,-328(gp)
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+addi t0,zero,1
+addi a3,t0,0
+addi t0,zero,0
+addi a4,t0,0
+jal ra,-1094
+addi t0,a0,0
+jal zero,6
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,236
+addi t0,s1,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-328(gp)
+addi a0,t0,0
+jal ra,-1545
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi a0,t0,0
+jal ra,-685
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s1,t0,0
+jal zero,-12
+ld t0,-328(gp)
+addi a0,t0,0
+jal ra,-574
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,199
+jal zero,194
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1710
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1723
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1738
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1751
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-388
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,135
+jal zero,130
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1774
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,97
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1787
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-511
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,101
+jal zero,73
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1810
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-509
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,78
+jal zero,50
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1833
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-470
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,53
+jal zero,25
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-1858
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-446
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,28
+jal zero,23
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1881
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-420
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,24(s0)
+beq t0,zero,6
+ld t0,24(s0)
+sd t0,-464(gp)
+addi t0,zero,0
+sd t0,-472(gp)
+jal zero,3
+ld t0,16(s0)
+sd t0,-456(gp)
+addi t0,zero,0
+sd t0,-440(gp)
+addi t0,zero,0
+addi s1,t0,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,82
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1951
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1966
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t1,40(s0)
+ld t0,0(t1)
+addi t1,t1,8
+sd t1,40(s0)
+addi a2,t0,0
+jal ra,-460
+addi t0,a0,0
+addi s1,t0,0
+jal zero,9
+addi t0,zero,37
+addi a0,t0,0
+jal ra,-983
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,14
+ld t0,32(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-1998
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-997
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-70
+ld t0,24(s0)
+beq t0,zero,9
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-472(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-1979
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-464(gp)
+addi t0,zero,0
+sd t0,-472(gp)
+ld t0,-440(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,24
+add t1,t1,s0
+sd t1,-8(s0)
+addi t0,zero,1
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+ld t0,-8(s0)
+addi a3,t0,0
+jal ra,-141
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,32
+add t1,t1,s0
+sd t1,-8(s0)
+addi t0,zero,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+ld t0,-8(s0)
+addi a3,t0,0
+jal ra,-171
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,32
+add t1,t1,s0
+sd t1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+ld t0,-8(s0)
+addi a3,t0,0
+jal ra,-201
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+addi t0,t0,-1056
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-1800
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+addi t0,t0,-1064
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1974
+addi t0,a0,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+addi t0,t0,-1080
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-1818
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1088
+add t0,gp,t0
+addi a0,t0,0
+jal zero,21
+jal zero,19
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+addi t0,t0,-1104
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-1833
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1112
+add t0,gp,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-1120
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-172
+addi sp,sp,8
+addi t0,a0,0
+jal zero,45
+ld t0,-456(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1128
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-125
+addi sp,sp,8
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-2483
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFF
+addi t0,t0,-1176
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-448(gp)
+sd t0,16(sp)
+jal ra,-207
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-6805
+addi t0,a0,0
+ld t0,-432(gp)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,-432(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+addi t0,a0,0
+addi t1,a0,0
+addi t2,a1,0
+remu t1,t1,t2
+sub t0,t0,t1
+addi t1,a1,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,-35
+addi t0,a0,0
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,24(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-15
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+beq t0,zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-5147
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-6890
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+ld t0,-320(gp)
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-347
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+addi a0,t0,0
+jal ra,-6945
+addi t0,a0,0
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-86
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,-178
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-118
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-167
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-5282
+addi t0,a0,0
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-7026
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-176(gp)
+addi a0,t0,0
+jal ra,-1495
+addi t0,a0,0
+ld t0,16(s0)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1224
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1387
+addi t0,a0,0
+jal zero,10
+ld t0,-784(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,-1397
+addi t0,a0,0
+ld t0,-176(gp)
+addi a0,t0,0
+jal ra,-1521
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1256
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-920(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-521
+addi sp,sp,32
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1272
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-40
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-549
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1296
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-72
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1419
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1312
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1490
+addi t0,a0,0
+ld t0,-864(gp)
+addi a0,t0,0
+jal ra,-1429
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1320
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1500
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1336
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-114
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1352
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-623
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1368
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-146
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1419
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1384
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1564
+addi t0,a0,0
+ld t0,-824(gp)
+addi a0,t0,0
+jal ra,-1429
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1392
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1574
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-928(gp)
+addi a0,t0,0
+ld t0,-320(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-7278
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-320(gp)
+ld t0,0(t0)
+sd t0,-864(gp)
+ld t0,-872(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-872(gp)
+jal zero,30
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-112(gp)
+sd t0,-864(gp)
+jal zero,21
+lui t0,0xFFFFF
+addi t0,t0,-1448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-726
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-7324
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-152(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,-864(gp)
+ld t1,-128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-49
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,zero,1
+beq t0,zero,163
+addi t0,s1,0
+beq t0,zero,24
+jal ra,-74
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+addi s1,t0,0
+jal zero,17
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,147
+jal zero,7
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-160
+addi t0,a0,0
+jal zero,137
+addi t0,s2,0
+beq t0,zero,60
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-175
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+addi s2,t0,0
+jal zero,-20
+addi t0,s2,0
+beq t0,zero,30
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-816(gp)
+jal zero,19
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1480
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-358
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-7484
+addi t0,a0,0
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-221
+addi t0,a0,0
+jal zero,76
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,18
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-816(gp)
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-241
+addi t0,a0,0
+jal zero,56
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-250
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+addi s1,t0,0
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-268
+addi t0,a0,0
+jal zero,25
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+addi s2,t0,0
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-287
+addi t0,a0,0
+jal zero,6
+ld t0,-672(gp)
+sd t0,-880(gp)
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-163
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-864(gp)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-78
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-36
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-160(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-371
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-824(gp)
+addi a0,t0,0
+ld t0,-784(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a1,t0,0
+jal ra,-2854
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-552(gp)
+addi a0,t0,0
+jal ra,-30
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,87
+jal zero,85
+ld t0,-560(gp)
+addi a0,t0,0
+jal ra,-39
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-560(gp)
+addi a0,t0,0
+jal zero,78
+jal zero,76
+ld t0,-568(gp)
+addi a0,t0,0
+jal ra,-48
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-568(gp)
+addi a0,t0,0
+jal zero,69
+jal zero,67
+ld t0,-576(gp)
+addi a0,t0,0
+jal ra,-57
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-576(gp)
+addi a0,t0,0
+jal zero,60
+jal zero,58
+ld t0,-584(gp)
+addi a0,t0,0
+jal ra,-66
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-584(gp)
+addi a0,t0,0
+jal zero,51
+jal zero,49
+ld t0,-592(gp)
+addi a0,t0,0
+jal ra,-75
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,42
+jal zero,40
+ld t0,-752(gp)
+addi a0,t0,0
+jal ra,-84
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,33
+jal zero,31
+ld t0,-760(gp)
+addi a0,t0,0
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+ld t0,-768(gp)
+addi a0,t0,0
+jal ra,-102
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,-776(gp)
+addi a0,t0,0
+jal ra,-111
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-544(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-512(gp)
+sd t0,-880(gp)
+jal ra,-473
+addi t0,a0,0
+ld t1,-112(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,579
+ld t0,-880(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,570
+jal ra,-297
+addi t0,a0,0
+beq t0,zero,56
+ld t0,-792(gp)
+addi a0,t0,0
+jal ra,-3211
+addi t0,a0,0
+sd t0,-824(gp)
+addi t0,zero,0
+addi s1,t0,0
+jal ra,-233
+addi t0,a0,0
+beq t0,zero,34
+addi t0,s1,0
+ld t1,-792(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1504
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-781
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-7907
+addi t0,a0,0
+ld t0,-824(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,-864(gp)
+addi a2,t0,0
+jal ra,-3319
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal ra,-652
+addi t0,a0,0
+jal zero,-35
+ld t0,-824(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3334
+addi t0,a0,0
+jal ra,-176
+addi t0,a0,0
+sd t0,-880(gp)
+jal zero,512
+jal ra,-306
+addi t0,a0,0
+beq t0,zero,87
+ld t0,-800(gp)
+addi a0,t0,0
+jal ra,-3269
+addi t0,a0,0
+sd t0,-832(gp)
+addi t0,zero,0
+addi s1,t0,0
+jal ra,-316
+addi t0,a0,0
+beq t0,zero,43
+addi t0,s1,0
+ld t1,-800(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,-856(gp)
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1536
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-841
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1560
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-848
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-7974
+addi t0,a0,0
+ld t0,-832(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,-864(gp)
+addi a2,t0,0
+jal ra,-3386
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal ra,-719
+addi t0,a0,0
+jal zero,-44
+ld t0,-832(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3401
+addi t0,a0,0
+ld t0,-832(gp)
+addi a0,t0,0
+jal ra,-3031
+addi t0,a0,0
+sd t0,-848(gp)
+ld t0,-856(gp)
+beq t0,zero,17
+ld t0,-848(gp)
+ld t1,-104(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1592
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-894
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8020
+addi t0,a0,0
+ld t0,-520(gp)
+sd t0,-880(gp)
+jal zero,423
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+jal ra,-762
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-848(gp)
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1648
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-925
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8051
+addi t0,a0,0
+jal zero,3
+ld t0,-864(gp)
+sd t0,-848(gp)
+jal ra,-787
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-795
+addi t0,a0,0
+jal zero,22
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-168(gp)
+addi a0,t0,0
+jal ra,-923
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8081
+addi t0,a0,0
+jal zero,5
+ld t0,-168(gp)
+addi a0,t0,0
+jal ra,-934
+addi t0,a0,0
+ld t0,-528(gp)
+sd t0,-880(gp)
+jal zero,357
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,84
+jal ra,-828
+addi t0,a0,0
+ld t0,-808(gp)
+addi a0,t0,0
+jal ra,-3429
+addi t0,a0,0
+sd t0,-840(gp)
+addi t0,zero,0
+addi s1,t0,0
+jal ra,-414
+addi t0,a0,0
+beq t0,zero,42
+addi t0,s1,0
+ld t1,-808(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1664
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-999
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8125
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,324
+addi t0,a0,0
+ld t0,-840(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,-864(gp)
+addi a2,t0,0
+jal ra,-3545
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal ra,-878
+addi t0,a0,0
+jal zero,-43
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-887
+addi t0,a0,0
+jal zero,11
+ld t0,-176(gp)
+addi a0,t0,0
+jal ra,-1009
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8167
+addi t0,a0,0
+ld t0,-840(gp)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3579
+addi t0,a0,0
+ld t0,-536(gp)
+sd t0,-880(gp)
+jal zero,268
+ld t0,-864(gp)
+ld t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-917
+addi t0,a0,0
+ld t0,-600(gp)
+sd t0,-880(gp)
+jal zero,257
+ld t0,-864(gp)
+ld t1,-192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-928
+addi t0,a0,0
+ld t0,-608(gp)
+sd t0,-880(gp)
+jal zero,246
+ld t0,-864(gp)
+ld t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-939
+addi t0,a0,0
+ld t0,-616(gp)
+sd t0,-880(gp)
+jal zero,235
+ld t0,-864(gp)
+ld t1,-208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-950
+addi t0,a0,0
+ld t0,-624(gp)
+sd t0,-880(gp)
+jal zero,224
+ld t0,-864(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-961
+addi t0,a0,0
+ld t0,-632(gp)
+sd t0,-880(gp)
+jal zero,213
+ld t0,-864(gp)
+ld t1,-224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-972
+addi t0,a0,0
+ld t0,-640(gp)
+sd t0,-880(gp)
+jal zero,202
+ld t0,-864(gp)
+ld t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-983
+addi t0,a0,0
+ld t0,-648(gp)
+sd t0,-880(gp)
+jal zero,191
+ld t0,-864(gp)
+ld t1,-240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-994
+addi t0,a0,0
+ld t0,-656(gp)
+sd t0,-880(gp)
+jal zero,180
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1005
+addi t0,a0,0
+ld t0,-664(gp)
+sd t0,-880(gp)
+jal zero,169
+ld t0,-864(gp)
+ld t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1016
+addi t0,a0,0
+ld t0,-680(gp)
+sd t0,-880(gp)
+jal zero,158
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1027
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1035
+addi t0,a0,0
+ld t0,-696(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-688(gp)
+sd t0,-880(gp)
+jal zero,136
+ld t0,-864(gp)
+ld t1,-280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-1049
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1057
+addi t0,a0,0
+jal zero,5
+ld t0,-272(gp)
+addi a0,t0,0
+jal ra,-1179
+addi t0,a0,0
+ld t0,-704(gp)
+sd t0,-880(gp)
+jal zero,112
+ld t0,-864(gp)
+ld t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1073
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1081
+addi t0,a0,0
+ld t0,-720(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-712(gp)
+sd t0,-880(gp)
+jal zero,90
+ld t0,-864(gp)
+ld t1,-296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1095
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1103
+addi t0,a0,0
+ld t0,-736(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-728(gp)
+sd t0,-880(gp)
+jal zero,68
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+jal ra,-1117
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1125
+addi t0,a0,0
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1133
+addi t0,a0,0
+jal zero,5
+ld t0,-312(gp)
+addi a0,t0,0
+jal ra,-1255
+addi t0,a0,0
+jal zero,5
+ld t0,-312(gp)
+addi a0,t0,0
+jal ra,-1260
+addi t0,a0,0
+ld t0,-744(gp)
+sd t0,-880(gp)
+jal zero,31
+lui t0,0xFFFFF
+addi t0,t0,-1680
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-1332
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1712
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2746
+addi t0,a0,0
+ld t0,-864(gp)
+addi a0,t0,0
+jal ra,-2685
+addi t0,a0,0
+jal ra,-2700
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8445
+addi t0,a0,0
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-1196
+addi t0,a0,0
+ld t0,-864(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-136(gp)
+sd t0,-864(gp)
+jal zero,67
+ld t0,-864(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-128(gp)
+sd t0,-864(gp)
+jal zero,58
+ld t0,-864(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-120(gp)
+sd t0,-864(gp)
+jal zero,49
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-168(gp)
+sd t0,-864(gp)
+jal zero,40
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-176(gp)
+sd t0,-864(gp)
+jal zero,31
+ld t0,-864(gp)
+ld t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-264(gp)
+sd t0,-864(gp)
+jal zero,22
+ld t0,-864(gp)
+ld t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-304(gp)
+sd t0,-864(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1744
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-1414
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi a0,t0,0
+jal ra,-8540
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi t1,a0,0
+ld t1,0(t1)
+addi t2,a0,0
+ld t2,0(t2)
+addi t3,a0,0
+ld t3,0(t3)
+addi t4,a0,0
+ld t4,0(t4)
+addi t5,a0,0
+ld t5,0(t5)
+ld t6,-1328(gp)
+divu t5,t5,t6
+add t4,t4,t5
+ld t5,-1328(gp)
+divu t4,t4,t5
+add t3,t3,t4
+ld t4,-1328(gp)
+divu t3,t3,t4
+add t2,t2,t3
+ld t3,-1328(gp)
+divu t2,t2,t3
+add t1,t1,t2
+ld t2,-1328(gp)
+divu t1,t1,t2
+add t0,t0,t1
+ld t1,-1328(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-64
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd a5,56(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-8119
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,32(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,40(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,48(s0)
+addi t0,t0,32
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,56(s0)
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,64(s0)
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,64
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-1304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,-8(s0)
+ld t1,-1624(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,-1336(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-92
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,40(s0)
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1360(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1360(gp)
+jal zero,22
+ld t0,40(s0)
+ld t1,-1256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1368(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1368(gp)
+jal zero,11
+ld t0,40(s0)
+ld t1,-1248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1376(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1376(gp)
+jal zero,26
+ld t0,16(s0)
+ld t1,-1312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-8(s0)
+ld t1,-1664(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,-1344(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,-1344(gp)
+jal zero,10
+ld t0,-8(s0)
+ld t1,-1624(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,-1352(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,-1352(gp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,72
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1384(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1384(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-1392(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1392(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8204
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8248
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-3878
+addi t0,a0,0
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8272
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1336(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-250
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-89
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-1344(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-1232(gp)
+addi a2,t0,0
+jal ra,-119
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,19
+ld t0,24(s0)
+ld t1,-1256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-1352(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-1256(gp)
+addi a2,t0,0
+jal ra,-135
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-86
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8351
+addi t0,a0,0
+ld t1,-1256(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,39
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8317
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8330
+addi t0,a0,0
+addi a0,t0,0
+jal ra,11925
+addi t0,a0,0
+addi a0,t0,0
+jal ra,10254
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1352(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-1256(gp)
+addi a2,t0,0
+jal ra,-235
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+ld t1,-1328(gp)
+sltu t0,t0,t1
+beq t0,zero,75
+ld t0,-1336(gp)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-8487
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-57
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,35
+addi t0,zero,1
+addi s1,t0,0
+lui t0,0xFFFFF
+addi t0,t0,-1760
+add t0,gp,t0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-8497
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1943
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-8526
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2455
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-8549
+addi t0,a0,0
+addi s3,t0,0
+jal zero,-61
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-77
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-880(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-880(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-880(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+ld t1,-1576(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1408(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1408(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1808
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2469
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-9595
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1408(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1632(gp)
+ld t1,-1408(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+ld t0,-1816(gp)
+ld t1,-1408(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1832
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2512
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-9638
+addi t0,a0,0
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+ld t0,-1408(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1656(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-62
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1856
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2555
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-9681
+addi t0,a0,0
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+ld t1,-1576(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-1408(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1824(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-105
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2598
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-9724
+addi t0,a0,0
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-1408(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,-1408(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1912
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-2632
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-9758
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1632(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,-1816(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-1640(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,26
+addi t0,a0,0
+ld t1,-1656(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+addi t0,a0,0
+ld t1,-1632(gp)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+addi t0,a0,0
+ld t1,-1824(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+addi t0,a0,0
+ld t1,-1816(gp)
+sub t0,t0,t1
+addi t1,zero,3
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1680(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,8889
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,-1680(gp)
+sub t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1672(gp)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,-1744(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,17
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,8853
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,-1744(gp)
+sub t0,t0,t1
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,-1440(gp)
+ld t0,-1344(gp)
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9356
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-5652
+addi t0,a0,0
+beq t0,zero,26
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9366
+addi t0,a0,0
+sub t0,zero,t0
+ld t1,-56(gp)
+divu t0,t0,t1
+addi s2,t0,0
+addi t0,s2,0
+ld t1,-1592(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-101
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9477
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-45
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-40(gp)
+ld t1,-24(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-3118
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1440(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,-1440(gp)
+ld t0,-1432(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-9454
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+add t1,t1,t2
+addi t0,t0,40
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-161
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-5978
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi t1,zero,2
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-1344(gp)
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9503
+addi t0,a0,0
+addi a0,t0,0
+jal ra,8650
+addi t0,a0,0
+beq t0,zero,31
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9541
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9523
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-240
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-6047
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi s2,t0,0
+addi t0,s1,0
+ld t1,-1664(gp)
+addi t0,t0,56
+sd t1,0(t0)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-9642
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-48
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,281
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-48(s0)
+ld t0,16(s0)
+addi s4,t0,0
+addi t0,s4,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,54
+addi t0,s4,0
+addi a0,t0,0
+jal ra,10677
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,9000
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8903
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-155
+addi t0,a0,0
+beq t0,zero,15
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+jal ra,10934
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi s4,t0,0
+jal zero,-56
+ld t0,-1440(gp)
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,131
+addi t0,s3,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,10612
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+addi t0,s3,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8863
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-216
+addi t0,a0,0
+beq t0,zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8893
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1664(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8839
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-390
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,11200
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8854
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-267
+addi t0,a0,0
+beq t0,zero,43
+ld t0,-1664(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8838
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-433
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,8778
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,11206
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi t0,s3,0
+ld t0,0(t0)
+addi s3,t0,0
+jal zero,-134
+ld t0,-48(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+ld t0,24(s0)
+addi s4,t0,0
+ld t0,24(s0)
+addi s5,t0,0
+addi t0,s4,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,41
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+addi s4,t0,0
+addi t0,s4,0
+addi a0,t0,0
+jal ra,10469
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10722
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+addi t0,s5,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+addi s5,t0,0
+addi t0,s5,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a1,t0,0
+jal ra,10478
+addi t0,a0,0
+jal zero,-43
+addi t0,s5,0
+addi s4,t0,0
+addi t0,s4,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,19
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+addi s4,t0,0
+addi t0,s4,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,10684
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,10454
+addi t0,a0,0
+jal zero,-21
+addi t0,s5,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,30
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-56(gp)
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,10729
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-873
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,11072
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-753
+addi t0,a0,0
+jal zero,-32
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-930
+addi t0,a0,0
+jal ra,-902
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,10981
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-56(gp)
+addi a2,t0,0
+jal ra,10676
+addi t0,a0,0
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-1416(gp)
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,10651
+addi t0,a0,0
+ld t0,-1416(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,25
+ld t0,-1416(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-1416(gp)
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1416(gp)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-1416(gp)
+addi a0,t0,0
+jal ra,-730
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10982
+addi t0,a0,0
+jal zero,-27
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,33
+ld t0,-1416(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-1416(gp)
+addi a0,t0,0
+jal ra,-759
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-1416(gp)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,10889
+addi t0,a0,0
+ld t0,-1416(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1416(gp)
+jal zero,-21
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,16(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,10577
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1928
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-3545
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-3589
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1944
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-4963
+addi t0,a0,0
+ld t0,-880(gp)
+addi a0,t0,0
+jal ra,-3599
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1952
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-4973
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1968
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-3586
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-1992
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5000
+addi t0,a0,0
+ld t0,-880(gp)
+addi a0,t0,0
+jal ra,-3636
+addi t0,a0,0
+lui t0,0xFFFFF
+addi t0,t0,-2000
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5010
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-2016
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5036
+addi t0,a0,0
+jal zero,46
+ld t0,16(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-2032
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5049
+addi t0,a0,0
+jal zero,33
+ld t0,16(s0)
+ld t1,-1288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-2040
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5062
+addi t0,a0,0
+jal zero,20
+ld t0,16(s0)
+ld t1,-1296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,2040
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5075
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,2032
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5082
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,2024
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-3693
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,2008
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5107
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-90
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1992
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5117
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-100
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1984
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-5127
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-6387
+addi t0,a0,0
+beq t0,zero,10
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,10356
+addi t0,a0,0
+jal zero,107
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,12
+addi a2,t0,0
+jal ra,-6641
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,20
+addi a2,t0,0
+jal ra,-6650
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi a0,t0,0
+jal ra,-6776
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,42
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-6390
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,10273
+addi t0,a0,0
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,19
+addi a0,t0,0
+jal ra,-6808
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+jal ra,10366
+addi t0,a0,0
+jal zero,16
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-6427
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,10236
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-6445
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10249
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-2180
+addi t0,a0,0
+addi a0,t0,0
+jal zero,29
+jal zero,27
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-2154
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-3800
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-11000
+addi t0,a0,0
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10426
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,12
+addi a2,t0,0
+jal ra,-6818
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10438
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,20
+addi a2,t0,0
+jal ra,-6830
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi a0,t0,0
+jal ra,-6956
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal ra,-1485
+addi t0,a0,0
+jal ra,-1457
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-6573
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,10090
+addi t0,a0,0
+jal ra,-1473
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10475
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-1488
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10138
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-162
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-10529
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-10519
+addi t0,a0,0
+addi a0,t0,0
+jal ra,7634
+addi t0,a0,0
+beq t0,zero,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-1139
+addi t0,a0,0
+jal ra,-1564
+addi t0,a0,0
+jal ra,-1536
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-10538
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,10043
+addi t0,a0,0
+jal zero,63
+ld t0,-16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-6716
+addi t0,a0,0
+beq t0,zero,20
+jal ra,-1590
+addi t0,a0,0
+jal ra,-1562
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-10564
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-16(s0)
+addi a2,t0,0
+jal ra,10314
+addi t0,a0,0
+jal zero,37
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-173
+addi t0,a0,0
+jal ra,-1583
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-1588
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,12
+addi a2,t0,0
+jal ra,-6997
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-6714
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10277
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-10657
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-6797
+addi t0,a0,0
+beq t0,zero,11
+jal ra,-1671
+addi t0,a0,0
+jal ra,-1643
+addi t0,a0,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-431
+addi t0,a0,0
+jal zero,48
+ld t0,-832(gp)
+addi a0,t0,0
+ld t0,-1240(gp)
+addi a1,t0,0
+jal ra,-2466
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,-832(gp)
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1240(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+ld t0,16(s0)
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2705
+addi t0,a0,0
+ld t0,-832(gp)
+addi a0,t0,0
+ld t0,-1240(gp)
+addi a1,t0,0
+jal ra,-193
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-6623
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4506
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1248(gp)
+addi a3,t0,0
+ld t0,-1280(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2767
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi a0,t0,0
+jal ra,-131
+addi t0,a0,0
+jal ra,-1761
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1624(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-1769
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,9857
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-1424(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,-1296(gp)
+sd t0,-8(s0)
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-8(s0)
+addi a4,t0,0
+ld t0,32(s0)
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2833
+addi t0,a0,0
+ld t0,-1608(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,10227
+addi t0,a0,0
+jal zero,86
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10869
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10844
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,-1608(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,10200
+addi t0,a0,0
+jal zero,59
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10866
+addi t0,a0,0
+addi a0,t0,0
+jal ra,9389
+addi t0,a0,0
+addi a0,t0,0
+jal ra,7718
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-1608(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10887
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,10169
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+sub t1,t1,t2
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,18
+ld t0,-1608(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10911
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sub t0,t0,t1
+addi a1,t0,0
+jal ra,10141
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,9315
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,7638
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,275
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,7559
+addi t0,a0,0
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,261
+jal ra,25043
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,247
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,236
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-1805
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,221
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,9227
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24984
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,188
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,177
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-1864
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,162
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,9166
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24923
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,127
+jal zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,116
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,105
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+ld t1,-32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,94
+ld t0,16(s0)
+addi t1,zero,3
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,9106
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24863
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,67
+jal zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,54
+jal zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,43
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-1998
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,28
+jal zero,17
+ld t0,-8(s0)
+ld t1,-16(s0)
+mul t0,t0,t1
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-7366
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,11
+ld t0,-8(s0)
+ld t1,-16(s0)
+mul t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,760
+jal zero,34
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-11267
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,747
+jal zero,21
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-11280
+addi t0,a0,0
+addi a0,t0,0
+jal ra,8975
+addi t0,a0,0
+addi a0,t0,0
+jal ra,7304
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,726
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-11315
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-7598
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,711
+jal zero,10
+addi t0,s2,0
+ld t1,-1576(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,701
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-11325
+addi t0,a0,0
+addi s1,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,zero,0
+addi s4,t0,0
+addi t0,zero,0
+addi s6,t0,0
+addi t0,zero,0
+addi s7,t0,0
+addi t0,s6,0
+ld t1,-1400(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,678
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,671
+addi t0,s1,0
+addi a0,t0,0
+jal ra,8903
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24660
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,642
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,8857
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24614
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,604
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1680(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,593
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,582
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,569
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,8797
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24554
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,544
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,524
+jal zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1608(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,513
+jal zero,24
+addi t0,s2,0
+addi t1,s3,0
+add t0,t0,t1
+ld t1,-1576(gp)
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,503
+jal zero,14
+addi t0,s7,0
+addi t1,s2,0
+addi t2,zero,1
+add t1,t1,t2
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,493
+jal zero,4
+addi t0,s6,0
+addi a0,t0,0
+jal zero,489
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-602
+addi t0,a0,0
+beq t0,zero,38
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-2345
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-2355
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s1,0
+addi t1,zero,4
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s6,0
+addi t1,zero,4
+add t0,t0,t1
+addi s6,t0,0
+addi t0,s7,0
+addi t1,zero,1
+add t0,t0,t1
+addi s7,t0,0
+jal zero,442
+addi t0,s1,0
+addi a0,t0,0
+jal ra,8679
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,24436
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1624(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,407
+jal zero,297
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2430
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1624(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,375
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-2451
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,361
+jal zero,251
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,159
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2484
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,328
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,317
+jal zero,21
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,8544
+addi t0,a0,0
+addi a0,t0,0
+jal ra,6873
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,296
+jal zero,103
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2483
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,275
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2503
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s5,t0,0
+addi t0,s5,0
+addi t1,s2,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,257
+jal zero,20
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s5,0
+addi a0,t0,0
+jal ra,-8276
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi t1,zero,2
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,237
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s5,0
+addi a0,t0,0
+jal ra,-8295
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi s4,t0,0
+addi t0,s7,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s7,t0,0
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2605
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1624(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,193
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,168
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,154
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,140
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2687
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,125
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-2702
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1680(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-2732
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,80
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-2749
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-2759
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2769
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-2779
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-2789
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-2799
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s6,0
+addi t1,zero,1
+add t0,t0,t1
+addi s6,t0,0
+addi t0,s7,0
+addi t1,zero,1
+add t0,t0,t1
+addi s7,t0,0
+jal zero,-682
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2840
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-1472(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2851
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2883
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-1472(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2894
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2909
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-2938
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-12157
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-3168
+addi t0,a0,0
+jal ra,-3140
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,8446
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-26
+ld t0,-1472(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-1576(gp)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-5879
+addi t0,a0,0
+sd t0,-1472(gp)
+addi t0,zero,1
+addi s2,t0,0
+addi t0,s2,0
+ld t1,-1576(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-3009
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-115
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-19
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-12201
+addi t0,a0,0
+addi s1,t0,0
+ld t0,32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,561
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-1275
+addi t0,a0,0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-182
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-191
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a2,t0,0
+jal ra,8368
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,4
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi s1,t0,0
+ld t0,32(s0)
+addi t1,zero,4
+sub t0,t0,t1
+sd t0,32(s0)
+jal zero,518
+addi t0,s1,0
+addi a0,t0,0
+jal ra,8006
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,23763
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-215
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,40(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-285
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,8276
+addi t0,a0,0
+jal zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-3084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+ld t0,-1472(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-3145
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-3114
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-3189
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-342
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-351
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a2,t0,0
+jal ra,8208
+addi t0,a0,0
+jal zero,360
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-377
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-386
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a2,t0,0
+jal ra,8470
+addi t0,a0,0
+jal zero,325
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-412
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-426
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8494
+addi t0,a0,0
+jal zero,288
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-449
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a1,t0,0
+jal ra,8080
+addi t0,a0,0
+jal zero,264
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-473
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-482
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-494
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8107
+addi t0,a0,0
+jal zero,220
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-517
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-526
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-538
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8106
+addi t0,a0,0
+jal zero,176
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-561
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-570
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-582
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8105
+addi t0,a0,0
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-605
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-614
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-626
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8104
+addi t0,a0,0
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-649
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-658
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-670
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8103
+addi t0,a0,0
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-693
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-702
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-714
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8102
+addi t0,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi s1,t0,0
+ld t0,32(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,32(s0)
+jal zero,-563
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-3630
+addi t0,a0,0
+ld t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1488(gp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-12808
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-9090
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+ld t1,-1584(gp)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-1584(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,2
+ld t1,24(s0)
+add t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,7760
+addi t0,a0,0
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-1616(gp)
+addi a0,t0,0
+addi t0,zero,2
+addi t1,s1,0
+add t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-3621
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8091
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-29
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+ld t0,-1608(gp)
+addi a2,t0,0
+jal ra,8078
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+ld t0,-1664(gp)
+addi a2,t0,0
+jal ra,8070
+addi t0,a0,0
+ld t0,-1664(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7704
+addi t0,a0,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,43
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-9059
+addi t0,a0,0
+beq t0,zero,11
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,16(s0)
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,7683
+addi t0,a0,0
+jal zero,25
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal ra,-2288
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3925
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7701
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-3805
+addi t0,a0,0
+ld t0,-1344(gp)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,39
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-12941
+addi t0,a0,0
+addi a0,t0,0
+jal ra,5212
+addi t0,a0,0
+beq t0,zero,25
+ld t0,-1664(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-12968
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-12963
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7977
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-13074
+addi t0,a0,0
+addi s2,t0,0
+jal zero,-42
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-1344(gp)
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13000
+addi t0,a0,0
+addi a0,t0,0
+jal ra,5153
+addi t0,a0,0
+beq t0,zero,21
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13008
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1664(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13033
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7861
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13129
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-38
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1664(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7550
+addi t0,a0,0
+ld t0,-1664(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7839
+addi t0,a0,0
+ld t0,-1608(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-56(gp)
+addi a2,t0,0
+jal ra,7831
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+ld t1,16(s0)
+add t0,t0,t1
+addi a2,t0,0
+jal ra,7522
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,8004
+addi t0,a0,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+beq t0,zero,174
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,7148
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,22905
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,zero,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,2
+ld t2,-56(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+ld t1,-56(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal ra,-3910
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+addi a4,t0,0
+jal ra,5499
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,7121
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,63
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,zero,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,2
+ld t2,-56(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+ld t1,-56(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal ra,-3997
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+addi a4,t0,0
+jal ra,5418
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,7040
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-178
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-13370
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-4318
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-9006
+addi t0,a0,0
+beq t0,zero,4
+jal ra,3502
+addi t0,a0,0
+jal zero,24
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1960
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-9018
+addi t0,a0,0
+beq t0,zero,4
+jal ra,3627
+addi t0,a0,0
+jal zero,12
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1952
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-9030
+addi t0,a0,0
+beq t0,zero,3
+jal ra,3739
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-13367
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-13380
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-4235
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,134
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,53
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-13402
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-9683
+addi t0,a0,0
+beq t0,zero,43
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,40(s0)
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7192
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4412
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7533
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-4292
+addi t0,a0,0
+ld t0,40(s0)
+addi a0,t0,0
+jal zero,77
+ld t0,24(s0)
+ld t1,-1584(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-4200
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4438
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7148
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-4319
+addi t0,a0,0
+ld t0,-1416(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1416(gp)
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+ld t0,24(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,40(s0)
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,7119
+addi t0,a0,0
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-1584(gp)
+sub t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4487
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7458
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-4367
+addi t0,a0,0
+ld t0,40(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-1352(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-1264(gp)
+addi a2,t0,0
+jal ra,-5403
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-260
+addi t0,a0,0
+addi a0,t0,0
+jal zero,352
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1256(gp)
+addi a1,t0,0
+jal ra,-5321
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13535
+addi t0,a0,0
+addi s2,t0,0
+jal zero,3
+addi t0,zero,0
+addi s2,t0,0
+ld t0,-1408(gp)
+sd t0,-24(s0)
+ld t0,-1416(gp)
+sd t0,-32(s0)
+ld t0,-24(s0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1928
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-7057
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-14183
+addi t0,a0,0
+jal ra,-3734
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3666
+addi t0,a0,0
+addi t0,zero,0
+addi s5,t0,0
+addi t0,zero,0
+addi s6,t0,0
+jal ra,-5090
+addi t0,a0,0
+beq t0,zero,159
+jal ra,984
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,s2,0
+addi a2,t0,0
+addi t0,s6,0
+addi a3,t0,0
+jal ra,-273
+addi t0,a0,0
+addi s6,t0,0
+addi t0,zero,1
+addi s5,t0,0
+ld t0,-880(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-6364
+addi t0,a0,0
+jal ra,961
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s5,0
+addi a1,t0,0
+addi t0,s2,0
+addi a2,t0,0
+addi t0,s6,0
+addi a3,t0,0
+jal ra,-296
+addi t0,a0,0
+addi s6,t0,0
+addi t0,s5,0
+addi t1,zero,1
+add t0,t0,t1
+addi s5,t0,0
+jal zero,-25
+addi t0,s6,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13673
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-9954
+addi t0,a0,0
+beq t0,zero,11
+addi t0,s6,0
+addi a0,t0,0
+addi t0,s5,0
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a1,t0,0
+jal ra,7633
+addi t0,a0,0
+jal zero,12
+addi t0,s6,0
+addi a0,t0,0
+addi t0,s5,0
+ld t1,-1584(gp)
+sub t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+addi a1,t0,0
+jal ra,7621
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13712
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13720
+addi t0,a0,0
+addi s5,t0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-6447
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi t0,s1,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi t0,s5,0
+addi a2,t0,0
+jal ra,-2935
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,25
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s5,0
+addi a1,t0,0
+addi t0,s2,0
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-4568
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+jal ra,-1627
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,11
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-3726
+addi t0,a0,0
+ld t0,-1408(gp)
+addi a0,t0,0
+jal ra,-4623
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-56(s0)
+jal zero,56
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-6507
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi t0,s1,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-2995
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,25
+addi t0,s1,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,s2,0
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-4628
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+jal ra,-1687
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,7
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-3786
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-56(s0)
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,36
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13851
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-10132
+addi t0,a0,0
+beq t0,zero,26
+ld t0,-1616(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13871
+addi t1,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,6736
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-1416(gp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-4697
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1680(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,6721
+addi t0,a0,0
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-3899
+addi t0,a0,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,-3989
+addi t0,a0,0
+jal ra,-4912
+addi t0,a0,0
+ld t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1480(gp)
+ld t0,-56(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+jal ra,-5135
+addi t0,a0,0
+beq t0,zero,19
+jal ra,-3850
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-14529
+addi t0,a0,0
+jal zero,3
+jal ra,-6673
+addi t0,a0,0
+jal zero,-20
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+jal ra,-6682
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,zero,1
+sd t0,-8(s0)
+jal ra,1817
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6701
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-3940
+addi t0,a0,0
+jal zero,20
+jal ra,618
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6718
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-3957
+addi t0,a0,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,217
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,1
+sd t0,-32(s0)
+addi t0,zero,1
+sd t0,-856(gp)
+jal ra,-6741
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-856(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,1
+sd t0,-40(s0)
+jal ra,-6756
+addi t0,a0,0
+jal zero,3
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-824(gp)
+sd t0,-48(s0)
+jal ra,-6769
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-6777
+addi t0,a0,0
+ld t0,-48(s0)
+addi a0,t0,0
+jal ra,-527
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,8
+ld t0,-48(s0)
+addi a0,t0,0
+ld t0,-1232(gp)
+addi a1,t0,0
+jal ra,-3543
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,82
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-848(gp)
+addi a0,t0,0
+jal ra,-3430
+addi t0,a0,0
+jal ra,-6803
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal zero,67
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-5101
+addi t0,a0,0
+jal ra,-5073
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,-848(gp)
+addi a2,t0,0
+jal ra,6513
+addi t0,a0,0
+jal ra,-6825
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal zero,45
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-840(gp)
+addi a0,t0,0
+jal ra,-3391
+addi t0,a0,0
+jal ra,-6840
+addi t0,a0,0
+ld t0,-1280(gp)
+sd t0,-24(s0)
+jal zero,30
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-6851
+addi t0,a0,0
+jal ra,474
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6862
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-4101
+addi t0,a0,0
+jal zero,5
+jal ra,-4062
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+ld t0,-40(s0)
+beq t0,zero,28
+ld t0,-24(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1280(gp)
+addi a0,t0,0
+ld t0,-24(s0)
+addi a1,t0,0
+jal ra,-3972
+addi t0,a0,0
+jal ra,-5144
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5149
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,6734
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+ld t0,-32(s0)
+beq t0,zero,30
+ld t0,-24(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1272(gp)
+addi a0,t0,0
+ld t0,-24(s0)
+addi a1,t0,0
+jal ra,-4001
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal ra,-5175
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5183
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6486
+addi t0,a0,0
+ld t0,-8(s0)
+beq t0,zero,5
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+jal ra,-307
+addi t0,a0,0
+addi s1,t0,0
+jal ra,-5602
+addi t0,a0,0
+beq t0,zero,107
+ld t0,-880(gp)
+addi s2,t0,0
+jal ra,-6965
+addi t0,a0,0
+jal ra,-317
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s1,0
+addi t1,s3,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s3,0
+addi a1,t0,0
+jal ra,-4066
+addi t0,a0,0
+addi t0,s2,0
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5200
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5205
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5257
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6455
+addi t0,a0,0
+jal zero,56
+addi t0,s2,0
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5228
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5233
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5285
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6470
+addi t0,a0,0
+jal zero,28
+addi t0,s2,0
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-5256
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5261
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5313
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6485
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5193
+addi t0,a0,0
+jal zero,-108
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+jal ra,-140
+addi t0,a0,0
+addi s1,t0,0
+jal ra,-5695
+addi t0,a0,0
+beq t0,zero,218
+ld t0,-880(gp)
+addi s2,t0,0
+jal ra,-7097
+addi t0,a0,0
+jal ra,-150
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s2,0
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,65
+addi t0,s1,0
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi t0,s3,0
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-5377
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,2802
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1888
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-7871
+addi t0,a0,0
+jal zero,16
+addi t0,s3,0
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-5354
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,2781
+addi t0,a0,0
+ld t0,-1280(gp)
+addi s1,t0,0
+jal ra,-5363
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5368
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5420
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6206
+addi t0,a0,0
+jal zero,136
+addi t0,s2,0
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,130
+addi t0,s1,0
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+addi t0,s3,0
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+jal ra,-5447
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,2732
+addi t0,a0,0
+jal ra,-5410
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5415
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5467
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6202
+addi t0,a0,0
+jal zero,54
+jal ra,-5432
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5437
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5489
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6180
+addi t0,a0,0
+jal ra,-5497
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,-24(gp)
+addi a2,t0,0
+jal ra,6089
+addi t0,a0,0
+jal ra,-5462
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5467
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5519
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6236
+addi t0,a0,0
+ld t0,-1272(gp)
+addi s1,t0,0
+jal zero,35
+addi t0,s3,0
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1848
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-8022
+addi t0,a0,0
+jal zero,22
+jal ra,-5499
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5504
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5556
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6113
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5436
+addi t0,a0,0
+jal zero,-219
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-251
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-5909
+addi t0,a0,0
+beq t0,zero,318
+ld t0,-880(gp)
+sd t0,-16(s0)
+jal ra,-7340
+addi t0,a0,0
+jal ra,-261
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-24(s0)
+addi a1,t0,0
+jal ra,-4441
+addi t0,a0,0
+ld t0,-1272(gp)
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+jal ra,-5577
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5626
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5590
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6035
+addi t0,a0,0
+jal ra,-5642
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,5944
+addi t0,a0,0
+jal ra,-5607
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5612
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5664
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6177
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5544
+addi t0,a0,0
+jal zero,236
+ld t0,-16(s0)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-5639
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5688
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5652
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5973
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5576
+addi t0,a0,0
+jal ra,-5708
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5716
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6125
+addi t0,a0,0
+jal zero,188
+ld t0,-16(s0)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-5687
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5692
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5744
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6097
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5624
+addi t0,a0,0
+jal zero,156
+ld t0,-16(s0)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-5719
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5768
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5732
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6065
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5656
+addi t0,a0,0
+jal zero,124
+ld t0,-16(s0)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+jal ra,-5751
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5800
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5764
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,6033
+addi t0,a0,0
+jal ra,-5816
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,5770
+addi t0,a0,0
+jal ra,-5781
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5830
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5794
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5831
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5718
+addi t0,a0,0
+jal zero,62
+ld t0,-16(s0)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-5813
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5818
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5870
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5971
+addi t0,a0,0
+jal ra,-5878
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,5708
+addi t0,a0,0
+jal ra,-5843
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5892
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5856
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5769
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5780
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-1432(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1432(gp)
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,85
+jal ra,-7687
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+jal ra,-7695
+addi t0,a0,0
+jal ra,-370
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-16(s0)
+jal ra,-5960
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,6045
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5841
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+jal ra,-7722
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-7730
+addi t0,a0,0
+jal ra,-6511
+addi t0,a0,0
+beq t0,zero,4
+jal ra,356
+addi t0,a0,0
+jal zero,-5
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7744
+addi t0,a0,0
+jal zero,11
+ld t0,-640(gp)
+addi a0,t0,0
+jal ra,-4983
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-15614
+addi t0,a0,0
+jal zero,3
+jal ra,333
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-4997
+addi t0,a0,0
+jal zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal ra,-5002
+addi t0,a0,0
+jal zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal ra,-5007
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sub t0,t0,t1
+addi a1,t0,0
+jal ra,6011
+addi t0,a0,0
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,6112
+addi t0,a0,0
+ld t0,-1432(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-1432(gp)
+ld t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1504(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,156
+jal ra,-7820
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,143
+jal ra,-7828
+addi t0,a0,0
+jal ra,-503
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-8(s0)
+jal ra,-6093
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,5912
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-5974
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,111
+jal ra,-7855
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-7863
+addi t0,a0,0
+jal ra,-6644
+addi t0,a0,0
+beq t0,zero,4
+jal ra,223
+addi t0,a0,0
+jal zero,-5
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7877
+addi t0,a0,0
+jal zero,11
+ld t0,-640(gp)
+addi a0,t0,0
+jal ra,-5116
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-15747
+addi t0,a0,0
+jal zero,3
+jal ra,200
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+jal ra,-7899
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-16(s0)
+ld t0,-1600(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,5885
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,5991
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-7921
+addi t0,a0,0
+jal ra,-6702
+addi t0,a0,0
+beq t0,zero,4
+jal ra,165
+addi t0,a0,0
+jal zero,-5
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7935
+addi t0,a0,0
+jal zero,11
+ld t0,-640(gp)
+addi a0,t0,0
+jal ra,-5174
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-15805
+addi t0,a0,0
+jal zero,3
+jal ra,142
+addi t0,a0,0
+ld t0,-16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a1,t0,0
+jal ra,6029
+addi t0,a0,0
+jal zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,5942
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-5201
+addi t0,a0,0
+jal zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal ra,-5206
+addi t0,a0,0
+jal zero,5
+ld t0,-560(gp)
+addi a0,t0,0
+jal ra,-5211
+addi t0,a0,0
+ld t0,-1512(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1512(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8000
+addi t0,a0,0
+jal zero,5
+ld t0,-584(gp)
+addi a0,t0,0
+jal ra,-5239
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+jal ra,-685
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1464(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1464(gp)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5111
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-6287
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,5299
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-6168
+addi t0,a0,0
+jal zero,20
+ld t0,-1464(gp)
+ld t1,-1288(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-1464(gp)
+addi a0,t0,0
+ld t0,-1288(gp)
+addi a1,t0,0
+jal ra,-5140
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,5275
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1456(gp)
+addi a1,t0,0
+jal ra,5727
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+sd t0,-1456(gp)
+ld t0,-1520(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1520(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-6487
+addi t0,a0,0
+beq t0,zero,19
+jal ra,-5291
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-15970
+addi t0,a0,0
+jal zero,3
+jal ra,-8114
+addi t0,a0,0
+jal zero,-20
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,140
+jal ra,-8123
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-824(gp)
+addi a0,t0,0
+ld t0,-1232(gp)
+addi a1,t0,0
+jal ra,-4889
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1280(gp)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5234
+addi t0,a0,0
+jal ra,-8149
+addi t0,a0,0
+jal zero,42
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+jal ra,-8158
+addi t0,a0,0
+jal ra,-833
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1280(gp)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5259
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8180
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-5419
+addi t0,a0,0
+jal zero,6
+ld t0,-616(gp)
+addi a0,t0,0
+jal ra,-5424
+addi t0,a0,0
+jal zero,312
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-8199
+addi t0,a0,0
+jal ra,-874
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1272(gp)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,-5300
+addi t0,a0,0
+jal ra,-6428
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-6480
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5465
+addi t0,a0,0
+addi t0,zero,2
+addi a0,t0,0
+jal ra,-6360
+addi t0,a0,0
+ld t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1496(gp)
+jal zero,9
+ld t0,-688(gp)
+addi a0,t0,0
+jal ra,-5476
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-6373
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8254
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-5493
+addi t0,a0,0
+jal zero,243
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,198
+ld t0,-824(gp)
+sd t0,-24(s0)
+jal ra,-8270
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+jal ra,-8278
+addi t0,a0,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,-2028
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-6413
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8294
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-5533
+addi t0,a0,0
+jal zero,163
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,155
+ld t0,-24(s0)
+addi a0,t0,0
+ld t0,-1232(gp)
+addi a1,t0,0
+jal ra,-5217
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-15614
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-8320
+addi t0,a0,0
+jal ra,-995
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,-5421
+addi t0,a0,0
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-15605
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-15595
+addi t0,a0,0
+addi a0,t0,0
+jal ra,2558
+addi t0,a0,0
+beq t0,zero,26
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-6215
+addi t0,a0,0
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-15607
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-6617
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,4969
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-6498
+addi t0,a0,0
+jal zero,71
+ld t0,-40(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-11794
+addi t0,a0,0
+beq t0,zero,24
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-15635
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-40(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-6648
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5297
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-6528
+addi t0,a0,0
+jal zero,41
+ld t0,-32(s0)
+addi a0,t0,0
+jal ra,-5255
+addi t0,a0,0
+jal ra,-6665
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-40(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,12
+addi a2,t0,0
+jal ra,-12071
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-11788
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-6645
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5256
+addi t0,a0,0
+addi t0,zero,2
+addi a0,t0,0
+jal ra,-6569
+addi t0,a0,0
+ld t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1496(gp)
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8454
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-5693
+addi t0,a0,0
+jal zero,3
+jal ra,-5654
+addi t0,a0,0
+jal zero,40
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-805
+addi t0,a0,0
+jal zero,31
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-671
+addi t0,a0,0
+jal zero,22
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-500
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8497
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-5736
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-1272(gp)
+addi s1,t0,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+jal ra,-8523
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8531
+addi t0,a0,0
+jal zero,-8
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1280(gp)
+addi s1,t0,0
+jal ra,-8542
+addi t0,a0,0
+jal zero,-10
+jal zero,27
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-8552
+addi t0,a0,0
+ld t0,-1272(gp)
+addi s1,t0,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1280(gp)
+addi s1,t0,0
+jal ra,-8564
+addi t0,a0,0
+jal zero,-10
+jal zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal ra,-5804
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-81
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-1312(gp)
+addi a0,t0,0
+ld t0,-824(gp)
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1232(gp)
+addi a3,t0,0
+ld t0,-8(s0)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7886
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-8617
+addi t0,a0,0
+jal zero,25
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-5856
+addi t0,a0,0
+ld t0,-1312(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1840
+add t0,gp,t0
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1232(gp)
+addi a3,t0,0
+ld t0,-8(s0)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7913
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+jal ra,-8672
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,zero,1
+sd t0,-16(s0)
+jal ra,-8682
+addi t0,a0,0
+jal ra,-175
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8693
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-5932
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi t0,zero,1
+sd t0,-856(gp)
+jal ra,-8708
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-856(gp)
+ld t0,-848(gp)
+sub t0,zero,t0
+sd t0,-8(s0)
+jal zero,3
+ld t0,-848(gp)
+sd t0,-8(s0)
+jal ra,-7389
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-8721
+addi t0,a0,0
+jal zero,3
+jal ra,-5916
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8732
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-5971
+addi t0,a0,0
+jal zero,5
+ld t0,-688(gp)
+addi a0,t0,0
+jal ra,-5976
+addi t0,a0,0
+ld t0,-16(s0)
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-24(s0)
+addi a1,t0,0
+jal ra,-5842
+addi t0,a0,0
+jal zero,12
+ld t0,16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1272(gp)
+addi a1,t0,0
+jal ra,-5854
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,-1344(gp)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,84
+jal ra,-8805
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,74
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-230
+addi t0,a0,0
+addi s3,t0,0
+addi t0,zero,1
+addi s2,t0,0
+addi t0,s3,0
+addi t1,zero,2
+ld t2,-56(gp)
+mul t1,t1,t2
+addi t2,s2,0
+addi t3,zero,1
+sub t2,t2,t3
+ld t3,-56(gp)
+mul t2,t2,t3
+add t1,t1,t2
+addi t0,t0,48
+sd t1,0(t0)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-7337
+addi t0,a0,0
+beq t0,zero,36
+jal ra,-8836
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-8844
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+jal zero,22
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-267
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+addi t0,s3,0
+addi t1,zero,2
+ld t2,-56(gp)
+mul t1,t1,t2
+addi t2,s2,0
+addi t3,zero,1
+sub t2,t2,t3
+ld t3,-56(gp)
+mul t2,t2,t3
+add t1,t1,t2
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,-39
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-8877
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-6116
+addi t0,a0,0
+jal zero,3
+jal ra,-8885
+addi t0,a0,0
+jal zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal ra,-6124
+addi t0,a0,0
+addi t0,s1,0
+beq t0,zero,4
+addi t0,s2,0
+sub t0,zero,t0
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-10077
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1256(gp)
+addi a1,t0,0
+jal ra,-7974
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,-816(gp)
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,24(s0)
+addi a4,t0,0
+addi t0,s2,0
+addi a5,t0,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8202
+addi t0,a0,0
+addi s3,t0,0
+jal zero,14
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16233
+addi t0,a0,0
+ld t1,-1296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,s3,0
+ld t1,24(s0)
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s1,0
+beq t0,zero,35
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16233
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-12514
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16232
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1792
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-9714
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-16840
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16288
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16296
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-6091
+addi t0,a0,0
+jal ra,-9006
+addi t0,a0,0
+jal zero,322
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,314
+addi t0,zero,0
+sd t0,-48(s0)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-7987
+addi t0,a0,0
+beq t0,zero,63
+addi t0,zero,1
+sd t0,-40(s0)
+addi t0,s3,0
+ld t1,-816(gp)
+addi t0,t0,16
+sd t1,0(t0)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16327
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16335
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-6130
+addi t0,a0,0
+addi t0,s3,0
+ld t1,24(s0)
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16318
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-16326
+addi t0,a0,0
+sd t0,-48(s0)
+addi t0,s3,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-1536(gp)
+addi a1,t0,0
+jal ra,-12039
+addi t0,a0,0
+beq t0,zero,9
+ld t0,-920(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+ld t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1480(gp)
+jal zero,21
+addi t0,zero,0
+sd t0,-40(s0)
+lui t0,0xFFFFE
+addi t0,t0,1784
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-9860
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1744
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-10369
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-9104
+addi t0,a0,0
+addi t0,zero,0
+addi s4,t0,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+addi t0,s4,0
+ld t1,-56(gp)
+add t0,t0,t1
+addi s4,t0,0
+addi t0,s4,0
+sub t0,zero,t0
+addi a0,t0,0
+jal ra,-537
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-9129
+addi t0,a0,0
+jal zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal ra,-6368
+addi t0,a0,0
+jal zero,-28
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-7072
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-56(s0)
+addi t0,s4,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-3632
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-3604
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-64(s0)
+addi t0,zero,1
+sd t0,-1424(gp)
+addi t0,s3,0
+sd t0,-1448(gp)
+addi t0,zero,0
+sd t0,-1456(gp)
+ld t0,24(s0)
+sd t0,-1464(gp)
+jal ra,-7953
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-1086
+addi t0,a0,0
+jal zero,-5
+addi t0,zero,0
+sd t0,-1464(gp)
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,130
+ld t0,24(s0)
+ld t1,-1288(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,4137
+addi t0,a0,0
+ld t0,-1456(gp)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a1,t0,0
+jal ra,4910
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-1456(gp)
+addi t0,s4,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-1424(gp)
+jal zero,29
+addi t0,s1,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-1424(gp)
+jal zero,24
+addi t0,s2,0
+ld t1,-1584(gp)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-1424(gp)
+jal zero,17
+ld t0,-64(s0)
+addi a0,t0,0
+jal ra,3759
+addi t0,a0,0
+addi a0,t0,0
+jal ra,2088
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-1424(gp)
+ld t0,-1424(gp)
+beq t0,zero,14
+ld t0,-64(s0)
+addi a0,t0,0
+jal ra,-3420
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,4568
+addi t0,a0,0
+jal zero,26
+ld t0,-56(s0)
+addi a0,t0,0
+ld t0,-64(s0)
+addi a1,t0,0
+jal ra,-7037
+addi t0,a0,0
+sd t0,-56(s0)
+addi t0,s1,0
+beq t0,zero,9
+addi t0,s2,0
+sub t0,zero,t0
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-3543
+addi t0,a0,0
+jal zero,7
+addi t0,s2,0
+ld t1,-56(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-3550
+addi t0,a0,0
+ld t0,-56(s0)
+sd t0,-64(s0)
+ld t0,-40(s0)
+beq t0,zero,27
+ld t0,-48(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-48(s0)
+addi a0,t0,0
+ld t0,-64(s0)
+addi a1,t0,0
+jal ra,4820
+addi t0,a0,0
+addi t0,s3,0
+ld t1,-64(s0)
+addi t0,t0,48
+sd t1,0(t0)
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-5333
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+jal ra,-9314
+addi t0,a0,0
+jal zero,11
+ld t0,-640(gp)
+addi a0,t0,0
+jal ra,-6553
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-17184
+addi t0,a0,0
+jal zero,3
+jal ra,-6520
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-1448(gp)
+addi t0,zero,0
+sd t0,-1344(gp)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,175
+jal ra,-7680
+addi t0,a0,0
+beq t0,zero,19
+jal ra,-6553
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi a0,t0,0
+jal ra,-17232
+addi t0,a0,0
+jal zero,3
+jal ra,-9376
+addi t0,a0,0
+jal zero,-20
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-9385
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-9393
+addi t0,a0,0
+ld t0,-1280(gp)
+addi s1,t0,0
+jal zero,3
+ld t0,-1288(gp)
+addi s1,t0,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-824(gp)
+addi s2,t0,0
+jal ra,-9408
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-632
+addi t0,a0,0
+jal zero,5
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-6653
+addi t0,a0,0
+jal zero,110
+jal ra,-913
+addi t0,a0,0
+addi s1,t0,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,97
+ld t0,-824(gp)
+addi s2,t0,0
+jal ra,-9433
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi t0,s2,0
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-663
+addi t0,a0,0
+jal zero,79
+ld t0,-816(gp)
+addi s3,t0,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-9456
+addi t0,a0,0
+addi t0,zero,0
+addi s4,t0,0
+jal zero,6
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-807
+addi t0,a0,0
+addi s4,t0,0
+addi t0,s2,0
+addi a0,t0,0
+ld t0,-1232(gp)
+addi a1,t0,0
+jal ra,-8538
+addi t0,a0,0
+addi s5,t0,0
+addi t0,s5,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+ld t0,-1304(gp)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi t0,s3,0
+addi a2,t0,0
+ld t0,-1232(gp)
+addi a3,t0,0
+addi t0,s1,0
+addi a4,t0,0
+addi t0,s4,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8777
+addi t0,a0,0
+jal zero,19
+lui t0,0xFFFFE
+addi t0,t0,1736
+add t0,gp,t0
+addi a0,t0,0
+addi t0,s3,0
+addi a1,t0,0
+jal ra,-10282
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1688
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,s2,0
+sd t0,8(sp)
+jal ra,-10791
+addi sp,sp,8
+addi t0,a0,0
+jal zero,5
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-6763
+addi t0,a0,0
+jal zero,-178
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-1448(gp)
+addi a0,t0,0
+jal ra,-16837
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-13118
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-10310
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+ld t0,-1344(gp)
+addi a0,t0,0
+ld t0,-824(gp)
+addi a1,t0,0
+ld t0,-1232(gp)
+addi a2,t0,0
+jal ra,-8718
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,71
+jal ra,-9593
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+jal ra,-9601
+addi t0,a0,0
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1448(gp)
+addi a0,t0,0
+jal ra,-16892
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-56(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-6249
+addi t0,a0,0
+jal ra,-7879
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-7884
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-1664(gp)
+addi a2,t0,0
+jal ra,3741
+addi t0,a0,0
+ld t0,-1664(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-16909
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-7907
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,4038
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-7787
+addi t0,a0,0
+jal zero,7
+ld t0,-824(gp)
+addi a0,t0,0
+jal ra,-10330
+addi t0,a0,0
+jal ra,-9667
+addi t0,a0,0
+jal zero,5
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-6906
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld t0,-1344(gp)
+addi a0,t0,0
+ld t0,-824(gp)
+addi a1,t0,0
+ld t0,-1232(gp)
+addi a2,t0,0
+jal ra,-8835
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,80
+jal ra,-9710
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,67
+jal ra,-9718
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-16989
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-8012
+addi t0,a0,0
+jal ra,-7984
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1664(gp)
+addi a1,t0,0
+ld t0,-16(s0)
+addi a2,t0,0
+jal ra,3899
+addi t0,a0,0
+jal ra,-7949
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-7998
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3885
+addi t0,a0,0
+jal ra,-8007
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-8012
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-56(gp)
+addi a2,t0,0
+jal ra,3574
+addi t0,a0,0
+ld t0,-1664(gp)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-8028
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,3917
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-7908
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-7020
+addi t0,a0,0
+jal zero,7
+ld t0,-824(gp)
+addi a0,t0,0
+jal ra,-10456
+addi t0,a0,0
+jal ra,-9793
+addi t0,a0,0
+jal zero,5
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-7032
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1448(gp)
+addi a0,t0,0
+jal ra,-17093
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-13374
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1560
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-10566
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-9835
+addi t0,a0,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-9843
+addi t0,a0,0
+jal zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal ra,-7082
+addi t0,a0,0
+jal zero,5
+ld t0,-544(gp)
+addi a0,t0,0
+jal ra,-7087
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-8153
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a2,t0,0
+jal ra,3460
+addi t0,a0,0
+jal ra,-8135
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,3451
+addi t0,a0,0
+jal ra,-8144
+addi t0,a0,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-8152
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,3646
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-8167
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,3502
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-8047
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-8103
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,3396
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-8119
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,3506
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,22
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,3308
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-10
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1248(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,3
+jal ra,3272
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+add t0,t0,t1
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-11061
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1224(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+jal ra,-8930
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3282
+addi t0,a0,0
+jal zero,170
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,31
+addi a0,t0,0
+jal ra,-13832
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi a0,t0,0
+jal ra,-13842
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-6712
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1528
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-10829
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-17955
+addi t0,a0,0
+ld t0,-1624(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-8359
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3227
+addi t0,a0,0
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-8240
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3215
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+addi a2,t0,0
+jal ra,3205
+addi t0,a0,0
+jal ra,3732
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-279
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+addi a2,t0,0
+jal ra,3187
+addi t0,a0,0
+jal ra,3714
+addi t0,a0,0
+ld t0,-1544(gp)
+addi a0,t0,0
+ld t0,-1232(gp)
+addi a1,t0,0
+jal ra,-9225
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,-17414
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,-17436
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-1680(gp)
+addi a2,t0,0
+jal ra,3518
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3152
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,3441
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+ld t0,-1616(gp)
+addi a1,t0,0
+ld t0,-56(gp)
+addi a2,t0,0
+jal ra,3136
+addi t0,a0,0
+ld t0,-1536(gp)
+addi a0,t0,0
+ld t0,-1256(gp)
+addi a1,t0,0
+jal ra,-9274
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi a0,t0,0
+ld t0,-1536(gp)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,-17500
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-6698
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-376(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-18111
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-13631
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,1
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1520
+add t0,gp,t0
+sd t0,-920(gp)
+ld t0,-920(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi a0,t0,0
+jal ra,-11139
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1256(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1248(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+addi a0,t0,0
+jal ra,-11156
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1232(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1224(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-11179
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1208(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+ld t1,-56(gp)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-11192
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1200(t1)
+jal ra,-17466
+addi t0,a0,0
+jal ra,-17073
+addi t0,a0,0
+jal ra,-403
+addi t0,a0,0
+jal ra,5844
+addi t0,a0,0
+jal ra,5982
+addi t0,a0,0
+jal ra,6396
+addi t0,a0,0
+jal ra,6810
+addi t0,a0,0
+jal ra,7288
+addi t0,a0,0
+jal ra,7829
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,13
+jal ra,9971
+addi t0,a0,0
+jal ra,10015
+addi t0,a0,0
+jal ra,10059
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-24(s0)
+jal ra,10154
+addi t0,a0,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1504
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1264(gp)
+addi a3,t0,0
+ld t0,-1288(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9684
+addi t0,a0,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1496
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1264(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9703
+addi t0,a0,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1488
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1264(gp)
+addi a3,t0,0
+ld t0,-1288(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9722
+addi t0,a0,0
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,-1536(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9739
+addi t0,a0,0
+addi t0,s1,0
+beq t0,zero,211
+jal ra,26501
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi s1,t0,0
+jal zero,200
+addi t0,zero,0
+addi a0,t0,0
+jal ra,26507
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-13788
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi s1,t0,0
+jal zero,183
+jal ra,26522
+addi t0,a0,0
+sd t0,-920(gp)
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+lui t0,0xFFFFE
+addi t0,t0,1448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-11784
+addi sp,sp,16
+addi t0,a0,0
+ld t0,-920(gp)
+addi a0,t0,0
+jal ra,-272
+addi t0,a0,0
+sd t0,-928(gp)
+ld t0,-928(gp)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-14086
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-11810
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-18408
+addi t0,a0,0
+jal ra,-17954
+addi t0,a0,0
+jal ra,-17628
+addi t0,a0,0
+jal ra,-1212
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1352
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+ld t0,-816(gp)
+sd t0,24(sp)
+ld t0,-896(gp)
+sd t0,32(sp)
+jal ra,-11840
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld t0,-872(gp)
+addi a0,t0,0
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+addi a1,t0,0
+jal ra,-12973
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-872(gp)
+addi a0,t0,0
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+addi a1,t0,0
+jal ra,-12941
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-904(gp)
+sd t0,40(sp)
+jal ra,-11876
+addi sp,sp,40
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1224
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-1360(gp)
+sd t0,16(sp)
+ld t0,-1368(gp)
+sd t0,24(sp)
+ld t0,-1376(gp)
+sd t0,32(sp)
+jal ra,-11894
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-1480(gp)
+sd t0,16(sp)
+ld t0,-1488(gp)
+sd t0,24(sp)
+ld t0,-1496(gp)
+sd t0,32(sp)
+ld t0,-1504(gp)
+sd t0,40(sp)
+ld t0,-1512(gp)
+sd t0,48(sp)
+ld t0,-1520(gp)
+sd t0,56(sp)
+jal ra,-11918
+addi sp,sp,56
+addi t0,a0,0
+ld t0,-912(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,1072
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-912(gp)
+sd t0,16(sp)
+ld t0,-920(gp)
+sd t0,24(sp)
+jal ra,-11939
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal ra,-18537
+addi t0,a0,0
+jal zero,-211
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1024
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-11964
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-709
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,5
+ld t0,-24(s0)
+addi a0,t0,0
+jal ra,9885
+addi t0,a0,0
+jal ra,3566
+addi t0,a0,0
+jal ra,3720
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1264(t1)
+lui t0,0xFFFFE
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-1392(gp)
+ld t1,-1384(gp)
+divu t0,t0,t1
+sd t0,16(sp)
+ld t0,-1392(gp)
+sd t0,24(sp)
+jal ra,-11999
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,872
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,32(sp)
+jal ra,-12031
+addi sp,sp,32
+addi t0,a0,0
+jal ra,1775
+addi t0,a0,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1856(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-12976
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-1616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+addi t0,a0,0
+ld t1,-1664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+addi t0,a0,0
+ld t1,-1608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-52
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-1680(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+addi t0,a0,0
+ld t1,-1736(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-1672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,21
+jal zero,16
+addi t0,a0,0
+ld t1,-1744(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+addi t0,a0,0
+ld t1,-1816(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t1,-1640(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+addi t0,a0,0
+ld t1,-1656(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+addi t0,a0,0
+ld t1,-1824(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,26
+jal ra,16634
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-13196
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-234
+addi t0,a0,0
+jal ra,-13150
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,17451
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+addi t2,a0,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-106
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-41
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14527
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lui t0,0xFFFFE
+addi t0,t0,816
+add t0,gp,t0
+addi a0,t0,0
+ld t0,-816(gp)
+addi a1,t0,0
+jal ra,-11892
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,776
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-14907
+addi t0,a0,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-14915
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(sp)
+jal ra,-12418
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-19016
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-64
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd a5,56(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-14878
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-14885
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,3
+addi a1,t0,0
+jal ra,-14892
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-14899
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-14906
+addi t0,a0,0
+ld t1,56(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,25
+addi a1,t0,0
+addi t0,zero,7
+addi a2,t0,0
+jal ra,-14881
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+addi t0,zero,5
+addi a2,t0,0
+jal ra,-14902
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,15
+addi a1,t0,0
+addi t0,zero,5
+addi a2,t0,0
+jal ra,-14923
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,3
+addi a2,t0,0
+jal ra,-14944
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+addi t0,zero,5
+addi a2,t0,0
+jal ra,-14965
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,7
+addi a2,t0,0
+jal ra,-14986
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-134
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-122
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-110
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-98
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-86
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-314
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-14744
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15128
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,3
+addi a1,t0,0
+jal ra,-15135
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15142
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-15149
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+addi t0,zero,12
+addi a2,t0,0
+jal ra,-15124
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-14841
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-243
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-231
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-219
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-69
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-455
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-14885
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+addi t0,zero,7
+addi a2,t0,0
+jal ra,-15223
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+addi t0,zero,5
+addi a2,t0,0
+jal ra,-15232
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15287
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15294
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,3
+addi a1,t0,0
+jal ra,-15301
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15308
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-15315
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,25
+addi a1,t0,0
+addi t0,zero,7
+addi a2,t0,0
+jal ra,-15293
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+addi t0,zero,5
+addi a2,t0,0
+jal ra,-15302
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15357
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-15028
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-447
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-435
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-423
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-88
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,13
+addi a1,t0,0
+jal ra,-644
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,13
+addi a1,t0,0
+jal ra,-15074
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15412
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+addi t0,zero,6
+addi a2,t0,0
+jal ra,-15421
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+addi t0,zero,4
+addi a2,t0,0
+jal ra,-15430
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,11
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15439
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,6
+addi a1,t0,0
+jal ra,-15494
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15501
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15508
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,3
+addi a1,t0,0
+jal ra,-15515
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,4
+addi a1,t0,0
+jal ra,-15522
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15529
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-15536
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,31
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15516
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,25
+addi a1,t0,0
+addi t0,zero,6
+addi a2,t0,0
+jal ra,-15525
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+addi t0,zero,4
+addi a2,t0,0
+jal ra,-15534
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15543
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15598
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,6
+addi a1,t0,0
+jal ra,-15605
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,4
+addi a1,t0,0
+jal ra,-15612
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15619
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,13
+addi a1,t0,0
+jal ra,-15288
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-707
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-695
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-683
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-125
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,21
+addi a1,t0,0
+jal ra,-902
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,21
+addi a1,t0,0
+jal ra,-15332
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15670
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+jal ra,-15679
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,11
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15688
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,8
+addi a2,t0,0
+jal ra,-15697
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,10
+addi a1,t0,0
+jal ra,-15752
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15759
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-15766
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15773
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-15780
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,31
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15760
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,21
+addi a1,t0,0
+addi t0,zero,10
+addi a2,t0,0
+jal ra,-15769
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+jal ra,-15778
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,8
+addi a2,t0,0
+jal ra,-15787
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-15842
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15849
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,10
+addi a1,t0,0
+jal ra,-15856
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-15863
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,21
+addi a1,t0,0
+jal ra,-15532
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-900
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-115
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-1131
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-15561
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,5
+addi a1,t0,0
+jal ra,-15945
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,7
+addi a1,t0,0
+jal ra,-15952
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+addi t0,zero,20
+addi a2,t0,0
+jal ra,-15927
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-15644
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1680(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1712(t1)
+ld t0,-1600(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1720(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1688(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-1012
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1704(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-59
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1696(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1376(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,128(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,120(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,112(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,96(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,752
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,15168
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-136
+addi t0,a0,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-14857
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-144
+addi t0,a0,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-14824
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-13757
+addi sp,sp,32
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-53
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,736
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14902
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14868
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-13801
+addi sp,sp,16
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-13822
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+addi a2,t0,0
+jal ra,-72
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,712
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14751
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,672(t0)
+addi a2,t0,0
+jal ra,-92
+addi t0,a0,0
+jal ra,-14715
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,696
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-13870
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+addi a2,t0,0
+jal ra,-120
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,688
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14799
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi a2,t0,0
+jal ra,-140
+addi t0,a0,0
+jal ra,-14763
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,672
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-13918
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+addi a2,t0,0
+jal ra,-168
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,664
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14847
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi a2,t0,0
+jal ra,-188
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,656
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14867
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi a2,t0,0
+jal ra,-208
+addi t0,a0,0
+jal ra,-14831
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,640
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-13986
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+addi a2,t0,0
+jal ra,-236
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,632
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14915
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+addi a2,t0,0
+jal ra,-256
+addi t0,a0,0
+jal ra,-14879
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-14034
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+addi a2,t0,0
+jal ra,-284
+addi t0,a0,0
+jal ra,-14907
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,600
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-14062
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+addi a2,t0,0
+jal ra,-312
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,592
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-14991
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+addi a2,t0,0
+jal ra,-332
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,584
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-15011
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+addi a2,t0,0
+jal ra,-352
+addi t0,a0,0
+jal ra,-14975
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,568
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-14130
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi a1,t0,0
+jal ra,-418
+addi t0,a0,0
+jal ra,-14999
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi a2,t0,0
+jal ra,-16547
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi a2,t0,0
+jal ra,-16572
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi t1,a0,0
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,536
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-13706
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-20832
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-71
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-127
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-114
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+ld t1,-56(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-98
+addi t0,a0,0
+jal zero,70
+ld t0,16(s0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-77
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi a1,t0,0
+jal ra,-16775
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,24(s0)
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-133
+addi t0,a0,0
+jal zero,35
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi a1,t0,0
+jal ra,-16795
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-118
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-168
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+addi t1,a0,0
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,504
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-13900
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal ra,-21026
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-167
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-816(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1904(t0)
+addi a2,t0,0
+ld t0,-1600(gp)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+addi a4,t0,0
+jal ra,-1870
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-32
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-104
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1944(t0)
+addi a2,t0,0
+jal ra,-1097
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-136
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+addi a2,t0,0
+ld t0,16(s0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+addi a4,t0,0
+jal ra,-1955
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-175
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1888(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2236
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-218
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1880(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2279
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-261
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1872(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2322
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-304
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1864(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2365
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-347
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1856(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2408
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-390
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1848(t0)
+addi a3,t0,0
+ld t0,16(s0)
+addi a4,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+addi a5,t0,0
+jal ra,-2451
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-433
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-72(gp)
+beq t0,zero,21
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1840(t0)
+addi a2,t0,0
+ld t0,16(s0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+addi a4,t0,0
+jal ra,-2254
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-474
+addi t0,a0,0
+jal zero,20
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+addi a2,t0,0
+ld t0,16(s0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+addi a4,t0,0
+jal ra,-2274
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-494
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-72(gp)
+beq t0,zero,21
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1832(t0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+addi a4,t0,0
+jal ra,-2175
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-535
+addi t0,a0,0
+jal zero,20
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1816(t0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+addi a4,t0,0
+jal ra,-2195
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-555
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,16(s0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1936(t0)
+addi a4,t0,0
+jal ra,-2045
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-594
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1920(t0)
+addi a2,t0,0
+jal ra,-1817
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-626
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+addi a2,t0,0
+ld t0,16(s0)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1928(t0)
+addi a4,t0,0
+jal ra,-2445
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-665
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi a2,t0,0
+ld t0,-1600(gp)
+addi a3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1912(t0)
+addi a4,t0,0
+jal ra,-2483
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-703
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1280(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-921
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2690
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2679
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2670
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+addi sp,sp,-32
+sd a3,24(sp)
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2642
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+ld a3,24(sp)
+addi sp,sp,32
+addi a4,t0,0
+jal ra,-2242
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-949
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1004
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2708
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2697
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-2035
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1002
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1057
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2801
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2790
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2781
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+addi sp,sp,-32
+sd a3,24(sp)
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-2774
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+ld a3,24(sp)
+addi sp,sp,32
+addi a4,t0,0
+jal ra,-2703
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1081
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1141
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-2039
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-156
+addi t0,a0,0
+addi t0,s1,0
+sd t0,16(s0)
+jal zero,-21
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-1025
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21550
+addi t0,a0,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-17383
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-15259
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s2,0
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,39
+addi t0,s1,0
+ld t0,0(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21503
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi t1,s2,0
+add t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21575
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-101
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s2,0
+ld t1,-56(gp)
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-41
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1328(gp)
+sltu t0,t0,t1
+beq t0,zero,111
+ld t0,-1336(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21614
+addi t0,a0,0
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21593
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21585
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21655
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-181
+addi t0,a0,0
+jal zero,51
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21651
+addi t0,a0,0
+ld t1,-1240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21630
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21622
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21692
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-218
+addi t0,a0,0
+jal zero,14
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21688
+addi t0,a0,0
+ld t1,-1248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-188
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-21742
+addi t0,a0,0
+addi s2,t0,0
+jal zero,-97
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-113
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi a0,t0,0
+jal ra,-15249
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi a1,t0,0
+jal ra,1424
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-31
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-72(gp)
+beq t0,zero,329
+ld t0,-8(s0)
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-18159
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1624(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18176
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi a0,t0,0
+addi t0,zero,24
+addi a1,t0,0
+jal ra,-18193
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1600(t0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-18210
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1592(t0)
+addi a0,t0,0
+addi t0,zero,40
+addi a1,t0,0
+jal ra,-18227
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+addi a0,t0,0
+addi t0,zero,48
+addi a1,t0,0
+jal ra,-18244
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+addi a0,t0,0
+addi t0,zero,56
+addi a1,t0,0
+jal ra,-18261
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1568(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-18287
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1552(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18313
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1536(t0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-18330
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1528(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1520(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1512(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1504(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-18383
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+addi a0,t0,0
+addi t0,zero,48
+addi a1,t0,0
+jal ra,-18400
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18426
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-18443
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi a0,t0,0
+addi t0,zero,48
+addi a1,t0,0
+jal ra,-18460
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,288
+ld t0,-8(s0)
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-18487
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1624(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18504
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi a0,t0,0
+addi t0,zero,24
+addi a1,t0,0
+jal ra,-18521
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1592(t0)
+addi a0,t0,0
+addi t0,zero,8
+addi a1,t0,0
+jal ra,-18547
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18564
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+addi a0,t0,0
+addi t0,zero,24
+addi a1,t0,0
+jal ra,-18581
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1568(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1560(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1552(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18625
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1536(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1528(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1520(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1512(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1504(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1496(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18696
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18722
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi a0,t0,0
+addi t0,zero,16
+addi a1,t0,0
+jal ra,-18748
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+addi t0,zero,5
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1440(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1432(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1424(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1400(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,81
+addi t0,a0,0
+addi t0,zero,6
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1440(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-16144
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1432(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1424(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1400(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,32
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1488(t1)
+addi t2,a0,0
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-24(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-25
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-72(gp)
+beq t0,zero,110
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi a0,t0,0
+addi t0,zero,32
+addi a1,t0,0
+jal ra,-18905
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1424(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1416(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1392(t1)
+sd t1,0(t0)
+jal zero,105
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1424(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1416(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1392(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-259
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1248(t1)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-49
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-61
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+add t0,t0,t1
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-16519
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1224(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal ra,-1078
+addi t0,a0,0
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+ld t2,-24(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,s1,0
+addi t2,s2,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,10
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-30
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-408(gp)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-23419
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-18939
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-16890
+addi sp,sp,16
+addi t0,a0,0
+jal zero,214
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi a0,t0,0
+ld t0,-424(gp)
+addi a1,t0,0
+jal ra,-76
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-19197
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-16923
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-23521
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi a2,t0,0
+jal ra,-23528
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,352
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-16963
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-23561
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-16749
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,123
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi a1,t0,0
+ld t0,-16(s0)
+addi a2,t0,0
+jal ra,-23585
+addi t0,a0,0
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-17018
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-23616
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi a2,t0,0
+jal ra,-23623
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,240
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-17058
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-23656
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,160
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,40(sp)
+jal ra,-17104
+addi sp,sp,40
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi s1,t0,0
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,s1,0
+ld t0,0(t0)
+addi s2,t0,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sltu t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+ld t0,0(t0)
+addi s2,t0,0
+jal zero,-25
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+addi t0,s1,0
+ld t1,24(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+ld t0,0(t0)
+addi s2,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,21090
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi a0,t0,0
+jal ra,-5690
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-19504
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFE
+addi t0,t0,120
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-17230
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-23828
+addi t0,a0,0
+jal ra,-1566
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1264(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1248(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1224(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1208(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1200(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi a2,t0,0
+jal ra,-23867
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,164
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi a0,t0,0
+jal ra,-593
+addi t0,a0,0
+beq t0,zero,157
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-17073
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-17017
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a1,t0,0
+jal ra,-17089
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-24(s0)
+addi a1,t0,0
+jal ra,-213
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1256(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi a0,t0,0
+jal ra,-17038
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi a1,t0,0
+jal ra,-229
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1232(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi a1,t0,0
+ld t0,-24(s0)
+addi a2,t0,0
+jal ra,-23943
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-19457
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,83
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi a2,t0,0
+jal ra,-23969
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-19483
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-368(gp)
+addi a1,t0,0
+ld t0,-24(gp)
+addi a2,t0,0
+jal ra,-23993
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lui t0,0xFFFFE
+addi t0,t0,40
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,40(sp)
+jal ra,-17448
+addi sp,sp,40
+addi t0,a0,0
+jal zero,23
+lui t0,0xFFFFE
+addi t0,t0,-8
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+jal ra,-17465
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-24063
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-16
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1288(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15506
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi a2,t0,0
+jal ra,-2908
+addi t0,a0,0
+jal ra,-2381
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18444
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11944
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-40
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18454
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-20985
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-19622
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFE
+addi t0,t0,-128
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-17582
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-168
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-20776
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-20826
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-19704
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-17611
+addi sp,sp,24
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-176
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,3
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15646
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+addi a2,t0,0
+jal ra,-3048
+addi t0,a0,0
+jal ra,-2521
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-2568
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s8,-64(s0)
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,41
+lui t0,0xFFFFE
+addi t0,t0,-192
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18599
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11853
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-200
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18609
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+jal ra,11779
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-208
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18619
+addi t0,a0,0
+ld t0,-1696(gp)
+addi a0,t0,0
+jal ra,11833
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-216
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18629
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11823
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21164
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21174
+addi t0,a0,0
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21184
+addi t0,a0,0
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-320
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+addi t0,s2,0
+sd t0,32(sp)
+jal ra,-17776
+addi sp,sp,32
+addi t0,a0,0
+addi t0,zero,0
+addi s4,t0,0
+ld t0,-24(gp)
+addi s5,t0,0
+addi t0,zero,0
+addi s6,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,148
+addi t0,s3,0
+addi t1,s5,0
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,s3,0
+addi s5,t0,0
+addi t0,s2,0
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,3532
+addi t0,a0,0
+beq t0,zero,116
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,17473
+addi t0,a0,0
+beq t0,zero,90
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,18133
+addi t0,a0,0
+beq t0,zero,64
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21238
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,3568
+addi t0,a0,0
+addi s7,t0,0
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s7,0
+addi a1,t0,0
+addi t0,s5,0
+addi a2,t0,0
+jal ra,-24421
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-19935
+addi t0,a0,0
+addi s8,t0,0
+addi t0,s8,0
+addi t1,s5,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+addi t0,s4,0
+addi t1,s8,0
+add t0,t0,t1
+addi s4,t0,0
+addi t0,s3,0
+addi t1,s8,0
+sub t0,t0,t1
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,s2,0
+ld t1,-24(gp)
+add t0,t0,t1
+addi s2,t0,0
+jal zero,14
+addi t0,zero,0
+addi a0,t0,0
+addi t0,s8,0
+addi a1,t0,0
+jal ra,-20159
+addi t0,a0,0
+beq t0,zero,5
+addi t0,s4,0
+addi t1,s8,0
+add t0,t0,t1
+addi s4,t0,0
+addi t0,zero,0
+addi s3,t0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17894
+addi sp,sp,16
+addi t0,a0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17913
+addi sp,sp,16
+addi t0,a0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-584
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17932
+addi sp,sp,16
+addi t0,a0,0
+jal zero,-150
+addi t0,s6,0
+beq t0,zero,24
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21375
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-20010
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21398
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21426
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s4,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+jal ra,-18003
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-656
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-18922
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11530
+addi t0,a0,0
+jal ra,-18876
+addi t0,a0,0
+ld s8,-64(s0)
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-664
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,3
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16062
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi a2,t0,0
+jal ra,-3464
+addi t0,a0,0
+jal ra,-2937
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-2984
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s8,-64(s0)
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,41
+lui t0,0xFFFFE
+addi t0,t0,-680
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19015
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11437
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-688
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19025
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+jal ra,11363
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-696
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19035
+addi t0,a0,0
+ld t0,-1696(gp)
+addi a0,t0,0
+jal ra,11417
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-704
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19045
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11407
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21580
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21590
+addi t0,a0,0
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21600
+addi t0,a0,0
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s3,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-808
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+addi t0,s2,0
+sd t0,24(sp)
+addi t0,s1,0
+sd t0,32(sp)
+jal ra,-18192
+addi sp,sp,32
+addi t0,a0,0
+addi t0,zero,0
+addi s4,t0,0
+ld t0,-24(gp)
+addi s5,t0,0
+addi t0,zero,0
+addi s6,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,148
+addi t0,s3,0
+addi t1,s5,0
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,s3,0
+addi s5,t0,0
+addi t0,s2,0
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,3116
+addi t0,a0,0
+beq t0,zero,116
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,17057
+addi t0,a0,0
+beq t0,zero,90
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,17717
+addi t0,a0,0
+beq t0,zero,64
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21654
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,3152
+addi t0,a0,0
+addi s7,t0,0
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s7,0
+addi a1,t0,0
+addi t0,s5,0
+addi a2,t0,0
+jal ra,-24834
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-20351
+addi t0,a0,0
+addi s8,t0,0
+addi t0,s8,0
+addi t1,s5,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+addi t0,s4,0
+addi t1,s8,0
+add t0,t0,t1
+addi s4,t0,0
+addi t0,s3,0
+addi t1,s8,0
+sub t0,t0,t1
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,s2,0
+ld t1,-24(gp)
+add t0,t0,t1
+addi s2,t0,0
+jal zero,14
+addi t0,zero,0
+addi a0,t0,0
+addi t0,s8,0
+addi a1,t0,0
+jal ra,-20575
+addi t0,a0,0
+beq t0,zero,5
+addi t0,s4,0
+addi t1,s8,0
+add t0,t0,t1
+addi s4,t0,0
+addi t0,zero,0
+addi s3,t0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18310
+addi sp,sp,16
+addi t0,a0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-992
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18329
+addi sp,sp,16
+addi t0,a0,0
+jal zero,19
+addi t0,zero,1
+addi s6,t0,0
+addi t0,zero,0
+addi s3,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18348
+addi sp,sp,16
+addi t0,a0,0
+jal zero,-150
+addi t0,s6,0
+beq t0,zero,24
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21791
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-20426
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21814
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-21842
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1136
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s4,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+jal ra,-18419
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1144
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19338
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,11114
+addi t0,a0,0
+jal ra,-19292
+addi t0,a0,0
+ld s8,-64(s0)
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-1152
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,3
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16478
+addi t0,a0,0
+ld t0,-1704(gp)
+addi a0,t0,0
+ld t0,-1696(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3878
+addi t0,a0,0
+ld t0,-1696(gp)
+addi a0,t0,0
+ld t0,-1688(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3886
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+ld t0,-1680(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3894
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+addi a2,t0,0
+jal ra,-3904
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+addi a2,t0,0
+jal ra,-3914
+addi t0,a0,0
+jal ra,-3387
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-3434
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-352(gp)
+ld t2,-24(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,133
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,2774
+addi t0,a0,0
+beq t0,zero,108
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,16715
+addi t0,a0,0
+beq t0,zero,83
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,17375
+addi t0,a0,0
+beq t0,zero,21
+ld t0,32(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22003
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,2865
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18605
+addi sp,sp,16
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,93
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+ld t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,32(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-20657
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,69
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-26
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,24(s0)
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1320
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18660
+addi sp,sp,16
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,38
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1400
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18678
+addi sp,sp,16
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,20
+jal zero,-137
+lui t0,0xFFFFE
+addi t0,t0,-1480
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18696
+addi sp,sp,16
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,51
+lui t0,0xFFFFE
+addi t0,t0,-1496
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19636
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,10752
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1504
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19646
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+jal ra,10742
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1512
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19656
+addi t0,a0,0
+ld t0,-1696(gp)
+addi a0,t0,0
+jal ra,10732
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1520
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19666
+addi t0,a0,0
+ld t0,-1704(gp)
+addi a0,t0,0
+jal ra,10754
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1528
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19676
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+jal ra,10776
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22211
+addi t0,a0,0
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22221
+addi t0,a0,0
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22231
+addi t0,a0,0
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+ld t0,-360(gp)
+addi a2,t0,0
+jal ra,-275
+addi t0,a0,0
+beq t0,zero,60
+ld t0,-16(s0)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-408(gp)
+sd t0,-16(s0)
+ld t0,-360(gp)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+ld t0,-24(s0)
+addi a2,t0,0
+jal ra,-25410
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-20930
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22274
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1616
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-360(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,-32(s0)
+sd t0,40(sp)
+jal ra,-18868
+addi sp,sp,40
+addi t0,a0,0
+jal zero,23
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22309
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-20944
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22349
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1624
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-19825
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,10627
+addi t0,a0,0
+jal ra,-19779
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-1632
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1280(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16959
+addi t0,a0,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-1640
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1280(gp)
+addi a4,t0,0
+addi t0,zero,1
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16980
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+ld t0,-1304(gp)
+addi a0,t0,0
+ld t0,-1544(gp)
+addi a1,t0,0
+addi t0,zero,1
+addi a2,t0,0
+ld t0,-1232(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17008
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-1360(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-1360(gp)
+jal ra,-16030
+addi t0,a0,0
+jal ra,-16002
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-1680(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4416
+addi t0,a0,0
+jal ra,-16011
+addi t0,a0,0
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-7899
+addi t0,a0,0
+jal ra,-16048
+addi t0,a0,0
+jal ra,-16020
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25022
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25047
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-4153
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16049
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-16013
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-4431
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+addi a2,t0,0
+jal ra,-4480
+addi t0,a0,0
+jal ra,-3953
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16081
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,-4080
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,-4092
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16066
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,-4109
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4536
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,-4129
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25140
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25162
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-1680(gp)
+addi a2,t0,0
+jal ra,-4208
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16165
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4579
+addi t0,a0,0
+addi t0,zero,2
+addi a0,t0,0
+jal ra,-16046
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4101
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22482
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,2112
+addi t0,a0,0
+beq t0,zero,43
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,16006
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-19244
+addi sp,sp,16
+addi t0,a0,0
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,112
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,24(s0)
+ld t2,-8(s0)
+sub t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,920(t1)
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-19279
+addi sp,sp,16
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22736
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22581
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-115
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1736
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20237
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,10151
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1744
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20247
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,10141
+addi t0,a0,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22785
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-1680(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22800
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1112(t1)
+jal zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22822
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1752
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20311
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,10077
+addi t0,a0,0
+jal ra,-20265
+addi t0,a0,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22866
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-26016
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-26021
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFE
+addi t0,t0,-1768
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1280(gp)
+addi a4,t0,0
+addi t0,zero,2
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17501
+addi t0,a0,0
+ld t0,-1736(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1104(t0)
+addi a2,t0,0
+jal ra,-4903
+addi t0,a0,0
+jal ra,-4376
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1728(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4913
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-4431
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,15070
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22755
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22759
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+beq t0,zero,40
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-19600
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,200(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1856
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+sd t0,8(sp)
+jal ra,-19621
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-20480
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,31
+lui t0,0xFFFFE
+addi t0,t0,-1872
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20558
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,9830
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1880
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20568
+addi t0,a0,0
+ld t0,-1688(gp)
+addi a0,t0,0
+jal ra,9884
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20578
+addi t0,a0,0
+ld t0,-1728(gp)
+addi a0,t0,0
+jal ra,9874
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,14304
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,14260
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+ld t0,-16(s0)
+addi a2,t0,0
+jal ra,-181
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-360(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1896
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-20634
+addi t0,a0,0
+ld t0,-1728(gp)
+addi a0,t0,0
+jal ra,9754
+addi t0,a0,0
+jal ra,-20588
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-221
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-360(t1)
+jal ra,11721
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,14238
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-48
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,0
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,a0,0
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+jal ra,-21
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+jal ra,-27
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25195
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25171
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-19568
+addi t0,a0,0
+addi s2,t0,0
+ld t0,16(s0)
+addi t1,s2,0
+sd t1,0(t0)
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,30
+jal ra,-25044
+addi t0,a0,0
+addi s4,t0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25208
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-19598
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-32
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,32(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,40(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-100
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-138
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-25336
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1016(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+addi a3,t0,0
+jal ra,-58
+addi t0,a0,0
+jal ra,-25359
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1024(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1048(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+addi a3,t0,0
+jal ra,-81
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25361
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25337
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25386
+addi t0,a0,0
+addi s2,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s4,t0,0
+addi t0,s4,0
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,s4,0
+addi t1,zero,0
+addi t0,t0,24
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-22
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,48
+sd t1,0(t0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+jal ra,-79
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+jal ra,-85
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25448
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25439
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-37
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-73
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25496
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25520
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25529
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-46
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25617
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-123
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25609
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25576
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,1
+add t1,t1,t2
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-220
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-96
+addi t0,a0,0
+addi s2,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s2,0
+ld t0,0(t0)
+addi s4,t0,0
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25692
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,72
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s5,t0,0
+addi t0,s5,0
+addi a0,t0,0
+jal ra,-25475
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s4,0
+addi a0,t0,0
+jal ra,-25481
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,s5,0
+addi s4,t0,0
+addi t0,s5,0
+addi a0,t0,0
+jal ra,-25532
+addi t0,a0,0
+beq t0,zero,39
+addi t0,s5,0
+addi a0,t0,0
+jal ra,-25526
+addi t0,a0,0
+addi t1,s1,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,40(s0)
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25712
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+add t1,t1,t2
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-127
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+addi t0,s5,0
+addi a0,t0,0
+jal zero,13
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-81
+addi t0,s4,0
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,s4,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25784
+addi t0,a0,0
+ld t1,-56(gp)
+divu t0,t0,t1
+addi s1,t0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-25589
+addi t0,a0,0
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-289
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,24
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal ra,500
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-26
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,40(s0)
+beq t0,zero,53
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25823
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+add t1,t1,t2
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-96
+addi t0,a0,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-439
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-274
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,24(s0)
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+nop
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+ld t0,40(s0)
+addi a3,t0,0
+jal ra,-288
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25756
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+ld t0,40(s0)
+addi a3,t0,0
+jal ra,-109
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25970
+addi t0,a0,0
+ld t1,-56(gp)
+divu t0,t0,t1
+addi s1,t0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-25775
+addi t0,a0,0
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-475
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a1,t0,0
+jal ra,326
+addi t0,a0,0
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-23
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+addi t0,zero,1
+addi a3,t0,0
+jal ra,-129
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25842
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-512
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+addi t0,zero,1
+addi a3,t0,0
+jal ra,-181
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-25894
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-564
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-166
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-121
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-145
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+ld t0,32(s0)
+addi a3,t0,0
+jal ra,-123
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+addi t0,zero,0
+addi a3,t0,0
+jal ra,-303
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-8(s0)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,24
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1008(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-20950
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFE
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-22075
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-22041
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-22091
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-22057
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-20990
+addi sp,sp,48
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,944(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-19
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,944(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,70
+jal zero,68
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-72
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,23
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-91
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a1,t0,0
+jal ra,328
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-110
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-111
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,7
+jal zero,5
+ld t0,-8(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,43
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-199
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,14336
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-221
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-119
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,968(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,976(t2)
+mul t1,t1,t2
+addi t2,a1,0
+sub t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+addi t0,a0,0
+addi t1,a1,0
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-71
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-98
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-248
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,960(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-21441
+addi sp,sp,40
+addi t0,a0,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-72
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-463
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-96
+addi t0,a0,0
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,19
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-123
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-682
+addi t0,a0,0
+addi a0,t0,0
+jal zero,11
+jal zero,9
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-75
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,19
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-166
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-702
+addi t0,a0,0
+jal zero,9
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-97
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,19
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-207
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-790
+addi t0,a0,0
+addi a0,t0,0
+jal zero,11
+jal zero,9
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-159
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,2040
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19649
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,-1616(gp)
+addi a2,t0,0
+jal ra,-7010
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-6567
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,2016
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19695
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1600(gp)
+addi a1,t0,0
+ld t0,-1624(gp)
+addi a2,t0,0
+jal ra,-7056
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-6613
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,1992
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1280(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19743
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+ld t1,-1592(gp)
+ld t2,-56(gp)
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1216(t1)
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1592(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,32
+ld t0,-1624(gp)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi t1,s1,0
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-56(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-18494
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-6821
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-36
+ld t0,-1680(gp)
+addi a0,t0,0
+ld t0,-1624(gp)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sub t0,zero,t0
+addi a2,t0,0
+jal ra,-7195
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-6713
+addi t0,a0,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,1968
+add t0,gp,t0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+ld t0,-1256(gp)
+addi a3,t0,0
+ld t0,-1272(gp)
+addi a4,t0,0
+addi t0,zero,0
+addi a5,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19842
+addi t0,a0,0
+jal ra,-7290
+addi t0,a0,0
+jal ra,-7292
+addi t0,a0,0
+jal ra,-7294
+addi t0,a0,0
+ld t0,-1600(gp)
+addi a0,t0,0
+ld t0,-1608(gp)
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-6758
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+ld t0,-1680(gp)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi a1,t0,0
+jal ra,-17652
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+ld t2,16(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1240(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25352
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25200
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t1,t0
+beq t0,zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1952
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-22852
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,7536
+addi t0,a0,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25225
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1944
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-22877
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,7511
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25412
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,1150
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,1936
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-22910
+addi t0,a0,0
+ld t0,-1680(gp)
+addi a0,t0,0
+jal ra,7478
+addi t0,a0,0
+jal ra,-22864
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25432
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,170
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,-24(gp)
+sub t0,t0,t1
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25301
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-561
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1112(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25502
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,384(t3)
+mul t2,t2,t3
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+jal zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2774
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-22
+addi t0,a0,0
+beq t0,zero,12
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,840(t0)
+addi a1,t0,0
+jal ra,735
+addi t0,a0,0
+addi a0,t0,0
+jal zero,11
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,840(t0)
+addi a0,t0,0
+jal ra,-21823
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-57
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-27118
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25581
+addi t0,a0,0
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-89
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25494
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-117
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25522
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25513
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-154
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25529
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-182
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25542
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-210
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25465
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-238
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25478
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-266
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25491
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-294
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-25504
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-322
+addi t0,a0,0
+beq t0,zero,32
+jal ra,-27374
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,808(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27375
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,816(t1)
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-22060
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,800(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,792(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-369
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,784(t1)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,168
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-394
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,776(t1)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,176
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-419
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,768(t1)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,184
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-443
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+jal zero,7
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,880(t1)
+addi t0,t0,192
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,7
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-27566
+addi t0,a0,0
+jal ra,-27380
+addi t0,a0,0
+ld t0,-24(gp)
+addi t1,zero,2
+mul t0,t0,t1
+ld t1,-40(gp)
+addi t2,zero,2
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,840(t1)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-184
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-144
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-125
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-106
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-85
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-310
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-27546
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-27591
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-189
+addi t0,a0,0
+jal zero,11
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-27604
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-390
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-241
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal zero,13
+addi t0,s2,0
+addi s1,t0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-27632
+addi t0,a0,0
+addi s2,t0,0
+jal zero,-70
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-634
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,28
+jal zero,26
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26143
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1367
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26153
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1285
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-682
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,22
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26190
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1414
+addi t0,a0,0
+beq t0,zero,12
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26200
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-1311
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-27736
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-27729
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi s2,t0,0
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-77
+addi t0,a0,0
+addi t0,s1,0
+ld t1,-24(gp)
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-16
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-775
+addi t0,a0,0
+beq t0,zero,24
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-22495
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,792(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,26
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26152
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-3688
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-319
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-144
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-27873
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,12
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,760(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,720(t1)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-89
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,736(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,696(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,104
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-190
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,80
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-951
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-776
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,-627
+addi t0,a0,0
+ld t0,-16(s0)
+ld t1,-8(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-16(s0)
+ld t1,24(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+addi t0,t0,24
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,752(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,744(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,712(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,704(t1)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+ld t1,24(s0)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,720(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-809
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,856(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,608
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-674
+addi t0,a0,0
+jal zero,16
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-835
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi t1,zero,1
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-690
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-24(gp)
+addi a1,t0,0
+jal ra,-22955
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-238
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-991
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,85
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-977
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,69
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-962
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+ld t0,24(s0)
+addi t1,s1,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,840(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,42
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-28202
+addi t0,a0,0
+addi s2,t0,0
+ld t0,24(s0)
+addi t1,s2,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+addi t1,s2,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-28204
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,s1,0
+addi a0,t0,0
+jal zero,11
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-28244
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-58
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-624
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-2026
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,66
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-166
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,52
+jal zero,20
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-28283
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+addi t0,t0,24
+sd t1,0(t0)
+jal zero,2
+jal zero,32
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-28332
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-28325
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi s3,t0,0
+addi t0,s2,0
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-105
+addi t0,a0,0
+addi t0,s2,0
+ld t1,-24(gp)
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-14
+ld s3,-24(s0)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+ld t1,-24(gp)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+ld t2,-56(gp)
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-142
+addi t0,a0,0
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-18
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1403
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-28437
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+ld t0,-8(s0)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a2,t0,0
+jal ra,-61
+addi t0,a0,0
+jal zero,35
+addi t0,zero,1
+addi s2,t0,0
+addi t0,s2,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,29
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-11337
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-26953
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a1,t0,0
+jal ra,-184
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-31
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1266
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,50
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-85
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1437
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,976(t1)
+mul t0,t0,t1
+addi a2,t0,0
+jal ra,-142
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1426
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1408
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-166
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-28571
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1194
+addi t0,a0,0
+jal zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-28584
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,848(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1346
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-1200
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-28590
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,688(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,7
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1432
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-28666
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-28630
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi t0,s1,0
+addi a2,t0,0
+jal ra,-134
+addi t0,a0,0
+jal zero,9
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+addi t0,t0,24
+sd t1,0(t0)
+addi t0,s2,0
+addi s1,t0,0
+addi t0,s3,0
+addi s2,t0,0
+jal zero,-40
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-232
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-90
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,728(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1856
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-24979
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-24963
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+sd t0,48(sp)
+jal ra,-23840
+addi sp,sp,48
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1784
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25025
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25009
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi a1,t0,0
+jal ra,-24993
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi a1,t0,0
+jal ra,-24963
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+sd t0,48(sp)
+jal ra,-23900
+addi sp,sp,48
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25085
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25069
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+sd t0,32(sp)
+jal ra,-23938
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1640
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+add t0,t0,t1
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25127
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+add t0,t0,t1
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25115
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-25103
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-25077
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+add t0,t0,t1
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,56(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+sd t0,64(sp)
+jal ra,-24026
+addi sp,sp,64
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25211
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25195
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi a1,t0,0
+jal ra,-25179
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi a1,t0,0
+jal ra,-25149
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,48(sp)
+jal ra,-24086
+addi sp,sp,48
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25271
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-25255
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi a1,t0,0
+jal ra,-25239
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi a1,t0,0
+jal ra,-25209
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+sd t0,48(sp)
+jal ra,-24146
+addi sp,sp,48
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-2072
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1480
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25070
+addi t0,a0,0
+jal ra,-25020
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,1472
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-25882
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,872(t1)
+jal ra,14096
+addi t0,a0,0
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,1464
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-25902
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,872(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,848(t1)
+jal ra,14070
+addi t0,a0,0
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,1456
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-25928
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,848(t1)
+jal ra,14050
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,872(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1448
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-24257
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24139
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+beq t0,zero,42
+ld t0,-344(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1432
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-24291
+addi sp,sp,16
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24173
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+addi a1,t0,0
+jal ra,-82
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,224(t0)
+beq t0,zero,3
+jal zero,88
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,1424
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25254
+addi t0,a0,0
+jal zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+beq t0,zero,32
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1416
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-24332
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24214
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+addi a1,t0,0
+jal ra,-123
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1408
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25289
+addi t0,a0,0
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+beq t0,zero,41
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1400
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-24367
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24249
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-156
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1384
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+sd t0,16(sp)
+jal ra,-24391
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24273
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-142
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1368
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,4450
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-12413
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+addi t0,zero,20
+addi a1,t0,0
+jal ra,-26525
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-24443
+addi sp,sp,24
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24325
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1360
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25401
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,4985
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1352
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25422
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,4964
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,4788
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-12215
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-27002
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,136(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,136(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,408(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,416(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-377
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,-344(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1344
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-24679
+addi sp,sp,0
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24561
+addi t0,a0,0
+jal zero,40
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1328
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,4176
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-12687
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-12694
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,40(sp)
+jal ra,-24719
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24601
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1320
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25677
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,4773
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1312
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25689
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,4761
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1304
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25710
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,4740
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-12481
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,128(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,128(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-620
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1288
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,3972
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-12891
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-12898
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-12905
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24926
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-24808
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1280
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25884
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,4566
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1272
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25896
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,4554
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1264
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-25908
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,4542
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-12679
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,120(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,120(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-12782
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,112(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,112(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-12885
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,104(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,104(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+jal ra,-13002
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,96(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,96(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,4310
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+jal ra,-13130
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,88(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,88(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,4182
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13244
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,80(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,80(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-1395
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1248
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,3197
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-13666
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-13677
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-25698
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-25580
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1240
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-26673
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,3713
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4446
+addi t0,a0,0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4425
+addi t0,a0,0
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-13678
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1216
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4356
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25812
+addi sp,sp,16
+addi t0,a0,0
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,1192
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4376
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25832
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,3709
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,1184
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-26754
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4531
+addi t0,a0,0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-4510
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,1176
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-26786
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,3664
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1160
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-25893
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4595
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4574
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,3381
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4652
+addi t0,a0,0
+beq t0,zero,150
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,9339
+addi t0,a0,0
+beq t0,zero,136
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4636
+addi t0,a0,0
+beq t0,zero,111
+jal ra,-13660
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4519
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,72(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,72(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,0(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-4816
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3630
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,3621
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,3612
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-1861
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1144
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,2731
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-14132
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-14143
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-26164
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-26046
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1136
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27139
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,3247
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-4912
+addi t0,a0,0
+beq t0,zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4891
+addi t0,a0,0
+beq t0,zero,60
+lui t0,0xFFFFD
+addi t0,t0,1128
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27167
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,3283
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-14156
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1104
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4834
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-26290
+addi sp,sp,16
+addi t0,a0,0
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4854
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-26310
+addi sp,sp,16
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,1072
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27226
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-5003
+addi t0,a0,0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-4982
+addi t0,a0,0
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-26353
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,3188
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-5061
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5040
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-4957
+addi t0,a0,0
+addi a0,t0,0
+jal ra,2917
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-5115
+addi t0,a0,0
+beq t0,zero,163
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,8953
+addi t0,a0,0
+beq t0,zero,149
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5099
+addi t0,a0,0
+beq t0,zero,124
+jal ra,-14123
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-5018
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-4965
+addi t0,a0,0
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,64(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-4997
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-8(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-5292
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3154
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,3145
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,3136
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-5194
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-2386
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1032
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,2206
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-14657
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,-14664
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi a1,t0,0
+jal ra,-29002
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-26696
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-26578
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+beq t0,zero,23
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1024
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-26722
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-26604
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27680
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,2770
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27692
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi a0,t0,0
+jal ra,2758
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,992
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+jal ra,-26801
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,976
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+jal ra,-26822
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal ra,2494
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-14507
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,56(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-2624
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,960
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,1968
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-14895
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi a1,t0,0
+jal ra,-29233
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-26927
+addi sp,sp,24
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-26809
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+beq t0,zero,23
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,952
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-26953
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-26835
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,944
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27911
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,2468
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,936
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27930
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,920
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+jal ra,-27033
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-236
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-27966
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,2420
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-14737
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,32(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,5696
+addi t0,a0,0
+jal zero,87
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-29461
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,16(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,48(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-2973
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,896
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,1619
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,-15244
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi a1,t0,0
+jal ra,-29582
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,-15262
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-27283
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-27165
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,888
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-28241
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi a0,t0,0
+jal ra,2145
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,880
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-28253
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi a0,t0,0
+jal ra,2126
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,872
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-28272
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,856
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+jal ra,-27375
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-15049
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-29816
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-29845
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,40(t1)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,5416
+addi t0,a0,0
+jal zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,5360
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-3222
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,848
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi a0,t0,0
+jal ra,1370
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27507
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-27389
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,1768
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1280(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,408(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,416(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-28463
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1104(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,792
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-27648
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi a0,t0,0
+jal ra,-34246
+addi t0,a0,0
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,224(t0)
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,728
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-27671
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi a0,t0,0
+jal ra,-34269
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal ra,-8054
+addi t0,a0,0
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a1,t0,0
+jal ra,2046
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,408(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,416(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi a0,t0,0
+addi t0,zero,12
+addi a1,t0,0
+jal ra,-30231
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1696(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,168(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1712(t3)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,168(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1712(t3)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+sub t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,168(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1712(t3)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+mul t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,168(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1712(t3)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+divu t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,1606
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,168(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1712(t3)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+remu t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,1516
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-7013
+addi t0,a0,0
+beq t0,zero,88
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,6978
+addi t0,a0,0
+beq t0,zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-6997
+addi t0,a0,0
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-6889
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-7115
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,1331
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,1322
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,1313
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-7141
+addi t0,a0,0
+beq t0,zero,78
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,6927
+addi t0,a0,0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-7125
+addi t0,a0,0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-6968
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-7233
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,1213
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,1204
+addi t0,a0,0
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,1195
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+add t0,t0,t1
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-31101
+addi t0,a0,0
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-31130
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,720
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1240(t2)
+sub t1,t1,t2
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-28747
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-28629
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,712
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,16(sp)
+jal ra,-28775
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-28657
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+beq t0,zero,24
+jal ra,-74
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,704
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-29730
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-24(gp)
+addi t1,zero,2
+mul t0,t0,t1
+addi a1,t0,0
+jal ra,-29462
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,696
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-29744
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,688
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-29751
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-72
+addi t0,a0,0
+ld t0,-72(gp)
+beq t0,zero,14
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,672
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-28844
+addi sp,sp,8
+addi t0,a0,0
+jal zero,13
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,656
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-28857
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-28739
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4262
+addi t0,a0,0
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3257
+addi t0,a0,0
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2804
+addi t0,a0,0
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4058
+addi t0,a0,0
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4071
+addi t0,a0,0
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4084
+addi t0,a0,0
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4097
+addi t0,a0,0
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4110
+addi t0,a0,0
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4123
+addi t0,a0,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2370
+addi t0,a0,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2145
+addi t0,a0,0
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1809
+addi t0,a0,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4653
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1586
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+jal ra,9175
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,560(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+sd t0,16(sp)
+jal ra,-29143
+addi sp,sp,16
+addi t0,a0,0
+jal zero,173
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+addi a0,t0,0
+ld t0,-416(gp)
+addi a1,t0,0
+jal ra,-12329
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,552(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-31454
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,560
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+sd t0,16(sp)
+jal ra,-29180
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-35778
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+sd t0,-448(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+sd t0,-456(gp)
+jal ra,-35621
+addi t0,a0,0
+jal ra,-33408
+addi t0,a0,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,280(t1)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,240(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-14962
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal ra,795
+addi t0,a0,0
+jal ra,-312
+addi t0,a0,0
+jal ra,-30086
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,-33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-14866
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-418
+addi t0,a0,0
+jal ra,-30126
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,-37
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,240(t1)
+addi t0,zero,0
+sd t0,-448(gp)
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFD
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-432(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+sd t0,40(sp)
+jal ra,-29316
+addi sp,sp,40
+addi t0,a0,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,408(t1)
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,416(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+ld t0,-8(s0)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,408(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal ra,456
+addi t0,a0,0
+jal ra,589
+addi t0,a0,0
+jal ra,1497
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+jal zero,-39
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,248(t1)
+ld t0,-8(s0)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+jal ra,435
+addi t0,a0,0
+jal ra,568
+addi t0,a0,0
+jal ra,1525
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,408(t1)
+addi t0,s2,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+jal zero,-22
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,248(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17448
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-29508
+addi sp,sp,16
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,432
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17480
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-29540
+addi sp,sp,16
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17440
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-76
+addi t0,a0,0
+jal zero,32
+lui t0,0xFFFFD
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17522
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-29591
+addi sp,sp,24
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal ra,-30522
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29631
+addi sp,sp,8
+addi t0,a0,0
+jal zero,114
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,368
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29650
+addi sp,sp,8
+addi t0,a0,0
+jal zero,95
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,360
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29669
+addi sp,sp,8
+addi t0,a0,0
+jal zero,76
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,336
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29688
+addi sp,sp,8
+addi t0,a0,0
+jal zero,57
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,320
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29707
+addi sp,sp,8
+addi t0,a0,0
+jal zero,38
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29726
+addi sp,sp,8
+addi t0,a0,0
+jal zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,288
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-30650
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-17688
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-33018
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-33030
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,16(sp)
+jal ra,-29794
+addi sp,sp,16
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-202
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,208
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-30715
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-33068
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-33062
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-228
+addi t0,a0,0
+jal ra,-30685
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi a0,t0,0
+jal ra,-36426
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+ld t1,16(s0)
+addi t0,t0,120
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+ld t1,24(s0)
+addi t0,t0,128
+sd t1,0(t0)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+beq t0,zero,25
+lui t0,0xFFFFD
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,16(sp)
+jal ra,-29870
+addi sp,sp,16
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-278
+addi t0,a0,0
+jal ra,-30735
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi a1,t0,0
+jal ra,-8567
+addi t0,a0,0
+beq t0,zero,101
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,5121
+addi t0,a0,0
+beq t0,zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,-8559
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,-8361
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-15794
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t0,t1
+addi a1,t0,0
+jal ra,-8382
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-15792
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal zero,46
+jal zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a0,t0,0
+jal ra,-8680
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-234
+addi t0,a0,0
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,-245
+addi t0,a0,0
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,-256
+addi t0,a0,0
+jal ra,-15489
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi a0,t0,0
+jal ra,-17438
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1728(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17293
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,375
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-17322
+addi t0,a0,0
+ld t0,-72(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,327
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-17183
+addi t0,a0,0
+ld t0,-72(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,279
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,145
+jal ra,-17561
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1856(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1848(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,125
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17125
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-16910
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,77
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17620
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-16846
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1912(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-17668
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi a1,t0,0
+jal ra,-708
+addi t0,a0,0
+jal zero,33
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFD
+addi t0,t0,88
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,32(sp)
+jal ra,-30487
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+addi a0,t0,0
+jal ra,-37085
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+beq t0,zero,4
+jal ra,200
+addi t0,a0,0
+jal zero,3
+jal ra,464
+addi t0,a0,0
+jal zero,190
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+beq t0,zero,4
+jal ra,705
+addi t0,a0,0
+jal zero,182
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5721
+addi t0,a0,0
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4591
+addi t0,a0,0
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4141
+addi t0,a0,0
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5562
+addi t0,a0,0
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5472
+addi t0,a0,0
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5382
+addi t0,a0,0
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5292
+addi t0,a0,0
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5177
+addi t0,a0,0
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5062
+addi t0,a0,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3811
+addi t0,a0,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3595
+addi t0,a0,0
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3296
+addi t0,a0,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6143
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3137
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6200
+addi t0,a0,0
+jal ra,-5913
+addi t0,a0,0
+jal zero,195
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4840
+addi t0,a0,0
+jal ra,-4785
+addi t0,a0,0
+jal zero,180
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4389
+addi t0,a0,0
+jal ra,-4337
+addi t0,a0,0
+jal zero,165
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6245
+addi t0,a0,0
+jal ra,-5760
+addi t0,a0,0
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6260
+addi t0,a0,0
+jal ra,-5672
+addi t0,a0,0
+jal zero,135
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6275
+addi t0,a0,0
+jal ra,-5584
+addi t0,a0,0
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6290
+addi t0,a0,0
+jal ra,-5496
+addi t0,a0,0
+jal zero,105
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6305
+addi t0,a0,0
+jal ra,-5383
+addi t0,a0,0
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6320
+addi t0,a0,0
+jal ra,-5270
+addi t0,a0,0
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4032
+addi t0,a0,0
+jal ra,-4021
+addi t0,a0,0
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6350
+addi t0,a0,0
+jal ra,-3807
+addi t0,a0,0
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6365
+addi t0,a0,0
+jal ra,-3510
+addi t0,a0,0
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6380
+addi t0,a0,0
+jal ra,-6359
+addi t0,a0,0
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3373
+addi t0,a0,0
+jal ra,-3355
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4316
+addi t0,a0,0
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,17
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3255
+addi t0,a0,0
+jal zero,3
+jal ra,-6330
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2068
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6235
+addi t0,a0,0
+jal ra,-6182
+addi t0,a0,0
+jal ra,-6206
+addi t0,a0,0
+jal zero,220
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-5272
+addi t0,a0,0
+jal ra,-5056
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-5165
+addi t0,a0,0
+jal zero,202
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-4824
+addi t0,a0,0
+jal ra,-4611
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-4711
+addi t0,a0,0
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6081
+addi t0,a0,0
+jal ra,-6037
+addi t0,a0,0
+jal ra,-6259
+addi t0,a0,0
+jal zero,167
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6098
+addi t0,a0,0
+jal ra,-5951
+addi t0,a0,0
+jal ra,-6276
+addi t0,a0,0
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6115
+addi t0,a0,0
+jal ra,-5865
+addi t0,a0,0
+jal ra,-6293
+addi t0,a0,0
+jal zero,133
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6132
+addi t0,a0,0
+jal ra,-5779
+addi t0,a0,0
+jal ra,-6310
+addi t0,a0,0
+jal zero,116
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6149
+addi t0,a0,0
+jal ra,-5668
+addi t0,a0,0
+jal ra,-6327
+addi t0,a0,0
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6166
+addi t0,a0,0
+jal ra,-5557
+addi t0,a0,0
+jal ra,-6344
+addi t0,a0,0
+jal zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4387
+addi t0,a0,0
+jal ra,-4310
+addi t0,a0,0
+jal ra,-4346
+addi t0,a0,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4173
+addi t0,a0,0
+jal ra,-4098
+addi t0,a0,0
+jal ra,-4131
+addi t0,a0,0
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-3860
+addi t0,a0,0
+jal ra,-3803
+addi t0,a0,0
+jal ra,-4148
+addi t0,a0,0
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6717
+addi t0,a0,0
+jal ra,-6654
+addi t0,a0,0
+jal ra,-6700
+addi t0,a0,0
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3650
+addi t0,a0,0
+jal zero,3
+jal ra,-32078
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3412
+addi t0,a0,0
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2936
+addi t0,a0,0
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2821
+addi t0,a0,0
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3397
+addi t0,a0,0
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3349
+addi t0,a0,0
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3301
+addi t0,a0,0
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3257
+addi t0,a0,0
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3180
+addi t0,a0,0
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3099
+addi t0,a0,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2791
+addi t0,a0,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2746
+addi t0,a0,0
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2715
+addi t0,a0,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3628
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3843
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,200(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-34707
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-1714
+addi t0,a0,0
+jal zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-1609
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1484
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi a0,t0,0
+jal ra,-35951
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+add t1,t1,t2
+addi t0,t0,32
+sd t1,0(t0)
+jal ra,-1030
+addi t0,a0,0
+jal ra,-114
+addi t0,a0,0
+jal zero,-48
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-88(gp)
+addi s1,t0,0
+addi t0,zero,0
+addi s2,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s4,t0,0
+addi t0,s2,0
+addi t1,s4,0
+sltu t0,t0,t1
+beq t0,zero,17
+addi t0,s4,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,s4,0
+addi s2,t0,0
+addi t0,s3,0
+addi s1,t0,0
+jal zero,8
+addi t0,s3,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-41
+addi t0,s1,0
+ld t1,-88(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-88(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+jal ra,-99
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,59
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,-32796
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-16(s0)
+addi a1,t0,0
+jal ra,-32762
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-31697
+addi sp,sp,32
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-7452
+addi t0,a0,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,48
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-32622
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,32
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-31745
+addi sp,sp,24
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi a1,t0,0
+ld t0,-88(gp)
+addi a2,t0,0
+jal ra,-136
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-142
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-148
+addi t0,a0,0
+jal ra,-32638
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,47
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,0
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,40(s0)
+addi a1,t0,0
+jal ra,-33001
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,40(s0)
+addi a1,t0,0
+jal ra,-32981
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-31846
+addi sp,sp,64
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-19813
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-16
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a3,t0,0
+jal ra,-97
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-31908
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-96
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-104
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi a3,t0,0
+jal ra,-138
+addi t0,a0,0
+ld t0,-1624(gp)
+addi a0,t0,0
+jal ra,-77
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-120
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-128
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi a3,t0,0
+jal ra,-160
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-19879
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-64(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-72(t1)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-140
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-47
+lui t0,0xFFFFD
+addi t0,t0,-144
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-152
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+addi a3,t0,0
+jal ra,-228
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-168
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-176
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+addi a3,t0,0
+jal ra,-246
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-19898
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-80(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-88(t1)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-226
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-47
+lui t0,0xFFFFD
+addi t0,t0,-192
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-200
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+addi a3,t0,0
+jal ra,-314
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-19941
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-96(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-104(t1)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-294
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-47
+lui t0,0xFFFFD
+addi t0,t0,-216
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-224
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+addi a3,t0,0
+jal ra,-382
+addi t0,a0,0
+addi t0,zero,1
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-19974
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-112(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-120(t1)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-362
+addi t0,a0,0
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-47
+lui t0,0xFFFFD
+addi t0,t0,-240
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-248
+add t0,gp,t0
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+addi a2,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+addi a3,t0,0
+jal ra,-450
+addi t0,a0,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-336
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32261
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-400
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-18668
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-18671
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-18613
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-33397
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-18684
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-18626
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-33369
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-32302
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-456
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33487
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33471
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+sd t0,32(sp)
+jal ra,-32340
+addi sp,sp,32
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-528
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33525
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33509
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a1,t0,0
+jal ra,-32151
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi a1,t0,0
+jal ra,-33500
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a1,t0,0
+jal ra,-32169
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi a1,t0,0
+jal ra,-33477
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33583
+addi t0,a0,0
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33567
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-32432
+addi sp,sp,56
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-592
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,3118
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33616
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3108
+addi t0,a0,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi a1,t0,0
+jal ra,-33599
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,3092
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-33586
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,3078
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-33559
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-32500
+addi sp,sp,48
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,24(sp)
+jal ra,-32520
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,-736
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32536
+addi sp,sp,8
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-8749
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+beq t0,zero,21
+jal ra,-18942
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFD
+addi t0,t0,-824
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32561
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-18755
+addi t0,a0,0
+jal zero,110
+jal ra,-18962
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,105
+lui t0,0xFFFFD
+addi t0,t0,-912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32581
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-18775
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32602
+addi sp,sp,8
+addi t0,a0,0
+jal zero,13
+lui t0,0xFFFFD
+addi t0,t0,-1032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32615
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1048
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+addi a2,t0,0
+jal ra,-905
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1064
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi a2,t0,0
+jal ra,-919
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1080
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-933
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1096
+add t0,gp,t0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+addi a2,t0,0
+jal ra,-947
+addi t0,a0,0
+jal ra,-781
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+beq t0,zero,81
+lui t0,0xFFFFD
+addi t0,t0,-1144
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32689
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+jal ra,-37998
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+addi a0,t0,0
+jal ra,-37992
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-1160
+add t0,gp,t0
+addi a2,t0,0
+jal ra,-11789
+addi t0,a0,0
+jal ra,-33572
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+jal ra,-38024
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+addi a0,t0,0
+jal ra,-38018
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-1176
+add t0,gp,t0
+addi a2,t0,0
+jal ra,-11815
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,-1208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+sd t0,8(sp)
+jal ra,-32755
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-33614
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-32769
+addi sp,sp,8
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37265
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-37245
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,s1,0
+addi a0,t0,0
+jal zero,41
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-37272
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-22
+jal ra,-37329
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,16(s0)
+sd t1,0(t0)
+addi t0,s1,0
+ld t1,24(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37311
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,s1,0
+addi t0,t0,8
+sd t1,0(t0)
+addi t0,s1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-92
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-32(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi a0,t0,0
+jal ra,-37371
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi a0,t0,0
+jal ra,-37381
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-32(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38958
+addi t0,a0,0
+ld t1,-1256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38922
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38930
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38944
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39034
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+divu t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-32555
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-40(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,58
+ld t0,-1352(gp)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-103
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-39099
+addi t0,a0,0
+addi s2,t0,0
+jal zero,-14
+ld t0,-1336(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,34
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-1328(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,-1336(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-138
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-39134
+addi t0,a0,0
+addi s2,t0,0
+jal zero,-14
+addi t0,s1,0
+addi t1,zero,1
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-30
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37559
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi a0,t0,0
+jal ra,-33994
+addi t0,a0,0
+jal zero,82
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37575
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-29
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1304
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34008
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37547
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,28
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1248(t2)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,384(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-34059
+addi t0,a0,0
+jal zero,17
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1312
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-33133
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-33015
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37615
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,26
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-127
+addi t0,a0,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1320
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37633
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-33178
+addi sp,sp,8
+addi t0,a0,0
+ld t0,-344(gp)
+addi a0,t0,0
+jal ra,-33060
+addi t0,a0,0
+jal ra,-34071
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37692
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-47
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37684
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-49
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi a0,t0,0
+ld t0,-416(gp)
+addi a1,t0,0
+jal ra,-16423
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-35544
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,-1376
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+sd t0,16(sp)
+jal ra,-33270
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi a0,t0,0
+jal ra,-39868
+addi t0,a0,0
+jal ra,-309
+addi t0,a0,0
+jal ra,-39705
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+sd t0,-448(gp)
+ld t0,-8(s0)
+sd t0,-456(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi a0,t0,0
+jal ra,-118
+addi t0,a0,0
+addi t0,zero,0
+sd t0,-448(gp)
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1440
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-432(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+sd t0,24(sp)
+jal ra,-33314
+addi sp,sp,24
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1448
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34248
+addi t0,a0,0
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1456
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34265
+addi t0,a0,0
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1464
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34282
+addi t0,a0,0
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1472
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34299
+addi t0,a0,0
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1488
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34316
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-1496
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-34323
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-37285
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+addi a0,t0,0
+jal ra,-36924
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-376(t1)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-368(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+ld t1,-8(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-368(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1568(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-33070
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-33093
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,32
+sd t1,0(t0)
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,944(t1)
+divu t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-33113
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,32
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-36965
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,976(t1)
+mul t0,t0,t1
+ld t1,-56(gp)
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-12277
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-36965
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,121
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-37028
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-37315
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12167
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,72
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-37051
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-37324
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12190
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,80
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-37074
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-37333
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12213
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,88
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-37097
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-37342
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12236
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,96
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-37120
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+jal ra,-37351
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12259
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,104
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,160
+sd t1,0(t0)
+jal zero,17
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,128
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-408(t1)
+addi t0,t0,136
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,144
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,32(s0)
+addi t0,t0,152
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,168
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,176
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,184
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,888(t1)
+addi t0,t0,192
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-36999
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-36993
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,s1,0
+addi a0,t0,0
+jal zero,11
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-37286
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-31
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+sd t1,0(t0)
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-376(t1)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37323
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37331
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37326
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37334
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37342
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37359
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,8
+sd t1,0(t0)
+jal zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37371
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-71
+addi t0,a0,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-496
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-440
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1560
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+sd t0,24(sp)
+jal ra,-33949
+addi sp,sp,24
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-204
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-77
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37230
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,277
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37240
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-37453
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37233
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37845
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37507
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12587
+addi t0,a0,0
+addi t0,zero,0
+addi s3,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37504
+addi t0,a0,0
+addi s4,t0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37862
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-12630
+addi t0,a0,0
+addi s5,t0,0
+addi t0,s3,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,23
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s5,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a1,t0,0
+addi t0,s4,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-12629
+addi t0,a0,0
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-25
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37748
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37398
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12658
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37758
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37407
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12682
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37768
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37416
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12706
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37778
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37425
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12730
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37746
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37389
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12754
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37756
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37398
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12778
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37766
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37407
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12802
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-37776
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37416
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-12826
+addi t0,a0,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,a1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,a1,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,a1,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+nop
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,124
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37791
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-13219
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,108
+ld t0,-8(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-13194
+addi t0,a0,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37668
+addi t0,a0,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-13101
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37825
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-106
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37830
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-107
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,41
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37836
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-147
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37841
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-148
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+jal ra,-34511
+addi sp,sp,32
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,68
+ld t0,32(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,40(s0)
+addi a2,t0,0
+jal ra,-13483
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13188
+addi t0,a0,0
+beq t0,zero,45
+ld t0,32(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,40(s0)
+addi a2,t0,0
+jal ra,-13501
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13114
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,40(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,32(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-13281
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13429
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-238
+addi t0,a0,0
+ld t0,40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+jal zero,-70
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+nop
+nop
+nop
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37833
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,368
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37843
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-38056
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-37836
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38451
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13205
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+addi t0,zero,0
+addi s3,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38103
+addi t0,a0,0
+addi s4,t0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38461
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13229
+addi t0,a0,0
+addi s5,t0,0
+addi t0,s3,0
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,26
+addi t0,s4,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi t0,s5,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a1,t0,0
+jal ra,-13251
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38353
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13275
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,112
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38359
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13295
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38365
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13315
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,128
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38371
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13335
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,136
+sd t1,0(t0)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38570
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13352
+addi t0,a0,0
+sd t0,-48(s0)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38570
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13366
+addi t0,a0,0
+sd t0,-56(s0)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38570
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13380
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-48(s0)
+addi a1,t0,0
+addi t0,s1,0
+addi a2,t0,0
+ld t0,-56(s0)
+addi a3,t0,0
+ld t0,-64(s0)
+addi a4,t0,0
+jal ra,-327
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38610
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-64(s0)
+addi a2,t0,0
+jal ra,-13385
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38597
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13421
+addi t0,a0,0
+sd t0,-56(s0)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38597
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13435
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-48(s0)
+addi a1,t0,0
+addi t0,s1,0
+addi a2,t0,0
+ld t0,-56(s0)
+addi a3,t0,0
+ld t0,-64(s0)
+addi a4,t0,0
+jal ra,-382
+addi t0,a0,0
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38623
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,-56(s0)
+addi a2,t0,0
+jal ra,-13440
+addi t0,a0,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38459
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13479
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,168
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38465
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13499
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,176
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38471
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13519
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,184
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-16(s0)
+addi a0,t0,0
+jal ra,-38477
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-13539
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,192
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38450
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38442
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,168(t1)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38434
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,160(t1)
+jal ra,-14950
+addi t0,a0,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38386
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,28
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38399
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38394
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38411
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,28
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38424
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38419
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38586
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-1616(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,18
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,968(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,976(t2)
+mul t1,t1,t2
+ld t2,-56(gp)
+sub t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38486
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38484
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38513
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,20
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-38691
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-1616(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-204
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-160
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-121
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-253
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-128(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,48
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-219
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-144(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-190
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-160(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-330
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-136(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,48
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-296
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-152(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+ld t0,16(s0)
+addi a1,t0,0
+jal ra,-267
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-168(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,24
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+add t0,t0,t1
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,928(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-656(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+nop
+nop
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+jal ra,-70
+addi t0,a0,0
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-656(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+addi a0,t0,0
+jal ra,-35169
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-656(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-648(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a1,t0,0
+jal ra,-35389
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-640(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-656(t1)
+jal zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1664
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-35651
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+addi a0,t0,0
+jal ra,-42249
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-640(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-656(t1)
+ld t0,-16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a1,t0,0
+jal ra,-18578
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39141
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14365
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-14437
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-172
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1397
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39177
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+ld t0,32(s0)
+addi a2,t0,0
+jal ra,-14288
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-14466
+addi t0,a0,0
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-759
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi t1,s1,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39166
+addi t2,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+add t0,t0,t1
+addi a2,t0,0
+jal ra,-1477
+addi t0,a0,0
+jal zero,104
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-268
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1493
+addi t0,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+addi s2,t0,0
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,79
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-835
+addi t0,a0,0
+beq t0,zero,31
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39290
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39228
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-21686
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-14419
+addi t0,a0,0
+jal zero,37
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-817
+addi t0,a0,0
+beq t0,zero,30
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39327
+addi t0,a0,0
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39235
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi a0,t0,0
+jal ra,-21529
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-14456
+addi t0,a0,0
+addi t0,s1,0
+ld t1,-56(gp)
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-81
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39374
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14598
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-885
+addi t0,a0,0
+beq t0,zero,22
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-14677
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-213
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,904(t1)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39416
+addi t0,a0,0
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-14640
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1528(t1)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+addi a0,t0,0
+jal ra,-14729
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39447
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t0,t0,72
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t0,t0,80
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+addi t0,t0,88
+sd t1,0(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+addi t0,t0,96
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+add t0,t0,t1
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi a1,t0,0
+jal ra,-35856
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,104
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39383
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,112
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-624(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,67
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39471
+addi t0,a0,0
+addi t1,s1,0
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-14829
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-365
+addi t0,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-30
+addi t0,zero,0
+addi s1,t0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39474
+addi t0,a0,0
+addi t1,s1,0
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-14862
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-398
+addi t0,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+addi s1,t0,0
+jal zero,-30
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t0,t0,160
+sd t1,0(t0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-38102
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+ld t0,-56(gp)
+addi a1,t0,0
+jal ra,-35978
+addi t0,a0,0
+addi s1,t0,0
+ld t0,32(s0)
+addi t1,s1,0
+sub t0,t0,t1
+sd t0,32(s0)
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi t1,s2,0
+add t0,t0,t1
+addi a1,t0,0
+ld t0,24(s0)
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-519
+addi t0,a0,0
+ld t0,24(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,24(s0)
+addi t0,s2,0
+ld t1,-56(gp)
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-25
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,976(t1)
+mul t0,t0,t1
+addi s1,t0,0
+ld t0,24(s0)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal ra,-35982
+addi t0,a0,0
+addi s2,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a1,t0,0
+addi t0,s1,0
+addi a2,t0,0
+jal ra,-108
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s1,0
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,1
+add t0,t0,t1
+addi s3,t0,0
+jal zero,-29
+addi t0,s1,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-611
+addi t0,a0,0
+addi t0,s1,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,zero,0
+addi a2,t0,0
+jal ra,-623
+addi t0,a0,0
+addi t0,s3,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+addi t0,s1,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi s1,t0,0
+addi t0,s3,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s3,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a2,t0,0
+jal ra,-648
+addi t0,a0,0
+jal zero,-25
+addi t0,s1,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi s1,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+ld t0,24(s0)
+addi a2,t0,0
+jal ra,-661
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39812
+addi t0,a0,0
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s1,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39822
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39853
+addi t0,a0,0
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1128(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-14070
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-14532
+addi t0,a0,0
+jal zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17153
+addi t0,a0,0
+jal zero,83
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-18790
+addi t0,a0,0
+jal zero,70
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1144(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-18387
+addi t0,a0,0
+jal zero,57
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1136(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-17771
+addi t0,a0,0
+jal zero,44
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1160(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-18976
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi a0,t0,0
+jal zero,33
+jal zero,26
+lui t0,0xFFFFD
+addi t0,t0,-1696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-36517
+addi sp,sp,16
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-520(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39797
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-15250
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1541
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-807
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,904(t1)
+jal zero,77
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-15279
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1515
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+jal ra,-836
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,904(t1)
+jal zero,48
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,-8(s0)
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-1050
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-2275
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,896(t1)
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal ra,-15331
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1462
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,912(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t0,t0,120
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1736
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-36700
+addi sp,sp,8
+addi t0,a0,0
+jal ra,-7331
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-408(t1)
+addi t0,t0,136
+sd t1,0(t0)
+jal zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1760
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-36721
+addi sp,sp,8
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t0,t0,120
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-40023
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-377
+addi t0,a0,0
+addi a0,t0,0
+jal zero,91
+jal zero,89
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-253
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-135
+addi t0,a0,0
+addi a0,t0,0
+jal zero,61
+jal zero,59
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-80
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lui t0,0xFFFFD
+addi t0,t0,-1808
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-40022
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-36845
+addi sp,sp,16
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-40094
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-7260
+addi t0,a0,0
+jal ra,-37717
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-544(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-40365
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+addi t0,s1,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi s1,t0,0
+jal zero,21
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-40120
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,s1,0
+addi a0,t0,0
+jal zero,12
+jal zero,6
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-40401
+addi t0,a0,0
+addi s1,t0,0
+jal zero,-36
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1824
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-37859
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-36962
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s1,t0,0
+addi t0,zero,1
+beq t0,zero,72
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-17236
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40190
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40200
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+addi s1,t0,0
+jal zero,44
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-120
+addi t0,a0,0
+sd t0,16(s0)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-245
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi t1,s2,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40247
+addi t0,a0,0
+addi a0,t0,0
+jal zero,18
+addi t0,s2,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi a1,t0,0
+jal ra,-3193
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-368(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s1,t0,0
+jal zero,-72
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1928
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-37969
+addi t0,a0,0
+lui t0,0xFFFFD
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37072
+addi sp,sp,8
+addi t0,a0,0
+addi t0,zero,1
+beq t0,zero,50
+ld t0,16(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi a1,t0,0
+jal ra,-43642
+addi t0,a0,0
+addi s1,t0,0
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-208
+addi t0,a0,0
+sd t0,16(s0)
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-333
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi t1,s1,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,s1,0
+addi a0,t0,0
+jal ra,-40335
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+addi t0,s1,0
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi a1,t0,0
+jal ra,-3281
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-368(t1)
+jal zero,-50
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFC
+addi t0,t0,2040
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,100
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-37154
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFC
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37166
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s1,t0,0
+addi t0,s1,0
+ld t1,-88(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+addi t0,s1,0
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+addi s1,t0,0
+jal zero,24
+addi t0,s1,0
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+addi t0,s1,0
+addi t1,zero,10
+divu t0,t0,t1
+ld t1,24(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+addi s1,t0,0
+jal zero,7
+addi t0,s1,0
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul t0,t0,t1
+addi s1,t0,0
+addi t0,s1,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sd t0,24(s0)
+addi t0,s1,0
+addi s2,t0,0
+jal zero,7
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s2,t0,0
+addi t0,zero,1
+beq t0,zero,85
+ld t0,24(s0)
+beq t0,zero,9
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-17495
+addi t0,a0,0
+addi s3,t0,0
+jal zero,8
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-43801
+addi t0,a0,0
+addi s3,t0,0
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-40457
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-40467
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+addi s2,t0,0
+jal zero,47
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-507
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi t0,s3,0
+addi a0,t0,0
+jal ra,-40503
+addi t0,a0,0
+addi a0,t0,0
+jal zero,32
+jal zero,29
+addi t0,s3,0
+sd t0,16(s0)
+ld t0,24(s0)
+beq t0,zero,17
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,208(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi t1,s1,0
+sub t0,t0,t1
+addi s2,t0,0
+jal zero,9
+addi t0,s1,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+addi t0,s1,0
+addi s2,t0,0
+jal zero,-85
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s1,t0,0
+addi t0,zero,1
+beq t0,zero,125
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s1,0
+addi a1,t0,0
+jal ra,-17601
+addi t0,a0,0
+addi s2,t0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40555
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40565
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+addi s1,t0,0
+jal zero,97
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40620
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,24(s0)
+beq t0,zero,4
+jal ra,-1891
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40642
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,41
+lui t0,0xFFFFC
+addi t0,t0,1904
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40587
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-37410
+addi sp,sp,16
+addi t0,a0,0
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40670
+addi t0,a0,0
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40662
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-7828
+addi t0,a0,0
+jal ra,-38285
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi a0,t0,0
+jal zero,26
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-678
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-40674
+addi t0,a0,0
+addi a0,t0,0
+jal zero,9
+addi t0,s2,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi s1,t0,0
+jal zero,-125
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,1888
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38385
+addi t0,a0,0
+lui t0,0xFFFFC
+addi t0,t0,1800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37488
+addi sp,sp,8
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,1
+addi a1,t0,0
+jal ra,-174
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,1784
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38422
+addi t0,a0,0
+lui t0,0xFFFFC
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37525
+addi sp,sp,8
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-211
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39455
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-39463
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+addi a0,t0,0
+jal ra,-39488
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-39474
+addi t0,a0,0
+addi s2,t0,0
+addi t0,zero,0
+addi s3,t0,0
+addi t0,s3,0
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+addi t0,s3,0
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+addi t0,s2,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-39636
+addi t0,a0,0
+addi s3,t0,0
+jal zero,3
+addi t0,zero,46
+addi s3,t0,0
+jal zero,-31
+addi t0,s2,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+addi s4,t0,0
+jal zero,34
+addi t0,s2,0
+addi a0,t0,0
+jal ra,-39541
+addi t0,a0,0
+addi s4,t0,0
+addi t0,s2,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,25
+addi t0,s2,0
+addi t1,zero,1
+sub t0,t0,t1
+addi s2,t0,0
+addi t0,s4,0
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,16(s0)
+addi a0,t0,0
+addi t0,s2,0
+addi a1,t0,0
+jal ra,-39676
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-39645
+addi t0,a0,0
+jal zero,-27
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1688
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,s4,0
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-37634
+addi sp,sp,16
+addi t0,a0,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-1675
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi a0,t0,0
+jal ra,646
+addi t0,a0,0
+ld t0,16(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,542
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,545
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1457
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFC
+addi t0,t0,1648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37744
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi a0,t0,0
+jal zero,479
+jal zero,35
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-696(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFC
+addi t0,t0,1608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-37779
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi a0,t0,0
+jal zero,444
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-17848
+addi t0,a0,0
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1088(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+sd t0,16(s0)
+jal zero,21
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,232(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-16(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+sd t0,16(s0)
+jal ra,-42035
+addi t0,a0,0
+jal ra,-41700
+addi t0,a0,0
+jal ra,-40594
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal ra,424
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-39458
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-42873
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-624(t1)
+jal zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-624(t1)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-560(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-568(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-632(t1)
+addi t0,zero,0
+addi s2,t0,0
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-632(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-3986
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-360(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-228
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-15374
+addi t0,a0,0
+addi t0,s2,0
+addi t1,zero,1
+add t0,t0,t1
+addi s2,t0,0
+jal zero,-37
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,280(t1)
+lui t0,0xFFFFC
+addi t0,t0,1552
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-37949
+addi sp,sp,24
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFC
+addi t0,t0,1528
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-37967
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,30
+lui t0,0xFFFFC
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+sd t0,8(sp)
+jal ra,-37983
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,848(t0)
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,1480
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38902
+addi t0,a0,0
+jal zero,7
+lui t0,0xFFFFC
+addi t0,t0,1456
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38909
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+lui t0,0xFFFFC
+addi t0,t0,1440
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38931
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+sd t0,16(s0)
+jal zero,29
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal ra,-42588
+addi t0,a0,0
+lui t0,0xFFFFC
+addi t0,t0,1424
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38960
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+sd t0,16(s0)
+lui t0,0xFFFFC
+addi t0,t0,1416
+add t0,gp,t0
+addi a0,t0,0
+jal ra,-38970
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-560(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-1137
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,58
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-624
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,42
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-603
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,26
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-1074
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+addi t0,zero,0
+addi a1,t0,0
+jal ra,-1001
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFC
+addi t0,t0,1368
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-41342
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi a1,t0,0
+jal ra,-40267
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-38174
+addi sp,sp,24
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-5941
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,3
+jal ra,-4961
+addi t0,a0,0
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+beq t0,zero,19
+lui t0,0xFFFFC
+addi t0,t0,1280
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+jal ra,-38213
+addi sp,sp,8
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi a0,t0,0
+jal ra,-14428
+addi t0,a0,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,280(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-664(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-672(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-23
+addi t0,a0,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-672(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-36
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-680(t1)
+jal ra,-59
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-664(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-664(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-672(t0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-672(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-672(t0)
+addi t1,a0,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-424(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,1192
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-38406
+addi sp,sp,16
+addi t0,a0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-179
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi a0,t0,0
+jal zero,378
+jal zero,376
+lui t0,0xFFFFC
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-16(gp)
+sd t0,16(sp)
+jal ra,-38443
+addi sp,sp,16
+addi t0,a0,0
+lui t0,0xFFFFC
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+sd t0,8(sp)
+ld t0,-32(gp)
+sd t0,16(sp)
+ld t0,-48(gp)
+sd t0,24(sp)
+jal ra,-38459
+addi sp,sp,24
+addi t0,a0,0
+jal ra,-5140
+addi t0,a0,0
+jal ra,-39320
+addi t0,a0,0
+jal ra,-44887
+addi t0,a0,0
+jal ra,-44215
+addi t0,a0,0
+jal ra,-44196
+addi t0,a0,0
+jal ra,-43247
+addi t0,a0,0
+jal ra,-42826
+addi t0,a0,0
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,322
+jal ra,-193
+addi t0,a0,0
+jal ra,-14312
+addi t0,a0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1072
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40192
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-26950
+addi t0,a0,0
+jal zero,303
+jal ra,-259
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi a0,t0,0
+jal zero,298
+jal zero,290
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1064
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40219
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-235
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-21671
+addi t0,a0,0
+jal zero,273
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1056
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40236
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-9436
+addi t0,a0,0
+jal zero,257
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1048
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40252
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi a0,t0,0
+jal ra,-9452
+addi t0,a0,0
+jal zero,241
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1040
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40268
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-21379
+addi t0,a0,0
+jal zero,227
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1032
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40282
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-298
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-16(t1)
+jal zero,210
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1024
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40299
+addi t0,a0,0
+beq t0,zero,22
+jal ra,-315
+addi t0,a0,0
+addi a0,t0,0
+jal ra,-40227
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-632(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-632(t1)
+jal zero,178
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,167
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1016
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40337
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+addi a0,t0,0
+jal ra,-925
+addi t0,a0,0
+addi a0,t0,0
+jal zero,160
+jal zero,146
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1008
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40357
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-568(t0)
+addi a0,t0,0
+jal ra,-945
+addi t0,a0,0
+addi a0,t0,0
+jal zero,140
+jal zero,126
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1000
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40377
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+addi a0,t0,0
+jal ra,-965
+addi t0,a0,0
+addi a0,t0,0
+jal zero,120
+jal zero,106
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,992
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40397
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-584(t0)
+addi a0,t0,0
+jal ra,-985
+addi t0,a0,0
+addi a0,t0,0
+jal zero,100
+jal zero,86
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,984
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40417
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+addi a0,t0,0
+jal ra,-1005
+addi t0,a0,0
+addi a0,t0,0
+jal zero,80
+jal zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,976
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40437
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-600(t0)
+addi a0,t0,0
+jal ra,-1025
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,968
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40457
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-608(t0)
+addi a0,t0,0
+jal ra,-1045
+addi t0,a0,0
+addi a0,t0,0
+jal zero,40
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,960
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-40477
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-616(t0)
+addi a0,t0,0
+jal ra,-1065
+addi t0,a0,0
+addi a0,t0,0
+jal zero,20
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi a0,t0,0
+jal zero,14
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi a0,t0,0
+jal zero,8
+jal zero,-325
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal ra,-472
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal ra,-436
+addi t0,a0,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi a0,t0,0
+ld t0,24(s0)
+addi a1,t0,0
+jal ra,-41607
+addi t0,a0,0
+jal ra,-45434
+addi t0,a0,0
+jal ra,-41586
+addi t0,a0,0
+addi t0,zero,0
+addi a0,t0,0
+jal ra,-471
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,920
+add t0,gp,t0
+addi a1,t0,0
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+nop
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x6E61656C2D
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x782D
+.8byte 0x702D
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6F2D
+.8byte 0x632D
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x736973706F6E7973
+.8byte 0x2D207B207325203A
+.8byte 0x72756F73207B2063
+.8byte 0x2D207C207D206563
+.8byte 0x7972616E6962206F
+.8byte 0x20732D2028207C20
+.8byte 0x61202920532D207C
+.8byte 0x20796C626D657373
+.8byte 0x6E6962206C2D207C
+.8byte 0xA73257D20797261
+.8byte 0x0
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x666C6573203A7325
+.8byte 0x696D726574206569
+.8byte 0x2520676E6974616E
+.8byte 0x6520687469772073
+.8byte 0x65646F6320746978
+.8byte 0xA646C2520
+.8byte 0x206E6F20
+.8byte 0x79616C706572202C
+.8byte 0x0
+.8byte 0x676775626564202C
+.8byte 0x7265
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x20756C25206E6920
+.8byte 0x73747865746E6F63
+.8byte 0x0
+.8byte 0x666C6573203A7325
+.8byte 0x7563657865206569
+.8byte 0x20732520676E6974
+.8byte 0x756C252068746977
+.8byte 0x697379687020424D
+.8byte 0x6F6D656D206C6163
+.8byte 0x7972
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x73252E7325
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473626F6D
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA726574736E696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0x282072657478696D
+.8byte 0x696D202525756C25
+.8byte 0x6C252F7265747370
+.8byte 0x7370796820252575
+.8byte 0xA29726574
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473707968
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA7265747370696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0x3025783020747865
+.8byte 0xA586C38
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x3830257830207478
+.8byte 0x746165726320586C
+.8byte 0x646C696863206465
+.8byte 0x747865746E6F6320
+.8byte 0x586C383025783020
+.8byte 0xA
+.8byte 0x6E776F6E6B6E75
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x6F6620666F207372
+.8byte 0x6C6163206465646C
+.8byte 0x736B63617473206C
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6C61632065746165
+.8byte 0x206B63617473206C
+.8byte 0x20656C69666F7270
+.8byte 0x662074757074756F
+.8byte 0xA732520656C69
+.8byte 0x756C2520
+.8byte 0x586C257830
+.8byte 0x3B
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6120726F6A616D20
+.8byte 0x6D20756C2520646E
+.8byte 0x67617020726F6E69
+.8byte 0x73746C7561662065
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6D2029424D756C25
+.8byte 0x656D206465707061
+.8byte 0xA79726F6D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6C322E252E756C25
+.8byte 0x7463612029424D75
+.8byte 0x636120796C6C6175
+.8byte 0xA646573736563
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0xA73
+.8byte 0x6D6D7573203A7325
+.8byte 0x756C25203A797261
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x73706F6E20252575
+.8byte 0xA5D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x0
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x6F74206465766173
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x0
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x0
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x0
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x29
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x20
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x7463757274736E69
+.8byte 0x646E6120736E6F69
+.8byte 0x74796220756C2520
+.8byte 0x616420666F207365
+.8byte 0x7474697277206174
+.8byte 0x206F746E69206E65
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x302065747962342E
+.8byte 0x586C2578
+.8byte 0x302065747962382E
+.8byte 0x586C2578
+.8byte 0x203A
+.8byte 0x20
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x7325
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x2C
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C203A
+.8byte 0x5D586C2578305B
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x5D586C2578305B
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x2D7C20
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x646C25
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x203E2D20
+.8byte 0x2D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x646C253D3D5D586C
+.8byte 0x202D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x2578303D3D5D586C
+.8byte 0x202D7C20586C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x203E2D20
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x61735F6863746566
+.8byte 0x696765725F646576
+.8byte 0x7372657473
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x20626C74203A7325
+.8byte 0xA3A737365636361
+.8byte 0x203A726464617620
+.8byte 0xA586C3830257830
+.8byte 0x30203A6567617020
+.8byte 0x200A586C34302578
+.8byte 0x30203A656D617266
+.8byte 0x200A586C38302578
+.8byte 0x30203A7264646170
+.8byte 0xA586C38302578
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x6F72662064656863
+.8byte 0x7865746E6F63206D
+.8byte 0x6C38302578302074
+.8byte 0x6E6F63206F742058
+.8byte 0x2578302074786574
+.8byte 0x586C3830
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C617A
+.8byte 0x636F6C6C616D
+.8byte 0x203E2D20
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x736920656D616E20
+.8byte 0x6E6F6C206F6F7420
+.8byte 0x6464612074612067
+.8byte 0x2578302073736572
+.8byte 0xA586C3830
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x64696C61766E6920
+.8byte 0xA
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x69206E61206E6920
+.8byte 0x732064696C61766E
+.8byte 0xA746E656D6765
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x657070616D6E7520
+.8byte 0xA64
+.8byte 0x6E65706F
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0x65207325203A7325
+.8byte 0x7720676E69746978
+.8byte 0x7469786520687469
+.8byte 0x6C252065646F6320
+.8byte 0xA64
+.8byte 0x3C3C3C3C203A7325
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x72616E6962206461
+.8byte 0x69206D6F72662079
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x646564616F6C2061
+.8byte 0x7325206D6F726620
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x6E6120736E6F6974
+.8byte 0x796220756C252064
+.8byte 0x6420666F20736574
+.8byte 0xA617461
+.8byte 0x626D7973203A7325
+.8byte 0x656C626174206C6F
+.8byte 0x2068637261657320
+.8byte 0x73617720656D6974
+.8byte 0x65746920756C2520
+.8byte 0x20736E6F69746172
+.8byte 0x6172657661206E6F
+.8byte 0x2520646E61206567
+.8byte 0x6F74206E6920756C
+.8byte 0xA6C6174
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x62696C20796C6E6F
+.8byte 0x6E65672079726172
+.8byte 0xA646574617265
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x252820736C6C6163
+.8byte 0x6E696C6E6920756C
+.8byte 0x756C25202C296465
+.8byte 0x6D6E676973736120
+.8byte 0x6C25202C73746E65
+.8byte 0x2C656C6968772075
+.8byte 0x2C666920756C2520
+.8byte 0x74657220756C2520
+.8byte 0xA6E7275
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x6174732068746977
+.8byte 0xA6372
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x7972617262696C
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x6465636F7270206E
+.8byte 0x6874697720657275
+.8byte 0x7261762D6E6F6E20
+.8byte 0x6170206369646169
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x636F7270206E6920
+.8byte 0x6977206572756465
+.8byte 0x762D6E6F6E206874
+.8byte 0x2063696461697261
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x676E696E726177
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x676E696E726177
+.8byte 0x6369646169726176
+.8byte 0x756465636F727020
+.8byte 0x656C6C6163206572
+.8byte 0x65726F6665622064
+.8byte 0x6572616C63656420
+.8byte 0x64
+.8byte 0x656D616E5F6F6E
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x64696F76
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x2072656765746E69
+.8byte 0x6220666F2074756F
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6666756220657469
+.8byte 0x756F206F74207265
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x7325
+.8byte 0x7325
+.8byte 0x66746E69727064
+.8byte 0x645F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x66746E69727073
+.8byte 0x735F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x2066746E697270
+.8byte 0x705F6569666C6573
+.8byte 0x66746E6972
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x6567616972726163
+.8byte 0x6E727574657220
+.8byte 0x65656620656E696C
+.8byte 0x64
+.8byte 0x6F74616C75626174
+.8byte 0x72
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x6325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x989680
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x191
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x10000
+.8byte 0x8000
+.8byte 0x40000
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x0
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xB
+.8byte 0x6
+.8byte 0x7
+.8byte 0x20
+.8byte 0x2020706D75625F
+.8byte 0x2020206E69616D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xC
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x0
+.8byte 0x20
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
+.8byte 0x0
@@ -0,0 +1,44545 @@
+lui t0,0x3E
+addi t0,t0,-1480
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+addi a0,zero,0
+ld t0,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,sp,16
+sd t0,8(sp)
+jal ra,42621
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,0(sp)
+addi sp,sp,8
+addi a7,zero,93
+ecall
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+ld a3,0(sp)
+addi sp,sp,8
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,-504
+add t0,gp,t0
+sd t0,-16(gp)
+ld t0,-16(gp)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(gp)
+sub t0,t0,t1
+sd t0,-24(gp)
+ld t0,-24(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-32(gp)
+ld t0,-16(gp)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(gp)
+sub t0,t0,t1
+sd t0,-40(gp)
+ld t0,-40(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-48(gp)
+ld t0,-24(gp)
+sd t0,-56(gp)
+ld t0,-56(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-64(gp)
+ld t0,-32(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7409
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-80(gp)
+ld t0,-80(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-80(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-80(gp)
+ld t2,-8(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sd t0,-88(gp)
+ld t0,-32(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4348
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-104(gp)
+ld t0,-104(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-96(gp)
+ld t0,-24(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7356
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-320(gp)
+ld t0,-320(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-32(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4964
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-328(gp)
+ld t0,-336(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4957
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-344(gp)
+ld t0,-352(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4950
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-360(gp)
+ld t0,-24(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7325
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-368(gp)
+ld t0,-368(gp)
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-432(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-776(gp)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7287
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-784(gp)
+ld t0,-784(gp)
+ld t1,-520(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-528(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-536(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1128
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1136
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1144
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1152
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1160
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1168
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1176
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1184
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1192
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1200
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1216
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-784(gp)
+ld t1,-776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1224
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-112(gp)
+sd t0,-864(gp)
+ld t0,-512(gp)
+sd t0,-880(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+sd t0,-816(gp)
+addi t0,zero,0
+sd t0,-872(gp)
+jal ra,7415
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-888(gp)
+addi t0,zero,0
+sd t0,-896(gp)
+addi t0,zero,0
+sd t0,-904(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,6
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6970
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1328(gp)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6806
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-1336(gp)
+addi t0,zero,0
+sd t0,-1344(gp)
+addi t0,zero,0
+sd t0,-1352(gp)
+addi t0,zero,0
+sd t0,-1360(gp)
+addi t0,zero,0
+sd t0,-1368(gp)
+addi t0,zero,0
+sd t0,-1376(gp)
+addi t0,zero,0
+sd t0,-1384(gp)
+addi t0,zero,0
+sd t0,-1392(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-1432(gp)
+addi t0,zero,0
+sd t0,-1440(gp)
+addi t0,zero,0
+sd t0,-1448(gp)
+addi t0,zero,0
+sd t0,-1456(gp)
+addi t0,zero,0
+sd t0,-1464(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+jal ra,7676
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,zero,-1472
+add t0,gp,t0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4227
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-1480(gp)
+addi t0,zero,-1504
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4219
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-1488(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1512(gp)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6526
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-1784(gp)
+ld t0,-1784(gp)
+ld t1,-1528(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1792
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1536(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1800
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1808
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1816
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1824
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1832
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1840
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1848
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1856
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1864
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1872
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1880
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1888
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1896
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1904
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1912
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1920
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1928
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1944
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1968
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1784(gp)
+ld t1,-1776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1456(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1440(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1432(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1424(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1416(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1400(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1392(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,6
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6179
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,3
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6048
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sd t0,16(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+mul t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1000(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+ld t1,-40(gp)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1016(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,992(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1184(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,984(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,976(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,968(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,26244
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,832(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,824(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,816(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,808(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,800(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,792(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,784(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,776(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,768(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,760(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5418
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,640(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,616
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,608
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,600
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,592
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,584
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,576
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,568
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,560
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-72(gp)
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,552
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,544
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,536
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,528
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,520
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,512
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,504
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,496
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5328
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,472(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5315
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,464(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi t1,zero,1
+add t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5144
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,368(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,440(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-56
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-72
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,424(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-96
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,416(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-104
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-120
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-144
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-160
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-184
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-208
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,248(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,240(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,224(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,232(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,216(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,208(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,200(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,168(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,160(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,136(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,128(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,120(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,112(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5036
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,104(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,96(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5015
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,88(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4998
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,80(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4981
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,72(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1512(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4959
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,64(t1)
+ld t0,-1512(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4948
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,56(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,-1544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,48(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,40(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,32(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,24(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,16(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,8(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,0(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-8(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-16(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-24(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-32(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-40(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1560
+addi a0,zero,0
+jal ra,-1019
+addi a0,zero,0
+jal ra,-278
+addi a0,zero,0
+jal ra,-217
+addi a0,zero,0
+jal ra,-132
+addi a0,zero,0
+jal ra,-50
+addi a0,zero,0
+jal ra,21918
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,9
+ld t1,-40(gp)
+mul t0,t0,t1
+addi t1,zero,16
+ld t2,-24(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4666
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-232(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,8(sp)
+jal ra,33357
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-240(t1)
+jal zero,-22
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-520(t1)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-528(t1)
+jal ra,37779
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-544(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-24(gp)
+ld t1,-40(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-312(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4298
+addi a0,zero,0
+ld t0,-32(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-32(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,zero,0
+sd t0,-72(gp)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1672(t1)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1592(t1)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1568(t1)
+addi t0,zero,32
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1560(t1)
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-312(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4335
+addi a0,zero,0
+jal ra,19950
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,367
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-592(t1)
+jal zero,48
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-368(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-4369
+addi a0,zero,0
+ld t0,-368(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-592(t1)
+jal zero,23
+ld t0,-368(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-592(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-592(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-592(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-392(gp)
+sd t0,-408(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-400(gp)
+sd t0,-408(gp)
+jal zero,3
+ld t0,-384(gp)
+sd t0,-408(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2634
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,23141
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,928(t1)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-544(t1)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,936(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-80(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,13
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,13
+ld t0,16(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-119
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-39
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-155
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-61
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,40
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-104(gp)
+add t0,t0,t1
+ld t1,24(s0)
+ld t2,-104(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+ld t0,24(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,123
+jal zero,31
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-46
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,16
+ld t0,-104(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,99
+jal zero,7
+ld t0,-104(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,92
+jal zero,91
+ld t0,24(s0)
+ld t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,82
+jal zero,81
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-87
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,42
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-96
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-153
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,44
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-173
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,32
+jal zero,31
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-137
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-197
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,7
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-411
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-430
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-466
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,16
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-483
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-376
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-413
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-67
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-515
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-24(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-536
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2517
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-151
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-196
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-16(s0)
+sd t0,-8(s0)
+jal zero,5
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-24
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-235
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-202
+addi a0,zero,0
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-24
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-216
+addi a0,zero,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-137
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-290
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-304
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-271
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-280
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-46
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,68
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-349
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-362
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,39
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,35
+jal zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-383
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-393
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+jal zero,-68
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-432
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,123
+ld t0,-24(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+addi t0,t0,-640
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1714
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5480
+addi a0,zero,0
+ld t0,-16(s0)
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,67
+ld t0,-16(s0)
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,-24(s0)
+ld t1,-88(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,22
+lui t0,0xFFFFF
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1657
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5537
+addi a0,zero,0
+jal zero,22
+lui t0,0xFFFFF
+addi t0,t0,-736
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1635
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5559
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-558
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,-126
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-558
+addi a0,zero,0
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,23
+ld t0,40(s0)
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-897
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-609
+addi a0,zero,0
+jal zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-623
+addi a0,zero,0
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+ld t0,-16(s0)
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,45
+sd t0,16(sp)
+jal ra,-649
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-666
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-17
+jal zero,19
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-685
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-17
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-699
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-477
+addi a0,zero,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1282
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,4
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1316
+addi t0,a0,0
+addi a0,zero,0
+ld t1,16(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1344
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1369
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-142
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-69
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-172
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-74
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-207
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-166
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-141
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-253
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-212
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-162
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-464(gp)
+beq t0,zero,15
+ld t0,-464(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-472(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-1012
+addi a0,zero,0
+ld t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-472(gp)
+jal zero,98
+ld t0,-320(gp)
+beq t0,zero,89
+ld t0,-320(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-552(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-744
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,1091
+addi sp,sp,8
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,12
+ld t0,-456(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-320(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-6095
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,12
+ld t0,-456(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-320(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-6107
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFF
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-448(gp)
+sd t0,16(sp)
+jal ra,1039
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6155
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6163
+addi a0,zero,0
+ld t0,-440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-440(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-808
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17
+addi a0,zero,0
+jal zero,32
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1190
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1202
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-173
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-28
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-136(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-194
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-168(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-210
+addi a0,zero,0
+ld t0,16(s0)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+addi a0,zero,0
+jal zero,48
+ld t0,16(s0)
+ld t1,-128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-840
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+addi a0,zero,0
+jal zero,34
+ld t0,16(s0)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-856
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+addi a0,zero,0
+jal zero,20
+ld t0,16(s0)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-136
+addi a0,zero,0
+jal zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-271
+addi a0,zero,0
+ld t0,-168(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-276
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-292
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-168
+addi a0,zero,0
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-302
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-788
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-202
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-817
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-231
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-846
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1285
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+ld t0,-120(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-400
+addi a0,zero,0
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(s0)
+jal zero,-13
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-891
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-305
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-880
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-323
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-46
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-945
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-359
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-888
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-377
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-46
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-999
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-413
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-431
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-46
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1620
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-468
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,398
+jal zero,394
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1644
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-621
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,374
+jal zero,370
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1668
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,138
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1683
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,120
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1700
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,100
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1715
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-1162
+addi a0,zero,0
+jal zero,35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1744
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-328(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-1191
+addi a0,zero,0
+jal zero,6
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,265
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-328(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1643
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+addi t0,zero,48
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-761
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+jal zero,-13
+ld t0,-328(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-642
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,224
+jal zero,220
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1818
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1833
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,43
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1850
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1865
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-431
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,151
+jal zero,147
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1891
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1906
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-573
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,112
+jal zero,82
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1932
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-570
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,86
+jal zero,56
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1958
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-524
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,58
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1986
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-498
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,30
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-2012
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-470
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+beq t0,zero,6
+ld t0,24(s0)
+sd t0,-464(gp)
+addi t0,zero,0
+sd t0,-472(gp)
+jal zero,3
+ld t0,16(s0)
+sd t0,-456(gp)
+addi t0,zero,0
+sd t0,-440(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,97
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2070
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,74
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2082
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2099
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+ld a0,0(t0)
+addi t0,t0,8
+sd t0,40(s0)
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-509
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,10
+addi t0,zero,37
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1092
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,17
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2138
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1109
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-84
+ld t0,24(s0)
+beq t0,zero,10
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-472(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2122
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-464(gp)
+addi t0,zero,0
+sd t0,-472(gp)
+ld t0,-440(gp)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,24
+add t0,t0,s0
+sd t0,-8(s0)
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-154
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi a0,zero,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,t0,s0
+sd t0,-8(s0)
+addi a0,zero,0
+addi t0,zero,0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-189
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi a0,zero,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,t0,s0
+sd t0,-8(s0)
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-224
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi a0,zero,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-912
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-1957
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-920
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2128
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,39
+jal zero,38
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-936
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-1979
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-944
+add t0,gp,t0
+addi a0,t0,0
+jal zero,22
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-960
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-1996
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-968
+add t0,gp,t0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-456(gp)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-194
+addi sp,sp,8
+addi a0,zero,0
+jal zero,49
+ld t0,-456(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-984
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-137
+addi sp,sp,8
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-2681
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,22
+lui t0,0xFFFFF
+addi t0,t0,-1032
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-448(gp)
+sd t0,16(sp)
+jal ra,-232
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7426
+addi a0,zero,0
+ld t0,-432(gp)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,-432(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,11
+jal zero,10
+ld t0,16(s0)
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(gp)
+divu t0,t0,t1
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5517
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7500
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,32
+jal zero,31
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,23
+jal zero,22
+ld t0,-320(gp)
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-380
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7574
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,936(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-90
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,936(t1)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,-191
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-175
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5661
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7645
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1650
+addi a0,zero,0
+ld t0,16(s0)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1080
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1534
+addi a0,zero,0
+jal zero,11
+ld t0,-784(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1545
+addi a0,zero,0
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1679
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1112
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-920(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-567
+addi sp,sp,32
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1128
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-41
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1136
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-597
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1152
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-75
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1565
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1645
+addi a0,zero,0
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1577
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1657
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1192
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-123
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-679
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-157
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1565
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1240
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1727
+addi a0,zero,0
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1577
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1739
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-928(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-320(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-7935
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-320(gp)
+ld t0,0(t0)
+sd t0,-864(gp)
+ld t0,-872(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-872(gp)
+jal zero,31
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-112(gp)
+sd t0,-864(gp)
+jal zero,22
+lui t0,0xFFFFF
+addi t0,t0,-1304
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-791
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7985
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-864(gp)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-152(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,16
+ld t0,-864(gp)
+ld t1,-128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,6
+jal ra,-59
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,167
+ld t0,-8(s0)
+beq t0,zero,25
+jal ra,-84
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,17
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,149
+jal zero,7
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-172
+addi a0,zero,0
+jal zero,140
+ld t0,-16(s0)
+beq t0,zero,62
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-187
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,-20
+ld t0,-16(s0)
+beq t0,zero,32
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-816(gp)
+jal zero,21
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1336
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-386
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8155
+addi a0,zero,0
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-235
+addi a0,zero,0
+jal zero,77
+jal ra,-137
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,18
+ld t0,-864(gp)
+ld t1,-136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-816(gp)
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-256
+addi a0,zero,0
+jal zero,56
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-265
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-283
+addi a0,zero,0
+jal zero,25
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-302
+addi a0,zero,0
+jal zero,6
+ld t0,-672(gp)
+sd t0,-880(gp)
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,2
+jal zero,-167
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,29
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-864(gp)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,-864(gp)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-93
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,22
+jal ra,-47
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-864(gp)
+ld t1,-160(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,22
+jal ra,-397
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-824(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-784(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-3086
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,104
+jal zero,103
+ld t0,-560(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-560(gp)
+addi a0,t0,0
+jal zero,93
+jal zero,92
+ld t0,-568(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-568(gp)
+addi a0,t0,0
+jal zero,82
+jal zero,81
+ld t0,-576(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-576(gp)
+addi a0,t0,0
+jal zero,71
+jal zero,70
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-584(gp)
+addi a0,t0,0
+jal zero,60
+jal zero,59
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-89
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,49
+jal zero,48
+ld t0,-752(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-100
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,38
+jal zero,37
+ld t0,-760(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-111
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,27
+jal zero,26
+ld t0,-768(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,15
+ld t0,-776(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-552(gp)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,-544(gp)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-512(gp)
+sd t0,-880(gp)
+jal ra,-512
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-112(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,622
+ld t0,-880(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,613
+jal ra,-340
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,64
+ld t0,-792(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3465
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-824(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-265
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,37
+ld t0,-8(s0)
+ld t1,-792(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1360
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-853
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8622
+addi a0,zero,0
+ld t0,-824(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3582
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-711
+addi a0,zero,0
+jal zero,-39
+ld t0,-824(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3598
+addi a0,zero,0
+jal ra,-206
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-880(gp)
+jal zero,546
+jal ra,-353
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,99
+ld t0,-800(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3532
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-832(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-366
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,47
+ld t0,-8(s0)
+ld t1,-800(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,-856(gp)
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-922
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-930
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8699
+addi a0,zero,0
+ld t0,-832(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3659
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-788
+addi a0,zero,0
+jal zero,-49
+ld t0,-832(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3675
+addi a0,zero,0
+ld t0,-832(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3300
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-848(gp)
+ld t0,-856(gp)
+beq t0,zero,19
+ld t0,-848(gp)
+ld t1,-104(gp)
+sltu t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1448
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8751
+addi a0,zero,0
+ld t0,-520(gp)
+sd t0,-880(gp)
+jal zero,444
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+jal ra,-836
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-848(gp)
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,-1504
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1015
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8784
+addi a0,zero,0
+jal zero,3
+ld t0,-864(gp)
+sd t0,-848(gp)
+jal ra,-863
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-871
+addi a0,zero,0
+jal zero,25
+ld t0,-864(gp)
+ld t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-168(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1013
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8816
+addi a0,zero,0
+jal zero,6
+ld t0,-168(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1026
+addi a0,zero,0
+ld t0,-528(gp)
+sd t0,-880(gp)
+jal zero,373
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,93
+jal ra,-907
+addi a0,zero,0
+ld t0,-808(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3709
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-840(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-469
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,45
+ld t0,-8(s0)
+ld t1,-808(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1097
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8866
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,335
+addi a0,zero,0
+ld t0,-840(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3834
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-963
+addi a0,zero,0
+jal zero,-47
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-972
+addi a0,zero,0
+jal zero,13
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1108
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8911
+addi a0,zero,0
+ld t0,-840(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3871
+addi a0,zero,0
+ld t0,-536(gp)
+sd t0,-880(gp)
+jal zero,275
+ld t0,-864(gp)
+ld t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1005
+addi a0,zero,0
+ld t0,-600(gp)
+sd t0,-880(gp)
+jal zero,264
+ld t0,-864(gp)
+ld t1,-192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1016
+addi a0,zero,0
+ld t0,-608(gp)
+sd t0,-880(gp)
+jal zero,253
+ld t0,-864(gp)
+ld t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1027
+addi a0,zero,0
+ld t0,-616(gp)
+sd t0,-880(gp)
+jal zero,242
+ld t0,-864(gp)
+ld t1,-208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1038
+addi a0,zero,0
+ld t0,-624(gp)
+sd t0,-880(gp)
+jal zero,231
+ld t0,-864(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1049
+addi a0,zero,0
+ld t0,-632(gp)
+sd t0,-880(gp)
+jal zero,220
+ld t0,-864(gp)
+ld t1,-224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1060
+addi a0,zero,0
+ld t0,-640(gp)
+sd t0,-880(gp)
+jal zero,209
+ld t0,-864(gp)
+ld t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1071
+addi a0,zero,0
+ld t0,-648(gp)
+sd t0,-880(gp)
+jal zero,198
+ld t0,-864(gp)
+ld t1,-240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1082
+addi a0,zero,0
+ld t0,-656(gp)
+sd t0,-880(gp)
+jal zero,187
+ld t0,-864(gp)
+ld t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1093
+addi a0,zero,0
+ld t0,-664(gp)
+sd t0,-880(gp)
+jal zero,176
+ld t0,-864(gp)
+ld t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1104
+addi a0,zero,0
+ld t0,-680(gp)
+sd t0,-880(gp)
+jal zero,165
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1115
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1123
+addi a0,zero,0
+ld t0,-696(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-688(gp)
+sd t0,-880(gp)
+jal zero,143
+ld t0,-864(gp)
+ld t1,-280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-1137
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1145
+addi a0,zero,0
+jal zero,6
+ld t0,-272(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1281
+addi a0,zero,0
+ld t0,-704(gp)
+sd t0,-880(gp)
+jal zero,118
+ld t0,-864(gp)
+ld t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1162
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1170
+addi a0,zero,0
+ld t0,-720(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-712(gp)
+sd t0,-880(gp)
+jal zero,96
+ld t0,-864(gp)
+ld t1,-296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1184
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1192
+addi a0,zero,0
+ld t0,-736(gp)
+sd t0,-880(gp)
+jal zero,3
+ld t0,-728(gp)
+sd t0,-880(gp)
+jal zero,74
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+jal ra,-1206
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-1214
+addi a0,zero,0
+ld t0,-864(gp)
+ld t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1222
+addi a0,zero,0
+jal zero,6
+ld t0,-312(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1358
+addi a0,zero,0
+jal zero,6
+ld t0,-312(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1364
+addi a0,zero,0
+ld t0,-744(gp)
+sd t0,-880(gp)
+jal zero,35
+lui t0,0xFFFFF
+addi t0,t0,-1536
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-1439
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1568
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3004
+addi a0,zero,0
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2936
+addi a0,zero,0
+jal ra,-2954
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9197
+addi a0,zero,0
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-1292
+addi a0,zero,0
+ld t0,-864(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-136(gp)
+sd t0,-864(gp)
+jal zero,69
+ld t0,-864(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-128(gp)
+sd t0,-864(gp)
+jal zero,60
+ld t0,-864(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-120(gp)
+sd t0,-864(gp)
+jal zero,51
+ld t0,-864(gp)
+ld t1,-168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-168(gp)
+sd t0,-864(gp)
+jal zero,42
+ld t0,-864(gp)
+ld t1,-176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-176(gp)
+sd t0,-864(gp)
+jal zero,33
+ld t0,-864(gp)
+ld t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-264(gp)
+sd t0,-864(gp)
+jal zero,24
+ld t0,-864(gp)
+ld t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-304(gp)
+sd t0,-864(gp)
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1600
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1526
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9295
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+ld t1,0(t1)
+ld t2,16(s0)
+ld t2,0(t2)
+ld t3,16(s0)
+ld t3,0(t3)
+ld t4,16(s0)
+ld t4,0(t4)
+ld t5,16(s0)
+ld t5,0(t5)
+ld t6,-1328(gp)
+divu t5,t5,t6
+add t4,t4,t5
+ld t5,-1328(gp)
+divu t4,t4,t5
+add t3,t3,t4
+ld t4,-1328(gp)
+divu t3,t3,t4
+add t2,t2,t3
+ld t3,-1328(gp)
+divu t2,t2,t3
+add t1,t1,t2
+ld t2,-1328(gp)
+divu t1,t1,t2
+add t0,t0,t1
+ld t1,-1328(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-8824
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-8646
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-8635
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-8624
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-8613
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,56(s0)
+sd t0,8(sp)
+jal ra,-8602
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,64(s0)
+sd t0,8(sp)
+jal ra,-8591
+addi a0,zero,0
+ld t0,16(s0)
+ld t1,-1304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,67
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1552(gp)
+sd t0,8(sp)
+jal ra,-8586
+addi a0,zero,0
+ld t0,-1336(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-8731
+addi a0,zero,0
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,40(s0)
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1360(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1360(gp)
+jal zero,22
+ld t0,40(s0)
+ld t1,-1256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1368(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1368(gp)
+jal zero,11
+ld t0,40(s0)
+ld t1,-1248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1376(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1376(gp)
+jal zero,40
+ld t0,16(s0)
+ld t1,-1312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+jal ra,-8658
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1344(gp)
+sd t0,8(sp)
+jal ra,-8787
+addi a0,zero,0
+ld t0,-8(s0)
+sd t0,-1344(gp)
+jal zero,17
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1552(gp)
+sd t0,8(sp)
+jal ra,-8675
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1352(gp)
+sd t0,8(sp)
+jal ra,-8804
+addi a0,zero,0
+ld t0,-8(s0)
+sd t0,-1352(gp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1384(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1384(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,-1392(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1392(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8936
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8989
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-4214
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9018
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+jal zero,-48
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1336(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-292
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-93
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-1344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1232(gp)
+sd t0,16(sp)
+jal ra,-123
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,21
+ld t0,24(s0)
+ld t1,-1256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-1352(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1256(gp)
+sd t0,16(sp)
+jal ra,-141
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-92
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9094
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1256(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9050
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,32
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9065
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8958
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7077
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1352(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1256(gp)
+sd t0,16(sp)
+jal ra,-255
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1328(gp)
+sltu t0,t0,t1
+beq t0,zero,84
+ld t0,-1336(gp)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9248
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-60
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+addi t0,zero,1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-1616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9259
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2116
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1640
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9292
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2677
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9321
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,-70
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-86
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,64
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,55
+jal zero,54
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,45
+jal zero,44
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,35
+jal zero,34
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,55
+jal zero,54
+ld t0,-880(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,45
+jal zero,44
+ld t0,-880(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,35
+jal zero,34
+ld t0,-880(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,75
+jal zero,74
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,65
+jal zero,64
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,55
+jal zero,54
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+jal zero,44
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,35
+jal zero,34
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,55
+jal zero,54
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+jal zero,44
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,35
+jal zero,34
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+ld t1,-1520(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1400(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1400(gp)
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1664
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2694
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10463
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1400(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1560(gp)
+ld t1,-1400(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,24
+jal zero,8
+ld t0,-1744(gp)
+ld t1,-1400(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,16
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1688
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2741
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10510
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1400(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1584(gp)
+addi a0,t0,0
+jal zero,24
+jal zero,8
+jal ra,-66
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,16
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1712
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2788
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10557
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+ld t1,-1520(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-1400(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1752(gp)
+addi a0,t0,0
+jal zero,24
+jal zero,8
+jal ra,-113
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,16
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1736
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2835
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10604
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-1400(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,-1400(gp)
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-1768
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2871
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10640
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,28
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,8395
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-201
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,8757
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi a0,zero,0
+jal zero,-30
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+jal ra,-262
+addi a0,zero,0
+jal ra,-230
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,8661
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,8341
+addi a0,zero,0
+jal zero,-26
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-3007
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3057
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4577
+addi a0,zero,0
+ld t0,-880(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3069
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1808
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4589
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-3055
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4620
+addi a0,zero,0
+ld t0,-880(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3112
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1856
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4632
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4660
+addi a0,zero,0
+jal zero,50
+ld t0,16(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4674
+addi a0,zero,0
+jal zero,36
+ld t0,16(s0)
+ld t1,-1288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4688
+addi a0,zero,0
+jal zero,22
+ld t0,16(s0)
+ld t1,-1296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4702
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1920
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4710
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1928
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-3172
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4737
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4749
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-110
+addi a0,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4761
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6065
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,8094
+addi a0,zero,0
+jal zero,111
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6351
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-6362
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6505
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,44
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6073
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,8003
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6538
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,8100
+addi a0,zero,0
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6112
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,7964
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6128
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7983
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1518
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,32
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1492
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,14
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3285
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11136
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10491
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6537
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10507
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-6553
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6696
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal ra,-764
+addi a0,zero,0
+jal ra,-732
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6268
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,7808
+addi a0,zero,0
+jal ra,-748
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10546
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-760
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7866
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-169
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10599
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6380
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,20
+jal ra,-837
+addi a0,zero,0
+jal ra,-805
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10603
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,8081
+addi a0,zero,0
+jal zero,35
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-152
+addi a0,zero,0
+jal ra,-827
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-832
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6689
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6376
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,8046
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10706
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-6462
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+jal ra,-919
+addi a0,zero,0
+jal ra,-887
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-421
+addi a0,zero,0
+jal zero,51
+ld t0,-832(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1240(gp)
+sd t0,8(sp)
+jal ra,-1789
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-832(gp)
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1240(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+ld t0,16(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-2064
+addi a0,zero,0
+ld t0,-832(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1240(gp)
+sd t0,8(sp)
+jal ra,-173
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6283
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-4011
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1248(gp)
+sd t0,24(sp)
+ld t0,-1280(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-2131
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-143
+addi a0,zero,0
+jal ra,-1015
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1552(gp)
+sd t0,8(sp)
+jal ra,-1022
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7604
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,-1296(gp)
+sd t0,-8(s0)
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-2191
+addi a0,zero,0
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,7997
+addi a0,zero,0
+jal zero,101
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10925
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10894
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,-10767
+addi a0,zero,0
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,7962
+addi a0,zero,0
+jal zero,66
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10922
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7101
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5220
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10948
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,7926
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-10823
+addi a0,zero,0
+jal zero,17
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10974
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,7896
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,7392
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1536(gp)
+sd t0,16(sp)
+jal ra,7756
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,7373
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1592(gp)
+sd t0,16(sp)
+jal ra,7737
+addi a0,zero,0
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7355
+addi a0,zero,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+ld t0,16(s0)
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6827
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,7331
+addi a0,zero,0
+jal zero,23
+ld t0,16(s0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-395
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+jal ra,-1272
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7354
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1140
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7288
+addi a0,zero,0
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7590
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,7270
+addi a0,zero,0
+ld t0,-1536(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7572
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+ld t1,16(s0)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,7250
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7756
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11269
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1984
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-6501
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,3040
+addi a0,zero,0
+jal zero,28
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1992
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-6515
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,3169
+addi a0,zero,0
+jal zero,14
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-2000
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-6529
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,3
+jal ra,3283
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11260
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,-1352(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1264(gp)
+sd t0,16(sp)
+jal ra,-2391
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,208
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1256(gp)
+sd t0,8(sp)
+jal ra,-2309
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-1400(gp)
+sd t0,-16(s0)
+jal ra,-1288
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-24(s0)
+jal ra,-2014
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,109
+jal ra,866
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-32(s0)
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7103
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-1495
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7463
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1363
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+jal ra,-3420
+addi a0,zero,0
+jal ra,821
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-1527
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,7431
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1395
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-32
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sd t0,8(sp)
+jal ra,7747
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-3463
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-534
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+jal zero,8
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1319
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-40(s0)
+jal zero,28
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-3491
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-562
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+jal zero,8
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1347
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11444
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-7372
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,23
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11466
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+ld t1,-56(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,6942
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1433
+addi a0,zero,0
+ld t0,-1432(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1432(gp)
+ld t0,-40(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+jal ra,-1919
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,20
+jal ra,-1372
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12161
+addi a0,zero,0
+jal zero,3
+jal ra,-3597
+addi a0,zero,0
+jal zero,-22
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+jal ra,-3606
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi t0,zero,1
+sd t0,-8(s0)
+jal ra,1778
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3626
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1471
+addi a0,zero,0
+jal zero,22
+jal ra,608
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3645
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1490
+addi a0,zero,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,246
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,1
+sd t0,-32(s0)
+addi t0,zero,1
+sd t0,-856(gp)
+jal ra,-3669
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-856(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,1
+sd t0,-40(s0)
+jal ra,-3684
+addi a0,zero,0
+jal zero,3
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,53
+ld t0,-824(gp)
+sd t0,-48(s0)
+jal ra,-3697
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+jal ra,-3705
+addi a0,zero,0
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-382
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal ra,-1844
+addi a0,zero,0
+jal ra,-1812
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1608(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6768
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6759
+addi a0,zero,0
+jal zero,10
+ld t0,-48(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1232(gp)
+sd t0,8(sp)
+jal ra,-1066
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,88
+ld t0,-880(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-848(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+addi a0,zero,0
+jal ra,-3758
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal zero,72
+ld t0,-880(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-1899
+addi a0,zero,0
+jal ra,-1867
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,-848(gp)
+sd t0,16(sp)
+jal ra,6713
+addi a0,zero,0
+jal ra,-3782
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal zero,48
+ld t0,-880(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-840(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-939
+addi a0,zero,0
+jal ra,-3798
+addi a0,zero,0
+ld t0,-1280(gp)
+sd t0,-24(s0)
+jal zero,32
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3809
+addi a0,zero,0
+jal ra,432
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3821
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1666
+addi a0,zero,0
+jal zero,5
+jal ra,-1621
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+ld t0,-40(s0)
+beq t0,zero,28
+ld t0,-24(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1280(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1520
+addi a0,zero,0
+jal ra,-1944
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-1949
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6945
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+ld t0,-32(s0)
+beq t0,zero,28
+ld t0,-24(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-1272(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1549
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-24(s0)
+jal ra,-1975
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+jal ra,-1982
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6689
+addi a0,zero,0
+ld t0,-8(s0)
+beq t0,zero,5
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-342
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal ra,-2440
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,92
+ld t0,-880(gp)
+sd t0,-16(s0)
+jal ra,-3923
+addi a0,zero,0
+jal ra,-354
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1613
+addi a0,zero,0
+ld t0,-16(s0)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1996
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2001
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2052
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6664
+addi a0,zero,0
+jal zero,44
+ld t0,-16(s0)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2018
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2023
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2074
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6687
+addi a0,zero,0
+jal zero,22
+ld t0,-16(s0)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-2040
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2045
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2096
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6710
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1964
+addi a0,zero,0
+jal zero,-94
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-120
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal ra,-2510
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,200
+ld t0,-880(gp)
+sd t0,-16(s0)
+jal ra,-4037
+addi a0,zero,0
+jal ra,-132
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,64
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-24(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2157
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,2655
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFF
+addi t0,t0,-2040
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4881
+addi a0,zero,0
+jal zero,18
+ld t0,-24(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2134
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,2631
+addi a0,zero,0
+ld t0,-1280(gp)
+sd t0,-8(s0)
+jal ra,-2145
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2150
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2201
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6425
+addi a0,zero,0
+jal zero,117
+ld t0,-16(s0)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,111
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,76
+ld t0,-24(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-2226
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,2586
+addi a0,zero,0
+jal ra,-2188
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2193
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2244
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6427
+addi a0,zero,0
+jal zero,44
+jal ra,-2204
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2209
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2260
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6411
+addi a0,zero,0
+jal ra,-2266
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,-24(gp)
+sd t0,16(sp)
+jal ra,6314
+addi a0,zero,0
+jal ra,-2230
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2235
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2286
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6475
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-8(s0)
+jal zero,30
+ld t0,-24(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFE
+addi t0,t0,2016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5015
+addi a0,zero,0
+jal zero,16
+jal ra,-2262
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2267
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2318
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6353
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2186
+addi a0,zero,0
+jal zero,-202
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-228
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal ra,-2698
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,275
+ld t0,-880(gp)
+sd t0,-16(s0)
+jal ra,-4259
+addi a0,zero,0
+jal ra,-240
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1949
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+jal ra,-2334
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2386
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2343
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6281
+addi a0,zero,0
+jal ra,-2396
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6184
+addi a0,zero,0
+jal ra,-2360
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2365
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2416
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6435
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2284
+addi a0,zero,0
+jal zero,200
+ld t0,-16(s0)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2387
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2439
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2396
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6228
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2311
+addi a0,zero,0
+jal ra,-2454
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+jal ra,-2461
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6390
+addi a0,zero,0
+jal zero,160
+ld t0,-16(s0)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-2427
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2432
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2483
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6368
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2351
+addi a0,zero,0
+jal zero,133
+ld t0,-16(s0)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-2454
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2506
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2463
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6341
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2378
+addi a0,zero,0
+jal zero,106
+ld t0,-16(s0)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+jal ra,-2481
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2533
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2490
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6314
+addi a0,zero,0
+jal ra,-2543
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6037
+addi a0,zero,0
+jal ra,-2507
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2559
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2516
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6108
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2431
+addi a0,zero,0
+jal zero,53
+ld t0,-16(s0)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-2534
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2539
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2590
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6261
+addi a0,zero,0
+jal ra,-2596
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,5984
+addi a0,zero,0
+jal ra,-2560
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2612
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-2569
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,6055
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2484
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,93
+jal ra,-4558
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+jal ra,-4566
+addi a0,zero,0
+jal ra,-325
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-16(s0)
+jal ra,-2670
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6349
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2543
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-4596
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+jal ra,-4604
+addi a0,zero,0
+jal ra,-3281
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,368
+addi a0,zero,0
+jal zero,-6
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4619
+addi a0,zero,0
+jal zero,13
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2464
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13199
+addi a0,zero,0
+jal zero,3
+jal ra,343
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2480
+addi a0,zero,0
+jal zero,6
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2486
+addi a0,zero,0
+jal zero,6
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2492
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,6309
+addi a0,zero,0
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6418
+addi a0,zero,0
+ld t0,-1448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1448(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,171
+jal ra,-4698
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,157
+jal ra,-4706
+addi a0,zero,0
+jal ra,-465
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-8(s0)
+jal ra,-2810
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6209
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2683
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,121
+jal ra,-4736
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+jal ra,-4744
+addi a0,zero,0
+jal ra,-3421
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,228
+addi a0,zero,0
+jal zero,-6
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4759
+addi a0,zero,0
+jal zero,13
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2604
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13339
+addi a0,zero,0
+jal zero,3
+jal ra,203
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,68
+jal ra,-4783
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-16(s0)
+ld t0,-1528(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,6179
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6293
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+jal ra,-4807
+addi a0,zero,0
+jal ra,-3484
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,165
+addi a0,zero,0
+jal zero,-6
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4822
+addi a0,zero,0
+jal zero,13
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2667
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13402
+addi a0,zero,0
+jal zero,3
+jal ra,140
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,6308
+addi a0,zero,0
+jal zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6239
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2698
+addi a0,zero,0
+jal zero,6
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2704
+addi a0,zero,0
+jal zero,6
+ld t0,-560(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2710
+addi a0,zero,0
+ld t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1456(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4895
+addi a0,zero,0
+jal zero,6
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2740
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-665
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1424(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1424(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2596
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-3023
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5560
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2893
+addi a0,zero,0
+jal zero,13
+ld t0,-1424(gp)
+ld t1,-1288(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1424(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1288(gp)
+sd t0,8(sp)
+jal ra,-2625
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1416(gp)
+sd t0,8(sp)
+jal ra,6015
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t0,t1
+sd t0,-1416(gp)
+ld t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1464(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-3232
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,20
+jal ra,-2779
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13568
+addi a0,zero,0
+jal zero,3
+jal ra,-5004
+addi a0,zero,0
+jal zero,-22
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,150
+jal ra,-5013
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-824(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1232(gp)
+sd t0,8(sp)
+jal ra,-2350
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1280(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2714
+addi a0,zero,0
+jal ra,-5042
+addi a0,zero,0
+jal zero,46
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+jal ra,-5051
+addi a0,zero,0
+jal ra,-810
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1280(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2741
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5075
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2920
+addi a0,zero,0
+jal zero,7
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2926
+addi a0,zero,0
+jal zero,299
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-5096
+addi a0,zero,0
+jal ra,-855
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1272(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2786
+addi a0,zero,0
+jal ra,-3163
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-3217
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,5741
+addi a0,zero,0
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3085
+addi a0,zero,0
+ld t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1440(gp)
+jal zero,11
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2979
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3100
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5153
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2998
+addi a0,zero,0
+jal zero,227
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,181
+ld t0,-824(gp)
+sd t0,-24(s0)
+jal ra,-5170
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+jal ra,-5178
+addi a0,zero,0
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1855
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5301
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5200
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3045
+addi a0,zero,0
+jal zero,139
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,131
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1232(gp)
+sd t0,8(sp)
+jal ra,-2702
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13170
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal ra,-5231
+addi a0,zero,0
+jal ra,-990
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2921
+addi a0,zero,0
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13157
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8938
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,23
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13154
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+jal ra,-3371
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,5587
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3239
+addi a0,zero,0
+jal zero,40
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2713
+addi a0,zero,0
+jal ra,-3388
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-9246
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8933
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-3364
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,5547
+addi a0,zero,0
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3279
+addi a0,zero,0
+ld t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1440(gp)
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5336
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3181
+addi a0,zero,0
+jal zero,3
+jal ra,-3136
+addi a0,zero,0
+jal zero,41
+ld t0,-880(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-814
+addi a0,zero,0
+jal zero,32
+ld t0,-880(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-677
+addi a0,zero,0
+jal zero,23
+ld t0,-880(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-489
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5380
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3225
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1272(gp)
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+jal ra,-5408
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5416
+addi a0,zero,0
+jal zero,-8
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1280(gp)
+sd t0,-8(s0)
+jal ra,-5427
+addi a0,zero,0
+jal zero,-10
+jal zero,28
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-5437
+addi a0,zero,0
+ld t0,-1272(gp)
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1280(gp)
+sd t0,-8(s0)
+jal ra,-5449
+addi a0,zero,0
+jal zero,-10
+jal zero,6
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3295
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-79
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-1312(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-824(gp)
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1232(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,16(s0)
+sd t0,48(sp)
+jal ra,-4720
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+jal ra,-5502
+addi a0,zero,0
+jal zero,27
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3347
+addi a0,zero,0
+ld t0,-1312(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,2008
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1232(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,16(s0)
+sd t0,48(sp)
+jal ra,-4749
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+jal ra,-5556
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+addi t0,zero,1
+sd t0,-16(s0)
+jal ra,-5566
+addi a0,zero,0
+jal ra,-174
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5578
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3423
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi t0,zero,1
+sd t0,-856(gp)
+jal ra,-5594
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-856(gp)
+ld t0,-848(gp)
+sub t0,zero,t0
+sd t0,-8(s0)
+jal zero,3
+ld t0,-848(gp)
+sd t0,-8(s0)
+jal ra,-4161
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,-5608
+addi a0,zero,0
+jal zero,3
+jal ra,-3402
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5619
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3464
+addi a0,zero,0
+jal zero,6
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3470
+addi a0,zero,0
+ld t0,-16(s0)
+beq t0,zero,14
+ld t0,16(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-3319
+addi a0,zero,0
+jal zero,13
+ld t0,16(s0)
+ld t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1272(gp)
+sd t0,8(sp)
+jal ra,-3332
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-1344(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,97
+jal ra,-5687
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-230
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-56(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13479
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4092
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,41
+jal ra,-5725
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5733
+addi a0,zero,0
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,27
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-274
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-56(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13525
+addi a0,zero,0
+jal zero,-46
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5771
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3616
+addi a0,zero,0
+jal zero,3
+jal ra,-5780
+addi a0,zero,0
+jal zero,6
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3625
+addi a0,zero,0
+ld t0,-8(s0)
+beq t0,zero,4
+ld t0,-16(s0)
+sub t0,zero,t0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7072
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1256(gp)
+sd t0,8(sp)
+jal ra,-4788
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-816(gp)
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-16(s0)
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-5052
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,19
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13781
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13650
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13805
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13815
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3553
+addi a0,zero,0
+jal ra,-5881
+addi a0,zero,0
+jal zero,228
+ld t0,-880(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,220
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4769
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,88
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-13737
+addi a0,zero,0
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13850
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13860
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3598
+addi a0,zero,0
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13730
+addi a0,zero,0
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13841
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13851
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,5306
+addi a0,zero,0
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,-13727
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1480(gp)
+sd t0,8(sp)
+jal ra,-9192
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,9
+ld t0,-920(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+ld t0,-1432(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1432(gp)
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,2000
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-6825
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1960
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-7381
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-6003
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-880(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-32(s0)
+ld t1,-56(gp)
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-32(s0)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-554
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6029
+addi a0,zero,0
+jal zero,6
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3874
+addi a0,zero,0
+jal zero,-30
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2953
+addi a0,zero,0
+ld t0,-24(s0)
+sd t0,-1408(gp)
+addi t0,zero,0
+sd t0,-1416(gp)
+ld t0,24(s0)
+sd t0,-1424(gp)
+jal ra,-4724
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,-1075
+addi a0,zero,0
+jal zero,-6
+addi t0,zero,0
+sd t0,-1424(gp)
+ld t0,-880(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-1416(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,5190
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-1416(gp)
+ld t0,-8(s0)
+beq t0,zero,10
+ld t0,-16(s0)
+sub t0,zero,t0
+ld t1,-56(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2890
+addi a0,zero,0
+jal zero,8
+ld t0,-16(s0)
+ld t1,-56(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2898
+addi a0,zero,0
+jal ra,-6093
+addi a0,zero,0
+jal zero,13
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3938
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14673
+addi a0,zero,0
+jal zero,3
+jal ra,-3900
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-1408(gp)
+addi t0,zero,0
+sd t0,-1344(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,187
+jal ra,-4306
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,20
+jal ra,-3927
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14716
+addi a0,zero,0
+jal zero,3
+jal ra,-6152
+addi a0,zero,0
+jal zero,-22
+ld t0,-880(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+jal ra,-6161
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6169
+addi a0,zero,0
+ld t0,-1280(gp)
+sd t0,-8(s0)
+jal zero,3
+ld t0,-1288(gp)
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-824(gp)
+sd t0,-16(s0)
+jal ra,-6184
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-522
+addi a0,zero,0
+jal zero,6
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4036
+addi a0,zero,0
+jal zero,118
+jal ra,-806
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+ld t0,-824(gp)
+sd t0,-16(s0)
+jal ra,-6212
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-556
+addi a0,zero,0
+jal zero,84
+ld t0,-816(gp)
+sd t0,-24(s0)
+ld t0,-880(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-6236
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-32(s0)
+jal zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-704
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1232(gp)
+sd t0,8(sp)
+jal ra,-5236
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-1232(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+ld t0,-32(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-5511
+addi a0,zero,0
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-7133
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1904
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-7689
+addi sp,sp,8
+addi a0,zero,0
+jal zero,6
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4154
+addi a0,zero,0
+jal zero,-190
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-1408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14261
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10189
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1840
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7162
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+ld t0,-1344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-824(gp)
+sd t0,8(sp)
+ld t0,-1232(gp)
+sd t0,16(sp)
+jal ra,-5422
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+jal ra,-6381
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+jal ra,-6389
+addi a0,zero,0
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14323
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-56(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3637
+addi a0,zero,0
+jal ra,-4509
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4514
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-1592(gp)
+sd t0,16(sp)
+jal ra,4110
+addi a0,zero,0
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14337
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-4532
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,4426
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4400
+addi a0,zero,0
+jal zero,8
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7174
+addi a0,zero,0
+jal ra,-6453
+addi a0,zero,0
+jal zero,6
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4298
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,102
+ld t0,-1344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-824(gp)
+sd t0,8(sp)
+ld t0,-1232(gp)
+sd t0,16(sp)
+jal ra,-5540
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+jal ra,-6499
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,64
+jal ra,-6507
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14417
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+jal ra,-4646
+addi a0,zero,0
+jal ra,-4614
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,4277
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4628
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4266
+addi a0,zero,0
+jal ra,-4636
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4641
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,3942
+addi a0,zero,0
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-4654
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,4304
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4522
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4412
+addi a0,zero,0
+jal zero,8
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7302
+addi a0,zero,0
+jal ra,-6581
+addi a0,zero,0
+jal zero,6
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4426
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14527
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10455
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1776
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7428
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-6631
+addi a0,zero,0
+ld t0,-880(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6639
+addi a0,zero,0
+jal zero,6
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4484
+addi a0,zero,0
+jal zero,6
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4490
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-4794
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,3818
+addi a0,zero,0
+jal ra,-4773
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3807
+addi a0,zero,0
+jal ra,-4784
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-4791
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,4015
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-4802
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,3869
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4670
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-4730
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3756
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-4746
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,3876
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,22
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,3664
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-10
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,3
+jal ra,3630
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-7946
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+jal ra,-5620
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,11
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3643
+addi a0,zero,0
+jal zero,230
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10934
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10946
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4110
+addi a0,zero,0
+jal zero,15
+lui t0,0xFFFFE
+addi t0,t0,1744
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7697
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15466
+addi a0,zero,0
+ld t0,-1552(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-5000
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3583
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4870
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3569
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,3558
+addi a0,zero,0
+jal ra,4112
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-285
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,3538
+addi a0,zero,0
+jal ra,4092
+addi a0,zero,0
+ld t0,-1488(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1232(gp)
+sd t0,8(sp)
+jal ra,-5947
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14857
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14884
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-1608(gp)
+sd t0,16(sp)
+jal ra,3881
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3499
+addi a0,zero,0
+jal ra,-5126
+addi a0,zero,0
+jal ra,-5094
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3797
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3476
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-5120
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,3838
+addi a0,zero,0
+jal ra,-5126
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,2
+ld t1,-56(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3452
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-5144
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,3814
+addi a0,zero,0
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5012
+addi a0,zero,0
+ld t0,-1480(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1256(gp)
+sd t0,8(sp)
+jal ra,-6047
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1480(gp)
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15000
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-4142
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3403
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1608(gp)
+sd t0,16(sp)
+jal ra,3767
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-376(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-15682
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-10768
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,1736
+add t0,gp,t0
+sd t0,-920(gp)
+ld t0,-920(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8093
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8112
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8137
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1280(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-56(gp)
+divu t0,t0,t1
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8152
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+jal ra,-14974
+addi a0,zero,0
+jal ra,-14565
+addi a0,zero,0
+jal ra,-495
+addi a0,zero,0
+jal ra,6219
+addi a0,zero,0
+jal ra,6390
+addi a0,zero,0
+jal ra,6886
+addi a0,zero,0
+jal ra,7382
+addi a0,zero,0
+jal ra,7928
+addi a0,zero,0
+jal ra,8503
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,11
+jal ra,10851
+addi a0,zero,0
+jal ra,10899
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-24(s0)
+jal ra,10943
+addi a0,zero,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1264(gp)
+sd t0,24(sp)
+ld t0,-1288(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6518
+addi a0,zero,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1712
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1264(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6537
+addi a0,zero,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1704
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1264(gp)
+sd t0,24(sp)
+ld t0,-1288(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6556
+addi a0,zero,0
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1480(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6573
+addi a0,zero,0
+ld t0,-8(s0)
+beq t0,zero,225
+jal ra,26064
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,213
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,26082
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10931
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,192
+jal ra,26095
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-920(gp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,1664
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-8787
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-920(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-287
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-928(gp)
+ld t0,-928(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-11266
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-8817
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16011
+addi a0,zero,0
+jal ra,-15511
+addi a0,zero,0
+jal ra,-15141
+addi a0,zero,0
+jal ra,-1329
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+ld t0,-816(gp)
+sd t0,24(sp)
+ld t0,-896(gp)
+sd t0,32(sp)
+jal ra,-8848
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld t0,-872(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-10103
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+ld t0,-872(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-10068
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+ld t0,-904(gp)
+sd t0,40(sp)
+jal ra,-8888
+addi sp,sp,40
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-1360(gp)
+sd t0,16(sp)
+ld t0,-1368(gp)
+sd t0,24(sp)
+ld t0,-1376(gp)
+sd t0,32(sp)
+jal ra,-8906
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1376
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-1432(gp)
+sd t0,16(sp)
+ld t0,-1440(gp)
+sd t0,24(sp)
+ld t0,-1448(gp)
+sd t0,32(sp)
+ld t0,-1456(gp)
+sd t0,40(sp)
+ld t0,-1464(gp)
+sd t0,48(sp)
+jal ra,-8928
+addi sp,sp,48
+addi a0,zero,0
+ld t0,-912(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,1304
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-912(gp)
+sd t0,16(sp)
+ld t0,-920(gp)
+sd t0,24(sp)
+jal ra,-8949
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16143
+addi a0,zero,0
+jal zero,-225
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1256
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-8975
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-816
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,6
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10661
+addi a0,zero,0
+jal ra,3810
+addi a0,zero,0
+jal ra,3969
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+lui t0,0xFFFFE
+addi t0,t0,1176
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-1392(gp)
+ld t1,-1384(gp)
+divu t0,t0,t1
+sd t0,16(sp)
+ld t0,-1392(gp)
+sd t0,24(sp)
+jal ra,-9012
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1104
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,32(sp)
+jal ra,-9044
+addi sp,sp,32
+addi a0,zero,0
+jal ra,1974
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1784(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10098
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,25
+jal zero,24
+ld t0,16(s0)
+ld t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,16(s0)
+ld t1,-1536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1608(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,16(s0)
+ld t1,-1664(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,16(s0)
+ld t1,-1584(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,16(s0)
+ld t1,-1752(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,59
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+jal ra,16864
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1064
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10299
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-219
+addi a0,zero,0
+jal ra,-10249
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,17709
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-116
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-57
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11689
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFE
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-816(gp)
+sd t0,8(sp)
+jal ra,-8861
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12116
+addi t0,a0,0
+addi a0,zero,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12126
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(sp)
+jal ra,-9438
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16632
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12075
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12084
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12093
+addi t0,a0,0
+addi a0,zero,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12102
+addi t0,a0,0
+addi a0,zero,0
+ld t1,48(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12111
+addi t0,a0,0
+addi a0,zero,0
+ld t1,56(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-12086
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12109
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,15
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12132
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,3
+sd t0,16(sp)
+jal ra,-12155
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12178
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-12201
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-148
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-136
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-124
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-112
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-100
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-348
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11935
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12358
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12367
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12376
+addi t0,a0,0
+addi a0,zero,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12385
+addi t0,a0,0
+addi a0,zero,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-12360
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-12047
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-276
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-264
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-252
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-508
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-12095
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-12470
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12481
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12540
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12549
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12558
+addi t0,a0,0
+addi a0,zero,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12567
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12576
+addi t0,a0,0
+addi a0,zero,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-12552
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12563
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12622
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-12261
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-509
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-497
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-485
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-104
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-722
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-12309
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12684
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12695
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12706
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12717
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12776
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12785
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12794
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12803
+addi t0,a0,0
+addi a0,zero,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12812
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12821
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12830
+addi t0,a0,0
+addi a0,zero,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12806
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12817
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12828
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12839
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12898
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12907
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12916
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12925
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-12562
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-810
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-786
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-151
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-1023
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12610
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12985
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12996
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-13007
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-13018
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-13077
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-13086
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-13095
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-13104
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-13113
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-13089
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-13100
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-13111
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-13122
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-13181
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-13190
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-13199
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-13208
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12845
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1036
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-137
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-1291
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12878
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-13301
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-13310
+addi t0,a0,0
+addi a0,zero,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-13285
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12972
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+ld t0,-1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1792(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1760(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1163
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1776(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1768(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1424(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1416(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1392(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1384(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1376(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,208(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,200(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,184(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,176(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,160(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,152(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,144(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,136(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,128(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,120(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,984
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,15188
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-151
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-12181
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+jal ra,-162
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-12146
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-10964
+addi sp,sp,32
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-60
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+beq t0,zero,27
+lui t0,0xFFFFE
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-12231
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-12194
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11012
+addi sp,sp,16
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11035
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,16(sp)
+jal ra,-78
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12069
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+sd t0,16(sp)
+jal ra,-100
+addi a0,zero,0
+jal ra,-12029
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,928
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11086
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+sd t0,16(sp)
+jal ra,-129
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,920
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12120
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+sd t0,16(sp)
+jal ra,-151
+addi a0,zero,0
+jal ra,-12080
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,904
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11137
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+sd t0,16(sp)
+jal ra,-180
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12171
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+sd t0,16(sp)
+jal ra,-202
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12193
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+sd t0,16(sp)
+jal ra,-224
+addi a0,zero,0
+jal ra,-12153
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,872
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11210
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+sd t0,16(sp)
+jal ra,-253
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,864
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12244
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+sd t0,16(sp)
+jal ra,-275
+addi a0,zero,0
+jal ra,-12204
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11261
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+sd t0,16(sp)
+jal ra,-304
+addi a0,zero,0
+jal ra,-12233
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11290
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,672(t0)
+sd t0,16(sp)
+jal ra,-333
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12324
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+sd t0,16(sp)
+jal ra,-355
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,816
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12346
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+sd t0,16(sp)
+jal ra,-377
+addi a0,zero,0
+jal ra,-12306
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-11363
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+sd t0,8(sp)
+jal ra,-452
+addi a0,zero,0
+jal ra,-12331
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+sd t0,16(sp)
+jal ra,-13960
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+sd t0,16(sp)
+jal ra,-13987
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10902
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18671
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-97
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-129
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+ld t1,-56(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-108
+addi a0,zero,0
+jal zero,68
+ld t0,16(s0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-85
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+sd t0,8(sp)
+jal ra,-14209
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-144
+addi a0,zero,0
+jal zero,32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+sd t0,8(sp)
+jal ra,-14228
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-176
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,736
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11109
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18878
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+ld t1,16(s0)
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-173
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-816(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,16(sp)
+ld t0,-1528(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,32(sp)
+jal ra,-2081
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-36
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-112
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2016(t0)
+sd t0,16(sp)
+jal ra,-1189
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-147
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1456(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,32(sp)
+jal ra,-2173
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-188
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1856(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2485
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-233
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1440(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1840(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2530
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-278
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1432(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1848(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1944(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2575
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-323
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1424(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1832(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1936(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2620
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-368
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1416(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1928(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2665
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-413
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1816(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1920(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2024(t0)
+sd t0,40(sp)
+jal ra,-2710
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-458
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1400(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-72(gp)
+beq t0,zero,22
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1912(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+ld t0,-2048(gp)
+sd t0,32(sp)
+jal ra,-2484
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-499
+addi a0,zero,0
+jal zero,21
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+ld t0,-2048(gp)
+sd t0,32(sp)
+jal ra,-2505
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-520
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1392(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-72(gp)
+beq t0,zero,24
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2032(t0)
+sd t0,32(sp)
+jal ra,-2389
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-563
+addi a0,zero,0
+jal zero,23
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1888(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2032(t0)
+sd t0,32(sp)
+jal ra,-2412
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-586
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1880(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2008(t0)
+sd t0,32(sp)
+jal ra,-2239
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-627
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,16(sp)
+jal ra,-1973
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-662
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1872(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2000(t0)
+sd t0,32(sp)
+jal ra,-2688
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-703
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1864(t0)
+sd t0,16(sp)
+ld t0,-1528(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,32(sp)
+jal ra,-2731
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-746
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-978
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2963
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2947
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2931
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2892
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-2430
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-978
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1041
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2955
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2939
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-2176
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1025
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1088
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3046
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3030
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3014
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2998
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-2909
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1084
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1152
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2146
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-134
+addi a0,zero,0
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-26
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-1028
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19353
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14779
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-12500
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,34
+ld t0,-8(s0)
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19291
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19376
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-99
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-56(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-36
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1328(gp)
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,-1336(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,97
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19407
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19380
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19369
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19452
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-175
+addi a0,zero,0
+jal zero,53
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19443
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19416
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19405
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19488
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-211
+addi a0,zero,0
+jal zero,17
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19479
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-184
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19548
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+jal zero,-100
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-116
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12470
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,8(sp)
+jal ra,1509
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-36
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-72(gp)
+beq t0,zero,359
+ld t0,-8(s0)
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15602
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15621
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15640
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15659
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+jal ra,-15678
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15697
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+jal ra,-15716
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15744
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15772
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1608(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15791
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1592(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1584(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1576(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1568(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15846
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15865
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1552(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15893
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15912
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1528(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15931
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,308
+ld t0,-8(s0)
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15960
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15979
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15998
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-16026
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-16045
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-16064
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-16110
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1592(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1584(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1576(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1568(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-16183
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1552(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-16211
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1536(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1528(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-16239
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+addi t0,zero,5
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1512(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1504(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1496(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1480(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1472(t1)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,87
+addi a0,zero,0
+addi t0,zero,6
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1512(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-13438
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1504(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1496(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1480(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1472(t1)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,35
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1560(t1)
+ld t2,16(s0)
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-24(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-72(gp)
+beq t0,zero,112
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1520(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-16406
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1504(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1496(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1488(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sd t1,0(t0)
+jal zero,105
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1520(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1504(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1496(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1488(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1512(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-271
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1480(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-50
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-63
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-13825
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal ra,-1145
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+ld t2,-24(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,9
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-30
+addi t0,zero,1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-408(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-21327
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-16413
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14218
+addi sp,sp,16
+addi a0,zero,0
+jal zero,231
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-424(gp)
+sd t0,8(sp)
+jal ra,-78
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16702
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,648
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14255
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21449
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,16(sp)
+jal ra,-21449
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,584
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14298
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21492
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-14065
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,130
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-21512
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,528
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14359
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21553
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,16(sp)
+jal ra,-21553
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,472
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14402
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21596
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,40(sp)
+jal ra,-14449
+addi sp,sp,40
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sltu t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+jal zero,-25
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,20326
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1344(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6042
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-17021
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,352
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14574
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21768
+addi a0,zero,0
+jal ra,-1654
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1336(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1320(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1296(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1280(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1272(t1)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,16(sp)
+jal ra,-21807
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,188
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-616
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,179
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-14403
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14341
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-14423
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-224
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1328(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14368
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,8(sp)
+jal ra,-244
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1304(t1)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-21899
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-16967
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,89
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,16(sp)
+jal ra,-21929
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-16997
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-368(gp)
+sd t0,8(sp)
+ld t0,-24(gp)
+sd t0,16(sp)
+jal ra,-21957
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lui t0,0xFFFFE
+addi t0,t0,272
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,40(sp)
+jal ra,-14820
+addi sp,sp,40
+addi a0,zero,0
+jal zero,24
+lui t0,0xFFFFE
+addi t0,t0,224
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+jal ra,-14837
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22031
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,216
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1288(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-12718
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2701
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3021
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+sd t0,16(sp)
+jal ra,-3032
+addi a0,zero,0
+jal ra,-2478
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,200
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15942
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11793
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,192
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15954
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18779
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-17164
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-18082
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,104
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-14982
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18505
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18569
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-17254
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+jal ra,-15017
+addi sp,sp,24
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,56
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-12891
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2874
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3194
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2892
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3212
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2910
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3230
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-3241
+addi a0,zero,0
+jal ra,-2687
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2737
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,49
+lui t0,0xFFFFE
+addi t0,t0,40
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16160
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11645
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,32
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16172
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11563
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,24
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16184
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11621
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,16
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16196
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11609
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19026
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19038
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19050
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-88
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+jal ra,-15247
+addi sp,sp,32
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-24(gp)
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,164
+ld t0,-24(s0)
+ld t1,-40(s0)
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-24(s0)
+sd t0,-40(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,3922
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,130
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,16569
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,102
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,17267
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,74
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19108
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,3955
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(s0)
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-22496
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-17564
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-64(s0)
+ld t0,-64(s0)
+ld t1,-40(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-32(s0)
+ld t1,-64(s0)
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-24(s0)
+ld t1,-64(s0)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,-16(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,16
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-64(s0)
+sd t0,8(sp)
+jal ra,-17819
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-32(s0)
+ld t1,-64(s0)
+add t0,t0,t1
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-176
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15381
+addi sp,sp,16
+addi a0,zero,0
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-272
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15400
+addi sp,sp,16
+addi a0,zero,0
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-352
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15419
+addi sp,sp,16
+addi a0,zero,0
+jal zero,-166
+ld t0,-48(s0)
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19259
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-17642
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19286
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19320
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-18859
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-416
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15497
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-424
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16520
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11285
+addi a0,zero,0
+jal ra,-16470
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-432
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-13389
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3372
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3692
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3390
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3710
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3408
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-3728
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-3739
+addi a0,zero,0
+jal ra,-3185
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3235
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,49
+lui t0,0xFFFFE
+addi t0,t0,-448
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16658
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11147
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-456
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16670
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11065
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-464
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16682
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11123
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-472
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16694
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11111
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19524
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19536
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19548
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-576
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-15745
+addi sp,sp,32
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-24(gp)
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,164
+ld t0,-24(s0)
+ld t1,-40(s0)
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-24(s0)
+sd t0,-40(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,3424
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,130
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,16071
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,102
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,16769
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,74
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19606
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,3457
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(s0)
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-22985
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-18062
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-64(s0)
+ld t0,-64(s0)
+ld t1,-40(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-32(s0)
+ld t1,-64(s0)
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-24(s0)
+ld t1,-64(s0)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,-16(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,16
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-64(s0)
+sd t0,8(sp)
+jal ra,-18317
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-32(s0)
+ld t1,-64(s0)
+add t0,t0,t1
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-664
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15879
+addi sp,sp,16
+addi a0,zero,0
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-760
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15898
+addi sp,sp,16
+addi a0,zero,0
+jal zero,19
+addi t0,zero,1
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+addi t0,t0,-840
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15917
+addi sp,sp,16
+addi a0,zero,0
+jal zero,-166
+ld t0,-48(s0)
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19757
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-18140
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19784
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19818
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19357
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-904
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15995
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-912
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17018
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10787
+addi a0,zero,0
+jal ra,-16968
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-920
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-13887
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3870
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-4190
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3888
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-4208
+addi a0,zero,0
+ld t0,-1632(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3906
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-4226
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,16(sp)
+jal ra,-4237
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,16(sp)
+jal ra,-4248
+addi a0,zero,0
+jal ra,-3694
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3744
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-352(gp)
+ld t2,-24(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,145
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,3033
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,118
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,15680
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,91
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,16378
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,25
+ld t0,32(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20004
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,3124
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1000
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16217
+addi sp,sp,16
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,94
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,32(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-18412
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,68
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-28
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1088
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16274
+addi sp,sp,16
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,37
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16292
+addi sp,sp,16
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,19
+jal zero,-149
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16310
+addi sp,sp,16
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,61
+lui t0,0xFFFFE
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17348
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10387
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1272
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17360
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10375
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17372
+addi a0,zero,0
+ld t0,-1624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10363
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1288
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17384
+addi a0,zero,0
+ld t0,-1632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10386
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17396
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10409
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20226
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20238
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20250
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-360(gp)
+sd t0,16(sp)
+jal ra,-294
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,66
+ld t0,-16(s0)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-408(gp)
+sd t0,-16(s0)
+ld t0,-360(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-23618
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-18704
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20301
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1384
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-360(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,-32(s0)
+sd t0,40(sp)
+jal ra,-16500
+addi sp,sp,40
+addi a0,zero,0
+jal zero,27
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20338
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-18721
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20386
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19925
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17566
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10239
+addi a0,zero,0
+jal ra,-17516
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1400
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1280(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-14436
+addi a0,zero,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1408
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1280(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-14457
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1288(t1)
+ld t0,-1304(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1488(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-1232(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-14485
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-1360(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-1360(gp)
+jal ra,-13401
+addi a0,zero,0
+jal ra,-13369
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4478
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-4798
+addi a0,zero,0
+jal ra,-13389
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-8641
+addi a0,zero,0
+jal ra,-13432
+addi a0,zero,0
+jal ra,-13400
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23198
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23224
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-4519
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-13424
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-13381
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-4802
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-4854
+addi a0,zero,0
+jal ra,-4300
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-13450
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4432
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4445
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-13431
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4460
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4908
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4482
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23305
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23332
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-1608(gp)
+sd t0,16(sp)
+jal ra,-4567
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-13534
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4951
+addi a0,zero,0
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13404
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4450
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20478
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,2328
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,48
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,14925
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16893
+addi sp,sp,16
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20066
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+ld t1,24(s0)
+ld t2,-8(s0)
+sub t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,992(t1)
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1496
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-16931
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20783
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20586
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,25
+lui t0,0xFFFFE
+addi t0,t0,-1504
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17997
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9738
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1512
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18009
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9726
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20842
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-1608(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20859
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1184(t1)
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20883
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18081
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9654
+addi a0,zero,0
+jal ra,-18031
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20935
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20474
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24264
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24271
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1536
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1280(gp)
+sd t0,32(sp)
+addi t0,zero,2
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-15012
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4995
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-5315
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5013
+addi a0,zero,0
+ld t0,-1544(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+ld t0,-56(gp)
+sd t0,16(sp)
+jal ra,-5333
+addi a0,zero,0
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,16(sp)
+jal ra,-5344
+addi a0,zero,0
+jal ra,-4790
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1656(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5355
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4849
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13908
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20805
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20807
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,232(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+beq t0,zero,40
+lui t0,0xFFFFE
+addi t0,t0,-1592
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-17317
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+sd t0,8(sp)
+jal ra,-17338
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-18295
+addi a0,zero,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,37
+lui t0,0xFFFFE
+addi t0,t0,-1640
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18378
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9357
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18390
+addi a0,zero,0
+ld t0,-1616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9415
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18402
+addi a0,zero,0
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9403
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13175
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13127
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-193
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-232(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1664
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18465
+addi a0,zero,0
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9270
+addi a0,zero,0
+jal ra,-18415
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-237
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-232(t1)
+jal ra,11106
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13100
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-50
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23186
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23175
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23421
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23391
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17288
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-23336
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,34
+jal ra,-23222
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23437
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17327
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-23119
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-36
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-23379
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-23368
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-23357
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-173
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-23584
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1088(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+sd t0,24(sp)
+jal ra,-70
+addi a0,zero,0
+jal ra,-23609
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1096(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1104(t0)
+sd t0,24(sp)
+jal ra,-95
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23609
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23579
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23642
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23316
+addi a0,zero,0
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23273
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-29
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23450
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-90
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-97
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23713
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23702
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23761
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23786
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23797
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-49
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23899
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-134
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23887
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23839
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23727
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-232
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-100
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23972
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,82
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23694
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23702
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-40(s0)
+sd t0,-32(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23767
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,43
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23759
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,40(s0)
+beq t0,zero,27
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23994
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23875
+addi a0,zero,0
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-23686
+addi a0,zero,0
+ld t0,-40(s0)
+addi a0,t0,0
+jal zero,16
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-93
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23751
+addi a0,zero,0
+ld t0,-32(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24066
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-56(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23818
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-309
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,522
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-28
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,40(s0)
+beq t0,zero,61
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24100
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23982
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-96
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-466
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-23858
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-288
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-23834
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-23891
+addi a0,zero,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-298
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24000
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,16
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24260
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-56(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24012
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-503
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,343
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-24
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-129
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24080
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-538
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-182
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24133
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-591
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-56(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-170
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-128
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-153
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+jal ra,-128
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+beq t0,zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-312
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24232
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24189
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1080(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-18783
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-1720
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-20030
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-19993
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20050
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20013
+addi t0,a0,0
+addi a0,zero,0
+sd t0,48(sp)
+jal ra,-18831
+addi sp,sp,48
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1016(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,73
+jal zero,72
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-101
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,344
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-112
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-112
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,5
+ld t0,-8(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,48
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-208
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,13078
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-224
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1040(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1048(t2)
+mul t1,t1,t2
+ld t2,24(s0)
+sub t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-86
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-120
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-261
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1032(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-19311
+addi sp,sp,40
+addi a0,zero,0
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-75
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-498
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-101
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-511
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,19
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-133
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-731
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,12
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,18
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-176
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-751
+addi a0,zero,0
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-101
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,19
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-217
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-840
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,12
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-167
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-17366
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,-1544(gp)
+sd t0,16(sp)
+jal ra,-7619
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-7154
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1848
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-17416
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,-1552(gp)
+sd t0,16(sp)
+jal ra,-7669
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-7204
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1320(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1872
+add t0,gp,t0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1256(gp)
+sd t0,24(sp)
+ld t0,-1272(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,48(sp)
+jal ra,-17466
+addi a0,zero,0
+jal ra,-7814
+addi a0,zero,0
+jal ra,-7816
+addi a0,zero,0
+jal ra,-7818
+addi a0,zero,0
+ld t0,-1528(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-7251
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+ld t0,-1608(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,8(sp)
+jal ra,-15911
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+ld t2,16(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1312(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23537
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23343
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t1,t0
+beq t0,zero,140
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20748
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6987
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23372
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20777
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6958
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23607
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,1285
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1904
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20816
+addi a0,zero,0
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6919
+addi a0,zero,0
+jal ra,-20766
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23629
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,187
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-24(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23456
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-489
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1184(t1)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23704
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23245
+addi a0,zero,0
+jal zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2927
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+sd t0,8(sp)
+jal ra,834
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,12
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19607
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+jal ra,-25316
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,15
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23795
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23680
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-142
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+addi a0,t0,0
+jal zero,21
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23712
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23701
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-185
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23717
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-217
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23730
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-249
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23629
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-281
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,848(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23642
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-313
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,840(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23655
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-345
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23668
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-377
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+jal ra,-25606
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,880(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25603
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,888(t1)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19886
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,872(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-430
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,856(t1)
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-23361
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,848(t1)
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-23373
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-490
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,840(t1)
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-23385
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-520
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,936(t1)
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+sd t0,8(sp)
+jal ra,-23401
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-25837
+addi a0,zero,0
+jal ra,-25605
+addi a0,zero,0
+ld t0,-24(gp)
+addi t1,zero,2
+mul t0,t0,t1
+ld t1,-40(gp)
+addi t2,zero,2
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,912(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-215
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-169
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-146
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-123
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-356
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,75
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25804
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25858
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-213
+addi a0,zero,0
+jal zero,13
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25871
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-25803
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-445
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-25815
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-275
+addi a0,zero,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,14
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25904
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+jal zero,-78
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-729
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,24(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,35
+jal zero,34
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24431
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1394
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24445
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1317
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-785
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,29
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24486
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1449
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24500
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-1348
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26018
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26009
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-87
+addi a0,zero,0
+ld t0,-8(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-17
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-886
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,26
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20375
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,864(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,864(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,34
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24418
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-3960
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-151
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26165
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,11
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,832(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,832(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,792(t1)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-92
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,808(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,768(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,119
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-201
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1066
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-864
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-26234
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-694
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-26234
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26223
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+sd t0,8(sp)
+jal ra,-26214
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,824(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,816(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,784(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,912(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,776(t1)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,13
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+ld t1,24(s0)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,792(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,566
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-743
+addi a0,zero,0
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-929
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-758
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+sd t0,8(sp)
+jal ra,-20873
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-259
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1102
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,94
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1086
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,76
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1069
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,61
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,912(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,47
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26521
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,23
+ld t0,24(s0)
+ld t1,-16(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26521
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26571
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,-64
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-678
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-2112
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,78
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-174
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,62
+jal zero,25
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26600
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,904(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-26548
+addi a0,zero,0
+jal zero,2
+jal zero,37
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26662
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26653
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-118
+addi a0,zero,0
+ld t0,-16(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+ld t1,-24(gp)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+ld t2,-56(gp)
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-153
+addi a0,zero,0
+ld t0,24(s0)
+ld t1,-24(gp)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-19
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1321
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,40
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1512
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-70
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1495
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1470
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-89
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26830
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1215
+addi a0,zero,0
+jal zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26843
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-26775
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+beq t0,zero,20
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1389
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-26791
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1221
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26846
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,760(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1484
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26934
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26888
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,904(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-145
+addi a0,zero,0
+jal zero,12
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+sd t0,8(sp)
+jal ra,-26846
+addi a0,zero,0
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-24(s0)
+sd t0,-16(s0)
+jal zero,-48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-238
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-99
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,800(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1984
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23006
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-22989
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,832(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,48(sp)
+jal ra,-21743
+addi sp,sp,48
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,2040
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23056
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23039
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+sd t0,8(sp)
+jal ra,-23022
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+sd t0,8(sp)
+jal ra,-22989
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,48(sp)
+jal ra,-21811
+addi sp,sp,48
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1984
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23124
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23107
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+sd t0,32(sp)
+jal ra,-21853
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1896
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23170
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23157
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23144
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-23115
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+add t0,t0,t1
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,56(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+sd t0,64(sp)
+jal ra,-21949
+addi sp,sp,64
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23262
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23245
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+sd t0,8(sp)
+jal ra,-23228
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+sd t0,8(sp)
+jal ra,-23195
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,48(sp)
+jal ra,-22017
+addi sp,sp,48
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1752
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23330
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-23313
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+sd t0,8(sp)
+jal ra,-23296
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+sd t0,8(sp)
+jal ra,-23263
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+sd t0,48(sp)
+jal ra,-22085
+addi sp,sp,48
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2213
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23115
+addi a0,zero,0
+jal ra,-23060
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1728
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23968
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,944(t1)
+jal ra,12725
+addi a0,zero,0
+jal zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1720
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23990
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,944(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,920(t1)
+jal ra,12697
+addi a0,zero,0
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1712
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-24018
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,920(t1)
+jal ra,12675
+addi a0,zero,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,944(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1704
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-22202
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22068
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+beq t0,zero,45
+ld t0,-344(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1688
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-22238
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22104
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+sd t0,8(sp)
+jal ra,-85
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+beq t0,zero,3
+jal zero,95
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23312
+addi a0,zero,0
+jal zero,86
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+beq t0,zero,35
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1672
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22282
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22148
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+sd t0,8(sp)
+jal ra,-129
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1664
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23350
+addi a0,zero,0
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+beq t0,zero,44
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1656
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22320
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22186
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-165
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1640
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+sd t0,16(sp)
+jal ra,-22346
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22212
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-154
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1624
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3705
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13373
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-24636
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-22408
+addi sp,sp,24
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22274
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23478
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4255
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1608
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23503
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4230
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4042
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13191
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-25165
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,216(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,216(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1456(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,480(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-419
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-344(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1600
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22668
+addi sp,sp,0
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22534
+addi a0,zero,0
+jal zero,47
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1584
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3400
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13678
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13687
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,40(sp)
+jal ra,-22715
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22581
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23785
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4018
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23799
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4004
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1560
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23824
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3979
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13487
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,208(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,208(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1448(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-684
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1544
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3175
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13903
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13912
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13921
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+jal ra,-22945
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22811
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1536
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24015
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3788
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1528
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24029
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3774
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1520
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24043
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3760
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13706
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,200(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,200(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1440(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13810
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,192(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1432(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-13914
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,184(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1424(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+jal ra,-14032
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,176(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1416(t1)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,3532
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+jal ra,-14162
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,168(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,168(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1408(t1)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,3402
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-14278
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,160(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,160(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1400(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1487
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1504
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2372
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14706
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14719
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+jal ra,-23743
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23609
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24829
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2904
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-4639
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4611
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14713
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,1472
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4547
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-23874
+addi sp,sp,16
+addi a0,zero,0
+jal zero,22
+lui t0,0xFFFFD
+addi t0,t0,1448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4569
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-23896
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2895
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24923
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-4737
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-4709
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,25
+lui t0,0xFFFFD
+addi t0,t0,1432
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24961
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2842
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-23966
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-4808
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4780
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2538
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-4869
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,156
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7833
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4848
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,113
+jal ra,-14737
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4726
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,152(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1392(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5047
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,2805
+addi a0,zero,0
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2795
+addi a0,zero,0
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2785
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1998
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1400
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1861
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15217
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15230
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+jal ra,-24254
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24120
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25340
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2393
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-5150
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5122
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,68
+lui t0,0xFFFFD
+addi t0,t0,1384
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25374
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2429
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15238
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,1360
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5072
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-24399
+addi sp,sp,16
+addi a0,zero,0
+jal zero,22
+lui t0,0xFFFFD
+addi t0,t0,1336
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5094
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-24421
+addi sp,sp,16
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,1328
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25441
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-5255
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5227
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,1304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-24470
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2321
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-5319
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5291
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5211
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2027
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-5380
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,171
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7405
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5359
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,128
+jal ra,-15248
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5281
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-5221
+addi a0,zero,0
+jal zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,144(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-5254
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1384(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5573
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,2279
+addi a0,zero,0
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2269
+addi a0,zero,0
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2259
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-5459
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2575
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1288
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1284
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15794
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15803
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+sd t0,8(sp)
+jal ra,-27315
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+jal ra,-24840
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24706
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+beq t0,zero,24
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1280
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-24867
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24733
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1272
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25937
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1866
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25951
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1852
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1248
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-24958
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-24981
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1568
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-15664
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,136(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1376(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2839
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1216
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1020
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16058
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+sd t0,8(sp)
+jal ra,-27570
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-25095
+addi sp,sp,24
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24961
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+beq t0,zero,24
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1208
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-25122
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24988
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26192
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1534
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1192
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26213
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1176
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-25213
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-260
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFD
+addi t0,t0,1168
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26252
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1481
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-15915
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,112(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,89
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27808
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,96(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,128(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1368(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3198
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1152
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,661
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16417
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+sd t0,8(sp)
+jal ra,-27929
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16439
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+jal ra,-25463
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25329
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26533
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1200
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1136
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26547
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1179
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1128
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26568
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,1112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-25568
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-16236
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-28189
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-28221
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+ld t1,-1528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,120(t1)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1360(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3441
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1104
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,418
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-25675
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25541
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,827
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1352(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,480(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-26740
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal zero,93
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-25827
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33021
+addi a0,zero,0
+jal zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,984
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-25851
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33045
+addi a0,zero,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal ra,-8520
+addi a0,zero,0
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,1124
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,480(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,976
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1312(t2)
+sub t1,t1,t2
+ld t2,-24(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-25956
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25822
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,968
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,16(sp)
+jal ra,-25986
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25852
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+beq t0,zero,27
+jal ra,-78
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27051
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(gp)
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-26747
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27067
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27075
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-79
+addi a0,zero,0
+ld t0,-72(gp)
+beq t0,zero,14
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,928
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-26062
+addi sp,sp,8
+addi a0,zero,0
+jal zero,13
+ld t0,-344(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-26075
+addi sp,sp,8
+addi a0,zero,0
+ld t0,-344(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25941
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3500
+addi a0,zero,0
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2445
+addi a0,zero,0
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1947
+addi a0,zero,0
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3274
+addi a0,zero,0
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3287
+addi a0,zero,0
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3300
+addi a0,zero,0
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3313
+addi a0,zero,0
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3326
+addi a0,zero,0
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3339
+addi a0,zero,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1461
+addi a0,zero,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-1210
+addi a0,zero,0
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-864
+addi a0,zero,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3921
+addi a0,zero,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-647
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,8520
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,632(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,864
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+sd t0,16(sp)
+jal ra,-26374
+addi sp,sp,16
+addi a0,zero,0
+jal zero,183
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-416(gp)
+sd t0,8(sp)
+jal ra,-12234
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,624(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-28862
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,24
+lui t0,0xFFFFD
+addi t0,t0,816
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+sd t0,16(sp)
+jal ra,-26415
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33609
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+sd t0,-448(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,-456(gp)
+jal ra,-33420
+addi a0,zero,0
+jal ra,-31125
+addi a0,zero,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,352(t1)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,312(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sltu t0,t0,t1
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14954
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+jal ra,850
+addi a0,zero,0
+jal ra,-321
+addi a0,zero,0
+jal ra,-27422
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal zero,-35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14858
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-437
+addi a0,zero,0
+jal ra,-27465
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+ld t1,-56(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal zero,-40
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,312(t1)
+addi t0,zero,0
+sd t0,-448(gp)
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFD
+addi t0,t0,720
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-432(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+sd t0,40(sp)
+jal ra,-26557
+addi sp,sp,40
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,480(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,328(t1)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,480(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+jal ra,486
+addi a0,zero,0
+jal ra,637
+addi a0,zero,0
+jal ra,1545
+addi a0,zero,0
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-39
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,320(t1)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+jal ra,465
+addi a0,zero,0
+jal ra,616
+addi a0,zero,0
+jal ra,1575
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,480(t1)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-22
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,320(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,328(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,704
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17687
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-26755
+addi sp,sp,16
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,688
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17722
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-26790
+addi sp,sp,16
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17668
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-85
+addi a0,zero,0
+jal zero,34
+lui t0,0xFFFFD
+addi t0,t0,672
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17770
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-26847
+addi sp,sp,24
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27882
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26888
+addi sp,sp,8
+addi a0,zero,0
+jal zero,116
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,424(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26907
+addi sp,sp,8
+addi a0,zero,0
+jal zero,97
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26926
+addi sp,sp,8
+addi a0,zero,0
+jal zero,78
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,592
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26945
+addi sp,sp,8
+addi a0,zero,0
+jal zero,59
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,576
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26964
+addi sp,sp,8
+addi a0,zero,0
+jal zero,40
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26983
+addi sp,sp,8
+addi a0,zero,0
+jal zero,21
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28011
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17931
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30626
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,440(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30640
+addi t0,a0,0
+addi a0,zero,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,61
+lui t0,0xFFFFD
+addi t0,t0,504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+sd t0,16(sp)
+jal ra,-27057
+addi sp,sp,16
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-209
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28083
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30682
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30673
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-237
+addi a0,zero,0
+jal ra,-28049
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34288
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-30258
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-30249
+addi a0,zero,0
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,224(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+beq t0,zero,26
+lui t0,0xFFFFD
+addi t0,t0,424
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+sd t0,16(sp)
+jal ra,-27143
+addi sp,sp,16
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-295
+addi a0,zero,0
+jal ra,-28107
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+sd t0,8(sp)
+jal ra,-7982
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,113
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,4395
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-7969
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+ld t1,-56(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-7766
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15844
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-7791
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15844
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+jal zero,48
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8115
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-263
+addi a0,zero,0
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-275
+addi a0,zero,0
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-287
+addi a0,zero,0
+jal ra,-15520
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,264(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17696
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1800(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2040(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17527
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,373
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+ld t1,-2048(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-17554
+addi a0,zero,0
+ld t0,-72(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1912(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,327
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2032(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-17388
+addi a0,zero,0
+ld t0,-72(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1904(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,279
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2024(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,145
+jal ra,-17816
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1856(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1848(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,125
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2008(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17289
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-17035
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,77
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-17852
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2016(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-16956
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-17900
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,256(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-743
+addi a0,zero,0
+jal zero,34
+addi t0,zero,1
+sd t0,-456(gp)
+lui t0,0xFFFFD
+addi t0,t0,344
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+sd t0,32(sp)
+jal ra,-27782
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34976
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+beq t0,zero,4
+jal ra,193
+addi a0,zero,0
+jal zero,3
+jal ra,461
+addi a0,zero,0
+jal zero,182
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4999
+addi a0,zero,0
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3804
+addi a0,zero,0
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3306
+addi a0,zero,0
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4819
+addi a0,zero,0
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4728
+addi a0,zero,0
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4637
+addi a0,zero,0
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4546
+addi a0,zero,0
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4429
+addi a0,zero,0
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4312
+addi a0,zero,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2938
+addi a0,zero,0
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2701
+addi a0,zero,0
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2393
+addi a0,zero,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5451
+addi a0,zero,0
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2249
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5512
+addi a0,zero,0
+jal ra,-5193
+addi a0,zero,0
+jal zero,195
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4059
+addi a0,zero,0
+jal ra,-4000
+addi a0,zero,0
+jal zero,180
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3563
+addi a0,zero,0
+jal ra,-3504
+addi a0,zero,0
+jal zero,165
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5557
+addi a0,zero,0
+jal ra,-5019
+addi a0,zero,0
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5572
+addi a0,zero,0
+jal ra,-4930
+addi a0,zero,0
+jal zero,135
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5587
+addi a0,zero,0
+jal ra,-4841
+addi a0,zero,0
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5602
+addi a0,zero,0
+jal ra,-4752
+addi a0,zero,0
+jal zero,105
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5617
+addi a0,zero,0
+jal ra,-4637
+addi a0,zero,0
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5632
+addi a0,zero,0
+jal ra,-4522
+addi a0,zero,0
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3164
+addi a0,zero,0
+jal ra,-3150
+addi a0,zero,0
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5662
+addi a0,zero,0
+jal ra,-2915
+addi a0,zero,0
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5677
+addi a0,zero,0
+jal ra,-2609
+addi a0,zero,0
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-5692
+addi a0,zero,0
+jal ra,-5669
+addi a0,zero,0
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2490
+addi a0,zero,0
+jal ra,-2469
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3474
+addi a0,zero,0
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,17
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2367
+addi a0,zero,0
+jal zero,3
+jal ra,-5642
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2135
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5528
+addi a0,zero,0
+jal ra,-5466
+addi a0,zero,0
+jal ra,-5493
+addi a0,zero,0
+jal zero,224
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-4517
+addi a0,zero,0
+jal ra,-4275
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4396
+addi a0,zero,0
+jal zero,204
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-4026
+addi a0,zero,0
+jal ra,-3784
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3898
+addi a0,zero,0
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5355
+addi a0,zero,0
+jal ra,-5304
+addi a0,zero,0
+jal ra,-5550
+addi a0,zero,0
+jal zero,167
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5372
+addi a0,zero,0
+jal ra,-5217
+addi a0,zero,0
+jal ra,-5567
+addi a0,zero,0
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5389
+addi a0,zero,0
+jal ra,-5130
+addi a0,zero,0
+jal ra,-5584
+addi a0,zero,0
+jal zero,133
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5406
+addi a0,zero,0
+jal ra,-5043
+addi a0,zero,0
+jal ra,-5601
+addi a0,zero,0
+jal zero,116
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5423
+addi a0,zero,0
+jal ra,-4930
+addi a0,zero,0
+jal ra,-5618
+addi a0,zero,0
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5440
+addi a0,zero,0
+jal ra,-4817
+addi a0,zero,0
+jal ra,-5635
+addi a0,zero,0
+jal zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-3535
+addi a0,zero,0
+jal ra,-3447
+addi a0,zero,0
+jal ra,-3488
+addi a0,zero,0
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-3297
+addi a0,zero,0
+jal ra,-3214
+addi a0,zero,0
+jal ra,-3250
+addi a0,zero,0
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-2973
+addi a0,zero,0
+jal ra,-2910
+addi a0,zero,0
+jal ra,-3267
+addi a0,zero,0
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6045
+addi a0,zero,0
+jal ra,-5972
+addi a0,zero,0
+jal ra,-6024
+addi a0,zero,0
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2772
+addi a0,zero,0
+jal zero,3
+jal ra,-29476
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,232(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32168
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,440(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1569
+addi a0,zero,0
+jal zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,232(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,224(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,224(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-1451
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,224(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1308
+addi a0,zero,0
+jal ra,-826
+addi a0,zero,0
+jal ra,-96
+addi a0,zero,0
+jal zero,-24
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,224(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,-88(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-32(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+sd t0,-8(s0)
+jal zero,8
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,22
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-41
+ld t0,-8(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,-88(gp)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-87
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,320
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-30001
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-29964
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-28784
+addi sp,sp,32
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-6589
+addi a0,zero,0
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,11
+lui t0,0xFFFFD
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29814
+addi a0,zero,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,288
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-28832
+addi sp,sp,24
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,-88(gp)
+sd t0,16(sp)
+jal ra,-137
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-141
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-145
+addi a0,zero,0
+jal ra,-29816
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,51
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-30207
+addi t0,a0,0
+addi a0,zero,0
+sd t0,56(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-30186
+addi t0,a0,0
+addi a0,zero,0
+sd t0,64(sp)
+jal ra,-28928
+addi sp,sp,64
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19890
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,240
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-102
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFD
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-28995
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,160
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,152
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+sd t0,24(sp)
+jal ra,-145
+addi a0,zero,0
+ld t0,-1552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,136
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,128
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+sd t0,24(sp)
+jal ra,-169
+addi a0,zero,0
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1512(gp)
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19955
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,48(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,40(t1)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-150
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-50
+lui t0,0xFFFFD
+addi t0,t0,112
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,104
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+sd t0,24(sp)
+jal ra,-241
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,88
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,80
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+sd t0,24(sp)
+jal ra,-260
+addi a0,zero,0
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1512(gp)
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19973
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,32(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,24(t1)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-241
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-50
+lui t0,0xFFFFD
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,56
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+sd t0,24(sp)
+jal ra,-332
+addi a0,zero,0
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1512(gp)
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20016
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,16(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,8(t1)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-313
+addi a0,zero,0
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-50
+lui t0,0xFFFFD
+addi t0,t0,40
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,32
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+sd t0,24(sp)
+jal ra,-404
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-56
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29296
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-120
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-18517
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-18521
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-18458
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-30553
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+jal ra,-18534
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-18471
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-30520
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+jal ra,-29338
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-176
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30651
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30634
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,32(sp)
+jal ra,-29380
+addi sp,sp,32
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-248
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30693
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30676
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-29175
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+sd t0,8(sp)
+jal ra,-30668
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-29197
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+sd t0,8(sp)
+jal ra,-30644
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30763
+addi t0,a0,0
+addi a0,zero,0
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30746
+addi t0,a0,0
+addi a0,zero,0
+sd t0,56(sp)
+jal ra,-29488
+addi sp,sp,56
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-312
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,2652
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30801
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,2639
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-30784
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,2621
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-30767
+addi t0,a0,0
+addi a0,zero,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,2608
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-30734
+addi t0,a0,0
+addi a0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-29560
+addi sp,sp,48
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-368
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+sd t0,24(sp)
+jal ra,-29580
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,-456
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29596
+addi sp,sp,8
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7911
+addi a0,zero,0
+jal ra,-18813
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,109
+lui t0,0xFFFFD
+addi t0,t0,-544
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29619
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-18601
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,-608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29640
+addi sp,sp,8
+addi a0,zero,0
+jal zero,13
+lui t0,0xFFFFD
+addi t0,t0,-664
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29653
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+sd t0,16(sp)
+jal ra,-855
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+sd t0,16(sp)
+jal ra,-870
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-712
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+sd t0,16(sp)
+jal ra,-885
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,16(sp)
+jal ra,-900
+addi a0,zero,0
+jal ra,-736
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+beq t0,zero,83
+lui t0,0xFFFFD
+addi t0,t0,-776
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29731
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35510
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35501
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-792
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-10997
+addi a0,zero,0
+jal ra,-30713
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35537
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35528
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-808
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-11024
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,-840
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,8(sp)
+jal ra,-29799
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-30756
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-928
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-29813
+addi sp,sp,8
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-552(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFD
+addi t0,t0,-936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30853
+addi a0,zero,0
+jal zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-560(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFD
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30871
+addi a0,zero,0
+jal zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFD
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30889
+addi a0,zero,0
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFD
+addi t0,t0,-960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30907
+addi a0,zero,0
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFD
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30925
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,-984
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30933
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-34299
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33842
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-248(t1)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,8(sp)
+jal ra,-33384
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33377
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-33393
+addi a0,zero,0
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-240(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1512(gp)
+ld t1,-24(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29552
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33389
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29576
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33395
+addi a0,zero,0
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+divu t0,t0,t1
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29597
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33416
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33405
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33879
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33399
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+mul t0,t0,t1
+ld t1,-56(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10949
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33401
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33873
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33395
+addi a0,zero,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,129
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33949
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34317
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-10826
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33408
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33973
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34323
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-10850
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33414
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33997
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34329
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-10874
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33420
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34021
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34335
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-10898
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33426
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34045
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34341
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-10922
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33432
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33313
+addi a0,zero,0
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+sd t0,8(sp)
+jal ra,-33413
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33402
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+sd t0,8(sp)
+jal ra,-33393
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-33382
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-33371
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33342
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33331
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33320
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+sd t0,8(sp)
+jal ra,-33311
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33898
+addi t0,a0,0
+addi a0,zero,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33890
+addi t0,a0,0
+addi a0,zero,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34261
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,-37
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+sd t0,8(sp)
+jal ra,-33816
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-248(t1)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34307
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34317
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34310
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33844
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34319
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34329
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34352
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-33885
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33878
+addi a0,zero,0
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34369
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-101
+addi a0,zero,0
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-579
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-511
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1048
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,24(sp)
+jal ra,-30541
+addi sp,sp,24
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-232
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-33990
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34160
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,241
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34172
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34443
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34165
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34946
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34505
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11310
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34497
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34956
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11357
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-1512(gp)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-11355
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-26
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34799
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11379
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34800
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11398
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34801
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11417
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34802
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34346
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11436
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34749
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34289
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11455
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34750
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34289
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11474
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34751
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34289
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11493
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34752
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34289
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-11512
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,129
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34743
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11925
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-11903
+addi a0,zero,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34585
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-56(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11813
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34781
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-123
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34323
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34781
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-120
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34324
+addi a0,zero,0
+jal zero,39
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34782
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-162
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34326
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34782
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-159
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34327
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1112
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+jal ra,-31075
+addi sp,sp,32
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,63
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-12188
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11876
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,40
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-12206
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11803
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11984
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12130
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-232
+addi a0,zero,0
+ld t0,40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+jal zero,-65
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34717
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,369
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34729
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35000
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34722
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35506
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11889
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34597
+addi a0,zero,0
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35054
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35513
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11914
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-1512(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,-32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-11938
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35363
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11962
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34454
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35364
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-11981
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34455
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35365
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12000
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34456
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35366
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12019
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34457
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35616
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12035
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35612
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12049
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35608
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12063
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-56(s0)
+sd t0,24(sp)
+ld t0,-64(s0)
+sd t0,32(sp)
+jal ra,-317
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35653
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-64(s0)
+sd t0,16(sp)
+jal ra,-12066
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35631
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12104
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35627
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12118
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-56(s0)
+sd t0,24(sp)
+ld t0,-64(s0)
+sd t0,32(sp)
+jal ra,-372
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35654
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+ld t0,-56(s0)
+sd t0,16(sp)
+jal ra,-12121
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35437
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12162
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34528
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35438
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12181
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34529
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35439
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12200
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34530
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35440
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-12219
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-34531
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35401
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,272(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35391
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,248(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35381
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,240(t1)
+jal ra,-13727
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35311
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,32
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35326
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35319
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35333
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,32
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35348
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35341
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35545
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-1544(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,18
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1040(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1048(t2)
+mul t1,t1,t2
+ld t2,-56(gp)
+sub t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35406
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35402
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35432
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35656
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+ld t2,-1544(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-216
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,31
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-169
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-131
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-271
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,0(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-234
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-16(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-206
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-32(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-354
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-8(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-317
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-24(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-289
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-40(t1)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1000(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-47
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,25
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+add t0,t0,t1
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1000(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+jal ra,-76
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-512(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31731
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-504(t1)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-31970
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-496(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-512(t1)
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,-1152
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-32254
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39448
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-496(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-512(t1)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-17837
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36143
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13106
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13195
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-184
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-1443
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36177
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-13025
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13216
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-817
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+ld t1,-8(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36149
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi a0,zero,0
+sub t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-1525
+addi a0,zero,0
+jal zero,106
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-278
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-1537
+addi a0,zero,0
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,85
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-888
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36290
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36208
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21062
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-13154
+addi a0,zero,0
+jal zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-868
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,31
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36330
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36210
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20895
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-13194
+addi a0,zero,0
+ld t0,-8(s0)
+ld t1,-56(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-87
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36376
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13339
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-941
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13437
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-216
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,976(t1)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36423
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13386
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1600(t0)
+sd t0,8(sp)
+jal ra,-36023
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13495
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-35983
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36457
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-35977
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+sd t0,8(sp)
+jal ra,-35932
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+sd t0,8(sp)
+jal ra,-35923
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+sd t0,8(sp)
+jal ra,-35914
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,8(sp)
+jal ra,-35905
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,8(sp)
+jal ra,-32470
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-35909
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36375
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-35903
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36479
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13612
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-391
+addi a0,zero,0
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-31
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36475
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13646
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-425
+addi a0,zero,0
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,8(sp)
+jal ra,-35880
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34876
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-56(gp)
+sd t0,8(sp)
+jal ra,-32597
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,32(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,24(s0)
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-550
+addi a0,zero,0
+ld t0,24(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,-16(s0)
+ld t1,-56(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-26
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-40(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32589
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-105
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-31
+ld t0,-8(s0)
+ld t1,-56(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-640
+addi a0,zero,0
+ld t0,-8(s0)
+ld t1,-56(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-653
+addi a0,zero,0
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+ld t0,-8(s0)
+ld t1,-56(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-679
+addi a0,zero,0
+jal zero,-26
+ld t0,-8(s0)
+ld t1,-56(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-693
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36852
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36864
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+sd t0,8(sp)
+jal ra,-36208
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36897
+addi t0,a0,0
+addi a0,zero,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12871
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13396
+addi a0,zero,0
+jal zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16156
+addi a0,zero,0
+jal zero,90
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17979
+addi a0,zero,0
+jal zero,76
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17495
+addi a0,zero,0
+jal zero,62
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16819
+addi a0,zero,0
+jal zero,48
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1232(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18239
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+addi a0,t0,0
+jal zero,35
+jal zero,29
+lui t0,0xFFFFD
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-33174
+addi sp,sp,16
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,8(sp)
+jal ra,-36295
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+addi a0,t0,0
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+sd t0,8(sp)
+jal ra,-36362
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36804
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14055
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1651
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-861
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,976(t1)
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14085
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1621
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-891
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,976(t1)
+jal zero,44
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1117
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-2376
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,968(t1)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14134
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-1559
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,984(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+sd t0,8(sp)
+jal ra,-36497
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+beq t0,zero,25
+lui t0,0xFFFFD
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-33365
+addi sp,sp,8
+addi a0,zero,0
+jal ra,-6751
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+sd t0,8(sp)
+jal ra,-36488
+addi a0,zero,0
+jal zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-33389
+addi sp,sp,8
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,8(sp)
+jal ra,-36510
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+sd t0,8(sp)
+jal ra,-36571
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37049
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-413
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,100
+jal zero,99
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-276
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,83
+jal zero,82
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-157
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,66
+jal zero,65
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-100
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,49
+jal zero,48
+lui t0,0xFFFFD
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37038
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-33534
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37127
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-6691
+addi a0,zero,0
+jal ra,-34503
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+sd t0,8(sp)
+jal ra,-36669
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFD
+addi t0,t0,-1312
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34593
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-1400
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-33593
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,63
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-16138
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37160
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37172
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,-8(s0)
+jal zero,29
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-201
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37216
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,9
+jal zero,7
+ld t0,-16(s0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-8(s0)
+jal zero,-63
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFD
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34692
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-1504
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-33692
+addi sp,sp,8
+addi a0,zero,0
+addi t0,zero,1
+beq t0,zero,37
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,8(sp)
+jal ra,-40840
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-274
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37289
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,5
+jal zero,3
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-37
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFD
+addi t0,t0,-1544
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,100
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-33756
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-1632
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-33768
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-88(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-8(s0)
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sd t0,-8(s0)
+jal zero,24
+ld t0,-8(s0)
+ld t1,-88(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,-8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+ld t1,24(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,7
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,97
+ld t0,24(s0)
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-16368
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-40983
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37400
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37412
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,-16(s0)
+jal zero,51
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-441
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37456
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,31
+jal zero,29
+ld t0,-24(s0)
+sd t0,16(s0)
+ld t0,24(s0)
+beq t0,zero,17
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,9
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,-97
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,143
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-16480
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37502
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37514
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,-8(s0)
+jal zero,109
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37583
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,24(s0)
+beq t0,zero,5
+jal ra,-1924
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37608
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFD
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37535
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-34031
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37640
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37629
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,-7193
+addi a0,zero,0
+jal ra,-35005
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi a0,t0,0
+jal zero,29
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-624
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37639
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,8
+ld t0,-16(s0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,-8(s0)
+jal zero,-143
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35113
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-1784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-34113
+addi sp,sp,8
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-189
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35153
+addi a0,zero,0
+lui t0,0xFFFFD
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-34153
+addi sp,sp,8
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-229
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36217
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36227
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi a0,zero,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36256
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36242
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+ld t0,-24(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-36412
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,46
+sd t0,-24(s0)
+jal zero,-33
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+sd t0,-32(s0)
+jal zero,33
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36315
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,22
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-36454
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-36421
+addi a0,zero,0
+jal zero,-24
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1896
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-34263
+addi sp,sp,16
+addi a0,zero,0
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1689
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,587
+addi a0,zero,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,470
+addi t0,a0,0
+addi a0,zero,0
+sd t0,8(sp)
+jal ra,482
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+jal ra,-1443
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-1936
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-34369
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,418
+jal zero,35
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-552(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,-1976
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-34404
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,383
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-16709
+addi a0,zero,0
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1160(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,16(s0)
+jal ra,-39120
+addi a0,zero,0
+jal ra,-38812
+addi a0,zero,0
+jal ra,-37401
+addi a0,zero,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,393
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36201
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39876
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-3955
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-232(t1)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-488(t1)
+jal zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-488(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-176
+addi a0,zero,0
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,352(t1)
+lui t0,0xFFFFD
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-34513
+addi sp,sp,24
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14101
+addi a0,zero,0
+lui t0,0xFFFFC
+addi t0,t0,2032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-34536
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+beq t0,zero,9
+lui t0,0xFFFFC
+addi t0,t0,2016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35559
+addi a0,zero,0
+jal zero,8
+lui t0,0xFFFFC
+addi t0,t0,1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35567
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-440(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,344(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,336(t1)
+lui t0,0xFFFFC
+addi t0,t0,1976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35590
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,16(s0)
+jal zero,30
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-448(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,344(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,328(t1)
+jal ra,-39472
+addi a0,zero,0
+lui t0,0xFFFFC
+addi t0,t0,1960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35620
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,16(s0)
+lui t0,0xFFFFC
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35631
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1064
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,66
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-561
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,48
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-539
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,30
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1019
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-962
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,328(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,336(t1)
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,344(t1)
+lui t0,0xFFFFC
+addi t0,t0,1904
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38239
+addi t0,a0,0
+addi a0,zero,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-36983
+addi t0,a0,0
+addi a0,zero,0
+sd t0,24(sp)
+jal ra,-34746
+addi sp,sp,24
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-456(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5479
+addi a0,zero,0
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,1816
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+jal ra,-34777
+addi sp,sp,8
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13094
+addi a0,zero,0
+addi t0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,352(t1)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+addi a0,zero,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39
+addi t0,a0,0
+addi a0,zero,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-536(t1)
+jal ra,-77
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi t1,zero,1
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-520(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,-528(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,16(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,29
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-34994
+addi sp,sp,16
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-208
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-288(t0)
+addi a0,t0,0
+jal zero,352
+jal zero,351
+lui t0,0xFFFFC
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-16(gp)
+sd t0,16(sp)
+jal ra,-35033
+addi sp,sp,16
+addi a0,zero,0
+lui t0,0xFFFFC
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,8(sp)
+ld t0,-32(gp)
+sd t0,16(sp)
+ld t0,-48(gp)
+sd t0,24(sp)
+jal ra,-35049
+addi sp,sp,24
+addi a0,zero,0
+jal ra,-5230
+addi a0,zero,0
+jal ra,-36008
+addi a0,zero,0
+jal ra,-42030
+addi a0,zero,0
+jal ra,-41296
+addi a0,zero,0
+jal ra,-41271
+addi a0,zero,0
+jal ra,-40169
+addi a0,zero,0
+jal ra,-39897
+addi a0,zero,0
+jal ra,-266
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,296
+jal ra,-209
+addi a0,zero,0
+jal ra,-12960
+addi a0,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1608
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-36925
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,-26551
+addi a0,zero,0
+jal zero,275
+jal ra,-292
+addi t0,a0,0
+addi a0,zero,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,268
+jal zero,261
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1600
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-36955
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,9
+jal ra,-256
+addi t0,a0,0
+addi a0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20941
+addi a0,zero,0
+jal zero,240
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1592
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-36976
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8806
+addi a0,zero,0
+jal zero,221
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1584
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-36995
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,7
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8825
+addi a0,zero,0
+jal zero,202
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1576
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37014
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,4
+jal ra,-20647
+addi a0,zero,0
+jal zero,186
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,175
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1568
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37036
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-859
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,163
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1560
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37060
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-883
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,139
+jal zero,126
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1552
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37084
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-907
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,115
+jal zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1544
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37108
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-931
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,91
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1536
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37132
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-955
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,67
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1528
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37156
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-979
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,43
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1520
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37180
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1003
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,19
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,13
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-304(t0)
+addi a0,t0,0
+jal zero,7
+jal zero,-300
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-458
+addi t0,a0,0
+addi a0,zero,0
+beq t0,zero,6
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-415
+addi a0,zero,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,19
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+addi a0,t0,0
+jal zero,5
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38372
+addi a0,zero,0
+jal ra,-42573
+addi a0,zero,0
+jal ra,-38351
+addi a0,zero,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-449
+addi t0,a0,0
+addi a0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1480
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-85
+addi t0,a0,0
+addi a0,zero,0
+addi a0,t0,0
+jal zero,1
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6F2D
+.8byte 0x632D
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x736973706F6E7973
+.8byte 0x2D207B207325203A
+.8byte 0x72756F73207B2063
+.8byte 0x2D207C207D206563
+.8byte 0x7972616E6962206F
+.8byte 0x20732D2028207C20
+.8byte 0x61202920532D207C
+.8byte 0x20796C626D657373
+.8byte 0x6E6962206C2D207C
+.8byte 0xA73257D20797261
+.8byte 0x0
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x666C6573203A7325
+.8byte 0x696D726574206569
+.8byte 0x2520676E6974616E
+.8byte 0x6520687469772073
+.8byte 0x65646F6320746978
+.8byte 0xA646C2520
+.8byte 0x206E6F20
+.8byte 0x79616C706572202C
+.8byte 0x0
+.8byte 0x676775626564202C
+.8byte 0x7265
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x666C6573203A7325
+.8byte 0x7563657865206569
+.8byte 0x20732520676E6974
+.8byte 0x756C252068746977
+.8byte 0x697379687020424D
+.8byte 0x6F6D656D206C6163
+.8byte 0x7972
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x73252E7325
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473626F6D
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA726574736E696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0x282072657478696D
+.8byte 0x696D202525756C25
+.8byte 0x6C252F7265747370
+.8byte 0x7370796820252575
+.8byte 0xA29726574
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473707968
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA7265747370696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0x3025783020747865
+.8byte 0xA586C38
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x3830257830207478
+.8byte 0x746165726320586C
+.8byte 0x646C696863206465
+.8byte 0x747865746E6F6320
+.8byte 0x586C383025783020
+.8byte 0xA
+.8byte 0x6E776F6E6B6E75
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6120726F6A616D20
+.8byte 0x6D20756C2520646E
+.8byte 0x67617020726F6E69
+.8byte 0x73746C7561662065
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6D2029424D756C25
+.8byte 0x656D206465707061
+.8byte 0xA79726F6D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6C322E252E756C25
+.8byte 0x7463612029424D75
+.8byte 0x636120796C6C6175
+.8byte 0xA646573736563
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0xA73
+.8byte 0x6D6D7573203A7325
+.8byte 0x756C25203A797261
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x73706F6E20252575
+.8byte 0xA5D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x0
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x0
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x0
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x0
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x29
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x20
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x7463757274736E69
+.8byte 0x646E6120736E6F69
+.8byte 0x74796220756C2520
+.8byte 0x616420666F207365
+.8byte 0x7474697277206174
+.8byte 0x206F746E69206E65
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x302065747962342E
+.8byte 0x586C2578
+.8byte 0x302065747962382E
+.8byte 0x586C2578
+.8byte 0x203A
+.8byte 0x20
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x7325
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x2C
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C203A
+.8byte 0x5D586C2578305B
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x5D586C2578305B
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x2D7C20
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x646C25
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x203E2D20
+.8byte 0x2D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x646C253D3D5D586C
+.8byte 0x202D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x2578303D3D5D586C
+.8byte 0x202D7C20586C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x203E2D20
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x20626C74203A7325
+.8byte 0xA3A737365636361
+.8byte 0x203A726464617620
+.8byte 0xA586C3830257830
+.8byte 0x30203A6567617020
+.8byte 0x200A586C34302578
+.8byte 0x30203A656D617266
+.8byte 0x200A586C38302578
+.8byte 0x30203A7264646170
+.8byte 0xA586C38302578
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x6F72662064656863
+.8byte 0x7865746E6F63206D
+.8byte 0x6C38302578302074
+.8byte 0x6E6F63206F742058
+.8byte 0x2578302074786574
+.8byte 0x586C3830
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C617A
+.8byte 0x636F6C6C616D
+.8byte 0x203E2D20
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x736920656D616E20
+.8byte 0x6E6F6C206F6F7420
+.8byte 0x6464612074612067
+.8byte 0x2578302073736572
+.8byte 0xA586C3830
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x64696C61766E6920
+.8byte 0xA
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x69206E61206E6920
+.8byte 0x732064696C61766E
+.8byte 0xA746E656D6765
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x657070616D6E7520
+.8byte 0xA64
+.8byte 0x6E65706F
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0x65207325203A7325
+.8byte 0x7720676E69746978
+.8byte 0x7469786520687469
+.8byte 0x6C252065646F6320
+.8byte 0xA64
+.8byte 0x3C3C3C3C203A7325
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x72616E6962206461
+.8byte 0x69206D6F72662079
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x646564616F6C2061
+.8byte 0x7325206D6F726620
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x6E6120736E6F6974
+.8byte 0x796220756C252064
+.8byte 0x6420666F20736574
+.8byte 0xA617461
+.8byte 0x626D7973203A7325
+.8byte 0x656C626174206C6F
+.8byte 0x2068637261657320
+.8byte 0x73617720656D6974
+.8byte 0x65746920756C2520
+.8byte 0x20736E6F69746172
+.8byte 0x6172657661206E6F
+.8byte 0x2520646E61206567
+.8byte 0x6F74206E6920756C
+.8byte 0xA6C6174
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x62696C20796C6E6F
+.8byte 0x6E65672079726172
+.8byte 0xA646574617265
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x25202C736C6C6163
+.8byte 0x676973736120756C
+.8byte 0x202C73746E656D6E
+.8byte 0x6C69687720756C25
+.8byte 0x6920756C25202C65
+.8byte 0x7220756C25202C66
+.8byte 0xA6E72757465
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x6174732068746977
+.8byte 0xA6372
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x7972617262696C
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x6465636F7270206E
+.8byte 0x6874697720657275
+.8byte 0x7261762D6E6F6E20
+.8byte 0x6170206369646169
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x636F7270206E6920
+.8byte 0x6977206572756465
+.8byte 0x762D6E6F6E206874
+.8byte 0x2063696461697261
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x676E696E726177
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x676E696E726177
+.8byte 0x656D616E5F6F6E
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x64696F76
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x2072656765746E69
+.8byte 0x6220666F2074756F
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6666756220657469
+.8byte 0x756F206F74207265
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x7325
+.8byte 0x7325
+.8byte 0x66746E69727064
+.8byte 0x645F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x66746E69727073
+.8byte 0x735F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x2066746E697270
+.8byte 0x705F6569666C6573
+.8byte 0x66746E6972
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x6567616972726163
+.8byte 0x6E727574657220
+.8byte 0x65656620656E696C
+.8byte 0x64
+.8byte 0x6F74616C75626174
+.8byte 0x72
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x6325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x989680
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x191
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x10000
+.8byte 0x8000
+.8byte 0x40000
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x0
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x7
+.8byte 0x20
+.8byte 0x2020706D75625F
+.8byte 0x2020206E69616D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x0
+.8byte 0x20
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
+.8byte 0x0
@@ -101,6 +101,9 @@ uint64_t open(char* filename, uint64_t flags, ...);
 // selfie bootstraps void* to uint64_t* and unsigned to uint64_t!
 void* malloc(unsigned long);
 
+// selfie bootstraps struct timespec* to uint64_t*!
+int clock_gettime(int clock_id, uint64_t* timespec);
+
 // selfie bootstraps the following *printf procedures
 int printf(const char* format, ...);
 int sprintf(char* str, const char* format, ...);
@@ -262,6 +265,8 @@ char* filename_buffer; // buffer for opening files
 
 uint64_t* binary_buffer; // buffer for binary I/O
 
+uint64_t* timespec_buffer; // buffer for clock_gettime
+
 // flags for opening read-only files
 // LINUX:       0 = 0x0000 = O_RDONLY (0x0000)
 // MAC:         0 = 0x0000 = O_RDONLY (0x0000)
@@ -283,6 +288,19 @@ uint64_t WINDOWS_O_BINARY_CREAT_TRUNC_WRONLY = 33537;
 // default is LINUX, re-initialized in init_system
 uint64_t O_CREAT_TRUNC_WRONLY = 577; // write-only flags for host operating system
 
+// clock IDs for the clock_gettime system call
+// LINUX: CLOCK_MONOTONIC (1), CLOCK_PROCESS_CPUTIME_ID (2)
+uint64_t LINUX_CLOCK_MONOTONIC          = 1;
+uint64_t LINUX_CLOCK_PROCESS_CPUTIME_ID = 2;
+
+// MAC: CLOCK_MONOTONIC (6), CLOCK_PROCESS_CPUTIME_ID (12)
+uint64_t MAC_CLOCK_MONOTONIC          = 6;
+uint64_t MAC_CLOCK_PROCESS_CPUTIME_ID = 12;
+
+// default is LINUX, re-initialized in init_system
+uint64_t CLOCK_MONOTONIC          = 1; // wall-clock time of host operating system
+uint64_t CLOCK_PROCESS_CPUTIME_ID = 2; // cpu time of host operating system
+
 // flags for rw-r--r-- (text) file permissions
 // 420 = 00644 = S_IRUSR (00400) | S_IWUSR (00200) | S_IRGRP (00040) | S_IROTH (00004)
 // these flags seem to be working for LINUX, MAC, and WINDOWS
@@ -360,6 +378,11 @@ void init_library() {
   // allocate and touch to make sure memory is mapped for read calls
   binary_buffer  = smalloc(SIZEOFUINT64);
   *binary_buffer = 0;
+
+  // allocate and touch to make sure memory is mapped for clock_gettime calls
+  timespec_buffer       = smalloc(2 * SIZEOFUINT64);
+  *timespec_buffer       = 0;
+  *(timespec_buffer + 1) = 0;
 }
 
 void reset_library() {
@@ -565,32 +588,35 @@ uint64_t report_undefined_procedures();
 // | 2 | line#   | source line number
 // | 3 | class   | VARIABLE, BIGINT, STRING, PROCEDURE
 // | 4 | type    | UINT64_T, UINT64STAR_T, VOID_T
-// | 5 | value   | VARIABLE: initial value
+// | 5 | value   | VARIABLE: initial value, local variable in saved register: number of accesses in loops
 // | 6 | address | VARIABLE, BIGINT, STRING: offset, PROCEDURE: address
 // | 7 | scope   | REG_GP (global), REG_S0 (local)
+// | 8 | inline  | PROCEDURE: number of instructions of inlinable body, 0 otherwise
 // +---+---------+
 
 uint64_t* allocate_symbol_table_entry() {
-  return smalloc(2 * SIZEOFUINT64STAR + 6 * SIZEOFUINT64);
-}
-
-uint64_t* get_next_entry(uint64_t* entry)  { return (uint64_t*) *entry; }
-char*     get_string(uint64_t* entry)      { return (char*)     *(entry + 1); }
-uint64_t  get_line_number(uint64_t* entry) { return             *(entry + 2); }
-uint64_t  get_class(uint64_t* entry)       { return             *(entry + 3); }
-uint64_t  get_type(uint64_t* entry)        { return             *(entry + 4); }
-uint64_t  get_value(uint64_t* entry)       { return             *(entry + 5); }
-uint64_t  get_address(uint64_t* entry)     { return             *(entry + 6); }
-uint64_t  get_scope(uint64_t* entry)       { return             *(entry + 7); }
-
-void set_next_entry(uint64_t* entry, uint64_t* next) { *entry       = (uint64_t) next; }
-void set_string(uint64_t* entry, char* identifier)   { *(entry + 1) = (uint64_t) identifier; }
-void set_line_number(uint64_t* entry, uint64_t line) { *(entry + 2) = line; }
-void set_class(uint64_t* entry, uint64_t class)      { *(entry + 3) = class; }
-void set_type(uint64_t* entry, uint64_t type)        { *(entry + 4) = type; }
-void set_value(uint64_t* entry, uint64_t value)      { *(entry + 5) = value; }
-void set_address(uint64_t* entry, uint64_t address)  { *(entry + 6) = address; }
-void set_scope(uint64_t* entry, uint64_t scope)      { *(entry + 7) = scope; }
+  return smalloc(2 * SIZEOFUINT64STAR + 7 * SIZEOFUINT64);
+}
+
+uint64_t* get_next_entry(uint64_t* entry)    { return (uint64_t*) *entry; }
+char*     get_string(uint64_t* entry)        { return (char*)     *(entry + 1); }
+uint64_t  get_line_number(uint64_t* entry)   { return             *(entry + 2); }
+uint64_t  get_class(uint64_t* entry)         { return             *(entry + 3); }
+uint64_t  get_type(uint64_t* entry)          { return             *(entry + 4); }
+uint64_t  get_value(uint64_t* entry)         { return             *(entry + 5); }
+uint64_t  get_address(uint64_t* entry)       { return             *(entry + 6); }
+uint64_t  get_scope(uint64_t* entry)         { return             *(entry + 7); }
+uint64_t  get_inline_length(uint64_t* entry) { return             *(entry + 8); }
+
+void set_next_entry(uint64_t* entry, uint64_t* next)     { *entry       = (uint64_t) next; }
+void set_string(uint64_t* entry, char* identifier)       { *(entry + 1) = (uint64_t) identifier; }
+void set_line_number(uint64_t* entry, uint64_t line)     { *(entry + 2) = line; }
+void set_class(uint64_t* entry, uint64_t class)          { *(entry + 3) = class; }
+void set_type(uint64_t* entry, uint64_t type)            { *(entry + 4) = type; }
+void set_value(uint64_t* entry, uint64_t value)          { *(entry + 5) = value; }
+void set_address(uint64_t* entry, uint64_t address)      { *(entry + 6) = address; }
+void set_scope(uint64_t* entry, uint64_t scope)          { *(entry + 7) = scope; }
+void set_inline_length(uint64_t* entry, uint64_t length) { *(entry + 8) = length; }
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
@@ -669,9 +695,26 @@ uint64_t previous_temporary();
 uint64_t next_temporary();
 void     tfree(uint64_t number_of_temporaries);
 
+uint64_t temporary_register(uint64_t temporary);
+uint64_t temporary_number(uint64_t reg);
+
 void save_temporaries();
 void restore_temporaries(uint64_t number_of_temporaries);
 
+uint64_t argument_register(uint64_t parameter);
+uint64_t argument_number(uint64_t reg);
+
+void save_arguments();
+void restore_arguments(uint64_t number_of_arguments);
+
+uint64_t saved_register(uint64_t local);
+uint64_t saved_register_number(uint64_t reg);
+
+void allocate_saved_registers();
+void record_saved_register_access(uint64_t* entry);
+uint64_t is_released(uint64_t reg, uint64_t released);
+uint64_t release_saved_registers(uint64_t prologue, uint64_t body);
+
 void syntax_error_symbol(uint64_t expected);
 void syntax_error_unexpected();
 void print_type(uint64_t type);
@@ -682,18 +725,32 @@ uint64_t* get_variable_or_big_int(char* variable, uint64_t class);
 void      load_upper_base_address(uint64_t* entry);
 uint64_t  load_variable_or_big_int(char* variable, uint64_t class);
 void      load_integer(uint64_t value);
+uint64_t  allocate_string(char* string);
 void      load_string(char* string);
 
 uint64_t procedure_call(uint64_t* entry, char* procedure, uint64_t number_of_parameters);
 
-void procedure_prologue(uint64_t number_of_local_variable_bytes);
+uint64_t is_constant_offset(uint64_t address);
+uint64_t inline_length(uint64_t* entry);
+uint64_t inline_register(uint64_t reg);
+void     inline_definition(uint64_t reg, uint64_t number_of_parameters);
+uint64_t inline_call(uint64_t* entry, uint64_t number_of_parameters, uint64_t length, uint64_t result);
+
+uint64_t number_of_register_parameters(uint64_t number_of_parameters);
+
+void procedure_prologue(uint64_t number_of_local_variable_bytes, uint64_t number_of_register_parameters);
 void procedure_epilogue(uint64_t number_of_parameter_bytes);
 
+void elide_frame(uint64_t from_address);
+
+uint64_t pass_parameter(uint64_t* entry, uint64_t parameter, uint64_t length, uint64_t allocate_memory_on_stack);
+
 uint64_t  compile_macro(uint64_t* entry);
 uint64_t  compile_call(char* procedure);
 uint64_t  compile_factor();
 uint64_t  compile_term();
 uint64_t  compile_simple_expression();
+uint64_t  compile_comparison();
 uint64_t  compile_expression();
 void      compile_while();
 void      compile_if();
@@ -702,12 +759,24 @@ void      compile_statement();
 uint64_t  compile_type();
 uint64_t* compile_variable(uint64_t offset);
 uint64_t  compile_initialization(uint64_t type);
+uint64_t  allocate_global_variable(uint64_t initial_value);
 void      compile_procedure(char* procedure, uint64_t type);
 void      compile_cstar();
 
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t MAX_INLINE_LENGTH = 12; // maximum number of instructions of inlined procedure bodies
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
 uint64_t allocated_temporaries = 0; // number of allocated temporaries
+uint64_t allocated_arguments   = 0; // number of argument registers holding actual parameters
+
+uint64_t leaf_procedure = 0; // flag for currently parsed procedure not calling any procedures
+
+uint64_t loop_nesting = 0; // nesting depth of while loops in currently parsed procedure
+
+uint64_t* saved_register_accesses = (uint64_t*) 0; // code addresses of saved register accesses in currently parsed procedure
 
 uint64_t* current_procedure = (uint64_t*) 0; // currently parsed procedure definition
 
@@ -715,26 +784,130 @@ uint64_t return_branches = 0; // fixup chain for return statements
 
 uint64_t return_type = 0; // return type of currently parsed procedure
 
-uint64_t number_of_calls       = 0;
-uint64_t number_of_assignments = 0;
-uint64_t number_of_while       = 0;
-uint64_t number_of_if          = 0;
-uint64_t number_of_return      = 0;
+uint64_t* inline_temporaries = (uint64_t*) 0; // temporaries at call sites of inlined bodies
+
+uint64_t number_of_calls         = 0;
+uint64_t number_of_inlined_calls = 0;
+uint64_t number_of_assignments   = 0;
+uint64_t number_of_while         = 0;
+uint64_t number_of_if            = 0;
+uint64_t number_of_return        = 0;
 
 // ------------------------- INITIALIZATION ------------------------
 
 void reset_parser() {
-  number_of_calls       = 0;
-  number_of_assignments = 0;
-  number_of_while       = 0;
-  number_of_if          = 0;
-  number_of_return      = 0;
+  number_of_calls         = 0;
+  number_of_inlined_calls = 0;
+  number_of_assignments   = 0;
+  number_of_while         = 0;
+  number_of_if            = 0;
+  number_of_return        = 0;
 
   number_of_syntax_errors = 0;
 
   get_symbol();
 }
 
+// -----------------------------------------------------------------
+// ------------------------ EXPRESSION DAG -------------------------
+// -----------------------------------------------------------------
+
+void reset_expression_dag();
+
+// expression DAG node:
+// +---+-------+
+// | 0 | next  | pointer to next node of current expression
+// | 1 | op    | NODE_CONSTANT, NODE_VARIABLE, NODE_STRING, NODE_REGISTER, NODE_LOAD, NODE_ADD, ...
+// | 2 | left  | pointer to left operand
+// | 3 | right | pointer to right operand
+// | 4 | value | CONSTANT: value, VARIABLE: symbol table entry, STRING: offset, REGISTER: register
+// | 5 | reg   | register holding value of node during code generation, 0 otherwise
+// | 6 | uses  | number of uses of node during code generation
+// +---+-------+
+
+uint64_t* allocate_dag_node() {
+  return smalloc(3 * SIZEOFUINT64STAR + 4 * SIZEOFUINT64);
+}
+
+uint64_t* get_next_node(uint64_t* node)     { return (uint64_t*) *node; }
+uint64_t  get_node_op(uint64_t* node)       { return             *(node + 1); }
+uint64_t* get_left_node(uint64_t* node)     { return (uint64_t*) *(node + 2); }
+uint64_t* get_right_node(uint64_t* node)    { return (uint64_t*) *(node + 3); }
+uint64_t  get_node_value(uint64_t* node)    { return             *(node + 4); }
+uint64_t  get_node_register(uint64_t* node) { return             *(node + 5); }
+uint64_t  get_node_uses(uint64_t* node)     { return             *(node + 6); }
+
+void set_next_node(uint64_t* node, uint64_t* next)     { *node       = (uint64_t) next; }
+void set_node_op(uint64_t* node, uint64_t op)          { *(node + 1) = op; }
+void set_left_node(uint64_t* node, uint64_t* left)     { *(node + 2) = (uint64_t) left; }
+void set_right_node(uint64_t* node, uint64_t* right)   { *(node + 3) = (uint64_t) right; }
+void set_node_value(uint64_t* node, uint64_t value)    { *(node + 4) = value; }
+void set_node_register(uint64_t* node, uint64_t reg)   { *(node + 5) = reg; }
+void set_node_uses(uint64_t* node, uint64_t uses)      { *(node + 6) = uses; }
+
+uint64_t* create_node(uint64_t op, uint64_t* left, uint64_t* right, uint64_t value);
+uint64_t* search_node(uint64_t op, uint64_t* left, uint64_t* right, uint64_t value);
+
+uint64_t is_constant_node(uint64_t* node, uint64_t value);
+uint64_t is_immediate_node(uint64_t* node);
+
+uint64_t* constant_node(uint64_t value);
+uint64_t* variable_node(uint64_t* entry);
+uint64_t* string_node(uint64_t offset);
+uint64_t* register_node(uint64_t reg);
+uint64_t* operator_node(uint64_t op, uint64_t* left, uint64_t* right);
+uint64_t* fold_node(uint64_t op, uint64_t* left, uint64_t* right);
+
+uint64_t* get_temporary_node(uint64_t temporary);
+void      set_temporary_node(uint64_t temporary, uint64_t* node);
+void      reduce_temporaries(uint64_t op);
+void      scale_temporary(uint64_t temporary, uint64_t m);
+
+void     count_node_uses(uint64_t* node);
+void     hold_node_registers(uint64_t* node);
+uint64_t allocate_node_register(uint64_t* node);
+void     release_node(uint64_t* node);
+
+void     emit_upper_base_address(uint64_t reg, uint64_t* entry);
+void     emit_variable(uint64_t reg, uint64_t* entry);
+void     emit_constant(uint64_t reg, uint64_t value);
+uint64_t emit_node(uint64_t* node);
+
+void emit_temporary(uint64_t temporary);
+void emit_temporaries();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+// node operators
+uint64_t NODE_CONSTANT = 1;
+uint64_t NODE_VARIABLE = 2;
+uint64_t NODE_STRING   = 3;
+uint64_t NODE_REGISTER = 4;
+uint64_t NODE_LOAD     = 5;
+uint64_t NODE_ADD      = 6;
+uint64_t NODE_SUB      = 7;
+uint64_t NODE_MUL      = 8;
+uint64_t NODE_DIVU     = 9;
+uint64_t NODE_REMU     = 10;
+uint64_t NODE_SLTU     = 11;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t optimize = 0; // flag for compiling expressions through DAGs
+
+uint64_t* expression_nodes = (uint64_t*) 0; // list of nodes of current expression
+
+uint64_t* temporary_nodes   = (uint64_t*) 0; // nodes of temporaries whose code is not yet emitted
+uint64_t* temporary_holders = (uint64_t*) 0; // number of nodes holding temporaries during code generation
+
+uint64_t* root_node = (uint64_t*) 0; // root of DAG whose code is currently emitted
+
+uint64_t root_temporary = 0; // temporary receiving value of root node
+
+uint64_t number_of_nodes        = 0;
+uint64_t number_of_folded_nodes = 0;
+uint64_t number_of_shared_nodes = 0;
+
 // -----------------------------------------------------------------
 // ---------------------------- MACROS -----------------------------
 // -----------------------------------------------------------------
@@ -784,6 +957,62 @@ void init_bootstrapping() {
   bump_name = string_shrink("_bump  ");
 }
 
+// -----------------------------------------------------------------
+// ----------------------- PEEPHOLE OPTIMIZER ----------------------
+// -----------------------------------------------------------------
+
+uint64_t has_undefined_procedures();
+
+void     count_instruction(uint64_t instruction, uint64_t n);
+uint64_t is_pure_instruction(uint64_t instruction);
+uint64_t reads_register(uint64_t instruction, uint64_t reg);
+uint64_t writes_register(uint64_t instruction, uint64_t reg);
+
+uint64_t is_removed(uint64_t address);
+uint64_t is_branch_target(uint64_t address);
+void     mark_branch_target(uint64_t address);
+void     mark_procedure_entries();
+void     mark_branch_targets(uint64_t from_address);
+uint64_t previous_live_instruction(uint64_t address, uint64_t from_address);
+uint64_t next_live_instruction(uint64_t address);
+uint64_t live_instruction(uint64_t address);
+void     remove_instruction(uint64_t address);
+void     replace_instruction(uint64_t address, uint64_t instruction);
+uint64_t is_dead_temporary(uint64_t reg, uint64_t address);
+
+uint64_t remove_nop(uint64_t address, uint64_t instruction);
+uint64_t remove_dead_write(uint64_t address, uint64_t instruction);
+uint64_t remove_jump_to_next(uint64_t address, uint64_t instruction);
+uint64_t remove_unreachable_code(uint64_t address);
+uint64_t merge_addi(uint64_t address, uint64_t instruction);
+uint64_t remove_dead_store(uint64_t address, uint64_t instruction);
+uint64_t forward_store(uint64_t address, uint64_t instruction);
+uint64_t coalesce_copy(uint64_t address, uint64_t instruction);
+uint64_t optimize_instruction(uint64_t address);
+
+void     restore_procedure_entries(uint64_t from_address);
+uint64_t relocated_address(uint64_t address);
+void     relocate_code(uint64_t from_address);
+
+void peephole_optimize(uint64_t from_address);
+
+uint64_t end_of_procedure(uint64_t address);
+void     mark_live_procedure(uint64_t address, uint64_t from_address);
+
+void eliminate_dead_procedures(uint64_t from_address);
+
+void optimize_code(uint64_t from_address);
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// per instruction: 1 if removed plus 2 if target of branch, jump, or call,
+// overwritten by the code address after removing instructions when relocating
+uint64_t* instruction_flags = (uint64_t*) 0;
+
+uint64_t number_of_dead_procedures      = 0;
+uint64_t number_of_dead_instructions    = 0;
+uint64_t number_of_removed_instructions = 0;
+
 // -----------------------------------------------------------------
 // --------------------------- COMPILER ----------------------------
 // -----------------------------------------------------------------
@@ -810,6 +1039,7 @@ void  print_register_name(uint64_t reg);
 uint64_t is_stack_register(uint64_t reg);
 uint64_t is_system_register(uint64_t reg);
 uint64_t is_argument_register(uint64_t reg);
+uint64_t is_saved_register(uint64_t reg);
 uint64_t is_temporary_register(uint64_t reg);
 
 uint64_t read_register(uint64_t reg);
@@ -821,6 +1051,8 @@ void update_register_counters();
 
 uint64_t NUMBEROFREGISTERS   = 32;
 uint64_t NUMBEROFTEMPORARIES = 7;
+uint64_t NUMBEROFARGUMENTS   = 6; // parameters passed in a0-a5, a6 and a7 are used by switch and ecall
+uint64_t NUMBEROFSAVEDREGISTERS = 11; // local variables held in s1-s11
 
 uint64_t REG_ZR  = 0;
 uint64_t REG_RA  = 1;
@@ -1066,7 +1298,7 @@ void selfie_load();
 // page-aligned ELF header size for storing file header, program header, code size
 uint64_t ELF_HEADER_SIZE = 4096;
 
-uint64_t MAX_CODE_SIZE = 262144; // 256KB
+uint64_t MAX_CODE_SIZE = 524288; // 512KB
 uint64_t MAX_DATA_SIZE = 32768;  // 32KB
 
 uint64_t PK_CODE_START = 65536; // start of code segment at 0x10000 (according to RISC-V pk)
@@ -1152,6 +1384,7 @@ uint64_t  code_size   = 0;             // size of code binary in bytes
 uint64_t* data_binary = (uint64_t*) 0; // data binary
 uint64_t  data_start  = 0;             // start of data segment in virtual memory
 uint64_t  data_size   = 0;             // size of data binary in bytes
+uint64_t  bss_size    = 0;             // size of zero-initialized data above gp, not in binary
 
 uint64_t* code_line_number = (uint64_t*) 0; // code line number per emitted instruction
 uint64_t* data_line_number = (uint64_t*) 0; // data line number per emitted data word
@@ -1175,6 +1408,54 @@ void reset_instruction_counters() {
   ic_ecall = 0;
 }
 
+// -----------------------------------------------------------------
+// ---------------------------- OBJECT -----------------------------
+// -----------------------------------------------------------------
+
+void write_object_bytes(uint64_t fd, uint64_t* buffer, uint64_t bytes);
+void read_object_bytes(uint64_t fd, uint64_t* buffer, uint64_t bytes);
+
+void selfie_output_object(char* filename);
+
+uint64_t selfie_load_object();
+
+// object file:
+// +---+---------+
+// | 0 | magic   | OBJECT_MAGIC
+// | 1 | library | code size of program entry and library
+// | 2 | code    | code size before linking
+// | 3 | data    | data size
+// | 4 | bss     | bss size
+// +---+---------+
+// followed by the code after the library starting at the word boundary
+// at or before the end of the library, the source line numbers of that
+// code, and the global symbols, each followed by its string, up to class 0
+
+// object symbol:
+// +---+---------+
+// | 0 | line#   | source line number
+// | 1 | class   | VARIABLE, BIGINT, STRING, PROCEDURE
+// | 2 | type    | UINT64_T, UINT64STAR_T, VOID_T
+// | 3 | value   | see symbol table entry
+// | 4 | address | see symbol table entry
+// | 5 | inline  | see symbol table entry
+// | 6 | length  | length of string
+// +---+---------+
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t OBJECT_MAGIC = 5350926534889916754; // "RISCUOBJ"
+
+uint64_t OBJECT_HEADER_SIZE = 40; // 5 words
+uint64_t OBJECT_SYMBOL_SIZE = 56; // 7 words
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* object_name = (char*) 0; // file name of object
+
+uint64_t library_code_size = 0; // code size of program entry and library
+uint64_t object_code_size  = 0; // code size of most recent compilation before linking
+
 // -----------------------------------------------------------------
 // ----------------------- MIPSTER SYSCALLS ------------------------
 // -----------------------------------------------------------------
@@ -1196,6 +1477,9 @@ void     emit_malloc();
 uint64_t try_brk(uint64_t* context, uint64_t new_program_break);
 void     implement_brk(uint64_t* context);
 
+void emit_clock_gettime();
+void implement_clock_gettime(uint64_t* context);
+
 uint64_t is_boot_level_zero();
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
@@ -1211,6 +1495,8 @@ uint64_t SYSCALL_WRITE  = 64;
 uint64_t SYSCALL_OPENAT = 56;
 uint64_t SYSCALL_BRK    = 214;
 
+uint64_t SYSCALL_CLOCK_GETTIME = 113;
+
 /* DIRFD_AT_FDCWD corresponds to AT_FDCWD in fcntl.h and
    is passed as first argument of the openat system call
    emulating the (in Linux) deprecated open system call. */
@@ -1449,6 +1735,9 @@ uint64_t mc_brk = 0; // memory counter for brk syscall
 
 uint64_t mc_mapped_heap = 0; // memory counter for mapped heap
 
+uint64_t major_page_faults = 0; // page faults mapping pages of the binary
+uint64_t minor_page_faults = 0; // page faults mapping zeroed pages
+
 // ------------------------- INITIALIZATION ------------------------
 
 void init_memory(uint64_t megabytes) {
@@ -1466,6 +1755,9 @@ void reset_memory_counters() {
   sc_brk = 0;
 
   mc_mapped_heap = 0;
+
+  major_page_faults = 0;
+  minor_page_faults = 0;
 }
 
 // -----------------------------------------------------------------
@@ -1479,9 +1771,12 @@ uint64_t fetch_stack_pointer()     { return 0; } // indicate that gc is unavaila
 uint64_t fetch_global_pointer()    { return 0; }
 uint64_t fetch_data_segment_size() { return 0; }
 
+uint64_t* fetch_saved_registers() { return (uint64_t*) 0; }
+
 // ... here, not available on boot level 0 - only for compilation
 void emit_fetch_stack_pointer();
 void emit_fetch_global_pointer();
+void emit_fetch_saved_registers();
 void emit_fetch_data_segment_size_interface();
 void emit_fetch_data_segment_size_implementation(uint64_t fetch_dss_code_location);
 
@@ -1558,8 +1853,14 @@ uint64_t* get_metadata_if_address_is_valid(uint64_t* context, uint64_t address);
 void mark_object(uint64_t* context, uint64_t address);
 
 void mark_object_selfie(uint64_t* context, uint64_t gc_address);
+
+// interface to marking an object through a pointer in a register using an external collector
+void mark_pointer(uint64_t* context, uint64_t gc_address);
+
 void mark_segment(uint64_t* context, uint64_t segment_start, uint64_t segment_end);
 
+void mark_saved_registers(uint64_t* context);
+
 // this function scans the heap from two roots (data segment and stack) in O(n^2)
 // where n is memory size; checking if a value is a pointer takes O(n), see above
 // improvement: push O(n^2) down to O(n)
@@ -1703,6 +2004,20 @@ void record_ecall();
 void do_ecall();
 void undo_ecall();
 
+void lean_lui();
+void lean_addi();
+void lean_add();
+void lean_sub();
+void lean_mul();
+void lean_divu();
+void lean_remu();
+void lean_sltu();
+void lean_load();
+void lean_store();
+void lean_beq();
+void lean_jal();
+void lean_jalr();
+
 void print_data_line_number();
 void print_data_context(uint64_t data);
 void print_data(uint64_t data);
@@ -1828,6 +2143,7 @@ void execute();
 void execute_record();
 void execute_undo();
 void execute_debug();
+void execute_lean();
 
 void interrupt();
 
@@ -1844,6 +2160,43 @@ void print_register_memory_profile();
 
 void print_profile(uint64_t* context);
 
+// call tree node struct:
+// +---+-----------+
+// | 0 | caller    | pointer to call tree node of calling procedure
+// | 1 | callees   | pointer to first call tree node of called procedures
+// | 2 | next      | pointer to next call tree node called by the same caller
+// | 3 | procedure | address of called procedure
+// | 4 | counter   | number of instructions executed in procedure on this call path
+// +---+-----------+
+
+uint64_t* allocate_call() {
+  return zmalloc(3 * SIZEOFUINT64STAR + 2 * SIZEOFUINT64);
+}
+
+uint64_t* get_call_caller(uint64_t* call)    { return (uint64_t*) *call; }
+uint64_t* get_call_callees(uint64_t* call)   { return (uint64_t*) *(call + 1); }
+uint64_t* get_call_next(uint64_t* call)      { return (uint64_t*) *(call + 2); }
+uint64_t  get_call_procedure(uint64_t* call) { return             *(call + 3); }
+uint64_t  get_call_counter(uint64_t* call)   { return             *(call + 4); }
+
+void set_call_caller(uint64_t* call, uint64_t* caller)       { *call       = (uint64_t) caller; }
+void set_call_callees(uint64_t* call, uint64_t* callees)     { *(call + 1) = (uint64_t) callees; }
+void set_call_next(uint64_t* call, uint64_t* next)           { *(call + 2) = (uint64_t) next; }
+void set_call_procedure(uint64_t* call, uint64_t procedure)  { *(call + 3) = procedure; }
+void set_call_counter(uint64_t* call, uint64_t counter)      { *(call + 4) = counter; }
+
+uint64_t* find_or_create_call(uint64_t* caller, uint64_t procedure);
+
+void call_procedure(uint64_t procedure);
+void return_from_procedure();
+
+void name_procedure(uint64_t* entry);
+void name_procedures();
+
+void print_call_path(uint64_t* call);
+void print_folded_call_stacks(uint64_t* call);
+void print_call_stack_profile();
+
 void print_host_os();
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
@@ -1878,6 +2231,8 @@ uint64_t redo   = 0; // flag for redoing code execution
 
 uint64_t disassemble_verbose = 0; // flag for disassembling code in more detail
 
+uint64_t lean = 0; // flag for executing code without profiling
+
 uint64_t symbolic = 0; // flag for symbolically executing code
 uint64_t model    = 0; // flag for modeling code
 
@@ -1933,6 +2288,15 @@ uint64_t* iterations_per_loop = (uint64_t*) 0; // number of executed iterations
 uint64_t* loads_per_instruction  = (uint64_t*) 0; // number of executed loads per load instruction
 uint64_t* stores_per_instruction = (uint64_t*) 0; // number of executed stores per store instruction
 
+// call stack profile
+
+char* call_stack_profile_name = (char*) 0; // name of output file for folded call stacks
+
+uint64_t* call_tree    = (uint64_t*) 0; // root of call tree, only allocated if call stacks are profiled
+uint64_t* current_call = (uint64_t*) 0; // call tree node of currently executing procedure
+
+uint64_t* procedure_names = (uint64_t*) 0; // names of procedures indexed by code address
+
 // register access counters
 
 uint64_t* reads_per_register  = (uint64_t*) 0;
@@ -1944,6 +2308,9 @@ uint64_t stack_register_writes = 0;
 uint64_t argument_register_reads  = 0;
 uint64_t argument_register_writes = 0;
 
+uint64_t saved_register_reads  = 0;
+uint64_t saved_register_writes = 0;
+
 uint64_t temporary_register_reads  = 0;
 uint64_t temporary_register_writes = 0;
 
@@ -2013,9 +2380,19 @@ void reset_source_profile() {
 
   loads_per_instruction  = zmalloc(code_size / INSTRUCTIONSIZE * SIZEOFUINT64);
   stores_per_instruction = zmalloc(code_size / INSTRUCTIONSIZE * SIZEOFUINT64);
+
+  if (call_stack_profile_name != (char*) 0)
+    // root of call tree represents the code before main is called
+    call_tree = find_or_create_call((uint64_t*) 0, code_start);
+  else
+    call_tree = (uint64_t*) 0;
+
+  current_call = call_tree;
 }
 
 void reset_register_access_counters() {
+  uint64_t reg;
+
   reads_per_register  = zmalloc(NUMBEROFREGISTERS * SIZEOFUINT64);
   writes_per_register = zmalloc(NUMBEROFREGISTERS * SIZEOFUINT64);
 
@@ -2026,10 +2403,23 @@ void reset_register_access_counters() {
   // a6 register is written to by the kernel
   *(writes_per_register + REG_A6) = 1;
 
+  // saved registers are zeroed by boot loader and
+  // saved in prologues before holding local variables
+  reg = 1;
+
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_saved_register(reg))
+      *(writes_per_register + reg) = 1;
+
+    reg = reg + 1;
+  }
+
   stack_register_reads      = 0;
   stack_register_writes     = 0;
   argument_register_reads   = 0;
   argument_register_writes  = 0;
+  saved_register_reads      = 0;
+  saved_register_writes     = 0;
   temporary_register_reads  = 0;
   temporary_register_writes = 0;
 }
@@ -2254,6 +2644,9 @@ void      pfree(uint64_t* frame);
 
 void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data);
 
+void     up_load_page(uint64_t* context, uint64_t page);
+uint64_t is_virtual_address_mapped_on_demand(uint64_t* context, uint64_t vaddr);
+
 void up_load_binary(uint64_t* context);
 
 uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP);
@@ -2265,13 +2658,14 @@ uint64_t handle_division_by_zero(uint64_t* context);
 uint64_t handle_timer(uint64_t* context);
 uint64_t handle_exception(uint64_t* context);
 
+uint64_t* schedule(uint64_t* context);
+
 uint64_t mipster(uint64_t* to_context);
 uint64_t hypster(uint64_t* to_context);
 
 uint64_t mixter(uint64_t* to_context, uint64_t mix);
 
-uint64_t minmob(uint64_t* to_context);
-void     map_unmapped_pages(uint64_t* context);
+uint64_t minmob(uint64_t* to_context, uint64_t page_faults);
 uint64_t minster(uint64_t* to_context);
 uint64_t mobster(uint64_t* to_context);
 
@@ -2320,8 +2714,14 @@ uint64_t MOBSTER = 6;
 
 uint64_t CAPSTER = 7;
 
+uint64_t LIPSTER = 8;
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
+uint64_t demand_paging = 0; // map code and data pages of binaries on first access
+
+uint64_t number_of_contexts = 1; // number of independent contexts running the same binary
+
 uint64_t next_page_frame = 0;
 
 uint64_t allocated_page_frame_memory = 0;
@@ -2360,10 +2760,43 @@ void init_system();
 
 void turn_on_gc_library(uint64_t period, char* name);
 
+uint64_t selfie_options(uint64_t extras);
+
+void     reset_options();
+uint64_t read_job(uint64_t fd);
+uint64_t selfie_serve(char* jobs_name);
+
+void     init_timing(char* name);
+uint64_t read_clock(uint64_t clock_id);
+void     start_timing(uint64_t timing);
+void     stop_timing(uint64_t timing);
+void     selfie_output_timing(uint64_t exit_code);
+
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 char* selfie_name = (char*) 0; // name of running selfie executable
 
+uint64_t MAX_JOB_ARGUMENTS = 64; // maximum number of arguments of a job
+
+// timed phases of selfie and system calls of its guests
+
+uint64_t TIMING_COMPILE     = 0;
+uint64_t TIMING_OUTPUT      = 1;
+uint64_t TIMING_LOAD        = 2;
+uint64_t TIMING_DISASSEMBLE = 3;
+uint64_t TIMING_RUN         = 4;
+uint64_t TIMING_EXIT        = 5;
+uint64_t TIMING_READ        = 6;
+uint64_t TIMING_WRITE       = 7;
+uint64_t TIMING_OPENAT      = 8;
+uint64_t TIMING_BRK         = 9;
+
+uint64_t NUMBEROFTIMINGS = 10;
+
+uint64_t NUMBEROFPHASES = 5; // timings before TIMING_EXIT are phases
+
+uint64_t* TIMINGS; // strings representing timings
+
 // IDs for host operating systems
 
 uint64_t SELFIE    = 0;
@@ -2376,6 +2809,16 @@ uint64_t BAREMETAL = 4;
 
 uint64_t OS = 0; // default host operating system is selfie
 
+char* timing_name = (char*) 0; // name of timing output file
+
+// per timing: number of occurrences, accumulated and most recent
+// start of wall-clock and cpu time in nanoseconds
+uint64_t* timing_counts      = (uint64_t*) 0;
+uint64_t* timing_wall_times  = (uint64_t*) 0;
+uint64_t* timing_cpu_times   = (uint64_t*) 0;
+uint64_t* timing_wall_starts = (uint64_t*) 0;
+uint64_t* timing_cpu_starts  = (uint64_t*) 0;
+
 // ------------------------- INITIALIZATION ------------------------
 
 void init_selfie(uint64_t argc, uint64_t* argv) {
@@ -2431,9 +2874,12 @@ void init_system() {
   } else
     OS = SELFIE;
 
-  if (OS == MACOS)
+  if (OS == MACOS) {
     O_CREAT_TRUNC_WRONLY = MAC_O_CREAT_TRUNC_WRONLY;
-  else if (OS == WINDOWS)
+
+    CLOCK_MONOTONIC          = MAC_CLOCK_MONOTONIC;
+    CLOCK_PROCESS_CPUTIME_ID = MAC_CLOCK_PROCESS_CPUTIME_ID;
+  } else if (OS == WINDOWS)
     O_CREAT_TRUNC_WRONLY = WINDOWS_O_BINARY_CREAT_TRUNC_WRONLY;
   else
     // Linux file opening flags are the default for Linux, selfie, and bare-metal hosts
@@ -3889,6 +4335,7 @@ uint64_t* create_symbol_table_entry(uint64_t which_table, char* string, uint64_t
   set_type(new_entry, type);
   set_value(new_entry, value);
   set_address(new_entry, address);
+  set_inline_length(new_entry, 0);
 
   // create entry at head of list of symbols
   if (which_table == GLOBAL_TABLE) {
@@ -4203,6 +4650,213 @@ void tfree(uint64_t number_of_temporaries) {
   }
 }
 
+uint64_t temporary_register(uint64_t temporary) {
+  // register of the given temporary, counting from 1 as allocated_temporaries
+  if (temporary < 4)
+    return REG_TP + temporary;
+  else
+    return REG_S11 + temporary - 3;
+}
+
+uint64_t temporary_number(uint64_t reg) {
+  // inverse of temporary_register, 0 if reg is not a temporary
+  if (reg >= REG_T0) {
+    if (reg <= REG_T2)
+      return reg - REG_TP;
+    else if (reg >= REG_T3)
+      return reg - REG_S11 + 3;
+  }
+
+  return 0;
+}
+
+uint64_t argument_register(uint64_t parameter) {
+  // register of the given parameter, counting from 0
+  return REG_A0 + parameter;
+}
+
+uint64_t argument_number(uint64_t reg) {
+  // inverse of argument_register, counting from 1, 0 if reg is not an argument register
+  if (is_argument_register(reg))
+    return reg - REG_A0 + 1;
+  else
+    return 0;
+}
+
+uint64_t saved_register(uint64_t local) {
+  // register of the given local variable, counting from 1
+  if (local == 1)
+    return REG_S1;
+  else
+    return REG_S2 + local - 2;
+}
+
+uint64_t saved_register_number(uint64_t reg) {
+  // inverse of saved_register, 0 if reg is not a saved register
+  if (reg == REG_S1)
+    return 1;
+  else if (is_saved_register(reg))
+    return reg - REG_S2 + 2;
+  else
+    return 0;
+}
+
+void allocate_saved_registers() {
+  uint64_t* entry;
+  uint64_t local;
+
+  // C* has no address operator, so local variables are never accessed
+  // through pointers and the first NUMBEROFSAVEDREGISTERS of them are
+  // held in saved registers rather than in their slots in the frame
+
+  saved_register_accesses = (uint64_t*) 0;
+
+  entry = local_symbol_table;
+
+  while (entry != (uint64_t*) 0) {
+    if (signed_less_than(get_address(entry), 0)) {
+      // local variables have negative offsets, parameters positive ones
+      local = -get_address(entry) / WORDSIZE;
+
+      if (local <= NUMBEROFSAVEDREGISTERS)
+        set_scope(entry, saved_register(local));
+    }
+
+    entry = get_next_entry(entry);
+  }
+}
+
+void record_saved_register_access(uint64_t* entry) {
+  uint64_t* access;
+
+  // remember where the access is about to be emitted
+  access = smalloc(SIZEOFUINT64STAR + SIZEOFUINT64);
+
+  *access       = (uint64_t) saved_register_accesses;
+  *(access + 1) = code_size;
+
+  saved_register_accesses = access;
+
+  if (loop_nesting > 0)
+    set_value(entry, get_value(entry) + 1);
+}
+
+uint64_t is_released(uint64_t reg, uint64_t released) {
+  uint64_t local;
+
+  local = saved_register_number(reg);
+
+  if (local != 0)
+    return released / two_to_the_power_of(local) % 2;
+  else
+    return 0;
+}
+
+uint64_t release_saved_registers(uint64_t prologue, uint64_t body) {
+  uint64_t* entry;
+  uint64_t released;
+  uint64_t* access;
+  uint64_t from_address;
+  uint64_t to_address;
+  uint64_t saved_code_size;
+
+  // saving and restoring a saved register only pays off for local
+  // variables accessed in loops, all other local variables are moved
+  // back into their slots in the frame by turning their recorded
+  // register accesses into memory accesses, instruction by instruction
+  // to preserve all branch offsets; returns the procedure address
+
+  entry = local_symbol_table;
+
+  released = 0;
+
+  while (entry != (uint64_t*) 0) {
+    if (is_saved_register(get_scope(entry))) {
+      if (get_value(entry) == 0) {
+        released = released + two_to_the_power_of(saved_register_number(get_scope(entry)));
+
+        set_scope(entry, REG_S0);
+      }
+    }
+
+    entry = get_next_entry(entry);
+  }
+
+  if (released == 0)
+    return prologue;
+
+  saved_code_size = code_size;
+
+  // no need to save released registers in prologue
+  from_address = prologue;
+
+  while (from_address < body) {
+    ir = load_instruction(from_address);
+
+    if (get_opcode(ir) == OP_STORE)
+      if (is_released(get_rs2(ir), released)) {
+        code_size = from_address;
+
+        emit_nop();
+
+        ic_store = ic_store - 1;
+      }
+
+    from_address = from_address + INSTRUCTIONSIZE;
+  }
+
+  access = saved_register_accesses;
+
+  while (access != (uint64_t*) 0) {
+    ir = load_instruction(*(access + 1));
+
+    code_size = *(access + 1);
+
+    if (is_released(get_rs1(ir), released)) {
+      emit_load(get_rd(ir), REG_S0, -(saved_register_number(get_rs1(ir)) * WORDSIZE));
+
+      ic_addi = ic_addi - 1;
+    } else if (is_released(get_rd(ir), released)) {
+      emit_store(REG_S0, -(saved_register_number(get_rd(ir)) * WORDSIZE), get_rs1(ir));
+
+      ic_addi = ic_addi - 1;
+    }
+
+    access = (uint64_t*) *access;
+  }
+
+  code_size = saved_code_size;
+
+  // the prologue contains no nops other than the ones just
+  // created and is moved down to the body over them, leaving
+  // the nops at the original procedure address which remains
+  // the target of recursive calls already emitted in the body
+  from_address = body;
+  to_address   = body;
+
+  while (from_address > prologue) {
+    from_address = from_address - INSTRUCTIONSIZE;
+
+    ir = load_instruction(from_address);
+
+    if (ir != encode_nop()) {
+      to_address = to_address - INSTRUCTIONSIZE;
+
+      store_instruction(to_address, ir);
+    }
+  }
+
+  from_address = to_address;
+
+  while (from_address > prologue) {
+    from_address = from_address - INSTRUCTIONSIZE;
+
+    store_instruction(from_address, encode_nop());
+  }
+
+  return to_address;
+}
+
 void save_temporaries() {
   while (allocated_temporaries > 0) {
     // push temporary onto stack
@@ -4223,6 +4877,34 @@ void restore_temporaries(uint64_t number_of_temporaries) {
   }
 }
 
+void save_arguments() {
+  // actual parameters already passed in argument registers
+  // must survive calls in subsequent actual parameters
+  if (allocated_arguments > 0) {
+    emit_addi(REG_SP, REG_SP, -(allocated_arguments * WORDSIZE));
+
+    while (allocated_arguments > 0) {
+      allocated_arguments = allocated_arguments - 1;
+
+      // push argument register onto stack
+      emit_store(REG_SP, allocated_arguments * WORDSIZE, argument_register(allocated_arguments));
+    }
+  }
+}
+
+void restore_arguments(uint64_t number_of_arguments) {
+  if (number_of_arguments > 0) {
+    while (allocated_arguments < number_of_arguments) {
+      // restore argument register from stack
+      emit_load(argument_register(allocated_arguments), REG_SP, allocated_arguments * WORDSIZE);
+
+      allocated_arguments = allocated_arguments + 1;
+    }
+
+    emit_addi(REG_SP, REG_SP, number_of_arguments * WORDSIZE);
+  }
+}
+
 void syntax_error_symbol(uint64_t expected) {
   print_line_number("syntax error", line_number);
   print_symbol(expected);
@@ -4320,23 +5002,11 @@ uint64_t* get_variable_or_big_int(char* variable_or_big_int, uint64_t class) {
 }
 
 void load_upper_base_address(uint64_t* entry) {
-  uint64_t lower;
-  uint64_t upper;
-
   // assert: n = allocated_temporaries
 
-  lower = get_bits(get_address(entry),  0, 12);
-  upper = get_bits(get_address(entry), 12, 20);
-
-  if (lower >= two_to_the_power_of(11))
-    // add 1 which is effectively 2^12 to cancel sign extension of lower
-    upper = upper + 1;
-
   talloc();
 
-  // calculate upper part of base address relative to global or frame pointer
-  emit_lui(current_temporary(), sign_extend(upper, 20));
-  emit_add(current_temporary(), get_scope(entry), current_temporary());
+  emit_upper_base_address(current_temporary(), entry);
 
   // assert: allocated_temporaries == n + 1
 }
@@ -4351,7 +5021,14 @@ uint64_t load_variable_or_big_int(char* variable_or_big_int, uint64_t class) {
 
   offset = get_address(entry);
 
-  if (is_signed_integer(offset, 12)) {
+  if (is_saved_register(get_scope(entry))) {
+    record_saved_register_access(entry);
+
+    talloc();
+
+    // local variable held in saved register
+    emit_addi(current_temporary(), get_scope(entry), 0);
+  } else if (is_signed_integer(offset, 12)) {
     talloc();
 
     emit_load(current_temporary(), get_scope(entry), offset);
@@ -4394,11 +5071,9 @@ void load_integer(uint64_t value) {
   // assert: allocated_temporaries == n + 1
 }
 
-void load_string(char* string) {
+uint64_t allocate_string(char* string) {
   uint64_t length;
 
-  // assert: n = allocated_temporaries
-
   length = string_length(string) + 1;
 
   // allocate memory for string in data segment
@@ -4406,7 +5081,14 @@ void load_string(char* string) {
 
   create_symbol_table_entry(GLOBAL_TABLE, string, line_number, STRING, UINT64STAR_T, 0, -data_size);
 
-  load_integer(-data_size);
+  // offset of string relative to global pointer
+  return -data_size;
+}
+
+void load_string(char* string) {
+  // assert: n = allocated_temporaries
+
+  load_integer(allocate_string(string));
 
   emit_add(current_temporary(), REG_GP, current_temporary());
 
@@ -4416,6 +5098,9 @@ void load_string(char* string) {
 uint64_t procedure_call(uint64_t* entry, char* procedure, uint64_t number_of_parameters) {
   uint64_t type;
 
+  // procedures calling other procedures need a frame
+  leaf_procedure = 0;
+
   if (entry == (uint64_t*) 0) {
     // procedure never called nor declared nor defined
 
@@ -4449,15 +5134,411 @@ uint64_t procedure_call(uint64_t* entry, char* procedure, uint64_t number_of_par
   return type;
 }
 
-void procedure_prologue(uint64_t number_of_local_variable_bytes) {
-  // allocate memory for return address
-  emit_addi(REG_SP, REG_SP, -WORDSIZE);
+uint64_t is_constant_offset(uint64_t address) {
+  uint64_t offset;
+  uint64_t scale;
+  uint64_t ra;
+  uint64_t rb;
+
+  // checks if code at address adds a constant offset to a pointer,
+  // that is, addi ra,zero,offset; addi rb,zero,scale; mul ra,ra,rb;
+  // add rd,rd,ra, and if so leaves rd and the scaled offset in imm
 
-  // save return address
-  emit_store(REG_SP, 0, REG_RA);
+  ir = load_instruction(address);
+
+  // avoid decoding most instructions
+  if (get_opcode(ir) != OP_IMM)
+    return 0;
+  else if (get_rs1(ir) != REG_ZR)
+    return 0;
+
+  decode();
+
+  if (is != ADDI)
+    return 0;
+  else if (rs1 != REG_ZR)
+    return 0;
+  else if (temporary_number(rd) == 0)
+    return 0;
+
+  ra     = rd;
+  offset = imm;
+
+  ir = load_instruction(address + INSTRUCTIONSIZE);
+
+  decode();
+
+  if (is != ADDI)
+    return 0;
+  else if (rs1 != REG_ZR)
+    return 0;
+  else if (temporary_number(rd) == 0)
+    return 0;
+
+  rb    = rd;
+  scale = imm;
+
+  ir = load_instruction(address + 2 * INSTRUCTIONSIZE);
+
+  decode();
+
+  if (is != MUL)
+    return 0;
+  else if (rd != ra)
+    return 0;
+  else if (rs1 != ra)
+    return 0;
+  else if (rs2 != rb)
+    return 0;
+
+  ir = load_instruction(address + 3 * INSTRUCTIONSIZE);
+
+  decode();
+
+  if (is != ADD)
+    return 0;
+  else if (rs1 != rd)
+    return 0;
+  else if (rs2 != ra)
+    return 0;
+  else if (temporary_number(rd) == 0)
+    return 0;
+  else if (is_signed_integer(offset * scale, 12) == 0)
+    return 0;
+
+  imm = offset * scale;
+
+  return 1;
+}
+
+uint64_t inline_length(uint64_t* entry) {
+  uint64_t address;
+  uint64_t number_of_parameters;
+  uint64_t number_of_temporaries;
+  uint64_t loaded_parameters;
+  uint64_t parameter;
+  uint64_t length;
+  uint64_t size;
+
+  // procedures are only inlined if already defined as leaf procedures
+  // with a body of at most MAX_INLINE_LENGTH instructions that reads
+  // each of its parameters at most once, accesses memory only through
+  // temporaries and global variables, and either returns a value at
+  // the end or nothing; returns the number of instructions of the body,
+  // or 0 if the procedure is not inlined
+
+  if (entry == (uint64_t*) 0)
+    return 0;
+  else if (get_address(entry) == 0)
+    // procedure declared but never called nor defined
+    return 0;
+  else if (get_opcode(load_instruction(get_address(entry))) == OP_JAL)
+    // procedure called and possibly declared but not defined
+    return 0;
+
+  number_of_parameters = get_value(entry);
+
+  if (signed_less_than(number_of_parameters, 0))
+    // variadic procedure
+    return 0;
+  else if (number_of_parameters >= NUMBEROFTEMPORARIES)
+    return 0;
+
+  // leaf procedures have no prologue, procedures with a frame
+  // start by allocating it which is rejected below
+  address = get_address(entry);
+
+  number_of_temporaries = 0;
+  loaded_parameters     = 0;
+
+  length = 0;
+
+  // number of instructions emitted at call sites
+  size = 0;
+
+  while (length <= MAX_INLINE_LENGTH) {
+    if (address >= code_size)
+      // procedure is still being compiled
+      return 0;
+
+    ir = load_instruction(address);
+
+    decode();
+
+    if (is == JAL) {
+      // only a return statement right before the epilogue
+      if (rd != REG_ZR)
+        return 0;
+      else if (imm == 2 * INSTRUCTIONSIZE) {
+        // skipping the return value of missing return expressions
+        ir = load_instruction(address + INSTRUCTIONSIZE);
+
+        decode();
+
+        if (is != ADDI)
+          return 0;
+        else if (rd != REG_A0)
+          return 0;
+        else if (rs1 != REG_ZR)
+          return 0;
+      } else if (imm != INSTRUCTIONSIZE)
+        return 0;
+
+      ir = load_instruction(address + imm);
+
+      decode();
+
+      if (is != JALR)
+        return 0;
+    }
+
+    if (is == JALR) {
+      // epilogue of leaf procedures reached, parameters and temporaries
+      // used in the body must fit into temporaries at call sites, and
+      // inlined bodies must not be larger than the calls they replace
+      // to keep branches within range
+      if (rd != REG_ZR)
+        return 0;
+      else if (rs1 != REG_RA)
+        return 0;
+      else if (number_of_parameters + number_of_temporaries > NUMBEROFTEMPORARIES)
+        return 0;
+      else if (size > number_of_parameters + 1)
+        return 0;
+      else
+        return length;
+    }
+
+    if (is_constant_offset(address)) {
+      // folded into a single addi at call sites
+
+      if (number_of_temporaries < temporary_number(rd))
+        number_of_temporaries = temporary_number(rd);
+
+      address = address + 4 * INSTRUCTIONSIZE;
+
+      length = length + 4;
+      size   = size + 1;
+    } else {
+      ir = load_instruction(address);
+
+      decode();
+
+      if (is == LOAD) {
+        if (temporary_number(rs1) == 0)
+          if (rs1 != REG_GP)
+            return 0;
+      } else if (is == STORE) {
+        if (temporary_number(rs1) == 0)
+          if (rs1 != REG_GP)
+            return 0;
+
+        if (temporary_number(rs2) == 0)
+          return 0;
+      } else if (is == ADDI) {
+        if (rd == REG_A0) {
+          // only saving return value right before returning
+          if (temporary_number(rs1) == 0)
+            return 0;
+          else if (imm != 0)
+            return 0;
+          else if (get_opcode(load_instruction(address + INSTRUCTIONSIZE)) != OP_JAL)
+            // assigning the first parameter
+            return 0;
+        } else if (argument_number(rs1) != 0) {
+          // only reading parameters from argument registers
+          if (imm != 0)
+            return 0;
+
+          parameter = argument_number(rs1) - 1;
+
+          if (parameter >= number_of_parameters)
+            return 0;
+          else if (loaded_parameters / two_to_the_power_of(parameter) % 2 != 0)
+            // parameters are read from their actual parameter registers
+            // which may only be overwritten once read for the last time
+            return 0;
+
+          loaded_parameters = loaded_parameters + two_to_the_power_of(parameter);
+
+          // no instruction emitted at call sites
+          size = size - 1;
+        } else if (temporary_number(rs1) == 0)
+          if (rs1 != REG_ZR)
+            if (rs1 != REG_GP)
+              return 0;
+      } else if (is == LUI) {
+        // rd is checked below
+      } else if (is == BEQ)
+        return 0;
+      else if (is == JAL)
+        return 0;
+      else if (is == ECALL)
+        return 0;
+      else if (temporary_number(rs1) == 0)
+        // add, sub, mul, divu, remu, sltu
+        return 0;
+      else if (temporary_number(rs2) == 0)
+        return 0;
+
+      if (is != STORE)
+        if (rd != REG_A0)
+          if (temporary_number(rd) == 0)
+            return 0;
+
+      if (number_of_temporaries < temporary_number(rd))
+        number_of_temporaries = temporary_number(rd);
+      if (number_of_temporaries < temporary_number(rs1))
+        number_of_temporaries = temporary_number(rs1);
+      if (number_of_temporaries < temporary_number(rs2))
+        number_of_temporaries = temporary_number(rs2);
+
+      address = address + INSTRUCTIONSIZE;
+
+      length = length + 1;
+      size   = size + 1;
+    }
+  }
+
+  return 0;
+}
+
+uint64_t inline_register(uint64_t reg) {
+  // temporaries of inlined bodies are mapped to temporaries at call sites
+  if (temporary_number(reg) != 0)
+    return *(inline_temporaries + temporary_number(reg) - 1);
+  else
+    return reg;
+}
+
+void inline_definition(uint64_t reg, uint64_t number_of_parameters) {
+  // temporaries newly defined in inlined bodies follow the actual parameters
+  if (temporary_number(reg) != 0)
+    *(inline_temporaries + temporary_number(reg) - 1) =
+      temporary_register(temporary_number(reg) + number_of_parameters);
+}
+
+uint64_t inline_call(uint64_t* entry, uint64_t number_of_parameters, uint64_t length, uint64_t result) {
+  uint64_t address;
+  uint64_t temporary;
+
+  // assert: allocated_temporaries == number_of_parameters
+
+  // missing actual parameters are 0
+  while (number_of_parameters < get_value(entry)) {
+    talloc();
+
+    emit_addi(current_temporary(), REG_ZR, 0);
+
+    number_of_parameters = number_of_parameters + 1;
+  }
+
+  // assert: allocated_temporaries == get_value(entry)
+
+  if (inline_temporaries == (uint64_t*) 0)
+    inline_temporaries = smalloc(NUMBEROFTEMPORARIES * WORDSIZE);
+
+  temporary = 1;
+
+  while (temporary <= NUMBEROFTEMPORARIES) {
+    inline_definition(temporary_register(temporary), number_of_parameters);
 
-  // allocate memory for caller's frame pointer
-  emit_addi(REG_SP, REG_SP, -WORDSIZE);
+    temporary = temporary + 1;
+  }
+
+  address = get_address(entry);
+
+  while (length > 0) {
+    if (is_constant_offset(address)) {
+      emit_addi(inline_register(rd), inline_register(rd), imm);
+
+      address = address + 4 * INSTRUCTIONSIZE;
+
+      length = length - 4;
+    } else {
+      ir = load_instruction(address);
+
+      decode();
+
+      if (is != STORE)
+        if (rd != rs1)
+          if (rd != rs2)
+            // rd is newly defined rather than updated in place
+            inline_definition(rd, number_of_parameters);
+
+      if (is == ADDI) {
+        if (rd == REG_A0)
+          // return value goes directly into result register
+          emit_addi(result, inline_register(rs1), 0);
+        else if (argument_number(rs1) != 0)
+          // use actual parameter instead of copying it
+          *(inline_temporaries + temporary_number(rd) - 1) =
+            temporary_register(argument_number(rs1));
+        else
+          emit_addi(inline_register(rd), inline_register(rs1), imm);
+      } else if (is == LOAD)
+        emit_load(inline_register(rd), inline_register(rs1), imm);
+      else if (is == STORE)
+        emit_store(inline_register(rs1), imm, inline_register(rs2));
+      else if (is == LUI)
+        emit_lui(inline_register(rd), imm);
+      else if (is == ADD)
+        emit_add(inline_register(rd), inline_register(rs1), inline_register(rs2));
+      else if (is == SUB)
+        emit_sub(inline_register(rd), inline_register(rs1), inline_register(rs2));
+      else if (is == MUL)
+        emit_mul(inline_register(rd), inline_register(rs1), inline_register(rs2));
+      else if (is == DIVU)
+        emit_divu(inline_register(rd), inline_register(rs1), inline_register(rs2));
+      else if (is == REMU)
+        emit_remu(inline_register(rd), inline_register(rs1), inline_register(rs2));
+      else if (is == SLTU)
+        emit_sltu(inline_register(rd), inline_register(rs1), inline_register(rs2));
+
+      address = address + INSTRUCTIONSIZE;
+
+      length = length - 1;
+    }
+  }
+
+  tfree(number_of_parameters);
+
+  number_of_inlined_calls = number_of_inlined_calls + 1;
+
+  // return type is grammar attribute
+  return get_type(entry);
+}
+
+uint64_t number_of_register_parameters(uint64_t number_of_parameters) {
+  if (signed_less_than(number_of_parameters, 0))
+    // all parameters of variadic procedures are passed on the stack
+    return 0;
+  else if (number_of_parameters < NUMBEROFARGUMENTS)
+    return number_of_parameters;
+  else
+    return NUMBEROFARGUMENTS;
+}
+
+void procedure_prologue(uint64_t number_of_local_variable_bytes, uint64_t number_of_register_parameters) {
+  uint64_t parameter;
+  uint64_t* entry;
+
+  // allocate memory for caller's frame pointer, return address,
+  // and parameters passed in argument registers
+  emit_addi(REG_SP, REG_SP, -((2 + number_of_register_parameters) * WORDSIZE));
+
+  // save parameters passed in argument registers right below
+  // parameters passed on the stack, if any
+  parameter = 0;
+
+  while (parameter < number_of_register_parameters) {
+    emit_store(REG_SP, (2 + parameter) * WORDSIZE, argument_register(parameter));
+
+    parameter = parameter + 1;
+  }
+
+  // save return address
+  emit_store(REG_SP, WORDSIZE, REG_RA);
 
   // save caller's frame pointer
   emit_store(REG_SP, 0, REG_S0);
@@ -4477,33 +5558,90 @@ void procedure_prologue(uint64_t number_of_local_variable_bytes) {
       tfree(1);
     }
   }
+
+  // save caller's saved registers in the slots of
+  // the local variables held in them instead
+  entry = local_symbol_table;
+
+  while (entry != (uint64_t*) 0) {
+    if (is_saved_register(get_scope(entry)))
+      emit_store(REG_S0, get_address(entry), get_scope(entry));
+
+    entry = get_next_entry(entry);
+  }
 }
 
 void procedure_epilogue(uint64_t number_of_parameter_bytes) {
+  uint64_t* entry;
+
+  // restore caller's saved registers
+  entry = local_symbol_table;
+
+  while (entry != (uint64_t*) 0) {
+    if (is_saved_register(get_scope(entry)))
+      emit_load(get_scope(entry), REG_S0, get_address(entry));
+
+    entry = get_next_entry(entry);
+  }
+
   // deallocate memory for callee's frame pointer and local variables
   emit_addi(REG_SP, REG_S0, 0);
 
   // restore caller's frame pointer
   emit_load(REG_S0, REG_SP, 0);
 
-  // deallocate memory for caller's frame pointer
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
   // restore return address
-  emit_load(REG_RA, REG_SP, 0);
+  emit_load(REG_RA, REG_SP, WORDSIZE);
 
-  // deallocate memory for return address and (non-variadic) actual parameters
-  emit_addi(REG_SP, REG_SP, WORDSIZE + number_of_parameter_bytes);
+  // deallocate memory for caller's frame pointer, return address, and (non-variadic) parameters
+  emit_addi(REG_SP, REG_SP, 2 * WORDSIZE + number_of_parameter_bytes);
 
   // return
   emit_jalr(REG_ZR, REG_RA, 0);
 }
 
+void elide_frame(uint64_t from_address) {
+  // leaf procedures without local variables and with parameters
+  // passed in argument registers only do not need a frame: the
+  // body compiled for accessing parameters in the frame is turned
+  // into accessing parameters in argument registers directly,
+  // instruction by instruction to preserve all branch offsets
+  while (from_address < code_size) {
+    ir = load_instruction(from_address);
+
+    decode();
+
+    if (is == LOAD) {
+      if (rs1 == REG_S0) {
+        // parameter access, no local variables
+        store_instruction(from_address,
+          encode_i_format(0, argument_register((imm - 2 * WORDSIZE) / WORDSIZE), F3_ADDI, rd, OP_IMM));
+
+        ic_load = ic_load - 1;
+        ic_addi = ic_addi + 1;
+      }
+    } else if (is == STORE) {
+      if (rs1 == REG_S0) {
+        store_instruction(from_address,
+          encode_i_format(0, rs2, F3_ADDI, argument_register((imm - 2 * WORDSIZE) / WORDSIZE), OP_IMM));
+
+        ic_store = ic_store - 1;
+        ic_addi  = ic_addi + 1;
+      }
+    }
+
+    from_address = from_address + INSTRUCTIONSIZE;
+  }
+}
+
 uint64_t compile_macro(uint64_t* entry) {
   char* name;
 
   name = get_string(entry);
 
+  // return value of macro, if any, goes into current temporary
+  talloc();
+
   if (string_compare(name, "var_start"))
     macro_var_start();
   else if (string_compare(name, "var_arg"))
@@ -4514,13 +5652,75 @@ uint64_t compile_macro(uint64_t* entry) {
   return get_type(entry);
 }
 
+uint64_t pass_parameter(uint64_t* entry, uint64_t parameter, uint64_t length, uint64_t allocate_memory_on_stack) {
+  // passes actual parameter in current temporary to callee, returns
+  // address of instruction allocating memory on stack for parameters
+  // not passed in argument registers, or 0 if there is none yet
+
+  if (length != 0) {
+    if (parameter >= get_value(entry))
+      // inlined body ignores excess parameters
+      tfree(1);
+
+    return 0;
+  }
+
+  if (entry != (uint64_t*) 0)
+    if (signed_less_than(get_value(entry), 0)) {
+      // all parameters of variadic procedures are passed on the stack
+      if (parameter == 0) {
+        // allocate memory on stack for actual parameters
+        allocate_memory_on_stack = code_size;
+
+        // we do not yet know how many, fixup later
+        emit_addi(REG_SP, REG_SP, 0);
+      }
+
+      emit_store(REG_SP, parameter * WORDSIZE, current_temporary());
+
+      tfree(1);
+
+      return allocate_memory_on_stack;
+    }
+
+  if (parameter < NUMBEROFARGUMENTS) {
+    emit_addi(argument_register(parameter), current_temporary(), 0);
+
+    tfree(1);
+
+    allocated_arguments = allocated_arguments + 1;
+
+    return 0;
+  }
+
+  if (parameter == NUMBEROFARGUMENTS) {
+    // allocate memory on stack for remaining actual parameters
+    allocate_memory_on_stack = code_size;
+
+    // we do not yet know how many, fixup later
+    emit_addi(REG_SP, REG_SP, 0);
+  }
+
+  emit_store(REG_SP, (parameter - NUMBEROFARGUMENTS) * WORDSIZE, current_temporary());
+
+  tfree(1);
+
+  return allocate_memory_on_stack;
+}
+
 uint64_t compile_call(char* procedure) {
   uint64_t* entry;
+  uint64_t length;
   uint64_t number_of_temporaries;
+  uint64_t number_of_arguments;
   uint64_t number_of_parameters;
   uint64_t allocate_memory_on_stack;
   uint64_t type;
 
+  if (optimize)
+    // calls and macros have side effects
+    emit_temporaries();
+
   entry = search_symbol_table(library_symbol_table, procedure, MACRO);
 
   if (entry != (uint64_t*) 0)
@@ -4529,79 +5729,117 @@ uint64_t compile_call(char* procedure) {
 
   entry = get_scoped_symbol_table_entry(procedure, PROCEDURE);
 
-  // assert: n = allocated_temporaries
+  // trivial procedures already defined are inlined rather than called,
+  // procedures not yet defined are always called
+  if (entry != (uint64_t*) 0)
+    length = get_inline_length(entry);
+  else
+    length = 0;
+
+  // assert: n = allocated_temporaries, m = allocated_arguments
 
   number_of_temporaries = allocated_temporaries;
+  number_of_arguments   = allocated_arguments;
+
+  if (number_of_temporaries == NUMBEROFTEMPORARIES) {
+    // no temporary left for return value
+    syntax_error_message("out of registers");
+
+    exit(EXITCODE_COMPILERERROR);
+  }
 
   save_temporaries();
 
+  if (length == 0)
+    // inlined bodies do not use argument registers
+    save_arguments();
+
   // assert: allocated_temporaries == 0
 
   number_of_parameters = 0;
 
+  allocate_memory_on_stack = 0;
+
   if (is_expression()) {
     compile_expression();
 
     // TODO: check if types/number of parameters is correct
 
-    // allocate memory on stack for actual parameters
-    allocate_memory_on_stack = code_size;
-
-    // we do not yet know how many, fixup later
-    emit_addi(REG_SP, REG_SP, 0);
-
-    // push first parameter onto stack
-    emit_store(REG_SP, number_of_parameters * WORDSIZE, current_temporary());
-
-    tfree(1);
+    allocate_memory_on_stack = pass_parameter(entry, 0, length, allocate_memory_on_stack);
 
-    number_of_parameters = number_of_parameters + 1;
+    number_of_parameters = 1;
 
     while (symbol == SYM_COMMA) {
       get_symbol();
 
       compile_expression();
 
-      // push next parameter onto stack
-      emit_store(REG_SP, number_of_parameters * WORDSIZE, current_temporary());
-
-      tfree(1);
+      allocate_memory_on_stack = pass_parameter(entry, number_of_parameters, length, allocate_memory_on_stack);
 
       number_of_parameters = number_of_parameters + 1;
     }
 
-    // now we know the number of actual parameters
-    fixup_IFormat(allocate_memory_on_stack, -(number_of_parameters * WORDSIZE));
+    if (allocate_memory_on_stack != 0) {
+      // now we know the number of actual parameters passed on the stack
+      if (signed_less_than(get_value(entry), 0))
+        fixup_IFormat(allocate_memory_on_stack, -(number_of_parameters * WORDSIZE));
+      else
+        fixup_IFormat(allocate_memory_on_stack, -((number_of_parameters - NUMBEROFARGUMENTS) * WORDSIZE));
+    }
+
+    if (length != 0)
+      if (number_of_parameters > get_value(entry))
+        number_of_parameters = get_value(entry);
 
     if (symbol == SYM_RPARENTHESIS) {
       get_symbol();
 
-      type = procedure_call(entry, procedure, number_of_parameters);
+      if (length == 0)
+        type = procedure_call(entry, procedure, number_of_parameters);
+      else
+        type = inline_call(entry, number_of_parameters, length, temporary_register(number_of_temporaries + 1));
     } else {
       syntax_error_symbol(SYM_RPARENTHESIS);
 
+      tfree(allocated_temporaries);
+
       type = UINT64_T;
     }
   } else if (symbol == SYM_RPARENTHESIS) {
     get_symbol();
 
-    type = procedure_call(entry, procedure, 0);
+    if (length == 0)
+      type = procedure_call(entry, procedure, 0);
+    else
+      type = inline_call(entry, 0, length, temporary_register(number_of_temporaries + 1));
   } else {
     syntax_error_symbol(SYM_RPARENTHESIS);
 
     type = UINT64_T;
   }
 
-  if (entry != (uint64_t*) 0)
-    if (signed_less_than(get_value(entry), 0))
-      // deallocate variadic parameters
-      emit_addi(REG_SP, REG_SP, (number_of_parameters + get_value(entry)) * WORDSIZE);
+  if (length == 0) {
+    if (entry != (uint64_t*) 0)
+      if (signed_less_than(get_value(entry), 0))
+        // deallocate variadic parameters
+        emit_addi(REG_SP, REG_SP, (number_of_parameters + get_value(entry)) * WORDSIZE);
 
-  // assert: allocated_temporaries == 0
+    // argument registers are consumed by the call
+    allocated_arguments = 0;
+
+    // return value goes into temporary right above saved temporaries
+    emit_addi(temporary_register(number_of_temporaries + 1), REG_A0, 0);
+
+    restore_arguments(number_of_arguments);
+  }
+
+  // assert: allocated_temporaries == 0, allocated_arguments == m
 
   restore_temporaries(number_of_temporaries);
 
-  // assert: allocated_temporaries == n
+  talloc();
+
+  // assert: allocated_temporaries == n + 1
 
   number_of_calls = number_of_calls + 1;
 
@@ -4616,6 +5854,7 @@ uint64_t compile_factor() {
   uint64_t negative;
   uint64_t dereference;
   char* variable_or_procedure_name;
+  uint64_t* entry;
 
   // assert: n = allocated_temporaries
 
@@ -4645,7 +5884,7 @@ uint64_t compile_factor() {
 
     // not a cast: "(" expression ")"
     } else {
-      type = compile_expression();
+      type = compile_comparison();
 
       if (symbol == SYM_RPARENTHESIS)
         get_symbol();
@@ -4656,9 +5895,12 @@ uint64_t compile_factor() {
 
       return type;
     }
-  } else
+  } else {
     has_cast = 0;
 
+    cast = 0;
+  }
+
   // optional: -
   if (symbol == SYM_MINUS) {
     negative = 1;
@@ -4689,23 +5931,29 @@ uint64_t compile_factor() {
       get_symbol();
 
       // procedure call: identifier "(" ... ")"
+      // return value is in current temporary
       type = compile_call(variable_or_procedure_name);
+    } else if (optimize) {
+      // variable access: identifier
+      entry = get_variable_or_big_int(variable_or_procedure_name, VARIABLE);
 
       talloc();
 
-      // retrieve return value
-      emit_addi(current_temporary(), REG_A0, 0);
+      set_temporary_node(allocated_temporaries, variable_node(entry));
 
-      // reset return register to initial return value
-      // for missing return expressions
-      emit_addi(REG_A0, REG_ZR, 0);
+      type = get_type(entry);
     } else
       // variable access: identifier
       type = load_variable_or_big_int(variable_or_procedure_name, VARIABLE);
 
   // integer literal?
   } else if (symbol == SYM_INTEGER) {
-    load_integer(literal);
+    if (optimize) {
+      talloc();
+
+      set_temporary_node(allocated_temporaries, constant_node(literal));
+    } else
+      load_integer(literal);
 
     get_symbol();
 
@@ -4715,7 +5963,10 @@ uint64_t compile_factor() {
   } else if (symbol == SYM_CHARACTER) {
     talloc();
 
-    emit_addi(current_temporary(), REG_ZR, literal);
+    if (optimize)
+      set_temporary_node(allocated_temporaries, constant_node(literal));
+    else
+      emit_addi(current_temporary(), REG_ZR, literal);
 
     get_symbol();
 
@@ -4723,7 +5974,12 @@ uint64_t compile_factor() {
 
   // string literal?
   } else if (symbol == SYM_STRING) {
-    load_string(string);
+    if (optimize) {
+      talloc();
+
+      set_temporary_node(allocated_temporaries, string_node(allocate_string(string)));
+    } else
+      load_string(string);
 
     get_symbol();
 
@@ -4733,7 +5989,7 @@ uint64_t compile_factor() {
   } else if (symbol == SYM_LPARENTHESIS) {
     get_symbol();
 
-    type = compile_expression();
+    type = compile_comparison();
 
     if (symbol == SYM_RPARENTHESIS)
       get_symbol();
@@ -4750,7 +6006,11 @@ uint64_t compile_factor() {
       type_warning(UINT64STAR_T, type);
 
     // dereference
-    emit_load(current_temporary(), current_temporary(), 0);
+    if (optimize)
+      set_temporary_node(allocated_temporaries,
+        operator_node(NODE_LOAD, get_temporary_node(allocated_temporaries), (uint64_t*) 0));
+    else
+      emit_load(current_temporary(), current_temporary(), 0);
 
     type = UINT64_T;
   }
@@ -4762,7 +6022,11 @@ uint64_t compile_factor() {
       type = UINT64_T;
     }
 
-    emit_sub(current_temporary(), REG_ZR, current_temporary());
+    if (optimize)
+      set_temporary_node(allocated_temporaries,
+        operator_node(NODE_SUB, constant_node(0), get_temporary_node(allocated_temporaries)));
+    else
+      emit_sub(current_temporary(), REG_ZR, current_temporary());
   }
 
   // assert: allocated_temporaries == n + 1
@@ -4799,7 +6063,14 @@ uint64_t compile_term() {
     if (ltype != rtype)
       type_warning(ltype, rtype);
 
-    if (operator_symbol == SYM_ASTERISK)
+    if (optimize) {
+      if (operator_symbol == SYM_ASTERISK)
+        reduce_temporaries(NODE_MUL);
+      else if (operator_symbol == SYM_DIVISION)
+        reduce_temporaries(NODE_DIVU);
+      else if (operator_symbol == SYM_REMAINDER)
+        reduce_temporaries(NODE_REMU);
+    } else if (operator_symbol == SYM_ASTERISK)
       emit_mul(previous_temporary(), previous_temporary(), current_temporary());
     else if (operator_symbol == SYM_DIVISION)
       emit_divu(previous_temporary(), previous_temporary(), current_temporary());
@@ -4838,42 +6109,64 @@ uint64_t compile_simple_expression() {
 
     if (operator_symbol == SYM_PLUS) {
       if (ltype == UINT64STAR_T) {
-        if (rtype == UINT64_T)
+        if (rtype == UINT64_T) {
           // UINT64STAR_T + UINT64_T
           // pointer arithmetic: left_term + right_term * SIZEOFUINT64
-          emit_multiply_by(current_temporary(), SIZEOFUINT64);
-        else
+          if (optimize)
+            scale_temporary(allocated_temporaries, SIZEOFUINT64);
+          else
+            emit_multiply_by(current_temporary(), SIZEOFUINT64);
+        } else
           // UINT64STAR_T + UINT64STAR_T
           syntax_error_message("(uint64_t*) + (uint64_t*) is undefined");
       } else if (rtype == UINT64STAR_T) {
         // UINT64_T + UINT64STAR_T
         // pointer arithmetic: left_term * SIZEOFUINT64 + right_term
-        emit_multiply_by(previous_temporary(), SIZEOFUINT64);
+        if (optimize)
+          scale_temporary(allocated_temporaries - 1, SIZEOFUINT64);
+        else
+          emit_multiply_by(previous_temporary(), SIZEOFUINT64);
 
         ltype = UINT64STAR_T;
       }
 
-      emit_add(previous_temporary(), previous_temporary(), current_temporary());
+      if (optimize)
+        reduce_temporaries(NODE_ADD);
+      else
+        emit_add(previous_temporary(), previous_temporary(), current_temporary());
 
     } else if (operator_symbol == SYM_MINUS) {
       if (ltype == UINT64STAR_T) {
         if (rtype == UINT64_T) {
           // UINT64STAR_T - UINT64_T
           // pointer arithmetic: left_term - right_term * SIZEOFUINT64
-          emit_multiply_by(current_temporary(), SIZEOFUINT64);
-          emit_sub(previous_temporary(), previous_temporary(), current_temporary());
+          if (optimize) {
+            scale_temporary(allocated_temporaries, SIZEOFUINT64);
+            reduce_temporaries(NODE_SUB);
+          } else {
+            emit_multiply_by(current_temporary(), SIZEOFUINT64);
+            emit_sub(previous_temporary(), previous_temporary(), current_temporary());
+          }
         } else {
           // UINT64STAR_T - UINT64STAR_T
           // pointer arithmetic: (left_term - right_term) / SIZEOFUINT64
-          emit_sub(previous_temporary(), previous_temporary(), current_temporary());
-          emit_addi(current_temporary(), REG_ZR, SIZEOFUINT64);
-          emit_divu(previous_temporary(), previous_temporary(), current_temporary());
+          if (optimize) {
+            reduce_temporaries(NODE_SUB);
+            set_temporary_node(allocated_temporaries - 1,
+              operator_node(NODE_DIVU, get_temporary_node(allocated_temporaries - 1), constant_node(SIZEOFUINT64)));
+          } else {
+            emit_sub(previous_temporary(), previous_temporary(), current_temporary());
+            emit_addi(current_temporary(), REG_ZR, SIZEOFUINT64);
+            emit_divu(previous_temporary(), previous_temporary(), current_temporary());
+          }
 
           ltype = UINT64_T;
         }
       } else if (rtype == UINT64STAR_T)
         // UINT64_T - UINT64STAR_T
         syntax_error_message("(uint64_t) - (uint64_t*) is undefined");
+      else if (optimize)
+        reduce_temporaries(NODE_SUB);
       else
         // UINT64_T - UINT64_T
         emit_sub(previous_temporary(), previous_temporary(), current_temporary());
@@ -4888,10 +6181,12 @@ uint64_t compile_simple_expression() {
   return ltype;
 }
 
-uint64_t compile_expression() {
+uint64_t compile_comparison() {
   uint64_t ltype;
   uint64_t operator_symbol;
   uint64_t rtype;
+  uint64_t* left;
+  uint64_t* right;
 
   // assert: n = allocated_temporaries
 
@@ -4915,7 +6210,36 @@ uint64_t compile_expression() {
     // for lack of boolean type
     ltype = UINT64_T;
 
-    if (operator_symbol == SYM_EQUALITY) {
+    if (optimize) {
+      left  = get_temporary_node(allocated_temporaries - 1);
+      right = get_temporary_node(allocated_temporaries);
+
+      set_temporary_node(allocated_temporaries, (uint64_t*) 0);
+
+      tfree(1);
+
+      if (operator_symbol == SYM_EQUALITY)
+        // a == b iff unsigned a - b < 1
+        left = operator_node(NODE_SLTU, operator_node(NODE_SUB, left, right), constant_node(1));
+      else if (operator_symbol == SYM_NOTEQ)
+        // a != b iff unsigned 0 < a - b
+        left = operator_node(NODE_SLTU, constant_node(0), operator_node(NODE_SUB, left, right));
+      else if (operator_symbol == SYM_LT)
+        // a < b
+        left = operator_node(NODE_SLTU, left, right);
+      else if (operator_symbol == SYM_GT)
+        // a > b iff b < a
+        left = operator_node(NODE_SLTU, right, left);
+      else if (operator_symbol == SYM_LEQ)
+        // a <= b iff 1 - (b < a)
+        left = operator_node(NODE_SUB, constant_node(1), operator_node(NODE_SLTU, right, left));
+      else if (operator_symbol == SYM_GEQ)
+        // a >= b iff 1 - (a < b)
+        left = operator_node(NODE_SUB, constant_node(1), operator_node(NODE_SLTU, left, right));
+
+      set_temporary_node(allocated_temporaries, left);
+
+    } else if (operator_symbol == SYM_EQUALITY) {
       // a == b iff unsigned b - a < 1
       emit_sub(previous_temporary(), current_temporary(), previous_temporary());
       emit_addi(current_temporary(), REG_ZR, 1);
@@ -4967,6 +6291,22 @@ uint64_t compile_expression() {
   return ltype;
 }
 
+uint64_t compile_expression() {
+  uint64_t type;
+
+  // assert: n = allocated_temporaries
+
+  type = compile_comparison();
+
+  if (optimize)
+    // value of expression is needed in current temporary
+    emit_temporaries();
+
+  // assert: allocated_temporaries == n + 1
+
+  return type;
+}
+
 void compile_while() {
   uint64_t jump_back_to_while;
   uint64_t branch_forward_to_end;
@@ -4977,6 +6317,8 @@ void compile_while() {
 
   branch_forward_to_end = 0;
 
+  loop_nesting = loop_nesting + 1;
+
   // while ( expression )
   if (symbol == SYM_WHILE) {
     get_symbol();
@@ -5030,6 +6372,8 @@ void compile_while() {
     // now we have the address for the conditional branch from above
     fixup_relative_BFormat(branch_forward_to_end);
 
+  loop_nesting = loop_nesting - 1;
+
   // assert: allocated_temporaries == 0
 
   number_of_while = number_of_while + 1;
@@ -5148,9 +6492,13 @@ void compile_return() {
     emit_addi(REG_A0, current_temporary(), 0);
 
     tfree(1);
-  } else if (return_type != VOID_T)
+  } else if (return_type != VOID_T) {
     type_warning(return_type, VOID_T);
 
+    // missing return expression returns 0
+    emit_addi(REG_A0, REG_ZR, 0);
+  }
+
   // jump to procedure epilogue through fixup chain using absolute address
   emit_jal(REG_ZR, return_branches);
 
@@ -5248,9 +6596,8 @@ void compile_statement() {
 
       compile_call(variable_or_procedure_name);
 
-      // reset return register to initial return value
-      // for missing return expressions
-      emit_addi(REG_A0, REG_ZR, 0);
+      // discard return value
+      tfree(1);
 
       if (symbol == SYM_SEMICOLON)
         get_symbol();
@@ -5272,7 +6619,14 @@ void compile_statement() {
 
       offset = get_address(entry);
 
-      if (is_signed_integer(offset, 12)) {
+      if (is_saved_register(get_scope(entry))) {
+        record_saved_register_access(entry);
+
+        // local variable held in saved register
+        emit_addi(get_scope(entry), current_temporary(), 0);
+
+        tfree(1);
+      } else if (is_signed_integer(offset, 12)) {
         emit_store(get_scope(entry), offset, current_temporary());
 
         tfree(1);
@@ -5429,11 +6783,32 @@ uint64_t compile_initialization(uint64_t type) {
   return initial_value;
 }
 
+uint64_t allocate_global_variable(uint64_t initial_value) {
+  // the gc library only scans the data segment below gp, see gc_init
+  if (GC_ON == 0)
+    if (initial_value == 0) {
+      // zero-initialized global variables are allocated in the bss
+      // segment above gp which occupies memory but no space in binaries
+      bss_size = bss_size + WORDSIZE;
+
+      return bss_size - WORDSIZE;
+    }
+
+  // allocate memory for global variable in data segment below gp
+  data_size = data_size + WORDSIZE;
+
+  return -data_size;
+}
+
 void compile_procedure(char* procedure, uint64_t type) {
   uint64_t is_variadic;
   uint64_t number_of_parameters;
   uint64_t* entry;
   uint64_t number_of_local_variable_bytes;
+  uint64_t is_defined;
+  uint64_t calls;
+  uint64_t prologue;
+  uint64_t body;
 
   local_symbol_table = (uint64_t*) 0;
 
@@ -5501,6 +6876,15 @@ void compile_procedure(char* procedure, uint64_t type) {
     // procedure already called but neither declared nor defined
     set_type(entry, type);
 
+  if (is_variadic)
+    if (signed_less_than(get_value(entry), 0) == 0)
+      if (get_address(entry) != 0) {
+        // actual parameters already passed in argument registers
+        syntax_error_message("variadic procedure called before declared");
+
+        exit(EXITCODE_COMPILERERROR);
+      }
+
   if (symbol == SYM_SEMICOLON) {
     // this is a procedure declaration
 
@@ -5514,7 +6898,12 @@ void compile_procedure(char* procedure, uint64_t type) {
   } else if (symbol == SYM_LBRACE) {
     // this is a procedure definition
 
+    // procedures already called but not defined are linked at the end
+    calls = 0;
+
     if (is_undefined_procedure(entry)) {
+      is_defined = 1;
+
       set_line_number(entry, line_number);
 
       if (get_type(entry) != type) {
@@ -5527,7 +6916,7 @@ void compile_procedure(char* procedure, uint64_t type) {
 
       if (get_address(entry) != 0)
         // procedure already called but not defined
-        fixlink_relative(get_address(entry), code_size);
+        calls = get_address(entry);
 
       set_address(entry, code_size);
 
@@ -5539,6 +6928,8 @@ void compile_procedure(char* procedure, uint64_t type) {
         number_of_calls = number_of_calls + 1;
       }
     } else {
+      is_defined = 0;
+
       // procedure already defined
       print_line_number("warning", line_number);
       printf("redefinition of procedure %s ignored\n", procedure);
@@ -5562,7 +6953,18 @@ void compile_procedure(char* procedure, uint64_t type) {
         syntax_error_symbol(SYM_SEMICOLON);
     }
 
-    procedure_prologue(number_of_local_variable_bytes);
+    if (is_variadic == 0)
+      // var_start and var_arg access local variables in the frame
+      allocate_saved_registers();
+
+    prologue = code_size;
+
+    procedure_prologue(number_of_local_variable_bytes, number_of_register_parameters(number_of_parameters));
+
+    body = code_size;
+
+    // until a call is compiled in the body
+    leaf_procedure = 1;
 
     // macros require access to current procedure
     current_procedure = entry;
@@ -5579,14 +6981,48 @@ void compile_procedure(char* procedure, uint64_t type) {
     return_type = 0;
 
     if (symbol == SYM_RBRACE) {
+      if (type != VOID_T)
+        // missing return statement returns 0
+        emit_addi(REG_A0, REG_ZR, 0);
+
       fixlink_relative(return_branches, code_size);
 
       return_branches = 0;
 
-      if (is_variadic)
-        procedure_epilogue(-number_of_parameters * WORDSIZE);
-      else
-        procedure_epilogue(number_of_parameters * WORDSIZE);
+      if (number_of_local_variable_bytes > 0)
+        leaf_procedure = 0;
+      else if (is_variadic)
+        leaf_procedure = 0;
+      else if (number_of_parameters > NUMBEROFARGUMENTS)
+        leaf_procedure = 0;
+      else if (get_opcode(load_instruction(body)) == OP_JAL)
+        // jal at entry would mark procedure as not yet defined
+        leaf_procedure = 0;
+
+      if (leaf_procedure) {
+        // frame is not needed, leaving prologue as dead code
+        elide_frame(body);
+
+        emit_jalr(REG_ZR, REG_RA, 0);
+      } else {
+        prologue = release_saved_registers(prologue, body);
+
+        if (is_variadic)
+          procedure_epilogue(-number_of_parameters * WORDSIZE);
+        else
+          procedure_epilogue(number_of_parameters * WORDSIZE);
+
+        body = prologue;
+      }
+
+      if (is_defined) {
+        if (calls != 0)
+          fixlink_relative(calls, body);
+
+        set_address(entry, body);
+
+        set_inline_length(entry, inline_length(entry));
+      }
 
       get_symbol();
     } else {
@@ -5671,12 +7107,10 @@ void compile_cstar() {
 
           entry = search_global_symbol_table(variable_or_procedure_name, VARIABLE);
 
-          if (entry == (uint64_t*) 0) {
-            // allocate memory for global variable in data segment
-            data_size = data_size + WORDSIZE;
-
-            create_symbol_table_entry(GLOBAL_TABLE, variable_or_procedure_name, current_line_number, VARIABLE, type, initial_value, -data_size);
-          } else {
+          if (entry == (uint64_t*) 0)
+            create_symbol_table_entry(GLOBAL_TABLE, variable_or_procedure_name, current_line_number, VARIABLE, type, initial_value,
+              allocate_global_variable(initial_value));
+          else {
             // global variable already declared or defined
             print_line_number("warning", current_line_number);
             printf("redefinition of global variable %s ignored\n", variable_or_procedure_name);
@@ -5689,280 +7123,1620 @@ void compile_cstar() {
 }
 
 // -----------------------------------------------------------------
-// ---------------------------- MACROS -----------------------------
+// ------------------------ EXPRESSION DAG -------------------------
 // -----------------------------------------------------------------
 
-void macro_var_start() {
-  uint64_t* var_list_variable;
-  uint64_t s0_offset;
+void reset_expression_dag() {
+  expression_nodes = (uint64_t*) 0;
 
-  var_list_variable = (uint64_t*) 0;
-  s0_offset         = 0;
+  temporary_nodes   = zmalloc((NUMBEROFTEMPORARIES + 1) * SIZEOFUINT64STAR);
+  temporary_holders = zmalloc((NUMBEROFTEMPORARIES + 1) * SIZEOFUINT64);
 
-  if (signed_less_than(get_value(current_procedure), 0) == 0)
-    syntax_error_message("'var_start' used in procedure with non-variadic parameters");
+  number_of_nodes        = 0;
+  number_of_folded_nodes = 0;
+  number_of_shared_nodes = 0;
+}
 
-  if (symbol == SYM_IDENTIFIER) {
-    var_list_variable = search_symbol_table(local_symbol_table, identifier, VARIABLE);
+uint64_t* create_node(uint64_t op, uint64_t* left, uint64_t* right, uint64_t value) {
+  uint64_t* node;
 
-    if (var_list_variable != (uint64_t*) 0) {
-      get_symbol();
+  node = allocate_dag_node();
 
-      if (symbol == SYM_RPARENTHESIS) {
-        get_symbol();
+  set_next_node(node, expression_nodes);
+  set_node_op(node, op);
+  set_left_node(node, left);
+  set_right_node(node, right);
+  set_node_value(node, value);
+  set_node_register(node, 0);
+  set_node_uses(node, 0);
 
-        // skip the return address, frame pointer and non-variadic parameters
-        s0_offset = 2 * WORDSIZE - get_value(current_procedure) * WORDSIZE;
+  expression_nodes = node;
 
-        load_integer(s0_offset);
+  number_of_nodes = number_of_nodes + 1;
 
-        // address of first variadic parameter is S0 + 2 * WORDSIZE + #non-variadic parameters * WORDSIZE
-        emit_add(current_temporary(), current_temporary(), REG_S0);
+  return node;
+}
 
-        // store address in variable passed as macro argument
-        emit_store(REG_S0, get_address(var_list_variable), current_temporary());
+uint64_t* search_node(uint64_t op, uint64_t* left, uint64_t* right, uint64_t value) {
+  uint64_t* node;
 
-        tfree(1);
+  // expressions are free of side effects between calls,
+  // so equal nodes of the same expression have equal values
+  node = expression_nodes;
+
+  while (node != (uint64_t*) 0) {
+    if (get_node_op(node) == op)
+      if (get_left_node(node) == left)
+        if (get_right_node(node) == right)
+          if (get_node_value(node) == value)
+            return node;
+
+    node = get_next_node(node);
+  }
+
+  return create_node(op, left, right, value);
+}
+
+uint64_t is_constant_node(uint64_t* node, uint64_t value) {
+  if (get_node_op(node) == NODE_CONSTANT)
+    if (get_node_value(node) == value)
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_immediate_node(uint64_t* node) {
+  if (get_node_op(node) == NODE_CONSTANT)
+    return is_signed_integer(get_node_value(node), 12);
+  else
+    return 0;
+}
+
+uint64_t* constant_node(uint64_t value) {
+  return search_node(NODE_CONSTANT, (uint64_t*) 0, (uint64_t*) 0, value);
+}
+
+uint64_t* variable_node(uint64_t* entry) {
+  uint64_t n;
+  uint64_t* node;
+
+  n = number_of_nodes;
+
+  node = search_node(NODE_VARIABLE, (uint64_t*) 0, (uint64_t*) 0, (uint64_t) entry);
+
+  if (n == number_of_nodes)
+    // variable is loaded only once
+    number_of_shared_nodes = number_of_shared_nodes + 1;
+
+  return node;
+}
+
+uint64_t* string_node(uint64_t offset) {
+  // every string literal has its own offset
+  return create_node(NODE_STRING, (uint64_t*) 0, (uint64_t*) 0, offset);
+}
+
+uint64_t* register_node(uint64_t reg) {
+  uint64_t* node;
+
+  // registers are reused for different values,
+  // so register nodes are never shared
+  node = create_node(NODE_REGISTER, (uint64_t*) 0, (uint64_t*) 0, reg);
+
+  set_node_register(node, reg);
+
+  return node;
+}
+
+uint64_t* operator_node(uint64_t op, uint64_t* left, uint64_t* right) {
+  uint64_t n;
+  uint64_t* node;
+
+  node = fold_node(op, left, right);
+
+  if (node != (uint64_t*) 0) {
+    number_of_folded_nodes = number_of_folded_nodes + 1;
+
+    return node;
+  }
+
+  n = number_of_nodes;
+
+  node = search_node(op, left, right, 0);
+
+  if (n == number_of_nodes)
+    // common subexpression is computed only once
+    number_of_shared_nodes = number_of_shared_nodes + 1;
+
+  return node;
+}
+
+uint64_t* fold_node(uint64_t op, uint64_t* left, uint64_t* right) {
+  uint64_t l;
+  uint64_t r;
+
+  // returns equivalent node by constant folding and
+  // algebraic simplification, or 0 if there is none
+
+  if (op == NODE_LOAD)
+    return (uint64_t*) 0;
+
+  if (get_node_op(left) == NODE_CONSTANT)
+    if (get_node_op(right) == NODE_CONSTANT) {
+      l = get_node_value(left);
+      r = get_node_value(right);
+
+      if (op == NODE_ADD)
+        return constant_node(l + r);
+      else if (op == NODE_SUB)
+        return constant_node(l - r);
+      else if (op == NODE_MUL)
+        return constant_node(l * r);
+      else if (op == NODE_SLTU)
+        return constant_node(l < r);
+      else if (r != 0) {
+        // division by zero is left to runtime
+        if (op == NODE_DIVU)
+          return constant_node(l / r);
+        else if (op == NODE_REMU)
+          return constant_node(l % r);
       }
-    } else {
-      syntax_error_undeclared_identifier(identifier);
 
-      get_symbol();
+      return (uint64_t*) 0;
     }
-  } else
-    syntax_error_symbol(SYM_IDENTIFIER);
+
+  if (op == NODE_ADD) {
+    if (get_node_op(left) == NODE_CONSTANT)
+      // constants go right
+      return operator_node(NODE_ADD, right, left);
+    else if (is_constant_node(right, 0))
+      // x + 0 == x
+      return left;
+    else if (get_node_op(right) == NODE_CONSTANT)
+      if (get_node_op(left) == NODE_ADD)
+        if (get_node_op(get_right_node(left)) == NODE_CONSTANT)
+          // (x + c1) + c2 == x + (c1 + c2)
+          return operator_node(NODE_ADD, get_left_node(left),
+            constant_node(get_node_value(get_right_node(left)) + get_node_value(right)));
+  } else if (op == NODE_SUB) {
+    if (left == right)
+      // x - x == 0
+      return constant_node(0);
+    else if (get_node_op(right) == NODE_CONSTANT)
+      // x - c == x + -c
+      return operator_node(NODE_ADD, left, constant_node(-get_node_value(right)));
+  } else if (op == NODE_MUL) {
+    if (get_node_op(left) == NODE_CONSTANT)
+      // constants go right
+      return operator_node(NODE_MUL, right, left);
+    else if (is_constant_node(right, 0))
+      // x * 0 == 0
+      return right;
+    else if (is_constant_node(right, 1))
+      // x * 1 == x
+      return left;
+    else if (get_node_op(right) == NODE_CONSTANT)
+      if (get_node_op(left) == NODE_MUL)
+        if (get_node_op(get_right_node(left)) == NODE_CONSTANT)
+          // (x * c1) * c2 == x * (c1 * c2)
+          return operator_node(NODE_MUL, get_left_node(left),
+            constant_node(get_node_value(get_right_node(left)) * get_node_value(right)));
+  } else if (op == NODE_DIVU) {
+    if (is_constant_node(right, 1))
+      // x / 1 == x
+      return left;
+  } else if (op == NODE_REMU) {
+    if (is_constant_node(right, 1))
+      // x % 1 == 0
+      return constant_node(0);
+  } else if (op == NODE_SLTU) {
+    if (left == right)
+      // x < x == 0
+      return constant_node(0);
+    else if (is_constant_node(right, 0))
+      // x < 0 == 0
+      return constant_node(0);
+  }
+
+  return (uint64_t*) 0;
 }
 
-void macro_var_arg() {
-  uint64_t* var_list_variable;
-  uint64_t  var_list_address;
+uint64_t* get_temporary_node(uint64_t temporary) {
+  uint64_t* node;
 
-  var_list_variable = (uint64_t*) 0;
-  var_list_address  = 0;
+  node = (uint64_t*) *(temporary_nodes + temporary);
 
-  if (symbol == SYM_IDENTIFIER) {
-    var_list_variable = search_symbol_table(local_symbol_table, identifier, VARIABLE);
+  if (node != (uint64_t*) 0)
+    return node;
+  else
+    // code for value of temporary has already been emitted
+    return register_node(temporary_register(temporary));
+}
 
-    if (var_list_variable != (uint64_t*) 0) {
-      get_symbol();
+void set_temporary_node(uint64_t temporary, uint64_t* node) {
+  *(temporary_nodes + temporary) = (uint64_t) node;
+}
 
-      if (symbol == SYM_RPARENTHESIS) {
-        get_symbol();
+void reduce_temporaries(uint64_t op) {
+  // previous temporary = previous temporary op current temporary
+  set_temporary_node(allocated_temporaries - 1,
+    operator_node(op, get_temporary_node(allocated_temporaries - 1), get_temporary_node(allocated_temporaries)));
 
-        var_list_address = get_address(var_list_variable);
+  set_temporary_node(allocated_temporaries, (uint64_t*) 0);
+}
 
-        talloc();
+void scale_temporary(uint64_t temporary, uint64_t m) {
+  set_temporary_node(temporary, operator_node(NODE_MUL, get_temporary_node(temporary), constant_node(m)));
+}
 
-        // load variadic parameter from memory address pointed to
-        // by variable passed as macro argument (var_list_variable)
-        emit_load(current_temporary(), REG_S0, var_list_address);
+void count_node_uses(uint64_t* node) {
+  set_node_uses(node, get_node_uses(node) + 1);
 
-        // store variadic parameter as return value of macro
-        emit_load(REG_A0, current_temporary(), 0);
+  if (get_node_uses(node) == 1) {
+    if (get_node_op(node) == NODE_REGISTER)
+      hold_node_registers(node);
+    else if (get_left_node(node) != (uint64_t*) 0) {
+      count_node_uses(get_left_node(node));
 
-        // increment var_list_variable pointer by one parameter size (=WORDSIZE)
-        emit_addi(current_temporary(), current_temporary(), WORDSIZE);
+      if (get_right_node(node) != (uint64_t*) 0)
+        count_node_uses(get_right_node(node));
+    }
+  }
+}
 
-        // store incremented address in variable passed as macro argument
-        emit_store(REG_S0, var_list_address, current_temporary());
+void hold_node_registers(uint64_t* node) {
+  uint64_t temporary;
 
-        tfree(1);
-      } else
-        syntax_error_symbol(SYM_RPARENTHESIS);
-    } else {
-      syntax_error_undeclared_identifier(identifier);
+  if (get_node_op(node) == NODE_REGISTER) {
+    temporary = temporary_number(get_node_value(node));
 
-      get_symbol();
-    }
-  } else
-    syntax_error_symbol(SYM_IDENTIFIER);
+    *(temporary_holders + temporary) = *(temporary_holders + temporary) + 1;
+  } else if (get_left_node(node) != (uint64_t*) 0) {
+    hold_node_registers(get_left_node(node));
+
+    if (get_right_node(node) != (uint64_t*) 0)
+      hold_node_registers(get_right_node(node));
+  }
 }
 
-// implementation of va_start, va_arg, and va_end is platform-specific;
-// RISC-V va_end does nothing and is only implemented for parity with standard C
-void macro_var_end() {
-  if (signed_less_than(get_value(current_procedure), 0) == 0)
-    syntax_error_message("'var_end' used in procedure with non-variadic parameters");
+uint64_t allocate_node_register(uint64_t* node) {
+  uint64_t temporary;
 
-  if (symbol == SYM_IDENTIFIER) {
-    get_symbol();
+  // value of root node goes into its temporary if possible
+  if (node == root_node)
+    if (*(temporary_holders + root_temporary) == 0) {
+      *(temporary_holders + root_temporary) = 1;
 
-    if (symbol == SYM_RPARENTHESIS)
-      get_symbol();
-    else
-      syntax_error_symbol(SYM_RPARENTHESIS);
-  } else
-    syntax_error_symbol(SYM_IDENTIFIER);
+      return temporary_register(root_temporary);
+    }
+
+  temporary = 1;
+
+  while (temporary <= NUMBEROFTEMPORARIES) {
+    if (*(temporary_holders + temporary) == 0) {
+      *(temporary_holders + temporary) = 1;
+
+      return temporary_register(temporary);
+    }
+
+    temporary = temporary + 1;
+  }
+
+  syntax_error_message("out of registers");
+
+  exit(EXITCODE_COMPILERERROR);
 }
 
-// -----------------------------------------------------------------
-// ------------------------ MACHINE CODE LIBRARY -------------------
-// -----------------------------------------------------------------
+void release_node(uint64_t* node) {
+  uint64_t temporary;
 
-void emit_round_up(uint64_t reg, uint64_t m) {
-  talloc();
+  set_node_uses(node, get_node_uses(node) - 1);
 
-  // computes value(reg) + m - 1 - (value(reg) + m - 1) % m
-  emit_addi(reg, reg, m - 1);
-  emit_addi(current_temporary(), REG_ZR, m);
-  emit_remu(current_temporary(), reg, current_temporary());
-  emit_sub(reg, reg, current_temporary());
+  if (get_node_uses(node) == 0) {
+    temporary = temporary_number(get_node_register(node));
 
-  tfree(1);
+    if (temporary != 0)
+      *(temporary_holders + temporary) = *(temporary_holders + temporary) - 1;
+
+    if (get_node_op(node) != NODE_REGISTER)
+      set_node_register(node, 0);
+  }
 }
 
-void emit_multiply_by(uint64_t reg, uint64_t m) {
-  // assert: there is a 0 <= b < 11 such that m == 2^b
+void emit_upper_base_address(uint64_t reg, uint64_t* entry) {
+  uint64_t lower;
+  uint64_t upper;
+
+  lower = get_bits(get_address(entry),  0, 12);
+  upper = get_bits(get_address(entry), 12, 20);
+
+  if (lower >= two_to_the_power_of(11))
+    // add 1 which is effectively 2^12 to cancel sign extension of lower
+    upper = upper + 1;
+
+  // calculate upper part of base address relative to global or frame pointer
+  emit_lui(reg, sign_extend(upper, 20));
+  emit_add(reg, get_scope(entry), reg);
+}
+
+void emit_variable(uint64_t reg, uint64_t* entry) {
+  uint64_t offset;
+
+  offset = get_address(entry);
+
+  if (is_saved_register(get_scope(entry))) {
+    record_saved_register_access(entry);
+
+    // local variable held in saved register
+    emit_addi(reg, get_scope(entry), 0);
+  } else if (is_signed_integer(offset, 12))
+    emit_load(reg, get_scope(entry), offset);
+  else {
+    emit_upper_base_address(reg, entry);
+
+    emit_load(reg, reg, sign_extend(get_bits(offset, 0, 12), 12));
+  }
+}
+
+void emit_constant(uint64_t reg, uint64_t value) {
+  char* big_int;
+  uint64_t* entry;
+
+  if (is_signed_integer(value, 32))
+    load_small_and_medium_integer(reg, value);
+  else {
+    // folded big integers have no literal, so big integers
+    // are named by their decimal representation instead
+    big_int = itoa(value, string_alloc(MAX_INTEGER_LENGTH), 10, 0, 0);
+
+    entry = search_global_symbol_table(big_int, BIGINT);
+
+    if (entry == (uint64_t*) 0) {
+      // allocate memory for big integer in data segment
+      data_size = data_size + WORDSIZE;
+
+      entry = create_symbol_table_entry(GLOBAL_TABLE, big_int, line_number, BIGINT, UINT64_T, value, -data_size);
+    }
+
+    emit_variable(reg, entry);
+  }
+}
+
+uint64_t emit_node(uint64_t* node) {
+  uint64_t op;
+  uint64_t* left;
+  uint64_t* right;
+  uint64_t left_register;
+  uint64_t right_register;
+  uint64_t offset;
+  uint64_t reg;
+
+  // returns register holding value of node which is
+  // computed only once no matter how often it is used
+
+  if (get_node_register(node) != 0)
+    return get_node_register(node);
+
+  op    = get_node_op(node);
+  left  = get_left_node(node);
+  right = get_right_node(node);
+
+  if (op == NODE_CONSTANT) {
+    if (get_node_value(node) == 0)
+      reg = REG_ZR;
+    else {
+      reg = allocate_node_register(node);
+
+      emit_constant(reg, get_node_value(node));
+    }
+  } else if (op == NODE_VARIABLE) {
+    reg = allocate_node_register(node);
+
+    emit_variable(reg, (uint64_t*) get_node_value(node));
+  } else if (op == NODE_STRING) {
+    reg = allocate_node_register(node);
+
+    if (is_signed_integer(get_node_value(node), 12))
+      emit_addi(reg, REG_GP, get_node_value(node));
+    else {
+      load_small_and_medium_integer(reg, get_node_value(node));
+
+      emit_add(reg, REG_GP, reg);
+    }
+  } else if (op == NODE_LOAD) {
+    offset = 0;
+
+    if (get_node_op(left) == NODE_ADD)
+      if (get_node_uses(left) == 1)
+        if (is_immediate_node(get_right_node(left))) {
+          // address x + c is computed by the load itself
+          offset = get_node_value(get_right_node(left));
+
+          release_node(get_right_node(left));
+          release_node(left);
+
+          left = get_left_node(left);
+        }
+
+    left_register = emit_node(left);
+
+    release_node(left);
+
+    reg = allocate_node_register(node);
+
+    emit_load(reg, left_register, offset);
+  } else if (op == NODE_ADD) {
+    if (is_immediate_node(right)) {
+      left_register = emit_node(left);
+
+      release_node(left);
+      release_node(right);
+
+      reg = allocate_node_register(node);
+
+      emit_addi(reg, left_register, get_node_value(right));
+    } else {
+      left_register  = emit_node(left);
+      right_register = emit_node(right);
+
+      release_node(left);
+      release_node(right);
+
+      reg = allocate_node_register(node);
+
+      emit_add(reg, left_register, right_register);
+    }
+  } else {
+    left_register  = emit_node(left);
+    right_register = emit_node(right);
+
+    release_node(left);
+    release_node(right);
+
+    reg = allocate_node_register(node);
+
+    if (op == NODE_SUB)
+      emit_sub(reg, left_register, right_register);
+    else if (op == NODE_MUL)
+      emit_mul(reg, left_register, right_register);
+    else if (op == NODE_DIVU)
+      emit_divu(reg, left_register, right_register);
+    else if (op == NODE_REMU)
+      emit_remu(reg, left_register, right_register);
+    else if (op == NODE_SLTU)
+      emit_sltu(reg, left_register, right_register);
+  }
+
+  set_node_register(node, reg);
+
+  return reg;
+}
+
+void emit_temporary(uint64_t temporary) {
+  uint64_t* node;
+  uint64_t reg;
+  uint64_t t;
+
+  node = (uint64_t*) *(temporary_nodes + temporary);
+
+  if (node == (uint64_t*) 0)
+    // code for value of temporary has already been emitted
+    return;
+
+  // registers of all other temporaries are held
+  t = 1;
+
+  while (t <= NUMBEROFTEMPORARIES) {
+    if (t == temporary)
+      *(temporary_holders + t) = 0;
+    else if (t > allocated_temporaries)
+      *(temporary_holders + t) = 0;
+    else if (*(temporary_nodes + t) == 0)
+      *(temporary_holders + t) = 1;
+    else
+      *(temporary_holders + t) = 0;
+
+    t = t + 1;
+  }
+
+  t = 1;
+
+  while (t <= allocated_temporaries) {
+    if (t != temporary)
+      if (*(temporary_nodes + t) != 0)
+        hold_node_registers((uint64_t*) *(temporary_nodes + t));
+
+    t = t + 1;
+  }
+
+  count_node_uses(node);
+
+  root_node      = node;
+  root_temporary = temporary;
+
+  reg = emit_node(node);
+
+  if (reg != temporary_register(temporary))
+    emit_addi(temporary_register(temporary), reg, 0);
+
+  release_node(node);
+
+  root_node = (uint64_t*) 0;
+
+  set_temporary_node(temporary, (uint64_t*) 0);
+}
+
+void emit_temporaries() {
+  uint64_t temporary;
+
+  // emit code for values of all temporaries
+  temporary = 1;
+
+  while (temporary <= allocated_temporaries) {
+    emit_temporary(temporary);
+
+    temporary = temporary + 1;
+  }
+
+  // nodes are not shared across side effects
+  expression_nodes = (uint64_t*) 0;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- MACROS -----------------------------
+// -----------------------------------------------------------------
+
+void macro_var_start() {
+  uint64_t* var_list_variable;
+  uint64_t s0_offset;
+
+  var_list_variable = (uint64_t*) 0;
+  s0_offset         = 0;
+
+  if (signed_less_than(get_value(current_procedure), 0) == 0)
+    syntax_error_message("'var_start' used in procedure with non-variadic parameters");
+
+  if (symbol == SYM_IDENTIFIER) {
+    var_list_variable = search_symbol_table(local_symbol_table, identifier, VARIABLE);
+
+    if (var_list_variable != (uint64_t*) 0) {
+      get_symbol();
+
+      if (symbol == SYM_RPARENTHESIS) {
+        get_symbol();
+
+        // skip the return address, frame pointer and non-variadic parameters
+        s0_offset = 2 * WORDSIZE - get_value(current_procedure) * WORDSIZE;
+
+        load_integer(s0_offset);
+
+        // address of first variadic parameter is S0 + 2 * WORDSIZE + #non-variadic parameters * WORDSIZE
+        emit_add(current_temporary(), current_temporary(), REG_S0);
+
+        // store address in variable passed as macro argument
+        emit_store(REG_S0, get_address(var_list_variable), current_temporary());
+
+        tfree(1);
+      }
+    } else {
+      syntax_error_undeclared_identifier(identifier);
+
+      get_symbol();
+    }
+  } else
+    syntax_error_symbol(SYM_IDENTIFIER);
+}
+
+void macro_var_arg() {
+  uint64_t* var_list_variable;
+  uint64_t  var_list_address;
+
+  var_list_variable = (uint64_t*) 0;
+  var_list_address  = 0;
+
+  if (symbol == SYM_IDENTIFIER) {
+    var_list_variable = search_symbol_table(local_symbol_table, identifier, VARIABLE);
+
+    if (var_list_variable != (uint64_t*) 0) {
+      get_symbol();
+
+      if (symbol == SYM_RPARENTHESIS) {
+        get_symbol();
+
+        var_list_address = get_address(var_list_variable);
+
+        talloc();
+
+        // load variadic parameter from memory address pointed to
+        // by variable passed as macro argument (var_list_variable)
+        emit_load(current_temporary(), REG_S0, var_list_address);
+
+        // store variadic parameter as return value of macro
+        emit_load(previous_temporary(), current_temporary(), 0);
+
+        // increment var_list_variable pointer by one parameter size (=WORDSIZE)
+        emit_addi(current_temporary(), current_temporary(), WORDSIZE);
+
+        // store incremented address in variable passed as macro argument
+        emit_store(REG_S0, var_list_address, current_temporary());
+
+        tfree(1);
+      } else
+        syntax_error_symbol(SYM_RPARENTHESIS);
+    } else {
+      syntax_error_undeclared_identifier(identifier);
+
+      get_symbol();
+    }
+  } else
+    syntax_error_symbol(SYM_IDENTIFIER);
+}
+
+// implementation of va_start, va_arg, and va_end is platform-specific;
+// RISC-V va_end does nothing and is only implemented for parity with standard C
+void macro_var_end() {
+  if (signed_less_than(get_value(current_procedure), 0) == 0)
+    syntax_error_message("'var_end' used in procedure with non-variadic parameters");
+
+  if (symbol == SYM_IDENTIFIER) {
+    get_symbol();
+
+    if (symbol == SYM_RPARENTHESIS)
+      get_symbol();
+    else
+      syntax_error_symbol(SYM_RPARENTHESIS);
+  } else
+    syntax_error_symbol(SYM_IDENTIFIER);
+}
+
+// -----------------------------------------------------------------
+// ------------------------ MACHINE CODE LIBRARY -------------------
+// -----------------------------------------------------------------
+
+void emit_round_up(uint64_t reg, uint64_t m) {
+  talloc();
+
+  // computes value(reg) + m - 1 - (value(reg) + m - 1) % m
+  emit_addi(reg, reg, m - 1);
+  emit_addi(current_temporary(), REG_ZR, m);
+  emit_remu(current_temporary(), reg, current_temporary());
+  emit_sub(reg, reg, current_temporary());
+
+  tfree(1);
+}
+
+void emit_multiply_by(uint64_t reg, uint64_t m) {
+  // assert: there is a 0 <= b < 11 such that m == 2^b
+
+  // load multiplier less than 2^11 to avoid sign extension
+  emit_addi(next_temporary(), REG_ZR, m);
+  emit_mul(reg, reg, next_temporary());
+}
+
+void emit_program_entry() {
+  uint64_t i;
+
+  i = 0;
+
+  // allocate memory for machine initialization code
+
+  // emit exactly 22 NOPs with source code line 1
+  while (i < 22) {
+    emit_nop();
+
+    i = i + 1;
+  }
+}
+
+void emit_bootstrapping() {
+  /*
+      1. initialize global pointer
+      2. initialize malloc's _bump pointer
+      3. pass argc and argv pointer in argument registers
+      4. call main procedure
+      5. proceed to exit procedure
+  */
+  uint64_t gp_value;
+  uint64_t saved_code_size;
+  uint64_t* entry;
+
+  // code segment starts at PK_CODE_START
+  code_start = PK_CODE_START;
+
+  // code size must be word-aligned
+  if (code_size % WORDSIZE != 0)
+    emit_nop();
+
+  // start of data segment must be page-aligned for ELF program header
+  data_start = round_up(code_start + code_size, p_align);
+
+  // calculate global pointer value
+  gp_value = data_start + data_size;
+
+  // further allocations in the data segment are not allowed at this point,
+  // because it would increase data_size and therefore lead to a false gp_value
+
+  // set code emission to program entry
+  saved_code_size = code_size;
+  code_size       = 0;
+
+  // assert: emitting no more than 22 instructions, see emit_program_entry
+
+  if (report_undefined_procedures()) {
+    // if there are undefined procedures just exit
+    // by loading exit code 0 into return register
+    emit_addi(REG_A0, REG_ZR, 0);
+  } else {
+    // avoid sign extension that would result in an additional sub instruction
+    if (gp_value < two_to_the_power_of(31) - two_to_the_power_of(11))
+      // assert: generates no more than two instructions and
+      // no data segment allocations in load_integer for gp_value
+      load_integer(gp_value);
+    else {
+      syntax_error_message("maximum program break exceeded");
+
+      exit(EXITCODE_COMPILERERROR);
+    }
+
+    // initialize global pointer
+    emit_addi(REG_GP, current_temporary(), 0);
+
+    tfree(1);
+
+    // retrieve current program break in return register
+    emit_addi(REG_A0, REG_ZR, 0);
+    emit_addi(REG_A7, REG_ZR, SYSCALL_BRK);
+    emit_ecall();
+
+    // word-align current program break
+    emit_round_up(REG_A0, WORDSIZE);
+
+    // set program break to word-aligned program break
+    emit_addi(REG_A7, REG_ZR, SYSCALL_BRK);
+    emit_ecall();
+
+    // look up global variable _bump for storing malloc's bump pointer
+    // use bump_name string to obtain unique hash
+    entry = search_global_symbol_table(bump_name, VARIABLE);
+
+    // store word-aligned program break in _bump
+    emit_store(get_scope(entry), get_address(entry), REG_A0);
+
+    // reset return register to initial return value
+    emit_addi(REG_A0, REG_ZR, 0);
+
+    // assert: stack is set up with argc on top
+
+    //   sp  sp+WORDSIZE
+    //    |      |
+    //    V      V
+    // | argc | argv[0] | argv[1] | ... | argv[n]
+
+    // pass argc and &argv to main procedure in argument registers
+
+    emit_load(REG_A0, REG_SP, 0);
+    emit_addi(REG_A1, REG_SP, WORDSIZE);
+
+    // assert: global, _bump, and stack pointers are set up
+    //         with all other non-temporary registers zeroed
+
+    // use main_name string to obtain unique hash
+    entry = search_global_symbol_table(main_name, PROCEDURE);
+
+    procedure_call(entry, main_name, get_value(entry));
+  }
+
+  // we exit with exit code in return register passed as argument
+
+  // discount NOPs in profile that were generated for program entry
+  ic_addi = ic_addi - code_size / INSTRUCTIONSIZE;
+
+  // wrapper code for exit must follow here
+
+  // restore original code size
+  code_size = saved_code_size;
+}
+
+// -----------------------------------------------------------------
+// ----------------------- PEEPHOLE OPTIMIZER ----------------------
+// -----------------------------------------------------------------
+
+uint64_t has_undefined_procedures() {
+  uint64_t i;
+  uint64_t* entry;
+
+  i = 0;
+
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
+
+    while (entry != (uint64_t*) 0) {
+      if (is_library_procedure(get_string(entry)) == 0)
+        if (is_undefined_procedure(entry))
+          return 1;
+
+      entry = get_next_entry(entry);
+    }
+
+    i = i + 1;
+  }
+
+  return 0;
+}
+
+void count_instruction(uint64_t instruction, uint64_t n) {
+  uint64_t opcode;
+  uint64_t funct3;
+
+  opcode = get_opcode(instruction);
+  funct3 = get_funct3(instruction);
+
+  if (opcode == OP_LUI)
+    ic_lui = ic_lui + n;
+  else if (opcode == OP_IMM)
+    ic_addi = ic_addi + n;
+  else if (opcode == OP_OP) {
+    if (funct3 == F3_SLTU)
+      ic_sltu = ic_sltu + n;
+    else if (funct3 == F3_DIVU)
+      ic_divu = ic_divu + n;
+    else if (funct3 == F3_REMU)
+      ic_remu = ic_remu + n;
+    else if (get_funct7(instruction) == F7_SUB)
+      ic_sub = ic_sub + n;
+    else if (get_funct7(instruction) == F7_MUL)
+      ic_mul = ic_mul + n;
+    else
+      ic_add = ic_add + n;
+  } else if (opcode == OP_LOAD)
+    ic_load = ic_load + n;
+  else if (opcode == OP_STORE)
+    ic_store = ic_store + n;
+  else if (opcode == OP_BRANCH)
+    ic_beq = ic_beq + n;
+  else if (opcode == OP_JAL)
+    ic_jal = ic_jal + n;
+  else if (opcode == OP_JALR)
+    ic_jalr = ic_jalr + n;
+  else if (opcode == OP_SYSTEM)
+    ic_ecall = ic_ecall + n;
+}
+
+uint64_t is_pure_instruction(uint64_t instruction) {
+  uint64_t opcode;
+
+  // instructions that only write their destination register
+  // and never raise exceptions, unlike divu, remu, and loads
+  opcode = get_opcode(instruction);
+
+  if (opcode == OP_LUI)
+    return 1;
+  else if (opcode == OP_IMM)
+    return 1;
+  else if (opcode == OP_OP) {
+    if (get_funct3(instruction) == F3_DIVU)
+      return 0;
+    else if (get_funct3(instruction) == F3_REMU)
+      return 0;
+    else
+      return 1;
+  } else
+    return 0;
+}
+
+uint64_t reads_register(uint64_t instruction, uint64_t reg) {
+  uint64_t opcode;
+
+  opcode = get_opcode(instruction);
+
+  if (opcode == OP_LUI)
+    return 0;
+  else if (opcode == OP_JAL)
+    return 0;
+  else if (get_rs1(instruction) == reg)
+    return 1;
+  else if (opcode == OP_OP)
+    return get_rs2(instruction) == reg;
+  else if (opcode == OP_STORE)
+    return get_rs2(instruction) == reg;
+  else if (opcode == OP_BRANCH)
+    return get_rs2(instruction) == reg;
+  else
+    return 0;
+}
+
+uint64_t writes_register(uint64_t instruction, uint64_t reg) {
+  uint64_t opcode;
+
+  opcode = get_opcode(instruction);
+
+  if (opcode == OP_STORE)
+    return 0;
+  else if (opcode == OP_BRANCH)
+    return 0;
+  else if (opcode == OP_SYSTEM)
+    return 0;
+  else
+    return get_rd(instruction) == reg;
+}
+
+uint64_t is_removed(uint64_t address) {
+  return *(instruction_flags + address / INSTRUCTIONSIZE) % 2;
+}
+
+uint64_t is_branch_target(uint64_t address) {
+  return *(instruction_flags + address / INSTRUCTIONSIZE) / 2;
+}
+
+void mark_branch_target(uint64_t address) {
+  if (address < code_size)
+    if (is_branch_target(address) == 0)
+      *(instruction_flags + address / INSTRUCTIONSIZE) = *(instruction_flags + address / INSTRUCTIONSIZE) + 2;
+}
+
+void mark_branch_targets(uint64_t from_address) {
+  uint64_t instruction;
+  uint64_t opcode;
+
+  from_address = live_instruction(from_address);
+
+  while (from_address < code_size) {
+    instruction = load_instruction(from_address);
+
+    opcode = get_opcode(instruction);
+
+    if (opcode == OP_BRANCH)
+      mark_branch_target(from_address + get_immediate_b_format(instruction));
+    else if (opcode == OP_JAL)
+      mark_branch_target(from_address + get_immediate_j_format(instruction));
+
+    from_address = next_live_instruction(from_address);
+  }
+
+  mark_procedure_entries();
+}
+
+void mark_procedure_entries() {
+  uint64_t i;
+  uint64_t* entry;
+
+  // procedures are also called from code emitted later such as main
+  // from the bootstrapping code, or not at all
+  i = 0;
+
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
+
+    while (entry != (uint64_t*) 0) {
+      if (get_class(entry) == PROCEDURE)
+        mark_branch_target(get_address(entry));
+
+      entry = get_next_entry(entry);
+    }
+
+    i = i + 1;
+  }
+}
+
+uint64_t previous_live_instruction(uint64_t address, uint64_t from_address) {
+  while (address > from_address) {
+    address = address - INSTRUCTIONSIZE;
+
+    if (is_removed(address) == 0)
+      return address;
+  }
+
+  return live_instruction(from_address);
+}
+
+uint64_t next_live_instruction(uint64_t address) {
+  address = address + INSTRUCTIONSIZE;
+
+  while (address < code_size) {
+    if (is_removed(address) == 0)
+      return address;
+
+    address = address + INSTRUCTIONSIZE;
+  }
+
+  return code_size;
+}
+
+uint64_t live_instruction(uint64_t address) {
+  // control reaching a removed instruction proceeds to the next live instruction
+  if (address < code_size)
+    if (is_removed(address))
+      return next_live_instruction(address);
+
+  return address;
+}
+
+void remove_instruction(uint64_t address) {
+  count_instruction(load_instruction(address), -1);
+
+  *(instruction_flags + address / INSTRUCTIONSIZE) = *(instruction_flags + address / INSTRUCTIONSIZE) + 1;
+}
+
+void replace_instruction(uint64_t address, uint64_t instruction) {
+  count_instruction(load_instruction(address), -1);
+
+  store_instruction(address, instruction);
+
+  count_instruction(instruction, 1);
+}
+
+uint64_t is_dead_temporary(uint64_t reg, uint64_t address) {
+  uint64_t instruction;
+  uint64_t opcode;
+
+  // the compiler never keeps temporaries live across statements,
+  // that is, beyond branches, jumps, calls, returns, and branch
+  // targets, within statements a temporary is dead at the given
+  // address if it is overwritten before being read again
+  if (temporary_number(reg) == 0)
+    return 0;
+
+  address = live_instruction(address);
+
+  while (address < code_size) {
+    if (is_branch_target(address))
+      return 1;
+
+    instruction = load_instruction(address);
+
+    opcode = get_opcode(instruction);
+
+    if (reads_register(instruction, reg))
+      return 0;
+    else if (opcode == OP_SYSTEM)
+      return 0;
+    else if (opcode == OP_BRANCH)
+      return 1;
+    else if (opcode == OP_JAL)
+      return 1;
+    else if (opcode == OP_JALR)
+      return 1;
+    else if (writes_register(instruction, reg))
+      return 1;
+
+    address = next_live_instruction(address);
+  }
+
+  return 1;
+}
+
+uint64_t remove_nop(uint64_t address, uint64_t instruction) {
+  // assert: instruction is pure
+  if (get_rd(instruction) == REG_ZR) {
+    remove_instruction(address);
+
+    return 1;
+  } else if (get_opcode(instruction) == OP_IMM)
+    if (get_rs1(instruction) == get_rd(instruction))
+      if (get_immediate_i_format(instruction) == 0) {
+        remove_instruction(address);
+
+        return 1;
+      }
+
+  return 0;
+}
+
+uint64_t remove_dead_write(uint64_t address, uint64_t instruction) {
+  // assert: instruction is pure
+
+  // for example, the copy of the return value of a procedure
+  // called in an expression statement into a temporary
+  if (is_dead_temporary(get_rd(instruction), address + INSTRUCTIONSIZE)) {
+    remove_instruction(address);
+
+    return 1;
+  }
+
+  return 0;
+}
+
+uint64_t remove_jump_to_next(uint64_t address, uint64_t instruction) {
+  uint64_t target;
+
+  // assert: instruction is beq or jal with rd == zero
+  if (get_opcode(instruction) == OP_BRANCH)
+    target = address + get_immediate_b_format(instruction);
+  else
+    target = address + get_immediate_j_format(instruction);
+
+  if (live_instruction(target) == next_live_instruction(address)) {
+    remove_instruction(address);
+
+    return 1;
+  }
+
+  return 0;
+}
+
+uint64_t remove_unreachable_code(uint64_t address) {
+  uint64_t removed;
+
+  // assert: instruction at address is jal or jalr with rd == zero
+
+  removed = 0;
+
+  // code after unconditional jumps and returns is
+  // unreachable up to the next branch target
+  address = next_live_instruction(address);
+
+  while (address < code_size) {
+    if (is_branch_target(address))
+      return removed;
+
+    remove_instruction(address);
+
+    removed = 1;
+
+    address = next_live_instruction(address);
+  }
+
+  return removed;
+}
+
+uint64_t merge_addi(uint64_t address, uint64_t instruction) {
+  uint64_t next_address;
+  uint64_t next_instruction;
+  uint64_t reg;
+  uint64_t immediate;
+
+  // assert: instruction is addi
+
+  // for example, popping the stack and then allocating stack
+  // space again for the next call: addi sp,sp,8; addi sp,sp,-8
+  next_address = next_live_instruction(address);
+
+  if (next_address == code_size)
+    return 0;
+  else if (is_branch_target(next_address))
+    return 0;
+
+  next_instruction = load_instruction(next_address);
+
+  reg = get_rd(instruction);
+
+  if (get_opcode(next_instruction) != OP_IMM)
+    return 0;
+  else if (get_rd(next_instruction) != reg)
+    return 0;
+  else if (get_rs1(next_instruction) != reg)
+    return 0;
+
+  immediate = get_immediate_i_format(instruction) + get_immediate_i_format(next_instruction);
+
+  if (is_signed_integer(immediate, 12) == 0)
+    return 0;
+
+  if (immediate == 0)
+    if (get_rs1(instruction) == reg) {
+      remove_instruction(address);
+      remove_instruction(next_address);
+
+      return 1;
+    }
+
+  replace_instruction(address,
+    encode_i_format(immediate, get_rs1(instruction), F3_ADDI, reg, OP_IMM));
+
+  remove_instruction(next_address);
+
+  return 1;
+}
+
+uint64_t remove_dead_store(uint64_t address, uint64_t instruction) {
+  uint64_t next_address;
+  uint64_t next_instruction;
+
+  // assert: instruction is sd
+
+  // for example, pushing a temporary onto the stack which is popped
+  // again right away after forwarding it: sd t0,0(sp); addi sp,sp,8
+  if (get_rs1(instruction) != REG_SP)
+    return 0;
+
+  next_address = next_live_instruction(address);
+
+  if (next_address == code_size)
+    return 0;
+
+  next_instruction = load_instruction(next_address);
+
+  if (get_opcode(next_instruction) != OP_IMM)
+    return 0;
+  else if (get_rd(next_instruction) != REG_SP)
+    return 0;
+  else if (get_rs1(next_instruction) != REG_SP)
+    return 0;
+
+  // memory below the stack pointer is never read
+  if (signed_less_than(get_immediate_i_format(next_instruction), get_immediate_s_format(instruction) + WORDSIZE))
+    return 0;
+
+  remove_instruction(address);
+
+  return 1;
+}
+
+uint64_t forward_store(uint64_t address, uint64_t instruction) {
+  uint64_t next_address;
+  uint64_t next_instruction;
+
+  // assert: instruction is sd
+
+  // for example, restoring a temporary right after saving it
+  // with no call in between: sd t0,0(sp); ld t0,0(sp)
+  next_address = next_live_instruction(address);
+
+  if (next_address == code_size)
+    return 0;
+  else if (is_branch_target(next_address))
+    return 0;
+
+  next_instruction = load_instruction(next_address);
+
+  if (get_opcode(next_instruction) != OP_LOAD)
+    return 0;
+  else if (get_rs1(next_instruction) != get_rs1(instruction))
+    return 0;
+  else if (get_immediate_i_format(next_instruction) != get_immediate_s_format(instruction))
+    return 0;
+
+  if (get_rd(next_instruction) == get_rs2(instruction))
+    remove_instruction(next_address);
+  else
+    replace_instruction(next_address,
+      encode_i_format(0, get_rs2(instruction), F3_ADDI, get_rd(next_instruction), OP_IMM));
+
+  return 1;
+}
+
+uint64_t coalesce_copy(uint64_t address, uint64_t instruction) {
+  uint64_t next_address;
+  uint64_t next_instruction;
+  uint64_t reg;
+
+  // assert: instruction is lui, addi, add, sub, mul, divu, remu, sltu, or ld
+
+  // for example, passing a parameter through a temporary:
+  // ld t0,16(s0); addi a0,t0,0 becomes ld a0,16(s0)
+  reg = get_rd(instruction);
+
+  if (temporary_number(reg) == 0)
+    return 0;
+
+  next_address = next_live_instruction(address);
+
+  if (next_address == code_size)
+    return 0;
+  else if (is_branch_target(next_address))
+    return 0;
+
+  next_instruction = load_instruction(next_address);
+
+  if (get_opcode(next_instruction) != OP_IMM)
+    return 0;
+  else if (get_rs1(next_instruction) != reg)
+    return 0;
+  else if (get_immediate_i_format(next_instruction) != 0)
+    return 0;
+  else if (is_dead_temporary(reg, next_address + INSTRUCTIONSIZE) == 0)
+    return 0;
+
+  // rd occupies the same bits in all instruction formats with rd
+  replace_instruction(address,
+    instruction - left_shift(reg, 7) + left_shift(get_rd(next_instruction), 7));
+
+  remove_instruction(next_address);
+
+  return 1;
+}
+
+uint64_t optimize_instruction(uint64_t address) {
+  uint64_t instruction;
+  uint64_t opcode;
+
+  // decode instruction once and only try patterns starting with it
+  instruction = load_instruction(address);
+
+  opcode = get_opcode(instruction);
+
+  if (opcode == OP_STORE) {
+    if (forward_store(address, instruction))
+      return 1;
+    else
+      return remove_dead_store(address, instruction);
+  } else if (opcode == OP_BRANCH)
+    return remove_jump_to_next(address, instruction);
+  else if (opcode == OP_JAL) {
+    if (get_rd(instruction) != REG_ZR)
+      return 0;
+    else if (remove_jump_to_next(address, instruction))
+      return 1;
+    else
+      return remove_unreachable_code(address);
+  } else if (opcode == OP_JALR) {
+    if (get_rd(instruction) != REG_ZR)
+      return 0;
+    else
+      return remove_unreachable_code(address);
+  } else if (opcode == OP_SYSTEM)
+    return 0;
+
+  if (is_pure_instruction(instruction))
+    if (remove_nop(address, instruction))
+      return 1;
+
+  if (opcode == OP_IMM)
+    if (merge_addi(address, instruction))
+      return 1;
+
+  if (coalesce_copy(address, instruction))
+    return 1;
+  else if (is_pure_instruction(instruction))
+    return remove_dead_write(address, instruction);
+  else
+    return 0;
+}
+
+void restore_procedure_entries(uint64_t from_address) {
+  uint64_t i;
+  uint64_t* entry;
+
+  // procedures starting with a jump look undefined, see
+  // is_undefined_procedure, so a removed first instruction
+  // of such a procedure is put back as nop
+  i = 0;
+
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
+
+    while (entry != (uint64_t*) 0) {
+      if (get_class(entry) == PROCEDURE)
+        if (get_address(entry) >= from_address)
+          if (get_address(entry) < code_size)
+            if (is_removed(get_address(entry)))
+              if (get_opcode(load_instruction(live_instruction(get_address(entry)))) == OP_JAL) {
+                store_instruction(get_address(entry), encode_nop());
+
+                count_instruction(encode_nop(), 1);
+
+                *(instruction_flags + get_address(entry) / INSTRUCTIONSIZE) =
+                  *(instruction_flags + get_address(entry) / INSTRUCTIONSIZE) - 1;
+              }
+
+      entry = get_next_entry(entry);
+    }
+
+    i = i + 1;
+  }
+}
+
+uint64_t relocated_address(uint64_t address) {
+  return *(instruction_flags + address / INSTRUCTIONSIZE);
+}
+
+void relocate_code(uint64_t from_address) {
+  uint64_t address;
+  uint64_t removed;
+  uint64_t flags;
+  uint64_t instruction;
+  uint64_t opcode;
+  uint64_t i;
+  uint64_t* entry;
+
+  removed = 0;
+
+  address = 0;
+
+  while (address <= code_size) {
+    flags = *(instruction_flags + address / INSTRUCTIONSIZE);
+
+    *(instruction_flags + address / INSTRUCTIONSIZE) = address - removed * INSTRUCTIONSIZE;
+
+    if (flags % 2)
+      removed = removed + 1;
+
+    address = address + INSTRUCTIONSIZE;
+  }
+
+  number_of_removed_instructions = removed;
+
+  // from now on, an instruction is removed if it is
+  // relocated to the same address as the next instruction
+
+  // branch and jump offsets are relative and need to be recomputed
+  // if instructions were removed in between, calls into library code
+  // before the given address are relocated in the same way
+  address = from_address;
+
+  while (address < code_size) {
+    if (relocated_address(address) != relocated_address(address + INSTRUCTIONSIZE)) {
+      instruction = load_instruction(address);
+
+      opcode = get_opcode(instruction);
+
+      if (opcode == OP_BRANCH)
+        store_instruction(address,
+          encode_b_format(
+            relocated_address(address + get_immediate_b_format(instruction)) - relocated_address(address),
+            get_rs2(instruction),
+            get_rs1(instruction),
+            get_funct3(instruction),
+            OP_BRANCH));
+      else if (opcode == OP_JAL)
+        store_instruction(address,
+          encode_j_format(
+            relocated_address(address + get_immediate_j_format(instruction)) - relocated_address(address),
+            get_rd(instruction),
+            OP_JAL));
+    }
+
+    address = address + INSTRUCTIONSIZE;
+  }
+
+  // compact code and source line numbers
+  address = from_address;
+
+  while (address < code_size) {
+    if (relocated_address(address) != relocated_address(address + INSTRUCTIONSIZE)) {
+      store_instruction(relocated_address(address), load_instruction(address));
+
+      *(code_line_number + relocated_address(address) / INSTRUCTIONSIZE) =
+        *(code_line_number + address / INSTRUCTIONSIZE);
+    }
+
+    address = address + INSTRUCTIONSIZE;
+  }
+
+  address = relocated_address(code_size);
+
+  // emit_instruction only sets source line numbers not yet set
+  while (address < code_size) {
+    store_instruction(address, 0);
 
-  // load multiplier less than 2^11 to avoid sign extension
-  emit_addi(next_temporary(), REG_ZR, m);
-  emit_mul(reg, reg, next_temporary());
-}
+    *(code_line_number + address / INSTRUCTIONSIZE) = 0;
 
-void emit_program_entry() {
-  uint64_t i;
+    address = address + INSTRUCTIONSIZE;
+  }
 
   i = 0;
 
-  // allocate memory for machine initialization code
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
 
-  // emit exactly 22 NOPs with source code line 1
-  while (i < 22) {
-    emit_nop();
+    while (entry != (uint64_t*) 0) {
+      if (get_class(entry) == PROCEDURE)
+        if (get_address(entry) >= from_address)
+          if (get_address(entry) < code_size)
+            set_address(entry, relocated_address(get_address(entry)));
+
+      entry = get_next_entry(entry);
+    }
 
     i = i + 1;
   }
-}
 
-void emit_bootstrapping() {
-  /*
-      1. initialize global pointer
-      2. initialize malloc's _bump pointer
-      3. push argv pointer onto stack
-      4. call main procedure
-      5. proceed to exit procedure
-  */
-  uint64_t gp_value;
-  uint64_t saved_code_size;
-  uint64_t* entry;
+  code_size = relocated_address(code_size);
+}
 
-  // code segment starts at PK_CODE_START
-  code_start = PK_CODE_START;
+void peephole_optimize(uint64_t from_address) {
+  uint64_t address;
 
-  // code size must be word-aligned
-  if (code_size % WORDSIZE != 0)
-    emit_nop();
+  mark_branch_targets(from_address);
 
-  // start of data segment must be page-aligned for ELF program header
-  data_start = round_up(code_start + code_size, p_align);
+  address = live_instruction(from_address);
 
-  // calculate global pointer value
-  gp_value = data_start + data_size;
+  while (address < code_size) {
+    if (optimize_instruction(address))
+      // changes may enable patterns that start at the previous instruction
+      address = previous_live_instruction(address, from_address);
+    else
+      address = next_live_instruction(address);
+  }
+}
 
-  // further allocations in the data segment are not allowed at this point,
-  // because it would increase data_size and therefore lead to a false gp_value
+uint64_t end_of_procedure(uint64_t address) {
+  // code of a procedure extends up to the entry of the next procedure
+  address = address + INSTRUCTIONSIZE;
 
-  // set code emission to program entry
-  saved_code_size = code_size;
-  code_size       = 0;
+  while (address < code_size) {
+    if (is_branch_target(address))
+      return address;
 
-  // assert: emitting no more than 22 instructions, see emit_program_entry
+    address = address + INSTRUCTIONSIZE;
+  }
 
-  if (report_undefined_procedures()) {
-    // if there are undefined procedures just exit
-    // by loading exit code 0 into return register
-    emit_addi(REG_A0, REG_ZR, 0);
-  } else {
-    // avoid sign extension that would result in an additional sub instruction
-    if (gp_value < two_to_the_power_of(31) - two_to_the_power_of(11))
-      // assert: generates no more than two instructions and
-      // no data segment allocations in load_integer for gp_value
-      load_integer(gp_value);
-    else {
-      syntax_error_message("maximum program break exceeded");
+  return code_size;
+}
 
-      exit(EXITCODE_COMPILERERROR);
-    }
+void mark_live_procedure(uint64_t address, uint64_t from_address) {
+  uint64_t end_address;
+  uint64_t instruction;
 
-    // initialize global pointer
-    emit_addi(REG_GP, current_temporary(), 0);
+  if (address < from_address)
+    // library procedures are never removed
+    return;
+  else if (is_removed(address) == 0)
+    // procedure is already live
+    return;
 
-    tfree(1);
+  end_address = end_of_procedure(address);
 
-    // retrieve current program break in return register
-    emit_addi(REG_A0, REG_ZR, 0);
-    emit_addi(REG_A7, REG_ZR, SYSCALL_BRK);
-    emit_ecall();
+  while (address < end_address) {
+    *(instruction_flags + address / INSTRUCTIONSIZE) = *(instruction_flags + address / INSTRUCTIONSIZE) - 1;
 
-    // word-align current program break
-    emit_round_up(REG_A0, WORDSIZE);
+    instruction = load_instruction(address);
 
-    // set program break to word-aligned program break
-    emit_addi(REG_A7, REG_ZR, SYSCALL_BRK);
-    emit_ecall();
+    // without procedure pointers in C*, procedures
+    // are only reachable through jal with rd != zero
+    if (get_opcode(instruction) == OP_JAL)
+      if (get_rd(instruction) != REG_ZR)
+        mark_live_procedure(address + get_immediate_j_format(instruction), from_address);
 
-    // look up global variable _bump for storing malloc's bump pointer
-    // use bump_name string to obtain unique hash
-    entry = search_global_symbol_table(bump_name, VARIABLE);
+    address = address + INSTRUCTIONSIZE;
+  }
+}
 
-    // store word-aligned program break in _bump
-    emit_store(get_scope(entry), get_address(entry), REG_A0);
+void eliminate_dead_procedures(uint64_t from_address) {
+  uint64_t address;
+  uint64_t* entry;
 
-    // reset return register to initial return value
-    emit_addi(REG_A0, REG_ZR, 0);
+  // all code is dead unless reachable from main
+  address = from_address;
 
-    // assert: stack is set up with argv pointer still missing
+  while (address < code_size) {
+    *(instruction_flags + address / INSTRUCTIONSIZE) = 1;
 
-    //   sp
-    //    |
-    //    V
-    // | argc | argv[0] | argv[1] | ... | argv[n]
+    address = address + INSTRUCTIONSIZE;
+  }
 
-    // first push argc again (!) onto stack
+  mark_procedure_entries();
 
-    talloc();
+  // use main_name string to obtain unique hash
+  entry = search_global_symbol_table(main_name, PROCEDURE);
 
-    emit_load(current_temporary(), REG_SP, 0);
-    emit_addi(REG_SP, REG_SP, -WORDSIZE);
-    emit_store(REG_SP, 0, current_temporary());
+  mark_live_procedure(get_address(entry), from_address);
 
-    //   sp  sp+WORDSIZE  sp+2*WORDSIZE
-    //    |      |        |
-    //    V      V        V
-    // | argc | argc | argv[0] | argv[1] | ... | argv[n]
+  address = from_address;
 
-    // then overwrite below-top argc with &argv
+  while (address < code_size) {
+    if (is_removed(address)) {
+      count_instruction(load_instruction(address), -1);
 
-    emit_addi(current_temporary(), REG_SP, 2 * WORDSIZE);
-    emit_store(REG_SP, WORDSIZE, current_temporary());
+      number_of_dead_instructions = number_of_dead_instructions + 1;
 
-    tfree(1);
+      if (is_branch_target(address))
+        number_of_dead_procedures = number_of_dead_procedures + 1;
+    }
 
-    //   sp
-    //    |        _______
-    //    V       |       V
-    // | argc | &argv | argv[0] | argv[1] | ... | argv[n]
+    address = address + INSTRUCTIONSIZE;
+  }
+}
 
-    // assert: global, _bump, and stack pointers are set up
-    //         with all other non-temporary registers zeroed
+void optimize_code(uint64_t from_address) {
+  number_of_dead_procedures      = 0;
+  number_of_dead_instructions    = 0;
+  number_of_removed_instructions = 0;
 
-    // use main_name string to obtain unique hash
-    entry = search_global_symbol_table(main_name, PROCEDURE);
+  // procedures called but not yet defined are linked
+  // through absolute code addresses, see fixlink_relative
+  if (has_undefined_procedures())
+    return;
 
-    procedure_call(entry, main_name, get_value(entry));
-  }
+  instruction_flags = zmalloc((code_size / INSTRUCTIONSIZE + 1) * SIZEOFUINT64);
 
-  // we exit with exit code in return register pushed onto the stack
-  emit_addi(REG_SP, REG_SP, -WORDSIZE);
-  emit_store(REG_SP, 0, REG_A0);
+  eliminate_dead_procedures(from_address);
 
-  // discount NOPs in profile that were generated for program entry
-  ic_addi = ic_addi - code_size / INSTRUCTIONSIZE;
+  peephole_optimize(from_address);
 
-  // wrapper code for exit must follow here
+  restore_procedure_entries(from_address);
 
-  // restore original code size
-  code_size = saved_code_size;
+  relocate_code(from_address);
 }
 
 // -----------------------------------------------------------------
@@ -5977,6 +8751,9 @@ void selfie_compile() {
   uint64_t link;
   uint64_t number_of_source_files;
   uint64_t fetch_dss_code_location;
+  uint64_t source_code_location;
+
+  start_timing(TIMING_COMPILE);
 
   fetch_dss_code_location = 0;
 
@@ -5996,6 +8773,7 @@ void selfie_compile() {
   data_binary = zmalloc(MAX_DATA_SIZE);
   data_start  = 0;
   data_size   = 0;
+  bss_size    = 0;
 
   // allocate zeroed memory for storing source code line numbers
   code_line_number = zmalloc(MAX_CODE_SIZE / INSTRUCTIONSIZE * SIZEOFUINT64);
@@ -6015,11 +8793,14 @@ void selfie_compile() {
 
   emit_malloc();
 
+  emit_clock_gettime();
+
   emit_switch();
 
   if (GC_ON) {
     emit_fetch_stack_pointer();
     emit_fetch_global_pointer();
+    emit_fetch_saved_registers();
 
     // save code location of eventual fetch_data_segment_size implementation
     fetch_dss_code_location = code_size;
@@ -6036,6 +8817,15 @@ void selfie_compile() {
   // use main_name string to obtain unique hash
   create_symbol_table_entry(GLOBAL_TABLE, main_name, 0, PROCEDURE, UINT64_T, 0, 0);
 
+  // save code location of code compiled from source files
+  source_code_location = code_size;
+
+  library_code_size = source_code_location;
+
+  // code compiled earlier may be linked from an object file
+  if (selfie_load_object())
+    number_of_source_files = number_of_source_files + 1;
+
   while (link) {
     if (number_of_remaining_arguments() == 0)
       link = 0;
@@ -6059,6 +8849,7 @@ void selfie_compile() {
       }
 
       reset_scanner();
+      reset_expression_dag();
       reset_parser();
 
       compile_cstar();
@@ -6079,13 +8870,20 @@ void selfie_compile() {
         number_of_procedures,
         number_of_strings);
 
-      printf("%s: %lu calls, %lu assignments, %lu while, %lu if, %lu return\n", selfie_name,
+      printf("%s: %lu calls (%lu inlined), %lu assignments, %lu while, %lu if, %lu return\n", selfie_name,
         number_of_calls,
+        number_of_inlined_calls,
         number_of_assignments,
         number_of_while,
         number_of_if,
         number_of_return);
 
+      if (optimize)
+        printf("%s: %lu expression nodes, %lu folded, %lu shared\n", selfie_name,
+          number_of_nodes,
+          number_of_folded_nodes,
+          number_of_shared_nodes);
+
       if (number_of_syntax_errors != 0) {
         printf("%s: encountered %lu syntax errors while compiling %s - omitting output\n",
           selfie_name,
@@ -6099,6 +8897,18 @@ void selfie_compile() {
   if (number_of_source_files == 0)
     printf("%s: nothing to compile, only library generated\n", selfie_name);
 
+  if (optimize) {
+    optimize_code(source_code_location);
+
+    printf("%s: %lu procedures with %lu instructions removed as unreachable from main\n", selfie_name,
+      number_of_dead_procedures,
+      number_of_dead_instructions);
+    printf("%s: %lu instructions removed by peephole optimization\n", selfie_name,
+      number_of_removed_instructions - number_of_dead_instructions);
+  }
+
+  object_code_size = code_size;
+
   emit_bootstrapping();
 
   if (GC_ON)
@@ -6112,12 +8922,15 @@ void selfie_compile() {
     total_search_time / number_of_searches,
     total_search_time);
 
-  printf("%s: %lu bytes generated with %lu instructions and %lu bytes of data\n", selfie_name,
+  printf("%s: %lu bytes generated with %lu instructions, %lu bytes of data, and %lu bytes of bss\n", selfie_name,
     code_size + data_size,
     code_size / INSTRUCTIONSIZE,
-    data_size);
+    data_size,
+    bss_size);
 
   print_instruction_counters();
+
+  stop_timing(TIMING_COMPILE);
 }
 
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
@@ -6164,6 +8977,16 @@ uint64_t is_argument_register(uint64_t reg) {
   return 0;
 }
 
+uint64_t is_saved_register(uint64_t reg) {
+  if (reg == REG_S1)
+    return 1;
+  else if (reg >= REG_S2)
+    if (reg <= REG_S11)
+      return 1;
+
+  return 0;
+}
+
 uint64_t is_temporary_register(uint64_t reg) {
   if (reg >= REG_T0)
     if (reg <= REG_T2)
@@ -6924,7 +9747,7 @@ uint64_t* encode_elf_header() {
   p_offset = ELF_HEADER_SIZE + round_up(code_size, p_align); // must match binary format
   p_vaddr  = data_start;
   p_filesz = data_size;
-  p_memsz  = data_size;
+  p_memsz  = data_size + bss_size; // bss is zeroed in memory but not stored in file
 
   encode_elf_program_header(header, 1);
 
@@ -6964,6 +9787,7 @@ void encode_elf_program_header(uint64_t* header, uint64_t ph_index) {
 
 void decode_elf_program_header(uint64_t* header, uint64_t ph_index) {
   p_filesz = *(header + get_elf_program_header_offset(ph_index) + 4);
+  p_memsz  = *(header + get_elf_program_header_offset(ph_index) + 5);
 }
 
 uint64_t validate_elf_header(uint64_t* header) {
@@ -6980,6 +9804,7 @@ uint64_t validate_elf_header(uint64_t* header) {
   decode_elf_program_header(header, 1);
 
   data_size = p_filesz;
+  bss_size  = p_memsz - p_filesz;
 
   // must match binary bootstrapping
   data_start = round_up(code_start + code_size, p_align);
@@ -7020,6 +9845,8 @@ void selfie_output(char* filename) {
     return;
   }
 
+  start_timing(TIMING_OUTPUT);
+
   // assert: binary_name is mapped and not longer than MAX_FILENAME_LENGTH
 
   fd = open_write_only(binary_name, S_IRUSR_IWUSR_IXUSR_IRGRP_IXGRP_IROTH_IXOTH);
@@ -7066,6 +9893,8 @@ void selfie_output(char* filename) {
     code_size / INSTRUCTIONSIZE,
     data_size,
     binary_name);
+
+  stop_timing(TIMING_OUTPUT);
 }
 
 uint64_t* touch(uint64_t* memory, uint64_t bytes) {
@@ -7105,6 +9934,8 @@ void selfie_load() {
   uint64_t number_of_read_bytes;
   uint64_t code_size_with_padding;
 
+  start_timing(TIMING_LOAD);
+
   binary_name = get_argument();
 
   // assert: binary_name is mapped and not longer than MAX_FILENAME_LENGTH
@@ -7120,49 +9951,282 @@ void selfie_load() {
   // this call makes sure ELF_header is mapped for reading into it
   ELF_header = allocate_elf_header();
 
-  // make sure code and data binaries are also mapped for reading into them
-  code_binary = touch(smalloc(MAX_CODE_SIZE), MAX_CODE_SIZE);
-  code_start  = 0;
-  code_size   = 0;
-  data_binary = touch(smalloc(MAX_DATA_SIZE), MAX_DATA_SIZE);
-  data_start  = 0;
-  data_size   = 0;
+  code_start = 0;
+  code_size  = 0;
+  data_start = 0;
+  data_size  = 0;
+  bss_size   = 0;
 
   // no source line numbers in binaries
   code_line_number = (uint64_t*) 0;
   data_line_number = (uint64_t*) 0;
 
-  number_of_read_bytes = read(fd, ELF_header, ELF_HEADER_SIZE);
+  // no symbols in binaries
+  object_code_size = 0;
+
+  number_of_read_bytes = read(fd, ELF_header, ELF_HEADER_SIZE);
+
+  if (number_of_read_bytes == ELF_HEADER_SIZE) {
+    if (validate_elf_header(ELF_header)) {
+      code_size_with_padding = round_up(code_size, p_align);
+
+      // allocate code and data binaries only as large as the segments in the binary,
+      // code binary is page-aligned so that up_load_binary may map code pages directly,
+      // and make sure code and data binaries are mapped for reading into them
+      code_binary = touch((uint64_t*) round_up((uint64_t) smalloc(code_size_with_padding + PAGESIZE), PAGESIZE),
+        code_size_with_padding);
+      data_binary = touch(smalloc(data_size), data_size);
+
+      number_of_read_bytes = sign_extend(read(fd, code_binary, code_size_with_padding), SYSCALL_BITWIDTH);
+
+      if (number_of_read_bytes == code_size_with_padding) {
+        number_of_read_bytes = sign_extend(read(fd, data_binary, data_size), SYSCALL_BITWIDTH);
+
+        if (number_of_read_bytes == data_size) {
+          // check if we are really at EOF
+          if (read(fd, binary_buffer, SIZEOFUINT64) == 0) {
+            printf("%s: %lu bytes with %lu instructions, %lu bytes of data, and %lu bytes of bss loaded from %s\n",
+              selfie_name,
+              ELF_HEADER_SIZE + code_size + data_size,
+              code_size / INSTRUCTIONSIZE,
+              data_size,
+              bss_size,
+              binary_name);
+
+            stop_timing(TIMING_LOAD);
+
+            return;
+          }
+        }
+      }
+    }
+  }
+
+  printf("%s: failed to load binary from input file %s\n", selfie_name, binary_name);
+
+  exit(EXITCODE_IOERROR);
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- OBJECT -----------------------------
+// -----------------------------------------------------------------
+
+void write_object_bytes(uint64_t fd, uint64_t* buffer, uint64_t bytes) {
+  if (write(fd, buffer, bytes) != bytes) {
+    printf("%s: could not write into object output file %s\n", selfie_name, object_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+}
+
+void read_object_bytes(uint64_t fd, uint64_t* buffer, uint64_t bytes) {
+  if (sign_extend(read(fd, buffer, bytes), SYSCALL_BITWIDTH) != bytes) {
+    printf("%s: failed to load object from input file %s\n", selfie_name, object_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+}
+
+void selfie_output_object(char* filename) {
+  uint64_t fd;
+  uint64_t* buffer;
+  uint64_t code_offset;
+  uint64_t number_of_symbols;
+  uint64_t i;
+  uint64_t* entry;
+
+  object_name = filename;
+
+  if (object_code_size == 0) {
+    printf("%s: nothing to emit to object file %s\n", selfie_name, object_name);
+
+    return;
+  }
+
+  // assert: object_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  fd = open_write_only(object_name, S_IRUSR_IWUSR_IRGRP_IROTH);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not create object output file %s\n", selfie_name, object_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  buffer = smalloc(OBJECT_SYMBOL_SIZE);
+
+  *buffer       = OBJECT_MAGIC;
+  *(buffer + 1) = library_code_size;
+  *(buffer + 2) = object_code_size;
+  *(buffer + 3) = data_size;
+  *(buffer + 4) = bss_size;
+
+  write_object_bytes(fd, buffer, OBJECT_HEADER_SIZE);
+
+  // the library is emitted again when loading the object, and its
+  // last instruction, which may share a word with the code after
+  // the library, is never fixed up
+  code_offset = library_code_size - library_code_size % WORDSIZE;
+
+  write_object_bytes(fd, (uint64_t*) ((uint64_t) code_binary + code_offset), object_code_size - code_offset);
+
+  write_object_bytes(fd, code_line_number + library_code_size / INSTRUCTIONSIZE,
+    (object_code_size - library_code_size) / INSTRUCTIONSIZE * SIZEOFUINT64);
+
+  // procedures declared or called but not yet defined keep their
+  // fixup chains in the code, see procedure_call and fixlink_relative
+  number_of_symbols = 0;
+
+  i = 0;
+
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
+
+    while (entry != (uint64_t*) 0) {
+      *buffer       = get_line_number(entry);
+      *(buffer + 1) = get_class(entry);
+      *(buffer + 2) = get_type(entry);
+      *(buffer + 3) = get_value(entry);
+      *(buffer + 4) = get_address(entry);
+      *(buffer + 5) = get_inline_length(entry);
+      *(buffer + 6) = string_length(get_string(entry));
+
+      write_object_bytes(fd, buffer, OBJECT_SYMBOL_SIZE);
+
+      // CAUTION: at boot levels higher than 0, strings are only
+      // accessible in C* at word granularity, see emit_string_data
+      write_object_bytes(fd, (uint64_t*) get_string(entry), round_up(*(buffer + 6) + 1, WORDSIZE));
+
+      number_of_symbols = number_of_symbols + 1;
+
+      entry = get_next_entry(entry);
+    }
+
+    i = i + 1;
+  }
+
+  // class 0 terminates global symbols
+  *(buffer + 1) = 0;
+
+  write_object_bytes(fd, buffer, OBJECT_SYMBOL_SIZE);
+
+  printf("%s: %lu instructions, %lu bytes of data, and %lu symbols written into %s\n", selfie_name,
+    (object_code_size - library_code_size) / INSTRUCTIONSIZE,
+    data_size,
+    number_of_symbols,
+    object_name);
+}
+
+uint64_t selfie_load_object() {
+  uint64_t fd;
+  uint64_t* buffer;
+  uint64_t code_offset;
+  uint64_t address;
+  uint64_t number_of_symbols;
+  char* name;
+  uint64_t* entry;
+
+  // an object file may only come first, before any source files,
+  // since its code continues right after the library
+  if (number_of_remaining_arguments() == 0)
+    return 0;
+  else if (load_character(peek_argument(0), 0) == '-')
+    return 0;
+
+  fd = open_read_only(peek_argument(0));
+
+  if (signed_less_than(fd, 0))
+    return 0;
+  else if (read(fd, binary_buffer, SIZEOFUINT64) != SIZEOFUINT64)
+    return 0;
+  else if (*binary_buffer != OBJECT_MAGIC)
+    // not an object file but presumably source code
+    return 0;
+
+  object_name = get_argument();
+
+  // make sure all memory is mapped for reading into it, see selfie_load
+
+  buffer = touch(smalloc(OBJECT_SYMBOL_SIZE), OBJECT_SYMBOL_SIZE);
+
+  read_object_bytes(fd, buffer, OBJECT_HEADER_SIZE - SIZEOFUINT64);
+
+  if (*buffer != library_code_size) {
+    printf("%s: object file %s was compiled with a different library\n", selfie_name, object_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  code_size = *(buffer + 1);
+  data_size = *(buffer + 2);
+  bss_size  = *(buffer + 3);
+
+  code_offset = library_code_size - library_code_size % WORDSIZE;
+
+  read_object_bytes(fd, touch((uint64_t*) ((uint64_t) code_binary + code_offset), code_size - code_offset),
+    code_size - code_offset);
+
+  read_object_bytes(fd, touch(code_line_number + library_code_size / INSTRUCTIONSIZE,
+    (code_size - library_code_size) / INSTRUCTIONSIZE * SIZEOFUINT64),
+    (code_size - library_code_size) / INSTRUCTIONSIZE * SIZEOFUINT64);
+
+  address = library_code_size;
+
+  while (address < code_size) {
+    count_instruction(load_instruction(address), 1);
 
-  if (number_of_read_bytes == ELF_HEADER_SIZE) {
-    if (validate_elf_header(ELF_header)) {
-      code_size_with_padding = round_up(code_size, p_align);
+    address = address + INSTRUCTIONSIZE;
+  }
 
-      number_of_read_bytes = sign_extend(read(fd, code_binary, code_size_with_padding), SYSCALL_BITWIDTH);
+  number_of_symbols = 0;
 
-      if (number_of_read_bytes == code_size_with_padding) {
-        number_of_read_bytes = sign_extend(read(fd, data_binary, data_size), SYSCALL_BITWIDTH);
+  read_object_bytes(fd, buffer, OBJECT_SYMBOL_SIZE);
 
-        if (number_of_read_bytes == data_size) {
-          // check if we are really at EOF
-          if (read(fd, binary_buffer, SIZEOFUINT64) == 0) {
-            printf("%s: %lu bytes with %lu instructions and %lu bytes of data loaded from %s\n",
-              selfie_name,
-              ELF_HEADER_SIZE + code_size + data_size,
-              code_size / INSTRUCTIONSIZE,
-              data_size,
-              binary_name);
+  while (*(buffer + 1) != 0) {
+    name = string_alloc(*(buffer + 6));
 
-            return;
-          }
-        }
-      }
+    read_object_bytes(fd, touch((uint64_t*) name, round_up(*(buffer + 6) + 1, WORDSIZE)),
+      round_up(*(buffer + 6) + 1, WORDSIZE));
+
+    // variables and procedures of the library such as _bump and main
+    // are updated while big integers and strings may appear repeatedly
+    if (*(buffer + 1) == BIGINT)
+      entry = (uint64_t*) 0;
+    else if (*(buffer + 1) == STRING)
+      entry = (uint64_t*) 0;
+    else
+      entry = search_global_symbol_table(name, *(buffer + 1));
+
+    if (entry == (uint64_t*) 0)
+      entry = create_symbol_table_entry(GLOBAL_TABLE, name, *buffer, *(buffer + 1), *(buffer + 2), *(buffer + 3), *(buffer + 4));
+    else {
+      set_line_number(entry, *buffer);
+      set_type(entry, *(buffer + 2));
+      set_value(entry, *(buffer + 3));
+      set_address(entry, *(buffer + 4));
     }
+
+    set_inline_length(entry, *(buffer + 5));
+
+    number_of_symbols = number_of_symbols + 1;
+
+    read_object_bytes(fd, buffer, OBJECT_SYMBOL_SIZE);
   }
 
-  printf("%s: failed to load binary from input file %s\n", selfie_name, binary_name);
+  // check if we are really at EOF
+  if (read(fd, binary_buffer, SIZEOFUINT64) != 0) {
+    printf("%s: failed to load object from input file %s\n", selfie_name, object_name);
 
-  exit(EXITCODE_IOERROR);
+    exit(EXITCODE_IOERROR);
+  }
+
+  printf("%s: %lu instructions, %lu bytes of data, and %lu symbols loaded from %s\n", selfie_name,
+    (code_size - library_code_size) / INSTRUCTIONSIZE,
+    data_size,
+    number_of_symbols,
+    object_name);
+
+  return 1;
 }
 
 // -----------------------------------------------------------------
@@ -7172,11 +10236,7 @@ void selfie_load() {
 void emit_exit() {
   create_symbol_table_entry(LIBRARY_TABLE, "exit", 0, PROCEDURE, VOID_T, 1, code_size);
 
-  // load signed 32-bit integer exit code
-  emit_load(REG_A0, REG_SP, 0);
-
-  // remove the exit code from the stack
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  // signed 32-bit integer exit code is passed in REG_A0
 
   // load the correct syscall number and invoke syscall
   emit_addi(REG_A7, REG_ZR, SYSCALL_EXIT);
@@ -7209,14 +10269,7 @@ void implement_exit(uint64_t* context) {
 void emit_read() {
   create_symbol_table_entry(LIBRARY_TABLE, "read", 0, PROCEDURE, UINT64_T, 3, code_size);
 
-  emit_load(REG_A0, REG_SP, 0); // fd
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A1, REG_SP, 0); // *buffer
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A2, REG_SP, 0); // size
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  // fd, *buffer, and size are passed in REG_A0, REG_A1, and REG_A2
 
   emit_addi(REG_A7, REG_ZR, SYSCALL_READ);
 
@@ -7272,7 +10325,7 @@ void implement_read(uint64_t* context) {
 
     if (is_virtual_address_valid(vbuffer, WORDSIZE))
       if (is_data_stack_heap_address(context, vbuffer))
-        if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
+        if (is_virtual_address_mapped_on_demand(context, vbuffer)) {
           buffer = tlb(get_pt(context), vbuffer);
 
           actually_read = sign_extend(read(fd, buffer, bytes_to_read), SYSCALL_BITWIDTH);
@@ -7333,14 +10386,7 @@ void implement_read(uint64_t* context) {
 void emit_write() {
   create_symbol_table_entry(LIBRARY_TABLE, "write", 0, PROCEDURE, UINT64_T, 3, code_size);
 
-  emit_load(REG_A0, REG_SP, 0); // fd
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A1, REG_SP, 0); // *buffer
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A2, REG_SP, 0); // size
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  // fd, *buffer, and size are passed in REG_A0, REG_A1, and REG_A2
 
   emit_addi(REG_A7, REG_ZR, SYSCALL_WRITE);
 
@@ -7395,7 +10441,7 @@ void implement_write(uint64_t* context) {
 
     if (is_virtual_address_valid(vbuffer, WORDSIZE))
       if (is_data_stack_heap_address(context, vbuffer))
-        if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
+        if (is_virtual_address_mapped_on_demand(context, vbuffer)) {
           buffer = tlb(get_pt(context), vbuffer);
 
           actually_written = sign_extend(write(fd, buffer, bytes_to_write), SYSCALL_BITWIDTH);
@@ -7456,14 +10502,10 @@ void implement_write(uint64_t* context) {
 void emit_open() {
   create_symbol_table_entry(LIBRARY_TABLE, "open", 0, PROCEDURE, UINT64_T, 3, code_size);
 
-  emit_load(REG_A1, REG_SP, 0); // filename
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A2, REG_SP, 0); // flags
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A3, REG_SP, 0); // mode
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  // filename, flags, and mode are passed in REG_A0, REG_A1, and REG_A2
+  emit_addi(REG_A3, REG_A2, 0); // mode
+  emit_addi(REG_A2, REG_A1, 0); // flags
+  emit_addi(REG_A1, REG_A0, 0); // filename
 
   // DIRFD_AT_FDCWD makes sure that openat behaves like open
   emit_addi(REG_A0, REG_ZR, DIRFD_AT_FDCWD);
@@ -7484,7 +10526,7 @@ uint64_t down_load_string(uint64_t* context, uint64_t vaddr, char* s) {
   while (i < MAX_FILENAME_LENGTH / SIZEOFUINT64) {
     if (is_virtual_address_valid(vaddr, WORDSIZE))
       if (is_data_stack_heap_address(context, vaddr)) {
-        if (is_virtual_address_mapped(get_pt(context), vaddr))
+        if (is_virtual_address_mapped_on_demand(context, vaddr))
           *((uint64_t*) s + i) = load_virtual_memory(get_pt(context), vaddr);
         else {
           printf("%s: opening file failed because the file name address 0x%08lX is unmapped\n", selfie_name, (uint64_t) vaddr);
@@ -7606,8 +10648,7 @@ void emit_malloc() {
   // allocate register for size parameter
   talloc();
 
-  emit_load(current_temporary(), REG_SP, 0); // size
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  emit_addi(current_temporary(), REG_A0, 0); // size
 
   // round up to word size
   emit_round_up(current_temporary(), WORDSIZE);
@@ -7715,6 +10756,77 @@ void implement_brk(uint64_t* context) {
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 }
 
+void emit_clock_gettime() {
+  create_symbol_table_entry(LIBRARY_TABLE, "clock_gettime", 0, PROCEDURE, UINT64_T, 2, code_size);
+
+  // clock ID and *timespec are passed in REG_A0 and REG_A1
+
+  emit_addi(REG_A7, REG_ZR, SYSCALL_CLOCK_GETTIME);
+
+  emit_ecall();
+
+  emit_jalr(REG_ZR, REG_RA, 0);
+}
+
+void implement_clock_gettime(uint64_t* context) {
+  // parameters
+  uint64_t clock_id;
+  uint64_t vtimespec;
+
+  // local variables
+  uint64_t* timespec;
+  uint64_t i;
+
+  if (debug_syscalls) {
+    print("(clock_gettime): ");
+    print_register_value(REG_A0);
+    print(",");
+    print_register_hexadecimal(REG_A1);
+    print(" |- ");
+    print_register_value(REG_A0);
+  }
+
+  clock_id  = *(get_regs(context) + REG_A0);
+  vtimespec = *(get_regs(context) + REG_A1);
+
+  // clock IDs of RISC-U binaries are Linux clock IDs
+  if (clock_id == LINUX_CLOCK_MONOTONIC)
+    clock_id = CLOCK_MONOTONIC;
+  else if (clock_id == LINUX_CLOCK_PROCESS_CPUTIME_ID)
+    clock_id = CLOCK_PROCESS_CPUTIME_ID;
+
+  // assert: timespec buffer is mapped, see init_library
+  timespec = timespec_buffer;
+
+  *(get_regs(context) + REG_A0) = sign_extend(clock_gettime(clock_id, timespec), SYSCALL_BITWIDTH);
+
+  // struct timespec consists of seconds and nanoseconds in two machine words
+  i = 0;
+
+  while (i < 2) {
+    if (is_virtual_address_valid(vtimespec + i * WORDSIZE, WORDSIZE))
+      if (is_data_stack_heap_address(context, vtimespec + i * WORDSIZE))
+        if (is_virtual_address_mapped_on_demand(context, vtimespec + i * WORDSIZE))
+          store_virtual_memory(get_pt(context), vtimespec + i * WORDSIZE, *(timespec + i));
+        else
+          *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
+      else
+        *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
+    else
+      *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
+
+    i = i + 1;
+  }
+
+  set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
+
+  if (debug_syscalls) {
+    print(" -> ");
+    print_register_value(REG_A0);
+    println();
+  }
+}
+
 uint64_t is_boot_level_zero() {
   // C99 malloc(0) returns either a null pointer or a unique pointer,
   // see http://pubs.opengroup.org/onlinepubs/9699919799
@@ -7742,11 +10854,8 @@ uint64_t is_boot_level_zero() {
 void emit_switch() {
   create_symbol_table_entry(LIBRARY_TABLE, "hypster_switch", 0, PROCEDURE, UINT64STAR_T, 2, code_size);
 
-  emit_load(REG_A0, REG_SP, 0); // context to which we switch
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
-
-  emit_load(REG_A1, REG_SP, 0); // number of instructions to execute
-  emit_addi(REG_SP, REG_SP, WORDSIZE);
+  // context to which we switch and number of instructions
+  // to execute are passed in REG_A0 and REG_A1
 
   emit_addi(REG_A7, REG_ZR, SYSCALL_SWITCH);
 
@@ -8368,6 +11477,29 @@ void emit_fetch_global_pointer() {
   emit_jalr(REG_ZR, REG_RA, 0);
 }
 
+void emit_fetch_saved_registers() {
+  uint64_t local;
+
+  create_symbol_table_entry(LIBRARY_TABLE, "fetch_saved_registers", 0, PROCEDURE, UINT64STAR_T, 0, code_size);
+
+  // allocate memory in data segment for storing saved registers
+  // which may hold local variables, in reverse order of address
+  data_size = data_size + NUMBEROFSAVEDREGISTERS * WORDSIZE;
+
+  local = 1;
+
+  while (local <= NUMBEROFSAVEDREGISTERS) {
+    emit_store(REG_GP, -data_size + (local - 1) * WORDSIZE, saved_register(local));
+
+    local = local + 1;
+  }
+
+  // return address of stored saved registers
+  emit_addi(REG_A0, REG_GP, -data_size);
+
+  emit_jalr(REG_ZR, REG_RA, 0);
+}
+
 void emit_fetch_data_segment_size_interface() {
   create_symbol_table_entry(LIBRARY_TABLE, "fetch_data_segment_size", 0, PROCEDURE, UINT64_T, 0, code_size);
 
@@ -8433,10 +11565,10 @@ void implement_gc_brk(uint64_t* context) {
       println();
     }
 
-    // assert: _bump pointer is last entry in data segment
+    // assert: _bump pointer is first entry below gp, see emit_malloc
 
     // updating the _bump pointer of the program (for consistency)
-    store_virtual_memory(get_pt(context), get_data_seg_end_gc(context) - SIZEOFUINT64, get_program_break(context));
+    store_virtual_memory(get_pt(context), *(get_regs(context) + REG_GP) - SIZEOFUINT64, get_program_break(context));
 
     sc_brk = sc_brk + 1;
 
@@ -8831,6 +11963,10 @@ void mark_object_selfie(uint64_t* context, uint64_t gc_address) {
   }
 }
 
+void mark_pointer(uint64_t* context, uint64_t gc_address) {
+  mark_object_selfie(context, gc_address);
+}
+
 void mark_segment(uint64_t* context, uint64_t segment_start, uint64_t segment_end) {
   // assert: segment is not heap
 
@@ -8847,16 +11983,39 @@ void mark_segment(uint64_t* context, uint64_t segment_start, uint64_t segment_en
   }
 }
 
+void mark_saved_registers(uint64_t* context) {
+  uint64_t* saved_registers;
+  uint64_t reg;
+
+  if (is_gc_library(context)) {
+    saved_registers = fetch_saved_registers();
+
+    mark_segment(context, (uint64_t) saved_registers, (uint64_t) (saved_registers + NUMBEROFSAVEDREGISTERS));
+  } else {
+    reg = 1;
+
+    while (reg < NUMBEROFREGISTERS) {
+      if (is_saved_register(reg))
+        mark_pointer(context, *(get_regs(context) + reg));
+
+      reg = reg + 1;
+    }
+  }
+}
+
 void mark(uint64_t* context) {
   if (get_used_list_head_gc(context) == (uint64_t*) 0)
     return; // if there is no used memory skip collection
 
-  // not traversing registers
+  // only traversing saved registers which may hold local variables
 
   // assert: temporary registers do not contain any reference to gc_heap memory
   // selfie saves all relevant temporary registers on stack, see procedure_prologue().
 
-  // root segments: call stack and data segment
+  // roots: saved registers, call stack, and data segment
+
+  // traverse saved registers
+  mark_saved_registers(context);
 
   // traverse call stack
   mark_segment(context, get_stack_seg_start_gc(context), VIRTUALMEMORYSIZE * GIGABYTE);
@@ -9553,6 +12712,9 @@ void do_jal() {
 
     // and individually
     *(calls_per_procedure + a) = *(calls_per_procedure + a) + 1;
+
+    if (call_tree != (uint64_t*) 0)
+      call_procedure(pc);
   } else if (signed_less_than(imm, 0)) {
     // jump backwards to check for another loop iteration
     pc = pc + imm;
@@ -9582,97 +12744,264 @@ void print_jalr() {
   direct_output(string_buffer);
 }
 
-void print_jalr_before() {
-  print(": ");
-  print_register_hexadecimal(rs1);
-  print(" |- ");
+void print_jalr_before() {
+  print(": ");
+  print_register_hexadecimal(rs1);
+  print(" |- ");
+  if (rd != REG_ZR) {
+    print_register_hexadecimal(rd);
+    print(",");
+  }
+  printf("pc==0x%lX", pc);
+}
+
+void do_jalr() {
+  uint64_t next_pc;
+
+  // jump and link register
+
+  update_register_counters();
+
+  // prepare jump rs1-relative with LSB reset
+  next_pc = left_shift(right_shift(*(registers + rs1) + imm, 1), 1);
+
+  if (rd == REG_ZR) {
+    // just jump
+    if (next_pc == pc + INSTRUCTIONSIZE)
+      nopc_jalr = nopc_jalr + 1;
+
+    pc = next_pc;
+
+    if (call_tree != (uint64_t*) 0)
+      if (rs1 == REG_RA)
+        return_from_procedure();
+  } else {
+    // first link, then jump
+
+    // link to next instruction (works even if rd == rs1)
+    *(registers + rd) = pc + INSTRUCTIONSIZE;
+
+    // jump
+    pc = next_pc;
+
+    if (call_tree != (uint64_t*) 0)
+      call_procedure(pc);
+  }
+
+  ic_jalr = ic_jalr + 1;
+}
+
+void print_ecall() {
+  print_code_context_for_instruction(pc);
+  sprintf(string_buffer, "%s", get_mnemonic(is));
+  direct_output(string_buffer);
+}
+
+void record_ecall() {
+  // TODO: record all side effects
+  record_state(*(registers + REG_A0));
+}
+
+void do_ecall() {
+  ic_ecall = ic_ecall + 1;
+
+  if (redo) {
+    // TODO: redo all side effects
+    *(registers + REG_A0) = *(values + (tc % MAX_REPLAY_LENGTH));
+
+    // TODO: print ecall details
+    println();
+
+    pc = pc + INSTRUCTIONSIZE;
+  } else if (*(registers + REG_A7) == SYSCALL_SWITCH)
+    if (record) {
+      printf("%s: context switching during recording is unsupported\n", selfie_name);
+
+      exit(EXITCODE_UNSUPPORTEDSYSCALL);
+    } else if (symbolic) {
+      printf("%s: context switching during symbolic execution is unsupported\n", selfie_name);
+
+      exit(EXITCODE_UNSUPPORTEDSYSCALL);
+    } else {
+      pc = pc + INSTRUCTIONSIZE;
+
+      implement_switch();
+    }
+  else
+    // all system calls other than switch are handled by exception
+    throw_exception(EXCEPTION_SYSCALL, *(registers + REG_A7));
+}
+
+void undo_ecall() {
+  uint64_t a0;
+
+  a0 = *(registers + REG_A0);
+
+  // TODO: undo all side effects
+  *(registers + REG_A0) = *(values + (tc % MAX_REPLAY_LENGTH));
+
+  // save register a0 for redoing system call
+  *(values + (tc % MAX_REPLAY_LENGTH)) = a0;
+}
+
+// lean instructions implement the same semantics as above
+// but only count instructions in total, no nops, register
+// accesses, or calls, loops, loads, and stores per instruction
+
+void lean_lui() {
+  if (rd != REG_ZR)
+    *(registers + rd) = left_shift(imm, 12);
+
+  pc = pc + INSTRUCTIONSIZE;
+
+  ic_lui = ic_lui + 1;
+}
+
+void lean_addi() {
+  if (rd != REG_ZR)
+    *(registers + rd) = *(registers + rs1) + imm;
+
+  pc = pc + INSTRUCTIONSIZE;
+
+  ic_addi = ic_addi + 1;
+}
+
+void lean_add() {
+  if (rd != REG_ZR)
+    *(registers + rd) = *(registers + rs1) + *(registers + rs2);
+
+  pc = pc + INSTRUCTIONSIZE;
+
+  ic_add = ic_add + 1;
+}
+
+void lean_sub() {
+  if (rd != REG_ZR)
+    *(registers + rd) = *(registers + rs1) - *(registers + rs2);
+
+  pc = pc + INSTRUCTIONSIZE;
+
+  ic_sub = ic_sub + 1;
+}
+
+void lean_mul() {
+  if (rd != REG_ZR)
+    *(registers + rd) = *(registers + rs1) * *(registers + rs2);
+
+  pc = pc + INSTRUCTIONSIZE;
+
+  ic_mul = ic_mul + 1;
+}
+
+void lean_divu() {
+  if (*(registers + rs2) != 0) {
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) / *(registers + rs2);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_divu = ic_divu + 1;
+  } else
+    throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
+}
+
+void lean_remu() {
+  if (*(registers + rs2) != 0) {
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) % *(registers + rs2);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_remu = ic_remu + 1;
+  } else
+    throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
+}
+
+void lean_sltu() {
   if (rd != REG_ZR) {
-    print_register_hexadecimal(rd);
-    print(",");
+    if (*(registers + rs1) < *(registers + rs2))
+      *(registers + rd) = 1;
+    else
+      *(registers + rd) = 0;
   }
-  printf("pc==0x%lX", pc);
-}
-
-void do_jalr() {
-  uint64_t next_pc;
-
-  // jump and link register
 
-  update_register_counters();
+  pc = pc + INSTRUCTIONSIZE;
 
-  // prepare jump rs1-relative with LSB reset
-  next_pc = left_shift(right_shift(*(registers + rs1) + imm, 1), 1);
+  ic_sltu = ic_sltu + 1;
+}
 
-  if (rd == REG_ZR) {
-    // just jump
-    if (next_pc == pc + INSTRUCTIONSIZE)
-      nopc_jalr = nopc_jalr + 1;
+void lean_load() {
+  uint64_t vaddr;
 
-    pc = next_pc;
-  } else {
-    // first link, then jump
+  vaddr = *(registers + rs1) + imm;
 
-    // link to next instruction (works even if rd == rs1)
-    *(registers + rd) = pc + INSTRUCTIONSIZE;
+  if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+    if (is_valid_segment_read(vaddr)) {
+      if (is_virtual_address_mapped(pt, vaddr)) {
+        if (rd != REG_ZR)
+          *(registers + rd) = load_cached_virtual_memory(pt, vaddr);
 
-    // jump
-    pc = next_pc;
-  }
+        pc = pc + INSTRUCTIONSIZE;
 
-  ic_jalr = ic_jalr + 1;
+        ic_load = ic_load + 1;
+      } else
+        throw_exception(EXCEPTION_PAGEFAULT, get_page_of_virtual_address(vaddr));
+    } else
+      throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
 }
 
-void print_ecall() {
-  print_code_context_for_instruction(pc);
-  sprintf(string_buffer, "%s", get_mnemonic(is));
-  direct_output(string_buffer);
-}
+void lean_store() {
+  uint64_t vaddr;
 
-void record_ecall() {
-  // TODO: record all side effects
-  record_state(*(registers + REG_A0));
-}
+  vaddr = *(registers + rs1) + imm;
 
-void do_ecall() {
-  ic_ecall = ic_ecall + 1;
+  if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+    if (is_valid_segment_write(vaddr)) {
+      if (is_virtual_address_mapped(pt, vaddr)) {
+        store_cached_virtual_memory(pt, vaddr, *(registers + rs2));
 
-  if (redo) {
-    // TODO: redo all side effects
-    *(registers + REG_A0) = *(values + (tc % MAX_REPLAY_LENGTH));
+        pc = pc + INSTRUCTIONSIZE;
 
-    // TODO: print ecall details
-    println();
+        ic_store = ic_store + 1;
+      } else
+        throw_exception(EXCEPTION_PAGEFAULT, get_page_of_virtual_address(vaddr));
+    } else
+      throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
+}
 
+void lean_beq() {
+  if (*(registers + rs1) == *(registers + rs2))
+    pc = pc + imm;
+  else
     pc = pc + INSTRUCTIONSIZE;
-  } else if (*(registers + REG_A7) == SYSCALL_SWITCH)
-    if (record) {
-      printf("%s: context switching during recording is unsupported\n", selfie_name);
 
-      exit(EXITCODE_UNSUPPORTEDSYSCALL);
-    } else if (symbolic) {
-      printf("%s: context switching during symbolic execution is unsupported\n", selfie_name);
+  ic_beq = ic_beq + 1;
+}
 
-      exit(EXITCODE_UNSUPPORTEDSYSCALL);
-    } else {
-      pc = pc + INSTRUCTIONSIZE;
+void lean_jal() {
+  if (rd != REG_ZR)
+    *(registers + rd) = pc + INSTRUCTIONSIZE;
 
-      implement_switch();
-    }
-  else
-    // all system calls other than switch are handled by exception
-    throw_exception(EXCEPTION_SYSCALL, *(registers + REG_A7));
+  pc = pc + imm;
+
+  ic_jal = ic_jal + 1;
 }
 
-void undo_ecall() {
-  uint64_t a0;
+void lean_jalr() {
+  uint64_t next_pc;
 
-  a0 = *(registers + REG_A0);
+  next_pc = left_shift(right_shift(*(registers + rs1) + imm, 1), 1);
 
-  // TODO: undo all side effects
-  *(registers + REG_A0) = *(values + (tc % MAX_REPLAY_LENGTH));
+  if (rd != REG_ZR)
+    *(registers + rd) = pc + INSTRUCTIONSIZE;
 
-  // save register a0 for redoing system call
-  *(values + (tc % MAX_REPLAY_LENGTH)) = a0;
+  pc = next_pc;
+
+  ic_jalr = ic_jalr + 1;
 }
 
 void print_data_line_number() {
@@ -9756,6 +13085,8 @@ void selfie_disassemble(uint64_t verbose) {
     return;
   }
 
+  start_timing(TIMING_DISASSEMBLE);
+
   // assert: assembly_name is mapped and not longer than MAX_FILENAME_LENGTH
 
   assembly_fd = open_write_only(assembly_name, S_IRUSR_IWUSR_IRGRP_IROTH);
@@ -9805,6 +13136,8 @@ void selfie_disassemble(uint64_t verbose) {
     code_size / INSTRUCTIONSIZE,
     data_size,
     assembly_name);
+
+  stop_timing(TIMING_DISASSEMBLE);
 }
 
 // -----------------------------------------------------------------
@@ -9930,14 +13263,16 @@ void throw_exception(uint64_t exception, uint64_t fault) {
 void fetch() {
   if (is_virtual_address_valid(pc, INSTRUCTIONSIZE)) {
     if (is_code_address(current_context, pc)) {
-      // assert: is_virtual_address_mapped(pt, pc) == 1
-
-      if (pc % WORDSIZE == 0)
-        ir = get_low_instruction(load_cached_instruction_word(pt, pc));
-      else
-        ir = get_high_instruction(load_cached_instruction_word(pt, pc - INSTRUCTIONSIZE));
+      if (is_virtual_address_mapped(pt, pc)) {
+        if (pc % WORDSIZE == 0)
+          ir = get_low_instruction(load_cached_instruction_word(pt, pc));
+        else
+          ir = get_high_instruction(load_cached_instruction_word(pt, pc - INSTRUCTIONSIZE));
 
-      return;
+        return;
+      } else
+        // code pages may be mapped on demand
+        throw_exception(EXCEPTION_PAGEFAULT, get_page_of_virtual_address(pc));
     } else
       throw_exception(EXCEPTION_SEGMENTATIONFAULT, pc);
   } else
@@ -10042,6 +13377,10 @@ void execute() {
     else
       execute_debug();
 
+    return;
+  } else if (lean) {
+    execute_lean();
+
     return;
   }
 
@@ -10199,6 +13538,38 @@ void execute_debug() {
   println();
 }
 
+void execute_lean() {
+  // assert: 1 <= is <= number of RISC-U instructions
+  if (is == ADDI)
+    lean_addi();
+  else if (is == LOAD)
+    lean_load();
+  else if (is == STORE)
+    lean_store();
+  else if (is == ADD)
+    lean_add();
+  else if (is == SUB)
+    lean_sub();
+  else if (is == MUL)
+    lean_mul();
+  else if (is == DIVU)
+    lean_divu();
+  else if (is == REMU)
+    lean_remu();
+  else if (is == SLTU)
+    lean_sltu();
+  else if (is == BEQ)
+    lean_beq();
+  else if (is == JAL)
+    lean_jal();
+  else if (is == JALR)
+    lean_jalr();
+  else if (is == LUI)
+    lean_lui();
+  else if (is == ECALL)
+    do_ecall();
+}
+
 void interrupt() {
   if (timer != TIMEROFF) {
     timer = timer - 1;
@@ -10220,8 +13591,16 @@ void run_until_exception() {
 
   while (trap == 0) {
     fetch();
-    decode();
-    execute();
+
+    if (trap == 0) {
+      decode();
+
+      if (call_tree != (uint64_t*) 0)
+        // attribute instruction to procedure on current call path
+        set_call_counter(current_call, get_call_counter(current_call) + 1);
+
+      execute();
+    }
 
     interrupt();
   }
@@ -10353,6 +13732,21 @@ void print_register_memory_profile() {
 
   reg = 1;
 
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_saved_register(reg)) {
+      saved_register_reads  = saved_register_reads + *(reads_per_register + reg);
+      saved_register_writes = saved_register_writes + *(writes_per_register + reg);
+
+      print_per_register_profile(reg);
+    }
+
+    reg = reg + 1;
+  }
+
+  print_access_profile("saved total:   ", "", saved_register_reads, saved_register_writes);
+
+  reg = 1;
+
   while (reg < NUMBEROFREGISTERS) {
     if (is_temporary_register(reg)) {
       temporary_register_reads  = temporary_register_reads + *(reads_per_register + reg);
@@ -10390,42 +13784,206 @@ void print_profile(uint64_t* context) {
     percentage_format_integral_2(total_page_frame_memory, pused()),
     percentage_format_fractional_2(total_page_frame_memory, pused()),
     total_page_frame_memory / MEGABYTE);
+  printf("%s:          %lu major and %lu minor page faults\n", selfie_name,
+    major_page_faults,
+    minor_page_faults);
+
+  if (GC_ON) {
+    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+    print_gc_profile(context);
+  }
+
+  if (lean) {
+    if (get_total_number_of_instructions() > 0) {
+      printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+      print_instruction_counters();
+    }
+  } else if (get_total_number_of_instructions() > 0) {
+    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+    print_instruction_counters();
+
+    if (code_line_number != (uint64_t*) 0)
+      printf("%s: profile: total,max(ratio%%)@address(line#),2ndmax,3rdmax\n", selfie_name);
+    else
+      printf("%s: profile: total,max(ratio%%)@address,2ndmax,3rdmax\n", selfie_name);
+
+    print_per_instruction_profile("calls:   ", calls, calls_per_procedure);
+    print_per_instruction_profile("loops:   ", iterations, iterations_per_loop);
+    print_per_instruction_profile("loads:   ", ic_load, loads_per_instruction);
+    print_per_instruction_profile("stores:  ", ic_store, stores_per_instruction);
+
+    print_register_memory_profile();
+  }
+
+  if (L1_CACHE_ENABLED) {
+    printf("%s: L1 caches:     accesses,hits,misses\n", selfie_name);
+
+    print_cache_profile(get_cache_hits(L1_DCACHE), get_cache_misses(L1_DCACHE), "data:          ");
+    println();
+
+    print_cache_profile(get_cache_hits(L1_ICACHE), get_cache_misses(L1_ICACHE), "instruction:   ");
+    if (L1_CACHE_COHERENCY)
+      printf(" (coherency invalidations: %lu)", L1_icache_coherency_invalidations);
+    println();
+  }
+
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+}
+
+uint64_t* find_or_create_call(uint64_t* caller, uint64_t procedure) {
+  uint64_t* call;
+
+  if (caller != (uint64_t*) 0) {
+    call = get_call_callees(caller);
+
+    while (call != (uint64_t*) 0) {
+      if (get_call_procedure(call) == procedure)
+        return call;
+
+      call = get_call_next(call);
+    }
+  }
+
+  call = allocate_call();
+
+  set_call_caller(call, caller);
+  set_call_procedure(call, procedure);
+
+  if (caller != (uint64_t*) 0) {
+    set_call_next(call, get_call_callees(caller));
+    set_call_callees(caller, call);
+  }
+
+  return call;
+}
+
+void call_procedure(uint64_t procedure) {
+  // push procedure onto shadow call stack
+  current_call = find_or_create_call(current_call, procedure);
+}
+
+void return_from_procedure() {
+  // pop procedure from shadow call stack but never the root
+  if (get_call_caller(current_call) != (uint64_t*) 0)
+    current_call = get_call_caller(current_call);
+}
+
+void name_procedure(uint64_t* entry) {
+  if (get_class(entry) == PROCEDURE)
+    if (get_address(entry) != 0)
+      if (get_address(entry) < code_size)
+        *(procedure_names + get_address(entry) / INSTRUCTIONSIZE) = (uint64_t) get_string(entry);
+}
+
+void name_procedures() {
+  uint64_t i;
+  uint64_t* entry;
+
+  procedure_names = zmalloc(code_size / INSTRUCTIONSIZE * SIZEOFUINT64STAR);
+
+  // no procedure names for binaries loaded without source
+  if (code_line_number == (uint64_t*) 0)
+    return;
+
+  entry = library_symbol_table;
+
+  while (entry != (uint64_t*) 0) {
+    name_procedure(entry);
+
+    entry = get_next_entry(entry);
+  }
+
+  if (global_symbol_table == (uint64_t*) 0)
+    return;
+
+  i = 0;
+
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
+
+    while (entry != (uint64_t*) 0) {
+      name_procedure(entry);
+
+      entry = get_next_entry(entry);
+    }
+
+    i = i + 1;
+  }
+}
+
+void print_call_path(uint64_t* call) {
+  uint64_t procedure;
+  char* name;
+
+  if (get_call_caller(call) == (uint64_t*) 0)
+    // root of call tree
+    print(binary_name);
+  else {
+    print_call_path(get_call_caller(call));
+    print(";");
+
+    procedure = get_call_procedure(call);
+
+    name = (char*) 0;
+
+    if (procedure >= code_start)
+      if (procedure - code_start < code_size)
+        name = (char*) *(procedure_names + (procedure - code_start) / INSTRUCTIONSIZE);
+
+    if (name != (char*) 0)
+      print(name);
+    else {
+      sprintf(string_buffer, "0x%lX", procedure);
+      direct_output(string_buffer);
+    }
+  }
+}
+
+void print_folded_call_stacks(uint64_t* call) {
+  // one line per call path in folded stack format:
+  // root;caller;...;procedure instructions
+  while (call != (uint64_t*) 0) {
+    if (get_call_counter(call) > 0) {
+      print_call_path(call);
+      sprintf(string_buffer, " %lu", get_call_counter(call));
+      direct_output(string_buffer);
+      println();
+    }
 
-  if (GC_ON) {
-    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    print_gc_profile(context);
+    print_folded_call_stacks(get_call_callees(call));
+
+    call = get_call_next(call);
   }
+}
 
-  if (get_total_number_of_instructions() > 0) {
-    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    print_instruction_counters();
+void print_call_stack_profile() {
+  uint64_t fd;
 
-    if (code_line_number != (uint64_t*) 0)
-      printf("%s: profile: total,max(ratio%%)@address(line#),2ndmax,3rdmax\n", selfie_name);
-    else
-      printf("%s: profile: total,max(ratio%%)@address,2ndmax,3rdmax\n", selfie_name);
+  // assert: call_stack_profile_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-    print_per_instruction_profile("calls:   ", calls, calls_per_procedure);
-    print_per_instruction_profile("loops:   ", iterations, iterations_per_loop);
-    print_per_instruction_profile("loads:   ", ic_load, loads_per_instruction);
-    print_per_instruction_profile("stores:  ", ic_store, stores_per_instruction);
+  fd = open_write_only(call_stack_profile_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-    print_register_memory_profile();
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not create call stack profile output file %s\n", selfie_name, call_stack_profile_name);
+
+    exit(EXITCODE_IOERROR);
   }
 
-  if (L1_CACHE_ENABLED) {
-    printf("%s: L1 caches:     accesses,hits,misses\n", selfie_name);
+  name_procedures();
 
-    print_cache_profile(get_cache_hits(L1_DCACHE), get_cache_misses(L1_DCACHE), "data:          ");
-    println();
+  reset_library();
 
-    print_cache_profile(get_cache_hits(L1_ICACHE), get_cache_misses(L1_ICACHE), "instruction:   ");
-    if (L1_CACHE_COHERENCY)
-      printf(" (coherency invalidations: %lu)", L1_icache_coherency_invalidations);
-    println();
-  }
+  output_name = call_stack_profile_name;
+  output_fd   = fd;
 
-  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  print_folded_call_stacks(call_tree);
+
+  output_name = (char*) 0;
+  output_fd   = 1;
+
+  printf("%s: %lu characters of folded call stacks written into %s\n", selfie_name,
+    number_of_written_characters,
+    call_stack_profile_name);
 }
 
 void print_host_os() {
@@ -10480,7 +14038,11 @@ void init_context(uint64_t* context, uint64_t* parent, uint64_t* vctxt) {
 
   // allocate zeroed memory for general-purpose registers
   // TODO: reuse memory
-  set_regs(context, zmalloc(NUMBEROFREGISTERS * SIZEOFUINT64));
+  set_regs(context, smalloc(NUMBEROFREGISTERS * SIZEOFUINT64));
+
+  // zero registers explicitly rather than on demand since, on boot
+  // levels above 0, the hosting kernel accesses them without mapping
+  zero_memory(get_regs(context), NUMBEROFREGISTERS * SIZEOFUINT64);
 
   // allocate zeroed memory for page table
   // TODO: save and reuse memory for page table
@@ -10937,6 +14499,52 @@ void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
   store_virtual_memory(get_pt(context), vaddr, data);
 }
 
+void up_load_page(uint64_t* context, uint64_t page) {
+  uint64_t vaddr;
+  uint64_t page_end;
+
+  // assert: page is not mapped
+
+  vaddr = get_virtual_address_of_page_start(page);
+
+  if (is_code_address(context, vaddr))
+    if ((uint64_t) code_binary % PAGESIZE == 0) {
+      // code is never written: instead of copying page-aligned code,
+      // map its page frame directly into the address space of context
+      map_page(context, page, (uint64_t) code_binary + (vaddr - get_code_seg_start(context)));
+
+      return;
+    }
+
+  map_page(context, page, (uint64_t) palloc());
+
+  page_end = vaddr + PAGESIZE;
+
+  while (vaddr < page_end) {
+    if (is_code_address(context, vaddr))
+      store_virtual_memory(get_pt(context), vaddr, load_code(vaddr - get_code_seg_start(context)));
+    else if (is_data_address(context, vaddr)) {
+      // bss is zeroed by palloc
+      if (vaddr - get_data_seg_start(context) < data_size)
+        store_virtual_memory(get_pt(context), vaddr, load_data(vaddr - get_data_seg_start(context)));
+    }
+
+    vaddr = vaddr + WORDSIZE;
+  }
+}
+
+uint64_t is_virtual_address_mapped_on_demand(uint64_t* context, uint64_t vaddr) {
+  // system calls may access data pages that have not been mapped yet
+  if (is_virtual_address_mapped(get_pt(context), vaddr) == 0)
+    if (is_data_address(context, vaddr)) {
+      up_load_page(context, get_page_of_virtual_address(vaddr));
+
+      major_page_faults = major_page_faults + 1;
+    }
+
+  return is_virtual_address_mapped(get_pt(context), vaddr);
+}
+
 void up_load_binary(uint64_t* context) {
   uint64_t baddr;
 
@@ -10954,24 +14562,28 @@ void up_load_binary(uint64_t* context) {
   set_code_seg_start(context, code_start);
   set_code_seg_size(context, code_size);
   set_data_seg_start(context, data_start);
-  set_data_seg_size(context, data_size);
-  set_heap_seg_start(context, round_up(data_start + data_size, p_align));
+  set_data_seg_size(context, data_size + bss_size);
+  set_heap_seg_start(context, round_up(data_start + data_size + bss_size, p_align));
   set_program_break(context, get_heap_seg_start(context));
 
-  baddr = 0;
+  if (demand_paging == 0) {
+    // otherwise code, data, and bss pages are mapped on first access
 
-  while (baddr < code_size) {
-    map_and_store(context, get_code_seg_start(context) + baddr, load_code(baddr));
+    baddr = 0;
 
-    baddr = baddr + WORDSIZE;
-  }
+    while (baddr < code_size) {
+      up_load_page(context, get_page_of_virtual_address(get_code_seg_start(context) + baddr));
 
-  baddr = 0;
+      baddr = baddr + PAGESIZE;
+    }
+
+    baddr = 0;
 
-  while (baddr < data_size) {
-    map_and_store(context, get_data_seg_start(context) + baddr, load_data(baddr));
+    while (baddr < data_size + bss_size) {
+      up_load_page(context, get_page_of_virtual_address(get_data_seg_start(context) + baddr));
 
-    baddr = baddr + WORDSIZE;
+      baddr = baddr + PAGESIZE;
+    }
   }
 
   set_name(context, binary_name);
@@ -11077,20 +14689,41 @@ uint64_t handle_system_call(uint64_t* context) {
   a7 = *(get_regs(context) + REG_A7);
 
   if (a7 == SYSCALL_BRK) {
+    start_timing(TIMING_BRK);
+
     if (get_gc_enabled_gc(context))
       implement_gc_brk(context);
     else
       implement_brk(context);
-  } else if (a7 == SYSCALL_READ)
+
+    stop_timing(TIMING_BRK);
+  } else if (a7 == SYSCALL_READ) {
+    start_timing(TIMING_READ);
+
     implement_read(context);
-  else if (a7 == SYSCALL_WRITE)
+
+    stop_timing(TIMING_READ);
+  } else if (a7 == SYSCALL_WRITE) {
+    start_timing(TIMING_WRITE);
+
     implement_write(context);
-  else if (a7 == SYSCALL_OPENAT)
+
+    stop_timing(TIMING_WRITE);
+  } else if (a7 == SYSCALL_OPENAT) {
+    start_timing(TIMING_OPENAT);
+
     implement_openat(context);
+
+    stop_timing(TIMING_OPENAT);
+  } else if (a7 == SYSCALL_CLOCK_GETTIME)
+    implement_clock_gettime(context);
   else if (a7 == SYSCALL_EXIT) {
+    start_timing(TIMING_EXIT);
+
     implement_exit(context);
 
-    // TODO: exit only if all contexts have exited
+    stop_timing(TIMING_EXIT);
+
     return EXIT;
   } else {
     printf("%s: unknown system call %lu\n", selfie_name, a7);
@@ -11110,11 +14743,30 @@ uint64_t handle_page_fault(uint64_t* context) {
 
   page = get_fault(context);
 
-  // TODO: reuse frames
-  map_page(context, page, (uint64_t) palloc());
+  if (is_code_address(context, get_virtual_address_of_page_start(page))) {
+    up_load_page(context, page);
+
+    major_page_faults = major_page_faults + 1;
+  } else if (is_data_address(context, get_virtual_address_of_page_start(page))) {
+    if (get_virtual_address_of_page_start(page) < get_data_seg_start(context) + data_size) {
+      up_load_page(context, page);
+
+      major_page_faults = major_page_faults + 1;
+    } else {
+      // bss pages are zero pages
+      map_page(context, page, (uint64_t) palloc());
+
+      minor_page_faults = minor_page_faults + 1;
+    }
+  } else {
+    // TODO: reuse frames
+    map_page(context, page, (uint64_t) palloc());
+
+    minor_page_faults = minor_page_faults + 1;
 
-  if (is_heap_address(context, get_virtual_address_of_page_start(page)))
-    mc_mapped_heap = mc_mapped_heap + PAGESIZE;
+    if (is_heap_address(context, get_virtual_address_of_page_start(page)))
+      mc_mapped_heap = mc_mapped_heap + PAGESIZE;
+  }
 
   return DONOTEXIT;
 }
@@ -11167,6 +14819,26 @@ uint64_t handle_exception(uint64_t* context) {
   }
 }
 
+uint64_t* schedule(uint64_t* context) {
+  uint64_t* next_context;
+
+  // round-robin over all contexts created on my boot level,
+  // contexts created by other boot levels are skipped
+
+  next_context = get_next_context(context);
+
+  while (next_context != context) {
+    if (next_context == (uint64_t*) 0)
+      next_context = used_contexts;
+    else if (get_parent(next_context) == MY_CONTEXT)
+      return next_context;
+    else
+      next_context = get_next_context(next_context);
+  }
+
+  return context;
+}
+
 uint64_t mipster(uint64_t* to_context) {
   uint64_t timeout;
   uint64_t* from_context;
@@ -11184,11 +14856,16 @@ uint64_t mipster(uint64_t* to_context) {
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
-    } else if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else {
-      // TODO: scheduler should go here
-      to_context = from_context;
+    } else {
+      to_context = schedule(from_context);
+
+      if (handle_exception(from_context) == EXIT) {
+        if (to_context == from_context)
+          // exit only if all contexts have exited
+          return get_exit_code(from_context);
+
+        used_contexts = delete_context(from_context, used_contexts);
+      }
 
       timeout = TIMESLICE;
     }
@@ -11204,11 +14881,15 @@ uint64_t hypster(uint64_t* to_context) {
   while (1) {
     from_context = hypster_switch(to_context, TIMESLICE);
 
-    if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else
-      // TODO: scheduler should go here
-      to_context = from_context;
+    to_context = schedule(from_context);
+
+    if (handle_exception(from_context) == EXIT) {
+      if (to_context == from_context)
+        // exit only if all contexts have exited
+        return get_exit_code(from_context);
+
+      used_contexts = delete_context(from_context, used_contexts);
+    }
   }
 }
 
@@ -11272,7 +14953,7 @@ uint64_t mixter(uint64_t* to_context, uint64_t mix) {
   }
 }
 
-uint64_t minmob(uint64_t* to_context) {
+uint64_t minmob(uint64_t* to_context, uint64_t page_faults) {
   uint64_t timeout;
   uint64_t* from_context;
 
@@ -11287,14 +14968,23 @@ uint64_t minmob(uint64_t* to_context) {
 
       timeout = TIMEROFF;
     } else {
-      // minster and mobster do not handle page faults
-      if (get_exception(from_context) == EXCEPTION_PAGEFAULT) {
-        printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(from_context));
-        print_exception(get_exception(from_context), get_fault(from_context));
-        println();
+      if (get_exception(from_context) == EXCEPTION_PAGEFAULT)
+        if (page_faults)
+          // minster handles page faults only as long as
+          // page frames are available, without overcommitting
+          page_faults = pavailable();
+
+      // mobster does not handle page faults
+      if (page_faults == 0)
+        if (get_exception(from_context) == EXCEPTION_PAGEFAULT) {
+          printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(from_context));
+          print_exception(get_exception(from_context), get_fault(from_context));
+          println();
+
+          return EXITCODE_UNCAUGHTEXCEPTION;
+        }
 
-        return EXITCODE_UNCAUGHTEXCEPTION;
-      } else if (handle_exception(from_context) == EXIT)
+      if (handle_exception(from_context) == EXIT)
         return get_exit_code(from_context);
 
       // TODO: scheduler should go here
@@ -11305,34 +14995,14 @@ uint64_t minmob(uint64_t* to_context) {
   }
 }
 
-void map_unmapped_pages(uint64_t* context) {
-  uint64_t page;
-
-  // assert: page table is only mapped from beginning up and end down
-
-  page = get_lowest_lo_page(context);
-
-  while (is_page_mapped(get_pt(context), page))
-    page = page + 1;
-
-  while (pavailable()) {
-    map_page(context, page, (uint64_t) palloc());
-
-    page = page + 1;
-  }
-}
-
 uint64_t minster(uint64_t* to_context) {
   print("minster\n");
   printf("%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n", selfie_name);
 
   // virtual is like physical memory in initial context up to memory size
-  // by mapping unmapped pages (for the heap) to all available page frames
-  // CAUTION: consumes memory even when not accessed
-  map_unmapped_pages(to_context);
-
-  // does not handle page faults, works only until running out of mapped pages
-  return minmob(to_context);
+  // by mapping pages on demand but only to available page frames,
+  // works only until running out of page frames
+  return minmob(to_context, 1);
 }
 
 uint64_t mobster(uint64_t* to_context) {
@@ -11340,7 +15010,7 @@ uint64_t mobster(uint64_t* to_context) {
   printf("%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n", selfie_name);
 
   // does not handle page faults, relies on fancy hypsters to do that
-  return minmob(to_context);
+  return minmob(to_context, 0);
 }
 
 char* replace_extension(char* filename, char* extension) {
@@ -11404,6 +15074,7 @@ void boot_loader(uint64_t* context) {
 
 uint64_t selfie_run(uint64_t machine) {
   uint64_t exit_code;
+  uint64_t i;
 
   if (code_size == 0) {
     printf("%s: nothing to run, debug, or host\n", selfie_name);
@@ -11417,11 +15088,21 @@ uint64_t selfie_run(uint64_t machine) {
     }
   }
 
+  start_timing(TIMING_RUN);
+
   if (machine == CAPSTER) {
     init_all_caches();
 
     L1_CACHE_ENABLED = 1;
 
+    machine = MIPSTER;
+  } else if (machine == LIPSTER) {
+    // lean mipster executes code without profiling
+    lean = 1;
+
+    // and thus also without call stack profile
+    call_stack_profile_name = (char*) 0;
+
     machine = MIPSTER;
   }
 
@@ -11431,13 +15112,35 @@ uint64_t selfie_run(uint64_t machine) {
 
   init_memory(atoi(peek_argument(0)));
 
-  current_context = create_context(MY_CONTEXT, 0);
+  // mobster does not handle page faults, so code and data pages
+  // are only mapped on demand on all other machines
+  if (machine == MOBSTER)
+    demand_paging = 0;
+  else
+    demand_paging = 1;
+
+  // only mipster, the debugger, and hypster schedule more than one context
+  if (machine != MIPSTER)
+    if (machine != DIPSTER)
+      if (machine != HYPSTER)
+        number_of_contexts = 1;
+
+  i = 0;
+
+  while (i < number_of_contexts) {
+    current_context = create_context(MY_CONTEXT, 0);
 
-  // assert: number_of_remaining_arguments() > 0
+    // assert: number_of_remaining_arguments() > 0
 
-  boot_loader(current_context);
+    boot_loader(current_context);
+
+    if (GC_ON)
+      gc_init(current_context);
+
+    i = i + 1;
+  }
 
-  // current_context is ready to run
+  // all contexts are ready to run, current_context runs first
 
   run = 1;
 
@@ -11445,9 +15148,10 @@ uint64_t selfie_run(uint64_t machine) {
     binary_name,
     total_page_frame_memory / MEGABYTE);
 
-  if (GC_ON) {
-    gc_init(current_context);
+  if (number_of_contexts > 1)
+    printf(" in %lu contexts", number_of_contexts);
 
+  if (GC_ON) {
     printf(", gcing every %lu mallocs, ", GC_PERIOD);
     if (GC_REUSE) print("reusing memory"); else print("not reusing memory");
   }
@@ -11479,6 +15183,8 @@ uint64_t selfie_run(uint64_t machine) {
     // change 0 to anywhere between 0% to 100% mipster
     exit_code = mixter(current_context, 0);
 
+  stop_timing(TIMING_RUN);
+
   record = 0;
 
   debug_syscalls = 0;
@@ -11488,9 +15194,12 @@ uint64_t selfie_run(uint64_t machine) {
     get_name(current_context),
     sign_extend(exit_code, SYSCALL_BITWIDTH));
 
-  if (machine != HYPSTER)
+  if (machine != HYPSTER) {
     print_profile(current_context);
-  else if (GC_ON) {
+
+    if (call_tree != (uint64_t*) 0)
+      print_call_stack_profile();
+  } else if (GC_ON) {
     printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
     print_gc_profile(current_context);
   }
@@ -11546,13 +15255,296 @@ uint64_t no_or_bad_or_more_arguments(uint64_t exit_code) {
 }
 
 void print_synopsis(char* extras) {
-  printf("synopsis: %s { -c { source } | -o binary | ( -s | -S ) assembly | -l binary }%s\n", selfie_name, extras);
+  printf("synopsis: %s { -c { source | object } | -o binary | -j object | ( -s | -S ) assembly | -l binary }%s\n", selfie_name, extras);
 }
 
 // -----------------------------------------------------------------
 // ----------------------------- SELFIE ----------------------------
 // -----------------------------------------------------------------
 
+uint64_t selfie_options(uint64_t extras) {
+  while (number_of_remaining_arguments() > 0) {
+    get_argument();
+
+    gc_arguments();
+
+    if (string_compare(argument, "-c"))
+      selfie_compile();
+    else if (string_compare(argument, "-O"))
+      optimize = 1;
+    else if (string_compare(argument, "-O0"))
+      optimize = 0;
+    else if (number_of_remaining_arguments() == 0)
+      // remaining options have at least one argument
+      return EXITCODE_BADARGUMENTS;
+    else if (string_compare(argument, "-o"))
+      selfie_output(get_argument());
+    else if (string_compare(argument, "-j"))
+      selfie_output_object(get_argument());
+    else if (string_compare(argument, "-s"))
+      selfie_disassemble(0);
+    else if (string_compare(argument, "-S"))
+      selfie_disassemble(1);
+    else if (string_compare(argument, "-l"))
+      selfie_load();
+    else if (string_compare(argument, "-p"))
+      call_stack_profile_name = get_argument();
+    else if (string_compare(argument, "-t"))
+      init_timing(get_argument());
+    else if (string_compare(argument, "-x")) {
+      number_of_contexts = atoi(get_argument());
+
+      if (number_of_contexts == 0)
+        number_of_contexts = 1;
+    } else if (extras == 0) {
+      if (string_compare(argument, "-m"))
+        return selfie_run(MIPSTER);
+      else if (string_compare(argument, "-d"))
+        return selfie_run(DIPSTER);
+      else if (string_compare(argument, "-r"))
+        return selfie_run(RIPSTER);
+      else if (string_compare(argument, "-y"))
+        return selfie_run(HYPSTER);
+      else if (string_compare(argument, "-min"))
+        return selfie_run(MINSTER);
+      else if (string_compare(argument, "-mob"))
+        return selfie_run(MOBSTER);
+      else if (string_compare(argument, "-L1"))
+        return selfie_run(CAPSTER);
+      else if (string_compare(argument, "-lean"))
+        return selfie_run(LIPSTER);
+      else if (string_compare(argument, "-serve"))
+        return selfie_serve(get_argument());
+      else
+        return EXITCODE_BADARGUMENTS;
+    } else
+      return EXITCODE_MOREARGUMENTS;
+  }
+
+  return EXITCODE_NOERROR;
+}
+
+void reset_options() {
+  // options of a job do not carry over to the next job
+  optimize = 0;
+
+  GC_REUSE = GC_ENABLED;
+
+  number_of_contexts = 1;
+
+  call_stack_profile_name = (char*) 0;
+
+  lean = 0;
+
+  L1_CACHE_ENABLED = 0;
+
+  // code of the previous job is neither linked nor run
+  code_size        = 0;
+  data_size        = 0;
+  bss_size         = 0;
+  object_code_size = 0;
+}
+
+uint64_t read_job(uint64_t fd) {
+  uint64_t* buffer;
+  uint64_t c;
+  char* s;
+  uint64_t i;
+
+  // a job is a line of console arguments separated by spaces or tabs
+  selfie_argc = 0;
+  selfie_argv = smalloc(MAX_JOB_ARGUMENTS * SIZEOFUINT64STAR);
+
+  buffer = smalloc(SIZEOFUINT64);
+
+  s = (char*) 0;
+  i = 0;
+
+  while (1) {
+    *buffer = 0;
+
+    if (read(fd, buffer, 1) != 1)
+      // end of jobs
+      return selfie_argc > 0;
+
+    c = *buffer;
+
+    if (c == CHAR_LF) {
+      if (selfie_argc > 0)
+        return 1;
+    } else if (c == CHAR_SPACE)
+      s = (char*) 0;
+    else if (c == CHAR_TAB)
+      s = (char*) 0;
+    else if (c != CHAR_CR) {
+      if (s == (char*) 0) {
+        if (selfie_argc == MAX_JOB_ARGUMENTS) {
+          printf("%s: job with more than %lu arguments\n", selfie_name, MAX_JOB_ARGUMENTS);
+
+          exit(EXITCODE_BADARGUMENTS);
+        }
+
+        s = string_alloc(MAX_FILENAME_LENGTH);
+        i = 0;
+
+        *(selfie_argv + selfie_argc) = (uint64_t) s;
+
+        selfie_argc = selfie_argc + 1;
+      }
+
+      if (i == MAX_FILENAME_LENGTH) {
+        printf("%s: job argument %s longer than %lu characters\n", selfie_name, s, MAX_FILENAME_LENGTH);
+
+        exit(EXITCODE_BADARGUMENTS);
+      }
+
+      store_character(s, i, c);
+
+      i = i + 1;
+    }
+  }
+}
+
+uint64_t selfie_serve(char* jobs_name) {
+  uint64_t fd;
+  uint64_t exit_code;
+  uint64_t number_of_jobs;
+
+  // jobs_name is usually a named pipe (FIFO) into which clients
+  // write jobs, one per line, while reading the server's output
+  fd = open_read_only(jobs_name);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not open jobs file %s\n", selfie_name, jobs_name);
+
+    return EXITCODE_IOERROR;
+  }
+
+  printf("%s: selfie serving jobs from %s\n", selfie_name, jobs_name);
+
+  number_of_jobs = 0;
+
+  // everything but options is initialized only once for all jobs,
+  // and libraries such as selfie.h are compiled only once as well
+  // if jobs link their objects, see selfie_load_object, however,
+  // a job that exits, for example on a syntax error, ends serving
+  while (read_job(fd)) {
+    reset_options();
+
+    exit_code = selfie_options(0);
+
+    if (no_or_bad_or_more_arguments(exit_code))
+      print_synopsis(" [ ( -m | -d | -r | -y ) 0-4096 ... ]");
+
+    number_of_jobs = number_of_jobs + 1;
+
+    // clients detect the end of the output of a job by this line
+    printf("%s: job %lu terminated with exit code %ld\n", selfie_name,
+      number_of_jobs,
+      sign_extend(exit_code, SYSCALL_BITWIDTH));
+  }
+
+  printf("%s: %lu jobs served from %s\n", selfie_name, number_of_jobs, jobs_name);
+
+  return EXITCODE_NOERROR;
+}
+
+void init_timing(char* name) {
+  timing_name = name;
+
+  if (TIMINGS != (uint64_t*) 0)
+    // timings accumulate across jobs, see selfie_serve
+    return;
+
+  TIMINGS = smalloc(NUMBEROFTIMINGS * SIZEOFUINT64STAR);
+
+  *(TIMINGS + TIMING_COMPILE)     = (uint64_t) "compile";
+  *(TIMINGS + TIMING_OUTPUT)      = (uint64_t) "output";
+  *(TIMINGS + TIMING_LOAD)        = (uint64_t) "load";
+  *(TIMINGS + TIMING_DISASSEMBLE) = (uint64_t) "disassemble";
+  *(TIMINGS + TIMING_RUN)         = (uint64_t) "run";
+  *(TIMINGS + TIMING_EXIT)        = (uint64_t) "exit";
+  *(TIMINGS + TIMING_READ)        = (uint64_t) "read";
+  *(TIMINGS + TIMING_WRITE)       = (uint64_t) "write";
+  *(TIMINGS + TIMING_OPENAT)      = (uint64_t) "openat";
+  *(TIMINGS + TIMING_BRK)         = (uint64_t) "brk";
+
+  timing_counts      = zmalloc(NUMBEROFTIMINGS * SIZEOFUINT64);
+  timing_wall_times  = zmalloc(NUMBEROFTIMINGS * SIZEOFUINT64);
+  timing_cpu_times   = zmalloc(NUMBEROFTIMINGS * SIZEOFUINT64);
+  timing_wall_starts = zmalloc(NUMBEROFTIMINGS * SIZEOFUINT64);
+  timing_cpu_starts  = zmalloc(NUMBEROFTIMINGS * SIZEOFUINT64);
+}
+
+uint64_t read_clock(uint64_t clock_id) {
+  if (clock_gettime(clock_id, timespec_buffer) != 0)
+    return 0;
+
+  // seconds and nanoseconds in nanoseconds
+  return *timespec_buffer * 1000000000 + *(timespec_buffer + 1);
+}
+
+void start_timing(uint64_t timing) {
+  if (timing_name == (char*) 0)
+    return;
+
+  *(timing_wall_starts + timing) = read_clock(CLOCK_MONOTONIC);
+  *(timing_cpu_starts + timing)  = read_clock(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+void stop_timing(uint64_t timing) {
+  if (timing_name == (char*) 0)
+    return;
+
+  *(timing_wall_times + timing) = *(timing_wall_times + timing)
+    + (read_clock(CLOCK_MONOTONIC) - *(timing_wall_starts + timing));
+  *(timing_cpu_times + timing) = *(timing_cpu_times + timing)
+    + (read_clock(CLOCK_PROCESS_CPUTIME_ID) - *(timing_cpu_starts + timing));
+
+  *(timing_counts + timing) = *(timing_counts + timing) + 1;
+}
+
+void selfie_output_timing(uint64_t exit_code) {
+  uint64_t fd;
+  uint64_t timing;
+
+  // assert: timing_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  fd = open_write_only(timing_name, S_IRUSR_IWUSR_IRGRP_IROTH);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not create timing output file %s\n", selfie_name, timing_name);
+
+    return;
+  }
+
+  // JSON summary of wall-clock and cpu time in nanoseconds
+  dprintf(fd, "{\n  \"exit_code\": %ld,\n", sign_extend(exit_code, SYSCALL_BITWIDTH));
+
+  timing = 0;
+
+  while (timing < NUMBEROFTIMINGS) {
+    if (timing == 0)
+      dprintf(fd, "  \"phases\": {\n");
+    else if (timing == NUMBEROFPHASES)
+      dprintf(fd, "\n  },\n  \"syscalls\": {\n");
+    else
+      dprintf(fd, ",\n");
+
+    dprintf(fd, "    \"%s\": { \"count\": %lu, \"wall_ns\": %lu, \"cpu_ns\": %lu }",
+      (char*) *(TIMINGS + timing),
+      *(timing_counts + timing),
+      *(timing_wall_times + timing),
+      *(timing_cpu_times + timing));
+
+    timing = timing + 1;
+  }
+
+  dprintf(fd, "\n  }\n}\n");
+
+  printf("%s: timing summary written into %s\n", selfie_name, timing_name);
+}
+
 uint64_t selfie(uint64_t extras) {
   if (number_of_remaining_arguments() == 0)
     return EXITCODE_NOARGUMENTS;
@@ -11571,46 +15563,7 @@ uint64_t selfie(uint64_t extras) {
     init_disassembler();
     init_interpreter();
 
-    while (number_of_remaining_arguments() > 0) {
-      get_argument();
-
-      gc_arguments();
-
-      if (string_compare(argument, "-c"))
-        selfie_compile();
-      else if (number_of_remaining_arguments() == 0)
-        // remaining options have at least one argument
-        return EXITCODE_BADARGUMENTS;
-      else if (string_compare(argument, "-o"))
-        selfie_output(get_argument());
-      else if (string_compare(argument, "-s"))
-        selfie_disassemble(0);
-      else if (string_compare(argument, "-S"))
-        selfie_disassemble(1);
-      else if (string_compare(argument, "-l"))
-        selfie_load();
-      else if (extras == 0) {
-        if (string_compare(argument, "-m"))
-          return selfie_run(MIPSTER);
-        else if (string_compare(argument, "-d"))
-          return selfie_run(DIPSTER);
-        else if (string_compare(argument, "-r"))
-          return selfie_run(RIPSTER);
-        else if (string_compare(argument, "-y"))
-          return selfie_run(HYPSTER);
-        else if (string_compare(argument, "-min"))
-          return selfie_run(MINSTER);
-        else if (string_compare(argument, "-mob"))
-          return selfie_run(MOBSTER);
-        else if (string_compare(argument, "-L1"))
-          return selfie_run(CAPSTER);
-        else
-          return EXITCODE_BADARGUMENTS;
-      } else
-        return EXITCODE_MOREARGUMENTS;
-    }
-
-    return EXITCODE_NOERROR;
+    return selfie_options(extras);
   }
 }
 
@@ -11618,6 +15571,9 @@ uint64_t exit_selfie(uint64_t exit_code, char* extras) {
   if (no_or_bad_or_more_arguments(exit_code))
     print_synopsis(extras);
 
+  if (timing_name != (char*) 0)
+    selfie_output_timing(exit_code);
+
   if (exit_code == EXITCODE_MOREARGUMENTS)
     return EXITCODE_BADARGUMENTS;
   else if (exit_code == EXITCODE_NOARGUMENTS)
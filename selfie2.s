@@ -0,0 +1,39372 @@
+lui t0,0x39
+addi t0,t0,-1104
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+addi a0,zero,0
+ld a0,0(sp)
+addi a1,sp,8
+jal ra,37420
+nop
+nop
+nop
+nop
+nop
+addi a7,zero,93
+ecall
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+addi a3,a2,0
+addi a2,a1,0
+addi a1,a0,0
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+addi t0,a0,0
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+addi a7,zero,113
+ecall
+jalr zero,0(ra)
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi t0,gp,-432
+sd t0,0(gp)
+addi t1,t0,8
+sub t0,t1,t0
+sd t0,-16(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-24(gp)
+ld t0,0(gp)
+addi t1,t0,8
+sub t0,t1,t0
+sd t0,-32(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-40(gp)
+ld t0,-16(gp)
+sd t0,-48(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-56(gp)
+ld t0,-24(gp)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,3714
+addi t0,a0,0
+sd t0,8(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,8(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,8(gp)
+addi t2,s1,-1
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+addi s1,s1,1
+jal zero,-19
+addi t0,zero,-1
+sd t0,16(gp)
+ld t0,-24(gp)
+addi a0,t0,-1
+jal ra,1770
+addi t0,a0,0
+sd t0,32(gp)
+addi t0,t0,-1
+sd t0,24(gp)
+ld a0,-16(gp)
+jal ra,3678
+addi t0,a0,0
+sd t0,40(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld a0,-24(gp)
+jal ra,2184
+addi t0,a0,0
+sd t0,48(gp)
+ld a0,-280(gp)
+jal ra,2180
+addi t0,a0,0
+sd t0,56(gp)
+ld a0,-288(gp)
+jal ra,2176
+addi t0,a0,0
+sd t0,64(gp)
+ld a0,-16(gp)
+jal ra,3660
+addi t0,a0,0
+sd t0,72(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-16(gp)
+addi t1,zero,2
+mul a0,t0,t1
+jal ra,3652
+addi t0,a0,0
+sd t0,80(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,80(gp)
+addi t0,t0,8
+addi t1,zero,0
+sd t1,0(t0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,88(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-696(gp)
+addi t0,t0,1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,3626
+addi t0,a0,0
+sd t0,136(gp)
+ld t1,128(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-736
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-448(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-752
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-456(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-760
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-464(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-776
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-472(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-792
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-480(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-800
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-488(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-808
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-496(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-816
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-504(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-824
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-512(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-832
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-520(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-840
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-528(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-848
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-536(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-856
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-544(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-864
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-872
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-880
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-888
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-896
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-904
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-912
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-920
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-928
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-936
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-944
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-952
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-960
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-968
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-976
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-984
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-992
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1000
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1016
+sd t1,0(t0)
+ld t0,136(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1024
+sd t1,0(t0)
+ld t0,-72(gp)
+sd t0,184(gp)
+ld t0,-440(gp)
+sd t0,200(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+sd t0,-728(gp)
+addi t0,zero,0
+sd t0,192(gp)
+jal ra,3608
+addi t0,zero,0
+sd t0,208(gp)
+addi t0,zero,0
+sd t0,216(gp)
+addi t0,zero,0
+sd t0,224(gp)
+addi t0,zero,0
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+addi t1,zero,2
+mul t0,t0,t1
+ld t1,-16(gp)
+addi t2,zero,7
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,3351
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,32(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,40(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,48(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,56(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,64(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1128(gp)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,3382
+addi t0,a0,0
+sd t0,256(gp)
+addi t0,zero,0
+sd t0,264(gp)
+addi t0,zero,0
+sd t0,272(gp)
+addi t0,zero,0
+sd t0,280(gp)
+addi t0,zero,0
+sd t0,288(gp)
+addi t0,zero,0
+sd t0,296(gp)
+addi t0,zero,0
+sd t0,304(gp)
+addi t0,zero,0
+sd t0,312(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,392(gp)
+addi t0,zero,0
+sd t0,400(gp)
+addi t0,zero,0
+sd t0,408(gp)
+addi t0,zero,0
+sd t0,416(gp)
+addi t0,zero,0
+sd t0,424(gp)
+addi t0,zero,0
+sd t0,432(gp)
+addi t0,zero,0
+sd t0,232(gp)
+jal ra,3964
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+addi t1,zero,3
+mul t0,t0,t1
+ld t1,-16(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,3254
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,32(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,40(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,48(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi a0,gp,-1240
+jal ra,1770
+addi t0,a0,0
+sd t0,512(gp)
+addi a0,gp,-1248
+jal ra,1766
+addi t0,a0,0
+sd t0,520(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1256(gp)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,3203
+addi t0,a0,0
+sd t0,568(gp)
+ld t1,560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1536
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1288(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1544
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1296(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1552
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1304(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1560
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1312(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1568
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1320(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1576
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1328(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1584
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1336(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1592
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1344(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1600
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1352(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1608
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1616
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1624
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1376(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1632
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1384(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1640
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1392(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1648
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1400(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1656
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1408(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1664
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1416(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1672
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1424(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1680
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1432(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1688
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1440(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1696
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1448(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1704
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1456(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1712
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1464(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1720
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1472(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1728
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1480(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1736
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1488(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1744
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1496(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1752
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1504(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1760
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1512(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1768
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1520(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1776
+sd t1,0(t0)
+ld t0,568(gp)
+ld t1,-1528(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,gp,-1784
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,832(gp)
+addi t0,zero,0
+sd t0,840(gp)
+addi t0,zero,0
+sd t0,848(gp)
+addi t0,zero,0
+sd t0,856(gp)
+addi t0,zero,0
+sd t0,864(gp)
+addi t0,zero,0
+sd t0,872(gp)
+addi t0,zero,0
+sd t0,880(gp)
+addi t0,zero,0
+sd t0,888(gp)
+addi t0,zero,0
+sd t0,896(gp)
+addi t0,zero,0
+sd t0,904(gp)
+addi t0,zero,0
+sd t0,912(gp)
+addi t0,zero,0
+sd t0,920(gp)
+addi t0,zero,0
+sd t0,928(gp)
+addi t0,zero,0
+sd t0,936(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+ld t1,-16(gp)
+addi t2,zero,6
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,2934
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,32(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,40(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,48(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+ld t1,-16(gp)
+addi t2,zero,3
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,2969
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+lui t0,0x1
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,2
+lui a0,0x1
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+mul t0,t0,t1
+sd t0,1152(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+ld t1,-32(gp)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1784(t1)
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,1160(gp)
+addi t0,zero,0
+sd t0,1088(gp)
+addi t0,zero,0
+sd t0,1168(gp)
+addi t0,zero,0
+sd t0,1176(gp)
+addi t0,zero,0
+sd t0,1184(gp)
+jalr zero,0(ra)
+addi a0,zero,0
+jalr zero,0(ra)
+addi a0,zero,0
+jalr zero,0(ra)
+addi a0,zero,0
+jalr zero,0(ra)
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi a0,zero,0
+ld a1,16(s0)
+jal ra,24578
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,1280(gp)
+addi t0,zero,0
+sd t0,1288(gp)
+addi t0,zero,0
+sd t0,1296(gp)
+addi t0,zero,0
+sd t0,1304(gp)
+addi t0,zero,0
+sd t0,1312(gp)
+addi t0,zero,0
+sd t0,1320(gp)
+addi t0,zero,0
+sd t0,1328(gp)
+addi t0,zero,0
+sd t0,1336(gp)
+addi t0,zero,0
+sd t0,1344(gp)
+addi t0,zero,0
+sd t0,1352(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1624(t0)
+addi t0,t0,1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,2785
+addi t0,a0,0
+sd t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1616
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1608
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1600
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1592
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1584
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1576
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1568
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1560
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-64(gp)
+beq t0,zero,24
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1552
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1544
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,23
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1536
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1528
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1520
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1512
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1504
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1360(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1496
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2661
+addi t0,a0,0
+sd t0,1392(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2653
+addi t0,a0,0
+sd t0,1400(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+addi t1,zero,3
+mul t0,t0,t1
+ld t1,-16(gp)
+addi t2,zero,2
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,2634
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,32(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+addi t0,t0,1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,2532
+addi t0,a0,0
+sd t0,1416(gp)
+ld t1,1408(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1384
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1368
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1344
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1336
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1320
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1296
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1424(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1280
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1416(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1256
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,1416(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1232
+add t1,gp,t1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,1512(gp)
+addi t0,zero,0
+sd t0,1520(gp)
+addi t0,zero,0
+sd t0,1528(gp)
+addi t0,zero,0
+sd t0,1536(gp)
+addi t0,zero,0
+sd t0,1544(gp)
+addi t0,zero,0
+sd t0,1560(gp)
+ld t0,1504(gp)
+sd t0,1552(gp)
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,1568(gp)
+addi t0,zero,0
+sd t0,1576(gp)
+addi t0,zero,0
+sd t0,1584(gp)
+addi t0,zero,0
+sd t0,1592(gp)
+addi t0,zero,0
+sd t0,1600(gp)
+addi t0,zero,0
+sd t0,1608(gp)
+addi t0,zero,0
+sd t0,1616(gp)
+addi t0,zero,0
+sd t0,1624(gp)
+addi t0,zero,0
+sd t0,1632(gp)
+addi t0,zero,0
+sd t0,1640(gp)
+addi t0,zero,0
+sd t0,1648(gp)
+addi t0,zero,0
+sd t0,1656(gp)
+addi t0,zero,0
+sd t0,1664(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,1672(gp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2444
+addi t0,a0,0
+sd t0,1680(gp)
+addi t0,zero,0
+sd t0,1688(gp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2432
+addi t0,a0,0
+sd t0,1696(gp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2422
+addi t0,a0,0
+sd t0,1704(gp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2412
+addi t0,a0,0
+sd t0,1712(gp)
+ld t0,1720(gp)
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,zero,0
+ld a1,968(gp)
+jal ra,30564
+addi t0,a0,0
+sd t0,1728(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,1728(gp)
+ld t0,1728(gp)
+sd t0,1736(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-1256(gp)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2382
+addi t0,a0,0
+sd t0,1752(gp)
+ld t0,-1256(gp)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,2376
+addi t0,a0,0
+sd t0,1760(gp)
+ld t1,-1296(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,1760(gp)
+ld t1,-1344(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,1760(gp)
+ld t1,-1408(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+addi a0,s1,0
+jal ra,15443
+addi t0,a0,0
+beq t0,zero,8
+ld t0,1760(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi s1,s1,1
+jal zero,-16
+addi t0,zero,0
+sd t0,1768(gp)
+addi t0,zero,0
+sd t0,1776(gp)
+addi t0,zero,0
+sd t0,1784(gp)
+addi t0,zero,0
+sd t0,1792(gp)
+addi t0,zero,0
+sd t0,1800(gp)
+addi t0,zero,0
+sd t0,1808(gp)
+addi t0,zero,0
+sd t0,1816(gp)
+addi t0,zero,0
+sd t0,1824(gp)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,1832(gp)
+addi t0,zero,0
+sd t0,1840(gp)
+addi t0,zero,0
+sd t0,1848(gp)
+addi t0,zero,0
+sd t0,1856(gp)
+addi t0,zero,0
+sd t0,1864(gp)
+addi t0,zero,0
+sd t0,1872(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-747
+jal ra,-636
+jal ra,-190
+jal ra,-164
+jal ra,-99
+jal ra,-22
+jal ra,21514
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+addi t1,zero,9
+mul t0,t0,t1
+ld t1,-16(gp)
+addi t2,zero,16
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,2202
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi a0,a0,16
+jalr zero,0(ra)
+addi a0,a0,24
+jalr zero,0(ra)
+addi a0,a0,32
+jalr zero,0(ra)
+addi a0,a0,40
+jalr zero,0(ra)
+addi a0,a0,48
+jalr zero,0(ra)
+addi a0,a0,56
+jalr zero,0(ra)
+addi a0,a0,64
+jalr zero,0(ra)
+addi a0,a0,72
+jalr zero,0(ra)
+addi a0,a0,80
+jalr zero,0(ra)
+addi a0,a0,88
+jalr zero,0(ra)
+addi a0,a0,96
+jalr zero,0(ra)
+addi a0,a0,104
+jalr zero,0(ra)
+addi a0,a0,112
+jalr zero,0(ra)
+addi a0,a0,120
+jalr zero,0(ra)
+addi a0,a0,128
+jalr zero,0(ra)
+addi a0,a0,136
+jalr zero,0(ra)
+addi a0,a0,168
+jalr zero,0(ra)
+addi a0,a0,176
+jalr zero,0(ra)
+addi a0,a0,184
+jalr zero,0(ra)
+addi a0,a0,192
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,8(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,16(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,24(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,32(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,40(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,48(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,56(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,64(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,72(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,80(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,88(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,96(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,104(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,112(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,120(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,128(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,136(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,144(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,152(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,160(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,168(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,176(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,184(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,192(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,1896(gp)
+ld t0,1904(gp)
+sltu t0,zero,t0
+beq t0,zero,7
+ld a0,1904(gp)
+ld a1,1904(gp)
+jal ra,31113
+addi t0,a0,0
+sd t0,1904(gp)
+jal zero,-8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+sd t0,1976(gp)
+ld t0,24(s0)
+sd t0,1984(gp)
+jal ra,34426
+addi t0,a0,0
+sd t0,2000(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-16(gp)
+ld t1,-32(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1192(t0)
+jal ra,-1752
+ld t0,-24(gp)
+addi t0,t0,-64
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,-24(gp)
+addi t0,t0,-32
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+addi t0,zero,0
+sd t0,-64(gp)
+addi t0,zero,1
+sd t0,-2024(gp)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,2016(t1)
+addi t0,zero,52
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,2008(t1)
+addi t0,zero,32
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,2000(t1)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1192(t0)
+jal ra,-1782
+jal ra,21056
+addi t0,a0,0
+beq t0,zero,48
+ld a0,2000(gp)
+jal ra,14651
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,202
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,2032(gp)
+jal zero,33
+ld a0,-8(s0)
+ld a1,72(gp)
+addi a2,zero,1
+jal ra,-1801
+ld t0,72(gp)
+ld t0,0(t0)
+ld t1,-1984(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+sd t0,2032(gp)
+jal zero,17
+ld t0,72(gp)
+ld t0,0(t0)
+ld t1,-2016(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,2032(gp)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,2032(gp)
+jal zero,3
+ld t0,2024(gp)
+sd t0,2032(gp)
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-312(gp)
+sd t0,-328(gp)
+ld t0,-352(gp)
+sd t0,-368(gp)
+ld t0,-360(gp)
+sd t0,-376(gp)
+jal zero,14
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,888(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-320(gp)
+sd t0,-328(gp)
+jal zero,3
+ld t0,-304(gp)
+sd t0,-328(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,8(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,9
+ld t0,16(s0)
+addi a0,t0,-1
+jal ra,-13
+addi t0,a0,0
+addi t1,zero,10
+mul a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-41
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-61
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-33
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-89
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+remu a0,t0,t1
+jal zero,6
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-46
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,14
+addi t0,a0,0
+beq t0,zero,4
+ld t0,16(s0)
+sub a0,zero,t0
+jal zero,4
+ld a0,16(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+ld t1,32(gp)
+add t0,t0,t1
+addi t2,a1,0
+add t1,t2,t1
+sltu a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,32(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,24(s0)
+ld t1,32(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,81
+ld a0,24(s0)
+addi a1,zero,0
+jal ra,-29
+addi t0,a0,0
+beq t0,zero,11
+ld t0,32(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-57
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+jal zero,66
+ld t0,32(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub a0,zero,t0
+jal zero,61
+jal zero,59
+ld t0,24(s0)
+ld t1,32(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,52
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-58
+addi t0,a0,0
+beq t0,zero,26
+ld a0,24(s0)
+addi a1,zero,0
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,13
+ld a0,16(s0)
+jal ra,-88
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-93
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+jal zero,30
+ld a0,16(s0)
+jal ra,-100
+addi t0,a0,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub a0,zero,t0
+jal zero,23
+jal zero,21
+ld a0,24(s0)
+addi a1,zero,0
+jal ra,-88
+addi t0,a0,0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-116
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+sub a0,zero,t0
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,-1
+jal ra,-249
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,-1
+jal ra,-262
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sub t1,zero,t1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi a0,t0,-1
+jal ra,-292
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-304
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,0
+ld a2,24(s0)
+jal ra,-254
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-16(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+ld t0,24(s0)
+ld t1,-16(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul a1,t0,t1
+addi a2,zero,8
+jal ra,-283
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-16(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-58
+ld t0,24(s0)
+ld t1,-16(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul a1,t0,t1
+jal ra,-364
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+ld t0,24(s0)
+ld t1,-16(gp)
+remu t0,t0,t1
+addi t1,zero,8
+mul a1,t0,t1
+jal ra,-381
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld a0,16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,1
+jal ra,1552
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi s1,zero,0
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-118
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,3
+addi s1,s1,1
+jal zero,-7
+addi a0,s1,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-33
+addi s1,a0,0
+addi s2,zero,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,12
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-150
+addi t0,a0,-32
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s1,s2,0
+jal zero,2
+addi s2,s2,1
+jal zero,-14
+addi a0,s1,0
+jal ra,-65
+addi s3,a0,0
+addi s2,zero,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,17
+addi a0,s3,0
+addi a1,s2,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-174
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-151
+addi s2,s2,1
+jal zero,-19
+addi a0,s3,0
+addi a1,s2,0
+addi a2,zero,0
+jal ra,-157
+addi a0,s3,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+ld a0,16(s0)
+jal ra,-99
+addi s2,a0,-1
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-215
+addi s3,a0,0
+ld a0,16(s0)
+addi a1,s1,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-224
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-201
+ld a0,16(s0)
+addi a1,s2,0
+addi a2,s3,0
+jal ra,-205
+addi s1,s1,1
+addi s2,s2,-1
+jal zero,-28
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,zero,1
+beq t0,zero,41
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-259
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld a0,24(s0)
+addi a1,s1,0
+jal ra,-266
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,26
+addi a0,zero,0
+jal zero,24
+jal zero,21
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-278
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+addi a1,s1,0
+jal ra,-284
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s1,s1,1
+jal zero,3
+addi a0,zero,0
+jal zero,3
+jal zero,-41
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi s2,zero,0
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-317
+addi s3,a0,0
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,92
+addi s3,s3,-48
+addi t0,zero,9
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1018
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-2540
+addi t0,s2,0
+ld t1,16(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,s2,0
+addi t1,zero,10
+mul t0,t0,t1
+addi t1,s3,0
+add s2,t0,t1
+jal zero,54
+addi t0,s2,0
+ld t1,16(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+addi t0,zero,1
+ld t1,16(gp)
+addi t2,zero,10
+remu t1,t1,t2
+addi t2,s3,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,7
+addi t0,s2,0
+addi t1,zero,10
+mul t0,t0,t1
+addi t1,s3,0
+add s2,t0,t1
+jal zero,16
+lui t0,0xFFFFF
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,969
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-2589
+jal zero,16
+lui t0,0xFFFFF
+addi t0,t0,736
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,953
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-2605
+addi s1,s1,1
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-410
+addi s3,a0,0
+jal zero,-93
+addi a0,s2,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,24(s0)
+addi a1,zero,0
+addi a2,zero,48
+jal ra,-414
+addi s1,zero,1
+jal zero,18
+ld t0,40(s0)
+beq t0,zero,16
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-655
+addi t0,a0,0
+beq t0,zero,11
+ld t0,32(s0)
+addi t0,t0,-10
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,28
+addi t0,zero,9
+ld t1,16(s0)
+ld t2,32(s0)
+remu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,24(s0)
+addi a1,s1,0
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi a2,t0,55
+jal ra,-449
+jal zero,8
+ld a0,24(s0)
+addi a1,s1,0
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi a2,t0,48
+jal ra,-457
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+addi s1,s1,1
+jal zero,-29
+ld t0,32(s0)
+addi t0,t0,-10
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-16(s0)
+beq t0,zero,6
+ld a0,24(s0)
+addi a1,s1,0
+addi a2,zero,45
+jal ra,-474
+addi s1,s1,1
+addi t0,s1,0
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,24(s0)
+addi a1,s1,0
+addi a2,zero,32
+jal ra,-483
+addi s1,s1,1
+jal zero,-9
+jal zero,11
+addi t0,s1,0
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,24(s0)
+addi a1,s1,0
+addi a2,zero,48
+jal ra,-494
+addi s1,s1,1
+jal zero,-9
+ld a0,24(s0)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-500
+ld a0,24(s0)
+jal ra,-335
+ld a0,24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-876
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-889
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,24(s0)
+addi a0,t0,4
+jal ra,-915
+addi t0,a0,0
+ld t1,16(s0)
+divu a0,t0,t1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-938
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-958
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+remu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+addi a2,zero,2
+jal ra,-114
+addi a1,zero,2
+jal ra,-51
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+addi a2,zero,2
+jal ra,-131
+addi a1,zero,2
+jal ra,-48
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+sltu t0,zero,t0
+beq t0,zero,10
+ld a0,16(s0)
+ld a1,24(s0)
+addi a2,zero,4
+jal ra,-151
+addi a1,zero,4
+jal ra,-112
+addi a1,zero,2
+jal ra,-90
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+sltu t0,zero,t0
+beq t0,zero,10
+ld a0,16(s0)
+ld a1,24(s0)
+addi a2,zero,4
+jal ra,-177
+addi a1,zero,4
+jal ra,-138
+addi a1,zero,2
+jal ra,-96
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,112(gp)
+beq t0,zero,9
+ld a0,112(gp)
+ld a1,120(gp)
+ld a2,16(s0)
+jal ra,-712
+ld t0,120(gp)
+addi t0,t0,1
+sd t0,120(gp)
+jal zero,71
+ld t0,40(gp)
+beq t0,zero,65
+ld t0,40(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-400(gp)
+addi t0,t0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,2032(gp)
+ld t1,2024(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,728
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,586
+addi sp,sp,8
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld a0,-400(gp)
+ld a1,40(gp)
+addi a2,zero,1
+jal ra,-2970
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld a0,-400(gp)
+ld a1,40(gp)
+addi a2,zero,1
+jal ra,-2977
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t0,t0,-1
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,-400(gp)
+addi t0,t0,-1
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,1
+sd t0,-400(gp)
+lui t0,0xFFFFF
+addi t0,t0,672
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,104(gp)
+sd t0,16(sp)
+jal ra,549
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-3009
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-3014
+ld t0,96(gp)
+addi t0,t0,1
+sd t0,96(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,664
+add a0,gp,t0
+jal ra,-14
+jal zero,14
+addi s1,zero,0
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-843
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,7
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-849
+jal ra,-120
+addi s1,s1,1
+jal zero,-11
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-96(gp)
+jal ra,-134
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-128(gp)
+jal ra,-146
+ld t0,16(s0)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,648
+add a0,gp,t0
+jal ra,-62
+jal zero,36
+ld t0,16(s0)
+ld t1,-88(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,632
+add a0,gp,t0
+jal ra,-73
+jal zero,25
+ld t0,16(s0)
+ld t1,-96(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,616
+add a0,gp,t0
+jal ra,-84
+jal zero,14
+ld t0,16(s0)
+ld t1,-104(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,600
+add a0,gp,t0
+jal ra,-95
+jal zero,3
+ld a0,16(s0)
+jal ra,-192
+ld a0,-128(gp)
+jal ra,-194
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,48(gp)
+addi a2,zero,10
+addi a3,zero,0
+addi a4,zero,0
+jal ra,-518
+jal ra,-117
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,48(gp)
+addi a2,zero,10
+addi a3,zero,1
+addi a4,zero,0
+jal ra,-535
+jal ra,-134
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,48(gp)
+addi a2,zero,16
+addi a3,zero,0
+ld a4,24(s0)
+jal ra,-553
+jal ra,-152
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,592
+add a0,gp,t0
+jal ra,-167
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-30
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,48(gp)
+addi a2,zero,8
+addi a3,zero,0
+ld a4,24(s0)
+jal ra,-589
+jal ra,-188
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,48(gp)
+addi a2,zero,2
+addi a3,zero,0
+ld a4,24(s0)
+jal ra,-607
+jal ra,-206
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1047
+addi t0,a0,-115
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,32(s0)
+jal ra,-229
+ld t0,24(s0)
+addi a0,t0,1
+jal zero,210
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1059
+addi t0,a0,-99
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,32(s0)
+jal ra,-335
+ld t0,24(s0)
+addi a0,t0,1
+jal zero,198
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1071
+addi t0,a0,-46
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,76
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1079
+addi s1,a0,-48
+addi t0,s1,0
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,66
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,2
+jal ra,-1088
+addi t0,a0,-108
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,3
+jal ra,-1096
+addi t0,a0,-117
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,32(s0)
+ld a1,48(gp)
+addi a2,zero,10
+addi a3,zero,0
+addi a4,zero,0
+jal ra,-684
+jal zero,19
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,3
+jal ra,-1111
+addi t0,a0,-100
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,32(s0)
+ld a1,48(gp)
+addi a2,zero,10
+addi a3,zero,1
+addi a4,zero,0
+jal ra,-699
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,4
+jal zero,141
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,19
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,48(gp)
+jal ra,-1025
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub s1,t0,t1
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,5
+addi a0,zero,48
+jal ra,-412
+addi s1,s1,-1
+jal zero,-6
+ld a0,48(gp)
+jal ra,-322
+ld t0,24(s0)
+addi a0,t0,4
+jal zero,117
+jal zero,115
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1153
+addi t0,a0,-48
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1161
+addi s1,a0,-48
+addi t0,s1,0
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,2
+jal ra,-1170
+addi t0,a0,-108
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,3
+jal ra,-1178
+addi t0,a0,-88
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,32(s0)
+addi a1,s1,0
+jal ra,-221
+ld t0,24(s0)
+addi a0,t0,4
+jal zero,78
+jal zero,76
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1192
+addi t0,a0,-108
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1200
+addi t0,a0,-117
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,32(s0)
+jal ra,-276
+ld t0,24(s0)
+addi a0,t0,2
+jal zero,57
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1213
+addi t0,a0,-100
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,32(s0)
+jal ra,-272
+ld t0,24(s0)
+addi a0,t0,2
+jal zero,44
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1226
+addi t0,a0,-88
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-269
+ld t0,24(s0)
+addi a0,t0,2
+jal zero,30
+ld a0,16(s0)
+ld t0,24(s0)
+addi a1,t0,1
+jal ra,-1240
+addi t0,a0,-111
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-247
+ld t0,24(s0)
+addi a0,t0,2
+jal zero,16
+jal zero,14
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1254
+addi t0,a0,-98
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-243
+ld t0,24(s0)
+addi a0,t0,1
+jal zero,2
+ld a0,24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,24(s0)
+beq t0,zero,6
+ld t0,24(s0)
+sd t0,112(gp)
+addi t0,zero,0
+sd t0,120(gp)
+jal zero,3
+ld t0,16(s0)
+sd t0,-400(gp)
+addi t0,zero,0
+sd t0,96(gp)
+addi s1,zero,0
+ld t0,32(s0)
+sltu t0,zero,t0
+beq t0,zero,47
+ld a0,32(s0)
+addi a1,s1,0
+jal ra,-1299
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,35
+ld a0,32(s0)
+addi a1,s1,0
+jal ra,-1305
+addi t0,a0,-37
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi s1,s1,1
+ld a0,32(s0)
+addi a1,s1,0
+jal ra,-1313
+addi t0,a0,-37
+sltu t0,zero,t0
+beq t0,zero,11
+ld a0,32(s0)
+addi a1,s1,0
+ld t1,40(s0)
+ld t0,0(t1)
+addi t1,t1,8
+sd t1,40(s0)
+addi a2,t0,0
+jal ra,-288
+addi s1,a0,0
+jal zero,4
+addi a0,zero,37
+jal ra,-598
+addi s1,s1,1
+jal zero,6
+ld a0,32(s0)
+addi a1,s1,0
+jal ra,-1333
+jal ra,-604
+addi s1,s1,1
+jal zero,-39
+ld t0,24(s0)
+beq t0,zero,5
+ld a0,24(s0)
+ld a1,120(gp)
+addi a2,zero,0
+jal ra,-1313
+addi t0,zero,0
+sd t0,112(gp)
+addi t0,zero,0
+sd t0,120(gp)
+ld a0,96(gp)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,24
+add t1,t1,s0
+sd t1,-8(s0)
+addi a0,zero,1
+addi a1,zero,0
+ld a2,16(s0)
+ld a3,-8(s0)
+jal ra,-96
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,32
+add t1,t1,s0
+sd t1,-8(s0)
+addi a0,zero,0
+ld a1,16(s0)
+ld a2,24(s0)
+ld a3,-8(s0)
+jal ra,-119
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t1,zero,32
+add t1,t1,s0
+sd t1,-8(s0)
+ld a0,16(s0)
+addi a1,zero,0
+ld a2,24(s0)
+ld a3,-8(s0)
+jal ra,-142
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+lui t0,0xFFFFF
+addi t0,t0,560
+add a1,gp,t0
+jal ra,-1186
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,552
+add a0,gp,t0
+jal ra,-1307
+jal zero,26
+ld a0,16(s0)
+lui t0,0xFFFFF
+addi t0,t0,536
+add a1,gp,t0
+jal ra,-1198
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+addi t0,t0,528
+add a0,gp,t0
+jal zero,15
+ld a0,16(s0)
+lui t0,0xFFFFF
+addi t0,t0,512
+add a1,gp,t0
+jal ra,-1209
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+addi t0,t0,504
+add a0,gp,t0
+jal zero,4
+ld a0,16(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-400(gp)
+addi t0,t0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-134
+addi sp,sp,8
+jal zero,38
+ld t0,-400(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,488
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-100
+addi sp,sp,8
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-1711
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,440
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,104(gp)
+sd t0,16(sp)
+jal ra,-164
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-3722
+ld t0,88(gp)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,88(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,a1,0
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,8
+addi t0,a0,0
+addi t1,a1,0
+remu t2,t0,t1
+sub t0,t0,t2
+add a0,t0,t1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld a0,24(s0)
+ld a1,-16(gp)
+jal ra,-25
+addi t0,a0,0
+ld t1,-16(gp)
+divu t0,t0,t1
+sd t0,24(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi s1,s1,1
+jal zero,-12
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1208(gp)
+beq t0,zero,6
+ld a0,16(s0)
+jal ra,-2838
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,5
+ld a0,16(s0)
+jal ra,-3781
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,22
+ld t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,17
+ld t0,40(gp)
+beq t0,zero,10
+lui t0,0xFFFFF
+addi t0,t0,408
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-266
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1144(t0)
+jal ra,-3824
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,1208(gp)
+sd t0,-8(s0)
+ld t0,1192(gp)
+sd t0,1208(gp)
+ld a0,16(s0)
+jal ra,-60
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+sd t0,1208(gp)
+ld a0,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1208(gp)
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-2908
+jal zero,5
+ld a0,16(s0)
+jal ra,-3849
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-136(gp)
+jal ra,-949
+ld t0,16(s0)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,392
+add a0,gp,t0
+jal ra,-865
+jal zero,8
+ld t0,136(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,-873
+ld a0,-136(gp)
+jal ra,-969
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,360
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,240(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-370
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,344
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-35
+lui t0,0xFFFFF
+addi t0,t0,336
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-394
+addi sp,sp,8
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,320
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-62
+ld a0,16(s0)
+jal ra,-899
+lui t0,0xFFFFF
+addi t0,t0,304
+add a0,gp,t0
+jal ra,-949
+ld a0,184(gp)
+jal ra,-905
+lui t0,0xFFFFF
+addi t0,t0,296
+add a0,gp,t0
+jal ra,-955
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,280
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-92
+lui t0,0xFFFFF
+addi t0,t0,264
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-451
+addi sp,sp,8
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,248(gp)
+ld a1,40(gp)
+addi a2,zero,1
+jal ra,-4020
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,t0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,40(gp)
+ld t0,0(t0)
+sd t0,184(gp)
+ld t0,192(gp)
+addi t0,t0,1
+sd t0,192(gp)
+jal zero,23
+ld t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-72(gp)
+sd t0,184(gp)
+jal zero,16
+lui t0,0xFFFFF
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,240(gp)
+sd t0,16(sp)
+jal ra,-499
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-4057
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,184(gp)
+ld t1,-96(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,184(gp)
+ld t1,-104(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,184(gp)
+ld t1,-112(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,184(gp)
+ld t1,-88(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+jal ra,-40
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi s2,zero,0
+addi t0,zero,1
+beq t0,zero,134
+addi t0,s1,0
+beq t0,zero,19
+jal ra,-61
+addi t0,a0,0
+beq t0,zero,3
+addi s1,zero,0
+jal zero,13
+ld t0,184(gp)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,184(gp)
+jal zero,120
+ld t0,208(gp)
+addi t0,t0,1
+sd t0,208(gp)
+jal ra,-126
+jal zero,113
+addi t0,s2,0
+beq t0,zero,50
+ld t0,184(gp)
+ld t1,-208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,208(gp)
+addi t0,t0,1
+sd t0,208(gp)
+jal ra,-139
+ld t0,184(gp)
+ld t1,-216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+addi s2,zero,0
+jal zero,-17
+addi t0,s2,0
+beq t0,zero,25
+ld t0,184(gp)
+ld t1,-96(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-728(gp)
+addi t0,t0,1
+sd t0,-728(gp)
+jal zero,15
+ld t0,184(gp)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,136
+add a0,gp,t0
+jal ra,-253
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4187
+ld t0,208(gp)
+addi t0,t0,1
+sd t0,208(gp)
+jal ra,-177
+jal zero,62
+jal ra,-110
+addi t0,a0,0
+beq t0,zero,15
+ld t0,184(gp)
+ld t1,-96(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-728(gp)
+addi t0,t0,1
+sd t0,-728(gp)
+ld t0,208(gp)
+addi t0,t0,1
+sd t0,208(gp)
+jal ra,-194
+jal zero,45
+ld t0,184(gp)
+ld t1,-216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-202
+ld t0,184(gp)
+ld t1,-216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi s1,zero,1
+ld t0,208(gp)
+addi t0,t0,2
+sd t0,208(gp)
+ld t0,216(gp)
+addi t0,t0,1
+sd t0,216(gp)
+jal ra,-216
+jal zero,20
+ld t0,184(gp)
+ld t1,-208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi s2,zero,1
+ld t0,208(gp)
+addi t0,t0,2
+sd t0,208(gp)
+ld t0,216(gp)
+addi t0,t0,1
+sd t0,216(gp)
+jal ra,-231
+jal zero,5
+ld t0,-592(gp)
+sd t0,200(gp)
+ld a0,184(gp)
+jal zero,6
+jal zero,3
+ld a0,184(gp)
+jal zero,3
+jal zero,-134
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,zero,1
+ld t1,184(gp)
+addi t2,zero,97
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,12
+addi t0,zero,1
+addi t1,zero,122
+ld t2,184(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,24
+addi a0,zero,0
+jal zero,22
+jal zero,20
+addi t0,zero,1
+ld t1,184(gp)
+addi t2,zero,65
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,12
+addi t0,zero,1
+addi t1,zero,90
+ld t2,184(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,7
+addi a0,zero,0
+jal zero,5
+jal zero,3
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,zero,1
+ld t1,184(gp)
+addi t2,zero,48
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,12
+addi t0,zero,1
+addi t1,zero,57
+ld t2,184(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,7
+addi a0,zero,0
+jal zero,5
+jal zero,3
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,17
+jal ra,-30
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,184(gp)
+ld t1,-120(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,184(gp)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,17
+jal ra,-301
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,12
+ld t0,184(gp)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,144(gp)
+ld t0,136(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a1,0(t0)
+jal ra,-1952
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-472(gp)
+jal ra,-23
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-472(gp)
+jal zero,58
+ld a0,-480(gp)
+jal ra,-29
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-480(gp)
+jal zero,52
+ld a0,-488(gp)
+jal ra,-35
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-488(gp)
+jal zero,46
+ld a0,-496(gp)
+jal ra,-41
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-496(gp)
+jal zero,40
+ld a0,-504(gp)
+jal ra,-47
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-504(gp)
+jal zero,34
+ld a0,-512(gp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-512(gp)
+jal zero,28
+ld a0,-672(gp)
+jal ra,-59
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-472(gp)
+jal zero,22
+ld a0,-680(gp)
+jal ra,-65
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-472(gp)
+jal zero,16
+ld a0,-688(gp)
+jal ra,-71
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-472(gp)
+jal zero,10
+ld a0,-696(gp)
+jal ra,-77
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-472(gp)
+jal zero,4
+ld a0,-464(gp)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,-440(gp)
+sd t0,200(gp)
+jal ra,-372
+addi t0,a0,0
+ld t1,-72(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,459
+ld t0,200(gp)
+ld t1,-592(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,451
+jal ra,-231
+addi t0,a0,0
+beq t0,zero,38
+ld a0,-704(gp)
+jal ra,-2204
+addi t0,a0,0
+sd t0,144(gp)
+addi s1,zero,0
+jal ra,-180
+addi t0,a0,0
+beq t0,zero,22
+addi t0,zero,1
+addi t1,s1,0
+ld t2,-704(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,112
+add a0,gp,t0
+jal ra,-584
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4518
+ld a0,144(gp)
+addi a1,s1,0
+ld a2,184(gp)
+jal ra,-2294
+addi s1,s1,1
+jal ra,-510
+jal zero,-23
+ld a0,144(gp)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-2301
+jal ra,-127
+addi t0,a0,0
+sd t0,200(gp)
+jal zero,411
+jal ra,-233
+addi t0,a0,0
+beq t0,zero,62
+ld a0,-712(gp)
+jal ra,-2244
+addi t0,a0,0
+sd t0,152(gp)
+addi s1,zero,0
+jal ra,-241
+addi t0,a0,0
+beq t0,zero,29
+addi t0,zero,1
+addi t1,s1,0
+ld t2,-712(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,16
+ld t0,176(gp)
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,80
+add a0,gp,t0
+jal ra,-626
+jal zero,5
+lui t0,0xFFFFF
+addi t0,t0,56
+add a0,gp,t0
+jal ra,-631
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4565
+ld a0,152(gp)
+addi a1,s1,0
+ld a2,184(gp)
+jal ra,-2341
+addi s1,s1,1
+jal ra,-557
+jal zero,-30
+ld a0,152(gp)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-2348
+ld a0,152(gp)
+jal ra,-2075
+addi t0,a0,0
+sd t0,168(gp)
+ld t0,176(gp)
+beq t0,zero,13
+ld t0,32(gp)
+ld t1,168(gp)
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,24
+add a0,gp,t0
+jal ra,-660
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4594
+ld t0,128(gp)
+sd t0,200(gp)
+jal zero,347
+ld t0,184(gp)
+ld t1,-128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+jal ra,-590
+addi t0,zero,0
+sd t0,168(gp)
+ld t0,184(gp)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+addi t0,t0,-32
+add a0,gp,t0
+jal ra,-686
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4620
+jal zero,3
+ld t0,184(gp)
+sd t0,168(gp)
+jal ra,-610
+ld t0,184(gp)
+ld t1,-128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-617
+jal zero,16
+ld t0,184(gp)
+ld t1,-72(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,-128(gp)
+jal ra,-683
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4644
+jal zero,3
+ld a0,-128(gp)
+jal ra,-690
+ld t0,-448(gp)
+sd t0,200(gp)
+jal zero,294
+ld t0,184(gp)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+jal ra,-643
+ld a0,-720(gp)
+jal ra,-2365
+addi t0,a0,0
+sd t0,160(gp)
+addi s1,zero,0
+jal ra,-311
+addi t0,a0,0
+beq t0,zero,29
+addi t0,zero,1
+addi t1,s1,0
+ld t2,-720(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-48
+add a0,gp,t0
+jal ra,-745
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4679
+ld t0,184(gp)
+ld t1,-264(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,267
+ld a0,160(gp)
+addi a1,s1,0
+ld a2,184(gp)
+jal ra,-2462
+addi s1,s1,1
+jal ra,-678
+jal zero,-30
+ld t0,184(gp)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-686
+jal zero,7
+ld a0,-136(gp)
+jal ra,-746
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4707
+ld a0,160(gp)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-2483
+ld t0,-456(gp)
+sd t0,200(gp)
+jal zero,230
+ld t0,184(gp)
+ld t1,-144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-707
+ld t0,-520(gp)
+sd t0,200(gp)
+jal zero,220
+ld t0,184(gp)
+ld t1,-152(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-717
+ld t0,-528(gp)
+sd t0,200(gp)
+jal zero,210
+ld t0,184(gp)
+ld t1,-160(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-727
+ld t0,-536(gp)
+sd t0,200(gp)
+jal zero,200
+ld t0,184(gp)
+ld t1,-168(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-737
+ld t0,-544(gp)
+sd t0,200(gp)
+jal zero,190
+ld t0,184(gp)
+ld t1,-176(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-747
+ld t0,-552(gp)
+sd t0,200(gp)
+jal zero,180
+ld t0,184(gp)
+ld t1,-184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-757
+ld t0,-560(gp)
+sd t0,200(gp)
+jal zero,170
+ld t0,184(gp)
+ld t1,-192(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-767
+ld t0,-568(gp)
+sd t0,200(gp)
+jal zero,160
+ld t0,184(gp)
+ld t1,-200(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-777
+ld t0,-576(gp)
+sd t0,200(gp)
+jal zero,150
+ld t0,184(gp)
+ld t1,-208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-787
+ld t0,-584(gp)
+sd t0,200(gp)
+jal zero,140
+ld t0,184(gp)
+ld t1,-224(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-797
+ld t0,-600(gp)
+sd t0,200(gp)
+jal zero,130
+ld t0,184(gp)
+ld t1,-232(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-807
+ld t0,184(gp)
+ld t1,-232(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-814
+ld t0,-616(gp)
+sd t0,200(gp)
+jal zero,3
+ld t0,-608(gp)
+sd t0,200(gp)
+jal zero,110
+ld t0,184(gp)
+ld t1,-240(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-827
+ld t0,184(gp)
+ld t1,-232(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-834
+jal zero,3
+ld a0,-232(gp)
+jal ra,-894
+ld t0,-624(gp)
+sd t0,200(gp)
+jal zero,90
+ld t0,184(gp)
+ld t1,-248(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-847
+ld t0,184(gp)
+ld t1,-232(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-854
+ld t0,-640(gp)
+sd t0,200(gp)
+jal zero,3
+ld t0,-632(gp)
+sd t0,200(gp)
+jal zero,70
+ld t0,184(gp)
+ld t1,-256(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-867
+ld t0,184(gp)
+ld t1,-232(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-874
+ld t0,-656(gp)
+sd t0,200(gp)
+jal zero,3
+ld t0,-648(gp)
+sd t0,200(gp)
+jal zero,50
+ld t0,184(gp)
+ld t1,-272(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+jal ra,-887
+ld t0,184(gp)
+ld t1,-272(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-894
+ld t0,184(gp)
+ld t1,-272(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-901
+jal zero,3
+ld a0,-272(gp)
+jal ra,-961
+jal zero,3
+ld a0,-272(gp)
+jal ra,-964
+ld t0,-664(gp)
+sd t0,200(gp)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-64
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-1025
+lui t0,0xFFFFF
+addi t0,t0,-96
+add a0,gp,t0
+jal ra,-1910
+ld a0,184(gp)
+jal ra,-1866
+jal ra,-1878
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-4943
+ld t0,224(gp)
+addi t0,t0,1
+sd t0,224(gp)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,208(gp)
+addi t0,t0,1
+sd t0,208(gp)
+jal ra,-946
+ld t0,184(gp)
+addi t0,t0,-110
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-96(gp)
+sd t0,184(gp)
+jal zero,61
+ld t0,184(gp)
+addi t0,t0,-116
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-88(gp)
+sd t0,184(gp)
+jal zero,53
+ld t0,184(gp)
+addi t0,t0,-98
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-80(gp)
+sd t0,184(gp)
+jal zero,45
+ld t0,184(gp)
+ld t1,-128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-128(gp)
+sd t0,184(gp)
+jal zero,36
+ld t0,184(gp)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-136(gp)
+sd t0,184(gp)
+jal zero,27
+ld t0,184(gp)
+ld t1,-224(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-224(gp)
+sd t0,184(gp)
+jal zero,18
+ld t0,184(gp)
+ld t1,-264(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-264(gp)
+sd t0,184(gp)
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-128
+add a0,gp,t0
+jal ra,-1094
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1176(t0)
+jal ra,-5028
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi t0,a0,0
+ld t0,0(t0)
+ld t1,-1128(gp)
+divu t2,t0,t1
+add t2,t0,t2
+divu t2,t2,t1
+add t2,t0,t2
+divu t2,t2,t1
+add t2,t0,t2
+divu t2,t2,t1
+add t2,t0,t2
+divu t2,t2,t1
+add t0,t0,t2
+remu a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-64
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd a5,56(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-4640
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,24(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,32(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,40(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,48(s0)
+addi t0,t0,32
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,56(s0)
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,64(s0)
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,64
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-1104(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+ld t0,-8(s0)
+ld t1,-1304(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,256(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-70
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,40(s0)
+ld t1,-1032(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,280(gp)
+addi t0,t0,1
+sd t0,280(gp)
+jal zero,20
+ld t0,40(s0)
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,288(gp)
+addi t0,t0,1
+sd t0,288(gp)
+jal zero,10
+ld t0,40(s0)
+ld t1,-1048(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,296(gp)
+addi t0,t0,1
+sd t0,296(gp)
+jal zero,26
+ld t0,16(s0)
+ld t1,-1112(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-8(s0)
+ld t1,-1344(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,264(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,264(gp)
+jal zero,10
+ld t0,-8(s0)
+ld t1,-1304(gp)
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,272(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,272(gp)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,72
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,304(gp)
+addi t0,t0,1
+sd t0,304(gp)
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,312(gp)
+addi t0,t0,1
+sd t0,312(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-4754
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-4772
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-2772
+addi t0,a0,0
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,7
+ld a0,16(s0)
+jal ra,-4786
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-36
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,256(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-209
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-73
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1032(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,264(gp)
+ld a1,16(s0)
+ld a2,-1032(gp)
+jal ra,-95
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,16
+ld t0,24(s0)
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,272(gp)
+ld a1,16(s0)
+ld a2,-1056(gp)
+jal ra,-108
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-67
+jal zero,4
+ld a0,-8(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-4870
+addi t0,a0,0
+ld t1,-1056(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,24
+ld a0,16(s0)
+jal ra,-4870
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,16
+ld a0,16(s0)
+jal ra,-4878
+jal ra,12945
+jal ra,11911
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,272(gp)
+ld a1,16(s0)
+ld a2,-1056(gp)
+jal ra,-180
+addi t0,a0,0
+sltu a0,zero,t0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi s2,zero,0
+addi t0,s2,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,54
+ld t0,256(gp)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s3,0(t0)
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,43
+addi a0,s3,0
+jal ra,-4952
+jal ra,-41
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+addi a0,s3,0
+jal ra,-89
+addi t0,a0,0
+beq t0,zero,28
+addi s1,zero,1
+lui t0,0xFFFFF
+addi t0,t0,-144
+add a0,gp,t0
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s3,0
+jal ra,-4966
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1510
+lui t0,0xFFFFF
+addi t0,t0,-168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi a0,s3,0
+jal ra,-4981
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1871
+addi sp,sp,8
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi a0,s3,0
+jal ra,-4993
+addi s3,a0,0
+jal zero,-44
+addi s2,s2,1
+jal zero,-56
+addi a0,s1,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,12
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,52
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,44
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,36
+ld t0,200(gp)
+ld t1,128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,28
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,20
+ld t0,200(gp)
+ld t1,-456(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,200(gp)
+ld t1,-448(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,200(gp)
+ld t1,-448(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,20
+ld t0,200(gp)
+ld t1,-592(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,200(gp)
+ld t1,-600(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,200(gp)
+ld t1,-568(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-616(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,44
+ld t0,200(gp)
+ld t1,-624(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,36
+ld t0,200(gp)
+ld t1,-632(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,28
+ld t0,200(gp)
+ld t1,-648(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,20
+ld t0,200(gp)
+ld t1,-640(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld t0,200(gp)
+ld t1,-656(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-520(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,60
+ld t0,200(gp)
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,52
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,44
+ld t0,200(gp)
+ld t1,128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,36
+ld t0,200(gp)
+ld t1,-448(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,28
+ld t0,200(gp)
+ld t1,-456(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,20
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,12
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,44
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,36
+ld t0,200(gp)
+ld t1,-512(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,28
+ld t0,200(gp)
+ld t1,-480(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,20
+ld t0,200(gp)
+ld t1,-504(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,12
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,200(gp)
+ld t1,-472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,20
+ld t0,200(gp)
+ld t1,-496(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,12
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+ld t1,-1264(gp)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,320(gp)
+addi t0,t0,1
+sd t0,320(gp)
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-192
+add a0,gp,t0
+jal ra,-1891
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-5825
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,320(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1312(gp)
+ld t1,320(gp)
+add a0,t0,t1
+jal zero,16
+ld t0,-1496(gp)
+ld t1,320(gp)
+add t0,t0,t1
+addi a0,t0,-3
+jal zero,11
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-216
+add a0,gp,t0
+jal ra,-1925
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-5859
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,320(gp)
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,320(gp)
+addi t0,t0,-4
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-1336(gp)
+jal zero,14
+jal ra,-50
+addi a0,a0,-1
+jal zero,11
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-240
+add a0,gp,t0
+jal ra,-1958
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-5892
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+ld t1,-1264(gp)
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,320(gp)
+addi t0,t0,-3
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-1504(gp)
+jal zero,14
+jal ra,-83
+addi a0,a0,1
+jal zero,11
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-264
+add a0,gp,t0
+jal ra,-1991
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-5925
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,320(gp)
+ld t2,16(s0)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,6
+ld t0,320(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,320(gp)
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-296
+add a0,gp,t0
+jal ra,-2021
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-5955
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1312(gp)
+addi t1,a0,0
+add a0,t0,t1
+jal zero,7
+ld t0,-1496(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,-3
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1320(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,22
+addi t0,zero,1
+ld t1,-1336(gp)
+addi t2,a0,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,5
+addi t0,a0,0
+ld t1,-1312(gp)
+sub a0,t0,t1
+jal zero,13
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1504(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,6
+addi t0,a0,0
+ld t1,-1496(gp)
+sub t0,t0,t1
+addi a0,t0,3
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+ld t0,-1360(gp)
+addi t1,a0,0
+add a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,10918
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+ld t1,-1360(gp)
+sub t0,t0,t1
+addi a0,t0,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-1352(gp)
+jal zero,7
+ld t0,-1424(gp)
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,-2
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1352(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,13
+ld a0,16(s0)
+jal ra,10891
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+ld t1,-1424(gp)
+sub t0,t0,t1
+addi a0,t0,2
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,352(gp)
+ld s1,264(gp)
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,33
+addi a0,s1,0
+jal ra,-5633
+addi a1,zero,0
+jal ra,-4096
+addi t0,a0,0
+beq t0,zero,23
+addi a0,s1,0
+jal ra,-5639
+addi t0,a0,0
+sub t0,zero,t0
+ld t1,-48(gp)
+divu s2,t0,t1
+addi t0,zero,1
+ld t1,-1280(gp)
+addi t2,s2,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,11
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s2,0
+jal ra,-78
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+addi a0,s1,0
+jal ra,-5679
+addi s1,a0,0
+jal zero,-34
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-32(gp)
+ld t1,-16(gp)
+add a0,t0,t1
+jal ra,-2353
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,352(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,8
+ld t1,976(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,352(gp)
+ld t0,344(gp)
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-5701
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,1
+addi t0,t0,40
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-129
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-8(s0)
+jal ra,-4314
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi t1,zero,2
+remu a0,t0,t1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld s1,264(gp)
+addi s2,zero,0
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,31
+addi a0,s1,0
+jal ra,-5758
+jal ra,10732
+addi t0,a0,0
+beq t0,zero,22
+addi a0,s1,0
+jal ra,-5769
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-5772
+jal ra,-187
+jal ra,-4364
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add s2,t0,t1
+addi t0,s1,0
+ld t1,-1344(gp)
+addi t0,t0,56
+sd t1,0(t0)
+addi a0,s1,0
+jal ra,-5805
+addi s1,a0,0
+jal zero,-32
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,168
+ld t0,976(gp)
+sd t0,-48(s0)
+ld s4,16(s0)
+addi t0,s4,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,31
+addi a0,s4,0
+jal ra,12020
+addi t0,a0,0
+sd t0,1520(gp)
+addi a0,t0,0
+jal ra,10983
+addi t0,a0,0
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld a0,1520(gp)
+jal ra,10919
+addi a1,s2,0
+jal ra,-108
+addi t0,a0,0
+beq t0,zero,7
+addi t0,s4,0
+sd t0,976(gp)
+jal ra,12205
+ld t0,904(gp)
+addi t0,t0,-1
+sd t0,904(gp)
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s4,t0,t1
+jal zero,-33
+ld s3,352(gp)
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,71
+addi t0,s3,0
+ld a0,8(t0)
+jal ra,11985
+addi t0,a0,0
+sd t0,1520(gp)
+addi t0,s3,0
+ld t0,8(t0)
+sd t0,976(gp)
+ld a0,1520(gp)
+jal ra,10903
+addi a1,s2,0
+jal ra,-138
+addi t0,a0,0
+beq t0,zero,22
+ld a0,1520(gp)
+jal ra,10925
+ld a1,-1344(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,1520(gp)
+jal ra,10891
+jal ra,-270
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a2,zero,t0
+jal ra,12354
+ld t0,840(gp)
+addi t0,t0,-1
+sd t0,840(gp)
+jal zero,33
+ld a0,1520(gp)
+jal ra,10904
+addi a1,s2,0
+jal ra,-165
+addi t0,a0,0
+beq t0,zero,27
+ld a0,-1344(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,1520(gp)
+jal ra,10895
+jal ra,-294
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a1,zero,t0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,1520(gp)
+jal ra,10855
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,12353
+ld t0,840(gp)
+addi t0,t0,-1
+sd t0,840(gp)
+addi t0,s3,0
+ld s3,0(t0)
+jal zero,-72
+ld t0,-48(s0)
+sd t0,976(gp)
+ld s4,24(s0)
+ld s5,24(s0)
+ld t0,16(s0)
+addi t1,s4,0
+sltu t0,t0,t1
+beq t0,zero,28
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub s4,t0,t1
+addi a0,s4,0
+jal ra,11903
+addi t0,a0,0
+sd t0,1520(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12087
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,s5,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub s5,t0,t1
+addi a0,s5,0
+ld a1,1520(gp)
+jal ra,11909
+jal zero,-30
+addi s4,s5,0
+ld t0,16(s0)
+addi t1,s4,0
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub s4,t0,t1
+addi a0,s4,0
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,12058
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,11889
+jal zero,-18
+addi a0,s5,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+sltu t0,zero,t0
+beq t0,zero,21
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,-48(gp)
+sub a2,zero,t0
+jal ra,12077
+ld a0,-1296(gp)
+addi a1,zero,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-614
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,12257
+addi a0,zero,1
+jal ra,-521
+jal zero,-22
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-663
+jal ra,-639
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,12203
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld a2,-48(gp)
+jal ra,12039
+jal zero,-13
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,328(gp)
+sltu t0,zero,t0
+beq t0,zero,30
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,328(gp)
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a2,zero,t0
+jal ra,12019
+ld t0,328(gp)
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,328(gp)
+addi t0,t0,-1
+sd t0,328(gp)
+ld a0,-1296(gp)
+ld t0,328(gp)
+ld t1,-48(gp)
+mul a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,328(gp)
+jal ra,-507
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,12190
+jal zero,-21
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,328(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,12
+ld a0,328(gp)
+jal ra,-533
+ld a1,-1296(gp)
+ld t0,328(gp)
+ld t1,-48(gp)
+mul a2,t0,t1
+jal ra,12133
+ld t0,328(gp)
+addi t0,t0,1
+sd t0,328(gp)
+jal zero,-14
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,16(s0)
+ld t1,-48(gp)
+mul a2,t0,t1
+jal ra,11963
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-312
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-2664
+ld a0,16(s0)
+jal ra,-2698
+lui t0,0xFFFFF
+addi t0,t0,-328
+add a0,gp,t0
+jal ra,-3551
+ld a0,200(gp)
+jal ra,-2704
+lui t0,0xFFFFF
+addi t0,t0,-336
+add a0,gp,t0
+jal ra,-3557
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-352
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-2693
+lui t0,0xFFFFF
+addi t0,t0,-376
+add a0,gp,t0
+jal ra,-3578
+ld a0,200(gp)
+jal ra,-2731
+lui t0,0xFFFFF
+addi t0,t0,-384
+add a0,gp,t0
+jal ra,-3584
+ld t0,232(gp)
+addi t0,t0,1
+sd t0,232(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1072(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,-400
+add a0,gp,t0
+jal ra,-3607
+jal zero,38
+ld t0,16(s0)
+ld t1,-1080(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,-416
+add a0,gp,t0
+jal ra,-3618
+jal zero,27
+ld t0,16(s0)
+ld t1,-1088(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,-424
+add a0,gp,t0
+jal ra,-3629
+jal zero,16
+ld t0,16(s0)
+ld t1,-1096(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,-440
+add a0,gp,t0
+jal ra,-3640
+jal zero,5
+lui t0,0xFFFFF
+addi t0,t0,-448
+add a0,gp,t0
+jal ra,-3645
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-456
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-2780
+lui t0,0xFFFFF
+addi t0,t0,-472
+add a0,gp,t0
+jal ra,-3665
+ld a0,16(s0)
+jal ra,-74
+lui t0,0xFFFFF
+addi t0,t0,-488
+add a0,gp,t0
+jal ra,-3671
+ld a0,24(s0)
+jal ra,-80
+lui t0,0xFFFFF
+addi t0,t0,-496
+add a0,gp,t0
+jal ra,-3677
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,24(s0)
+addi a1,zero,12
+jal ra,-4609
+addi t0,a0,0
+beq t0,zero,6
+ld a0,16(s0)
+ld a1,560(gp)
+ld a2,24(s0)
+jal ra,11795
+jal zero,81
+ld a0,24(s0)
+addi a1,zero,0
+addi a2,zero,12
+jal ra,-4787
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,24(s0)
+addi a1,zero,12
+addi a2,zero,20
+jal ra,-4793
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,11
+jal ra,-4871
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,32
+ld t0,-16(s0)
+addi t0,t0,1
+sd t0,-16(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+addi a1,zero,20
+jal ra,-4606
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,11737
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,19
+jal ra,-4897
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,560(gp)
+ld a2,16(s0)
+jal ra,11785
+jal zero,12
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+addi a1,zero,20
+jal ra,-4634
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,11709
+ld a0,16(s0)
+ld a1,16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+addi a1,zero,12
+jal ra,-4647
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,11714
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+ld t1,-1040(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1590
+jal zero,17
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-1568
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,8
+ld a0,16(s0)
+jal ra,-2848
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-6839
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1045
+jal ra,-1021
+ld a1,16(s0)
+jal ra,6029
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-61
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+jal ra,-6418
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,-8(s0)
+jal ra,-6419
+jal ra,10071
+addi t0,a0,0
+beq t0,zero,16
+ld a0,-8(s0)
+jal ra,-756
+jal ra,-1077
+jal ra,-1053
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-6430
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,11622
+jal zero,44
+ld a0,-16(s0)
+addi a1,zero,12
+jal ra,-4792
+addi t0,a0,0
+beq t0,zero,14
+jal ra,-1095
+jal ra,-1071
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-6448
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-16(s0)
+jal ra,11764
+jal zero,26
+ld a0,-8(s0)
+jal ra,-69
+jal ra,-1085
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-1088
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-16(s0)
+addi a1,zero,0
+addi a2,zero,12
+jal ra,-4991
+addi a1,zero,12
+jal ra,-4783
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,11738
+ld a0,-8(s0)
+jal ra,-6491
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+addi a1,zero,32
+jal ra,-4848
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-1151
+jal ra,-1127
+ld a1,16(s0)
+jal ra,-254
+jal zero,27
+ld a0,152(gp)
+ld a1,-1040(gp)
+jal ra,-1731
+addi t0,a0,0
+sd t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,1000(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1000(gp)
+ld a0,-1104(gp)
+ld a1,152(gp)
+ld a2,-728(gp)
+ld a3,-1040(gp)
+ld a4,-1072(gp)
+ld a5,16(s0)
+ld t0,1000(gp)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1935
+ld a0,152(gp)
+ld a1,-1040(gp)
+jal ra,-127
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-4693
+addi t0,a0,1
+sd t0,-8(s0)
+ld t0,1000(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-8(s0)
+ld a1,-48(gp)
+jal ra,-3276
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,1000(gp)
+ld a0,-1104(gp)
+ld a1,16(s0)
+ld a2,-728(gp)
+ld a3,-1048(gp)
+ld a4,-1080(gp)
+addi a5,zero,0
+ld t0,1000(gp)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1975
+ld t0,1000(gp)
+sub a0,zero,t0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-45
+jal ra,-93
+jal ra,-1209
+ld a1,-1304(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-1214
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,11487
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,336(gp)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-1096(gp)
+sd t0,-8(s0)
+ld a0,-1104(gp)
+ld a1,24(s0)
+ld a2,-728(gp)
+ld a3,-1056(gp)
+ld a4,-8(s0)
+ld a5,32(s0)
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2033
+ld a0,-1288(gp)
+addi a1,zero,0
+jal ra,11677
+jal zero,59
+ld a0,16(s0)
+jal ra,-6639
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,-6637
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,976(gp)
+addi t0,t0,48
+sd t1,0(t0)
+ld a0,-1288(gp)
+addi a1,zero,0
+jal ra,11659
+jal zero,41
+ld a0,16(s0)
+jal ra,-6651
+jal ra,11172
+jal ra,10138
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld a0,-1288(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-6664
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,11638
+ld t0,16(s0)
+ld t1,976(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+sub t1,t1,t2
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,12
+ld a0,-1288(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-6683
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,976(gp)
+sub a1,t0,t1
+jal ra,11618
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+jal ra,11121
+addi t0,a0,0
+sd t0,1520(gp)
+addi a0,t0,0
+jal ra,10084
+addi t0,a0,0
+ld t1,-1800(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,175
+ld a0,1520(gp)
+jal ra,10033
+addi t0,a0,0
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,166
+jal ra,22929
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,156
+ld t0,672(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,149
+ld a0,688(gp)
+jal ra,-1221
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,141
+ld t0,688(gp)
+sd t0,-24(s0)
+ld t0,696(gp)
+sd t0,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,11066
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22892
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,119
+ld t0,672(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,112
+ld a0,688(gp)
+jal ra,-1258
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,104
+ld t0,688(gp)
+sd t0,-32(s0)
+ld t0,696(gp)
+sd t0,-16(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,2
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,11027
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22853
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,80
+ld t0,688(gp)
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,73
+ld t0,672(gp)
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,66
+ld t0,680(gp)
+ld t1,-32(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,59
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,3
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,10986
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22812
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,39
+ld t0,672(gp)
+ld t1,688(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,32
+ld t0,680(gp)
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,25
+ld a0,688(gp)
+jal ra,-1345
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,17
+ld t0,-8(s0)
+ld t1,-16(s0)
+mul a0,t0,t1
+addi a1,zero,12
+jal ra,-5226
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+mul t0,t0,t1
+sd t0,696(gp)
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,501
+ld a0,16(s0)
+jal ra,-6914
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,493
+ld a0,16(s0)
+jal ra,-6922
+jal ra,10901
+jal ra,9867
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,481
+ld a0,16(s0)
+jal ra,-6937
+addi s2,a0,0
+addi a0,s2,0
+addi a1,zero,0
+jal ra,-5399
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,471
+addi t0,zero,1
+addi t1,s2,0
+ld t2,-1264(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,463
+ld a0,16(s0)
+jal ra,-6952
+addi s1,a0,0
+addi s3,zero,0
+addi s4,zero,0
+addi s6,zero,0
+addi s7,zero,0
+addi t0,zero,1
+ld t1,-1136(gp)
+addi t2,s6,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,449
+addi t0,zero,1
+addi t1,s1,0
+ld t2,976(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,442
+addi a0,s1,0
+jal ra,10851
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22677
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,76
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,422
+ld t0,696(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,10817
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22643
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,394
+ld t0,688(gp)
+ld t1,-1360(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,387
+ld t0,672(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,380
+jal zero,10
+ld t0,696(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,370
+addi t0,s1,0
+ld t1,696(gp)
+add a0,t0,t1
+jal ra,10777
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22603
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,354
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,339
+ld t0,672(gp)
+ld t1,-1288(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,332
+ld t0,-1264(gp)
+addi t1,s2,0
+addi t2,s3,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,324
+addi t0,s2,1
+addi t1,s7,0
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,318
+addi a0,s6,0
+jal zero,316
+addi a0,s1,0
+jal ra,-403
+addi t0,a0,0
+beq t0,zero,24
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,688(gp)
+jal ra,-1585
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,688(gp)
+jal ra,-1592
+addi s3,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add s1,t0,t1
+addi s6,s6,4
+addi s7,s7,1
+jal zero,287
+addi a0,s1,0
+jal ra,10698
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22524
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,672(gp)
+jal ra,-1618
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,672(gp)
+ld t1,-1304(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,263
+jal zero,194
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,672(gp)
+jal ra,-1640
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,672(gp)
+ld t1,-1304(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,241
+ld a0,680(gp)
+jal ra,-1653
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,233
+jal zero,164
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld t0,688(gp)
+ld t1,-1360(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld a0,672(gp)
+jal ra,-1676
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,210
+ld t0,696(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,205
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,10610
+jal ra,9576
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,191
+jal zero,66
+ld a0,672(gp)
+jal ra,-1671
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,43
+ld t0,696(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,180
+ld a0,672(gp)
+jal ra,-1681
+addi s5,a0,-1
+addi t0,zero,1
+addi t1,s5,0
+addi t2,s2,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,169
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s5,0
+jal ra,-5836
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi t1,zero,2
+remu t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,154
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s5,0
+jal ra,-5851
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add s4,t0,t1
+addi s7,s7,-1
+jal zero,19
+ld a0,672(gp)
+jal ra,-1751
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,672(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,672(gp)
+ld t1,-1304(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,125
+jal zero,56
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,47
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,105
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,95
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,85
+ld a0,672(gp)
+jal ra,-1809
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,77
+ld a0,680(gp)
+jal ra,-1817
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,69
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,688(gp)
+ld t1,-1360(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld a0,688(gp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,49
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,688(gp)
+jal ra,-1848
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,688(gp)
+jal ra,-1855
+addi s3,a0,0
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,672(gp)
+jal ra,-1861
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,672(gp)
+jal ra,-1868
+addi s3,a0,0
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,680(gp)
+jal ra,-1874
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,680(gp)
+jal ra,-1881
+addi s3,a0,0
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+addi s6,s6,1
+addi s7,s7,1
+jal zero,-453
+addi a0,zero,0
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-1910
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,384(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-1918
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,-8(t0)
+jal zero,4
+ld a0,16(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-1942
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,25
+ld t0,384(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-1950
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,-8
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-1961
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+jal ra,-1980
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-7514
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2166
+jal ra,-2142
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,10540
+ld t0,24(s0)
+addi t0,t0,1
+sd t0,24(s0)
+jal zero,-18
+ld t0,384(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1264(gp)
+ld t1,-48(gp)
+mul a0,t0,t1
+jal ra,-4206
+addi t0,a0,0
+sd t0,384(gp)
+addi s2,zero,1
+addi t0,zero,1
+ld t1,-1264(gp)
+addi t2,s2,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-2038
+ld a1,24(s0)
+jal ra,-90
+addi s2,s2,1
+jal zero,-11
+ld a0,16(s0)
+jal ra,-7550
+addi s1,a0,0
+ld t0,32(s0)
+sltu t0,zero,t0
+beq t0,zero,364
+addi a0,s1,0
+jal ra,-860
+addi t0,a0,0
+beq t0,zero,24
+ld a0,688(gp)
+jal ra,-135
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,688(gp)
+jal ra,-139
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,696(gp)
+jal ra,10491
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add s1,t0,t1
+ld t0,32(s0)
+addi t0,t0,-4
+sd t0,32(s0)
+jal zero,336
+addi a0,s1,0
+jal ra,10241
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,22067
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,688(gp)
+ld t1,672(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,688(gp)
+ld t1,680(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,688(gp)
+ld a1,24(s0)
+jal ra,-150
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,688(gp)
+ld t1,-1360(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld a0,40(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-200
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,10430
+jal zero,40
+ld a0,672(gp)
+jal ra,-2080
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,384(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,688(gp)
+jal ra,-2121
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,-8
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,672(gp)
+jal ra,-2099
+jal ra,-2148
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,13
+ld a0,688(gp)
+jal ra,-236
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-240
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,696(gp)
+jal ra,10390
+jal zero,237
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld a0,688(gp)
+jal ra,-257
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-261
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,696(gp)
+jal ra,10529
+jal zero,216
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld a0,672(gp)
+jal ra,-278
+ld a1,696(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-284
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10538
+jal zero,193
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,688(gp)
+jal ra,-301
+ld a1,696(gp)
+jal ra,10314
+jal zero,180
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,688(gp)
+jal ra,-314
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-318
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-327
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10325
+jal zero,150
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,688(gp)
+jal ra,-344
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-348
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-357
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10318
+jal zero,120
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,688(gp)
+jal ra,-374
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-378
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-387
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10311
+jal zero,90
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,688(gp)
+jal ra,-404
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-408
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-417
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10304
+jal zero,60
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,688(gp)
+jal ra,-434
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-438
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-447
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10297
+jal zero,30
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld a0,688(gp)
+jal ra,-464
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,672(gp)
+jal ra,-468
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,680(gp)
+jal ra,-477
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10290
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+ld t0,32(s0)
+addi t0,t0,-1
+sd t0,32(s0)
+jal zero,-365
+ld a0,24(s0)
+jal ra,-2442
+ld t0,400(gp)
+addi t0,t0,1
+sd t0,400(gp)
+ld a0,16(s0)
+jal ra,-7930
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-6400
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,10
+ld t0,16(s0)
+ld t1,-1272(gp)
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,4
+ld a0,-1272(gp)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,24(s0)
+addi t0,t0,2
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a2,zero,t0
+jal ra,10087
+addi s1,zero,0
+addi t0,s1,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+ld a0,-1296(gp)
+addi t0,s1,2
+ld t1,-48(gp)
+mul a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,-2438
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10259
+addi s1,s1,1
+jal zero,-20
+ld a0,-1296(gp)
+ld a1,-48(gp)
+ld a2,-1288(gp)
+jal ra,10253
+ld a0,-1296(gp)
+addi a1,zero,0
+ld a2,-1344(gp)
+jal ra,10249
+ld a0,-1344(gp)
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,10053
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,30
+ld t0,16(s0)
+sub a0,zero,t0
+addi a1,zero,12
+jal ra,-6364
+addi t0,a0,0
+beq t0,zero,7
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,16(s0)
+sub a2,zero,t0
+jal ra,10039
+jal zero,18
+ld t0,16(s0)
+sub a0,zero,t0
+jal ra,-1535
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-2656
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10045
+addi a0,zero,1
+jal ra,-2563
+ld s2,264(gp)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,30
+addi a0,s2,0
+jal ra,-8043
+jal ra,8447
+addi t0,a0,0
+beq t0,zero,21
+ld a0,-1344(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-8054
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-8060
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10184
+addi a0,s2,0
+jal ra,-8089
+addi s2,a0,0
+jal zero,-31
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld s1,264(gp)
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,24
+addi a0,s1,0
+jal ra,-8090
+jal ra,8400
+addi t0,a0,0
+beq t0,zero,15
+addi a0,s1,0
+jal ra,-8095
+ld a1,-1344(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,-8104
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,10111
+addi a0,s1,0
+jal ra,-8130
+addi s1,a0,0
+jal zero,-25
+ld a0,-1296(gp)
+ld a1,-1344(gp)
+addi a2,zero,0
+jal ra,9943
+ld a0,-1344(gp)
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,10099
+ld a0,-1288(gp)
+ld a1,-1296(gp)
+ld a2,-48(gp)
+jal ra,10095
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+ld t0,-48(gp)
+addi t1,zero,2
+mul t0,t0,t1
+ld t1,16(s0)
+add a2,t0,t1
+jal ra,9927
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,10188
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,110
+ld a0,16(s0)
+jal ra,9669
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,21495
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,672(gp)
+ld t1,-1344(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,696(gp)
+ld t1,-48(gp)
+addi t2,zero,2
+mul t2,t1,t2
+sub t0,t0,t2
+divu a0,t0,t1
+jal ra,-2635
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,584(gp)
+ld a3,688(gp)
+ld a4,-1800(gp)
+jal ra,8643
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,9651
+ld t0,896(gp)
+addi t0,t0,-1
+sd t0,896(gp)
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+jal zero,51
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+ld t0,672(gp)
+ld t1,-1344(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,0
+ld a1,680(gp)
+ld a2,584(gp)
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,696(gp)
+ld t1,-48(gp)
+addi t2,zero,2
+mul t2,t1,t2
+sub t0,t0,t2
+divu a0,t0,t1
+jal ra,-2686
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+ld a4,-1800(gp)
+jal ra,8592
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,9600
+ld t0,904(gp)
+addi t0,t0,-1
+sd t0,904(gp)
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-112
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-8290
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2927
+ld a0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-512
+add a1,gp,t0
+jal ra,-6293
+addi t0,a0,0
+beq t0,zero,3
+jal ra,4825
+jal zero,18
+ld a0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-520
+add a1,gp,t0
+jal ra,-6302
+addi t0,a0,0
+beq t0,zero,3
+jal ra,4918
+jal zero,9
+ld a0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-528
+add a1,gp,t0
+jal ra,-6311
+addi t0,a0,0
+beq t0,zero,2
+jal ra,4998
+ld a0,16(s0)
+jal ra,-8312
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-8330
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,3
+addi a0,zero,1
+jal ra,-2859
+addi a0,zero,0
+jal zero,91
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,35
+ld a0,16(s0)
+jal ra,-8346
+addi a1,zero,0
+jal ra,-6806
+addi t0,a0,0
+beq t0,zero,29
+ld t0,24(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,976(gp)
+sd t0,40(s0)
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,9704
+ld a0,-1296(gp)
+ld t0,24(s0)
+ld t1,-48(gp)
+mul a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-2989
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,9882
+addi a0,zero,1
+jal ra,-2896
+ld a0,40(s0)
+jal zero,54
+ld t0,24(s0)
+ld t1,-1272(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+ld a0,24(s0)
+jal ra,-2831
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3008
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,9671
+addi a0,zero,1
+jal ra,-2915
+ld t0,328(gp)
+addi t0,t0,1
+sd t0,328(gp)
+addi a0,zero,0
+jal zero,32
+ld t0,24(s0)
+ld t1,-1272(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,976(gp)
+sd t0,40(s0)
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,9652
+ld a0,-1296(gp)
+ld t0,24(s0)
+ld t1,-1272(gp)
+sub t0,t0,t1
+ld t1,-48(gp)
+mul a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3043
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,9828
+addi a0,zero,1
+jal ra,-2950
+ld a0,40(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,440(gp)
+beq t0,zero,2
+jal ra,4640
+ld a0,272(gp)
+ld a1,16(s0)
+ld a2,-1064(gp)
+jal ra,-3725
+addi s1,a0,0
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,4
+addi a0,s1,0
+jal ra,-188
+jal zero,243
+ld a0,16(s0)
+ld a1,-1056(gp)
+jal ra,-3656
+addi s1,a0,0
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,5
+addi a0,s1,0
+jal ra,-8460
+addi s2,a0,0
+jal zero,2
+addi s2,zero,0
+ld t0,320(gp)
+sd t0,-24(s0)
+ld t0,328(gp)
+sd t0,-32(s0)
+ld t0,-24(s0)
+ld t1,-1264(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-552
+add a0,gp,t0
+jal ra,-5008
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-8942
+jal ra,-2515
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2464
+addi s5,zero,0
+addi s6,zero,0
+jal ra,-3487
+addi t0,a0,0
+beq t0,zero,110
+jal ra,1418
+addi a0,s1,0
+addi a1,zero,0
+addi a2,s2,0
+addi a3,s6,0
+jal ra,-192
+addi s6,a0,0
+addi s5,zero,1
+ld t0,200(gp)
+ld t1,-520(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-4493
+jal ra,1403
+addi a0,s1,0
+addi a1,s5,0
+addi a2,s2,0
+addi a3,s6,0
+jal ra,-207
+addi s6,a0,0
+addi s5,s5,1
+jal zero,-15
+addi t0,s6,0
+sltu t0,zero,t0
+beq t0,zero,22
+addi a0,s1,0
+jal ra,-8530
+addi a1,zero,0
+jal ra,-6990
+addi t0,a0,0
+beq t0,zero,8
+addi a0,s6,0
+addi t0,s5,0
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a1,zero,t0
+jal ra,9947
+jal zero,9
+addi a0,s6,0
+addi t0,s5,0
+ld t1,-1272(gp)
+sub t0,t0,t1
+ld t1,-48(gp)
+mul t0,t0,t1
+sub a1,zero,t0
+jal ra,9938
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-8557
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t1,t0
+beq t0,zero,4
+addi a0,s1,0
+jal ra,-8564
+addi s5,a0,0
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+jal ra,-4549
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi a0,s1,0
+ld a1,16(s0)
+addi a2,s5,0
+jal ra,-1975
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,20
+addi a0,s1,0
+addi a1,s5,0
+addi a2,s2,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-24(s0)
+addi a0,t0,1
+jal ra,-3084
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+jal ra,-1101
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,7
+ld a0,-544(gp)
+jal ra,-2498
+ld a0,320(gp)
+jal ra,-3127
+ld t0,-1072(gp)
+sd t0,-56(s0)
+jal zero,43
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+jal ra,-4594
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi a0,s1,0
+ld a1,16(s0)
+addi a2,zero,0
+jal ra,-2020
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,20
+addi a0,s1,0
+addi a1,zero,0
+addi a2,s2,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld t0,-24(s0)
+addi a0,t0,1
+jal ra,-3129
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+jal ra,-1146
+addi t0,a0,0
+sd t0,-56(s0)
+jal zero,5
+ld a0,-544(gp)
+jal ra,-2543
+ld t0,-1072(gp)
+sd t0,-56(s0)
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-8661
+addi a1,zero,0
+jal ra,-7121
+addi t0,a0,0
+beq t0,zero,21
+ld a0,-1296(gp)
+ld a1,-1296(gp)
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,-8675
+addi t1,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+ld t1,-48(gp)
+mul a2,t0,t1
+jal ra,9379
+addi t0,zero,0
+sd t0,328(gp)
+ld t0,-24(s0)
+addi a0,t0,1
+jal ra,-3181
+ld a1,-1360(gp)
+addi a2,zero,0
+jal ra,9371
+ld a0,-32(s0)
+jal ra,-2622
+ld a0,-24(s0)
+jal ra,-2689
+jal ra,-3344
+ld t0,392(gp)
+addi t0,t0,1
+sd t0,392(gp)
+ld a0,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+jal ra,-3511
+addi t0,a0,0
+beq t0,zero,15
+jal ra,-2583
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-9182
+jal zero,2
+jal ra,-4709
+jal zero,-16
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+jal ra,-4717
+ld t0,200(gp)
+ld t1,-472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+addi t0,zero,1
+sd t0,-8(s0)
+jal ra,1803
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4735
+jal zero,3
+ld a0,-544(gp)
+jal ra,-2654
+jal zero,16
+jal ra,716
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4749
+jal zero,3
+ld a0,-544(gp)
+jal ra,-2668
+ld a0,-24(s0)
+jal zero,295
+jal zero,5
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,200(gp)
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sd t0,-32(s0)
+addi t0,zero,1
+sd t0,176(gp)
+jal ra,-4770
+addi t0,zero,0
+sd t0,176(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sd t0,-40(s0)
+jal ra,-4784
+jal zero,3
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+ld t0,144(gp)
+sd t0,-48(s0)
+jal ra,-4796
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-4803
+ld a0,-48(s0)
+jal ra,-391
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,29
+ld t0,440(gp)
+beq t0,zero,22
+ld a0,-48(s0)
+ld a1,-1032(gp)
+jal ra,-2480
+addi t0,a0,0
+sd t0,-56(s0)
+jal ra,-3485
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-56(s0)
+jal ra,2731
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3250
+ld a0,-56(s0)
+jal ra,-8854
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,6
+ld a0,-48(s0)
+ld a1,-1032(gp)
+jal ra,-2449
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,106
+ld t0,200(gp)
+ld t1,128(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,440(gp)
+beq t0,zero,13
+jal ra,-3515
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,168(gp)
+jal ra,2686
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3220
+jal zero,3
+ld a0,168(gp)
+jal ra,-2388
+jal ra,-4860
+ld t0,-1072(gp)
+sd t0,-24(s0)
+jal zero,80
+ld t0,200(gp)
+ld t1,-448(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-3539
+ld t0,440(gp)
+beq t0,zero,12
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,168(gp)
+jal ra,2660
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3194
+jal zero,5
+jal ra,-3528
+ld a1,560(gp)
+ld a2,168(gp)
+jal ra,9154
+jal ra,-4888
+ld t0,-1072(gp)
+sd t0,-24(s0)
+jal zero,52
+ld t0,200(gp)
+ld t1,-456(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,440(gp)
+beq t0,zero,14
+jal ra,-3569
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,160(gp)
+jal ra,-2387
+jal ra,2676
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3165
+jal zero,3
+ld a0,160(gp)
+jal ra,-2357
+jal ra,-4915
+ld t0,-1080(gp)
+sd t0,-24(s0)
+jal zero,25
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-4925
+jal ra,530
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4935
+jal zero,3
+ld a0,-544(gp)
+jal ra,-2854
+jal zero,4
+jal ra,-2826
+ld t0,-1072(gp)
+sd t0,-24(s0)
+ld t0,-40(s0)
+beq t0,zero,43
+ld t0,-24(s0)
+ld t1,-1080(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-1080(gp)
+ld a1,-24(s0)
+jal ra,-2753
+ld t0,440(gp)
+beq t0,zero,21
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-1176(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,320(gp)
+jal ra,3087
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,2651
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3103
+jal zero,11
+jal ra,-3619
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3622
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,9217
+ld t0,-1072(gp)
+sd t0,-24(s0)
+ld t0,-32(s0)
+beq t0,zero,54
+ld t0,-24(s0)
+ld t1,-1072(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,6
+ld a0,-1072(gp)
+ld a1,-24(s0)
+jal ra,-2797
+ld t0,-1072(gp)
+sd t0,-24(s0)
+ld t0,440(gp)
+beq t0,zero,30
+ld a0,320(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-1192(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,0
+jal ra,2529
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,320(gp)
+jal ra,3032
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,2596
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,3048
+jal zero,13
+jal ra,-3674
+ld a1,560(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3679
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,9045
+ld t0,-8(s0)
+beq t0,zero,3
+ld a0,-16(s0)
+jal zero,4
+ld a0,-24(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+jal ra,-373
+addi s1,a0,0
+jal ra,-3995
+addi t0,a0,0
+beq t0,zero,119
+ld s2,200(gp)
+jal ra,-5068
+jal ra,-380
+addi s3,a0,0
+addi t0,s1,0
+addi t1,s3,0
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+addi a0,s1,0
+addi a1,s3,0
+jal ra,-2879
+ld t0,440(gp)
+beq t0,zero,28
+addi t0,s2,0
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,-1200(gp)
+jal ra,2996
+jal zero,18
+addi t0,s2,0
+ld t1,-592(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,-1208(gp)
+jal ra,2987
+jal zero,9
+addi t0,s2,0
+ld t1,-600(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-1216(gp)
+jal ra,2978
+jal zero,75
+addi t0,s2,0
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-3723
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3726
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3769
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8978
+jal zero,50
+addi t0,s2,0
+ld t1,-592(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-3748
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3751
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3794
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8976
+jal zero,25
+addi t0,s2,0
+ld t1,-600(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-3773
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3776
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3819
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8974
+addi a0,zero,1
+jal ra,-3726
+jal zero,-120
+addi a0,s1,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+jal ra,-148
+addi s1,a0,0
+jal ra,-4107
+addi t0,a0,0
+beq t0,zero,241
+ld s2,200(gp)
+jal ra,-5208
+jal ra,-155
+addi s3,a0,0
+addi t0,s2,0
+ld t1,-568(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+addi t0,s1,0
+ld t1,-1080(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+addi t0,s3,0
+ld t1,-1072(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,440(gp)
+beq t0,zero,5
+ld a0,320(gp)
+ld a1,-16(gp)
+jal ra,2894
+jal zero,4
+jal ra,-3879
+ld a1,-16(gp)
+jal ra,4133
+jal zero,5
+lui t0,0xFFFFF
+addi t0,t0,-592
+add a0,gp,t0
+jal ra,-5787
+jal zero,18
+addi t0,s3,0
+ld t1,-1080(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,440(gp)
+beq t0,zero,6
+ld t0,320(gp)
+addi a0,t0,-1
+ld a1,-16(gp)
+jal ra,2872
+jal zero,4
+jal ra,-3866
+ld a1,-16(gp)
+jal ra,4111
+ld s1,-1080(gp)
+ld t0,440(gp)
+beq t0,zero,4
+ld a0,-1184(gp)
+jal ra,2820
+jal zero,19
+jal ra,-3875
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3878
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3921
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8780
+jal zero,160
+addi t0,s2,0
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,154
+addi t0,s1,0
+ld t1,-1080(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+addi t0,s3,0
+ld t1,-1072(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+ld t0,440(gp)
+beq t0,zero,7
+ld a0,320(gp)
+ld a1,-16(gp)
+jal ra,2820
+ld a0,-1192(gp)
+jal ra,2775
+jal zero,22
+jal ra,-3955
+ld a1,-16(gp)
+jal ra,4057
+jal ra,-3923
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3926
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-3969
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8755
+jal zero,77
+ld t0,440(gp)
+beq t0,zero,34
+ld a0,-1192(gp)
+jal ra,2748
+ld t0,320(gp)
+addi a0,t0,-1
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-1208(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,320(gp)
+addi a0,t0,-1
+jal ra,2703
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-16(gp)
+jal ra,2182
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,2258
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2710
+jal zero,41
+jal ra,-3977
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-3980
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4023
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8701
+jal ra,-4030
+ld a1,560(gp)
+ld a2,-16(gp)
+jal ra,8652
+jal ra,-3999
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4002
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4045
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8725
+ld s1,-1072(gp)
+jal zero,35
+addi t0,s3,0
+ld t1,-1080(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+addi t0,t0,-632
+add a0,gp,t0
+jal ra,-5964
+jal zero,24
+ld t0,440(gp)
+beq t0,zero,4
+ld a0,-1192(gp)
+jal ra,2660
+jal zero,19
+jal ra,-4035
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4038
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4081
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8643
+addi a0,zero,1
+jal ra,-3988
+jal zero,-242
+addi a0,s1,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-267
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-4347
+addi t0,a0,0
+beq t0,zero,425
+ld t0,200(gp)
+sd t0,-16(s0)
+jal ra,-5469
+jal ra,-276
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-8(s0)
+ld a1,-24(s0)
+jal ra,-3281
+ld t0,-1072(gp)
+sd t0,-8(s0)
+ld t0,440(gp)
+beq t0,zero,168
+ld t0,320(gp)
+addi a0,t0,-1
+jal ra,2562
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,320(gp)
+jal ra,2558
+addi t0,a0,0
+sd t0,-40(s0)
+ld a0,320(gp)
+addi a1,zero,0
+jal ra,2580
+addi a0,zero,1
+jal ra,-4041
+ld t0,-16(s0)
+ld t1,-616(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,-1224(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-1192(gp)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,2108
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,zero,1
+jal ra,2017
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,2093
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,119
+ld t0,-16(s0)
+ld t1,-624(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,-1224(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,0
+jal ra,1997
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-1192(gp)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,2068
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,2062
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,88
+ld t0,-16(s0)
+ld t1,-632(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,-1224(gp)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,2049
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,75
+ld t0,-16(s0)
+ld t1,-648(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,-1224(gp)
+ld a1,-40(s0)
+ld a2,-32(s0)
+jal ra,2036
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,62
+ld t0,-16(s0)
+ld t1,-640(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,-1192(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,1
+jal ra,1940
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-1224(gp)
+ld a1,-40(s0)
+ld a2,-32(s0)
+jal ra,2011
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,2005
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,31
+ld t0,-16(s0)
+ld t1,-656(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld a0,-1192(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,1
+jal ra,1909
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-1224(gp)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,1980
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,1974
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,320(gp)
+ld a1,-32(s0)
+jal ra,2426
+jal zero,240
+ld t0,-16(s0)
+ld t1,-616(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-4267
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4305
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4278
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8411
+jal ra,-4320
+ld a1,560(gp)
+addi a2,zero,1
+jal ra,8362
+jal ra,-4289
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4292
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4335
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8481
+addi a0,zero,1
+jal ra,-4242
+jal zero,191
+ld t0,-16(s0)
+ld t1,-624(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+jal ra,-4316
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4354
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4327
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8362
+addi a0,zero,1
+jal ra,-4269
+jal ra,-4371
+ld a1,560(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4376
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8440
+jal zero,152
+ld t0,-16(s0)
+ld t1,-632(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-4355
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4358
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4401
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8415
+addi a0,zero,1
+jal ra,-4308
+jal zero,125
+ld t0,-16(s0)
+ld t1,-648(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-4382
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4420
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4393
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8388
+addi a0,zero,1
+jal ra,-4335
+jal zero,98
+ld t0,-16(s0)
+ld t1,-640(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-4409
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4447
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4420
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8361
+jal ra,-4462
+ld a1,560(gp)
+addi a2,zero,1
+jal ra,8220
+jal ra,-4431
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4469
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4442
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8247
+addi a0,zero,1
+jal ra,-4384
+jal zero,49
+ld t0,-16(s0)
+ld t1,-656(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-4458
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4461
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4504
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8312
+jal ra,-4511
+ld a1,560(gp)
+addi a2,zero,1
+jal ra,8171
+jal ra,-4480
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4518
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4491
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,8198
+addi a0,zero,1
+jal ra,-4433
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-446
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,440(gp)
+beq t0,zero,2
+jal ra,3159
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,976(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,344(gp)
+addi t0,t0,1
+sd t0,344(gp)
+ld t0,200(gp)
+ld t1,-512(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+jal ra,-5932
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-5939
+jal ra,-43
+ld t0,976(gp)
+sd t0,-16(s0)
+jal ra,-4587
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,8319
+addi a0,zero,1
+jal ra,-4491
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+jal ra,-5955
+ld t0,200(gp)
+ld t1,-552(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-5962
+jal ra,-4994
+addi t0,a0,0
+beq t0,zero,3
+jal ra,248
+jal zero,-4
+ld t0,200(gp)
+ld t1,-560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5974
+jal zero,7
+ld a0,-560(gp)
+jal ra,-3893
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-10456
+jal zero,2
+jal ra,231
+jal zero,3
+ld a0,-544(gp)
+jal ra,-3902
+jal zero,3
+ld a0,-536(gp)
+jal ra,-3905
+jal zero,3
+ld a0,-512(gp)
+jal ra,-3908
+ld a0,560(gp)
+ld t0,-8(s0)
+ld t1,976(gp)
+sub a1,t0,t1
+jal ra,8290
+ld t0,-16(s0)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,-16(s0)
+jal ra,8345
+ld t0,344(gp)
+addi t0,t0,-1
+sd t0,344(gp)
+ld t0,416(gp)
+addi t0,t0,1
+sd t0,416(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,200(gp)
+ld t1,-480(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,108
+jal ra,-6025
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+jal ra,-6032
+jal ra,-136
+ld t0,976(gp)
+sd t0,-8(s0)
+jal ra,-4680
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,8226
+addi a0,zero,1
+jal ra,-4584
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+jal ra,-6048
+ld t0,200(gp)
+ld t1,-552(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-6055
+jal ra,-5087
+addi t0,a0,0
+beq t0,zero,3
+jal ra,155
+jal zero,-4
+ld t0,200(gp)
+ld t1,-560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6067
+jal zero,7
+ld a0,-560(gp)
+jal ra,-3986
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-10549
+jal zero,2
+jal ra,138
+ld t0,200(gp)
+ld t1,-488(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,41
+jal ra,-6083
+ld t0,976(gp)
+sd t0,-16(s0)
+ld a0,560(gp)
+addi a1,zero,0
+jal ra,8199
+ld a0,-8(s0)
+jal ra,8257
+ld t0,200(gp)
+ld t1,-552(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-6097
+jal ra,-5129
+addi t0,a0,0
+beq t0,zero,3
+jal ra,113
+jal zero,-4
+ld t0,200(gp)
+ld t1,-560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6109
+jal zero,7
+ld a0,-560(gp)
+jal ra,-4028
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-10591
+jal zero,2
+jal ra,96
+ld a0,-16(s0)
+ld a1,976(gp)
+jal ra,8297
+jal zero,3
+ld a0,-8(s0)
+jal ra,8223
+jal zero,3
+ld a0,-544(gp)
+jal ra,-4043
+jal zero,3
+ld a0,-536(gp)
+jal ra,-4046
+jal zero,3
+ld a0,-480(gp)
+jal ra,-4049
+ld t0,424(gp)
+addi t0,t0,1
+sd t0,424(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,200(gp)
+ld t1,-504(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6153
+jal zero,3
+ld a0,-504(gp)
+jal ra,-4072
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,24
+jal ra,-265
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,376(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,376(gp)
+ld a1,-8(s0)
+jal ra,-3972
+ld a0,-1360(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-4819
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,7860
+addi a0,zero,1
+jal ra,-4726
+jal zero,13
+ld t0,376(gp)
+ld t1,-1088(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,8
+ld a0,376(gp)
+ld a1,-1088(gp)
+jal ra,-3993
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,7845
+ld a0,560(gp)
+ld a1,368(gp)
+jal ra,8088
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t0,t1
+sd t0,368(gp)
+ld t0,432(gp)
+addi t0,t0,1
+sd t0,432(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-4968
+addi t0,a0,0
+beq t0,zero,15
+jal ra,-4108
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-10707
+jal zero,2
+jal ra,-6234
+jal zero,-16
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+jal ra,-6242
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,144(gp)
+ld a1,-1032(gp)
+jal ra,-3866
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,-1080(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-1080(gp)
+ld a1,-8(s0)
+jal ra,-4061
+jal ra,-6261
+jal zero,32
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-6269
+jal ra,-373
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,-1080(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-1080(gp)
+ld a1,-8(s0)
+jal ra,-4080
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6286
+jal zero,3
+ld a0,-544(gp)
+jal ra,-4205
+jal zero,4
+ld a0,-536(gp)
+jal ra,-4208
+jal zero,231
+ld t0,200(gp)
+ld t1,-608(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+jal ra,-6300
+jal ra,-404
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,-1072(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-1072(gp)
+ld a1,-16(s0)
+jal ra,-4111
+jal ra,-4920
+addi a1,zero,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-4960
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7911
+addi a0,zero,2
+jal ra,-4867
+ld t0,408(gp)
+addi t0,t0,1
+sd t0,408(gp)
+jal zero,5
+ld a0,-608(gp)
+jal ra,-4246
+addi a0,zero,1
+jal ra,-4875
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6339
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4258
+jal zero,181
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,142
+ld t0,144(gp)
+sd t0,-24(s0)
+jal ra,-6352
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-6359
+ld a0,-24(s0)
+jal ra,-1947
+addi a0,zero,1
+jal ra,-4906
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6370
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4289
+jal zero,116
+ld t0,200(gp)
+ld t1,-608(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+ld a0,-24(s0)
+ld a1,-1032(gp)
+jal ra,-4050
+addi t0,a0,0
+sd t0,-32(s0)
+addi a0,t0,0
+jal ra,-10413
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-6390
+jal ra,-494
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-8(s0)
+ld a1,-16(s0)
+jal ra,-4202
+ld a0,-32(s0)
+jal ra,-10423
+addi t0,a0,0
+sd t0,-40(s0)
+ld a0,-32(s0)
+jal ra,-10424
+jal ra,6066
+addi t0,a0,0
+beq t0,zero,17
+ld a0,-32(s0)
+jal ra,-4761
+ld a0,-32(s0)
+jal ra,-10431
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-5061
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,7618
+addi a0,zero,1
+jal ra,-4968
+jal zero,49
+ld a0,-40(s0)
+addi a1,zero,12
+jal ra,-8798
+addi t0,a0,0
+beq t0,zero,17
+ld a0,-32(s0)
+jal ra,-10450
+ld a1,-40(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5082
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7789
+addi a0,zero,1
+jal ra,-4989
+jal zero,28
+ld a0,-32(s0)
+jal ra,-4078
+jal ra,-5094
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-40(s0)
+addi a1,zero,0
+addi a2,zero,12
+jal ra,-8992
+addi a1,zero,12
+jal ra,-8784
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-5075
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,7761
+addi a0,zero,2
+jal ra,-5017
+ld t0,408(gp)
+addi t0,t0,1
+sd t0,408(gp)
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6484
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4403
+jal zero,2
+jal ra,-4375
+jal zero,34
+ld t0,200(gp)
+ld t1,-512(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-583
+jal zero,26
+ld t0,200(gp)
+ld t1,-480(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-491
+jal zero,18
+ld t0,200(gp)
+ld t1,-504(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-371
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6520
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4439
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld s1,-1072(gp)
+ld t0,200(gp)
+ld t1,-472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-6542
+ld t0,200(gp)
+ld t1,-472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6549
+jal zero,-7
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld s1,-1080(gp)
+jal ra,-6558
+jal zero,-8
+jal zero,21
+ld t0,200(gp)
+ld t1,-496(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-6567
+ld s1,-1072(gp)
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld s1,-1080(gp)
+jal ra,-6576
+jal zero,-8
+jal zero,3
+ld a0,-472(gp)
+jal ra,-4496
+addi a0,s1,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-65
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,-1112(gp)
+ld a1,144(gp)
+ld a2,-728(gp)
+ld a3,-1032(gp)
+ld a4,-8(s0)
+addi a5,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6038
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-6615
+jal zero,17
+ld a0,-464(gp)
+jal ra,-4534
+ld a0,-1112(gp)
+lui t0,0xFFFFF
+addi t0,t0,-640
+add a1,gp,t0
+ld a2,-728(gp)
+ld a3,-1032(gp)
+ld a4,-8(s0)
+addi a5,zero,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6056
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,200(gp)
+ld t1,-608(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+jal ra,-6655
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+addi t0,zero,1
+sd t0,-16(s0)
+jal ra,-6664
+jal ra,-136
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6674
+jal zero,3
+ld a0,-544(gp)
+jal ra,-4593
+ld t0,200(gp)
+ld t1,-576(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,1
+sd t0,176(gp)
+jal ra,-6686
+addi t0,zero,0
+sd t0,176(gp)
+ld t0,168(gp)
+sub t0,zero,t0
+sd t0,-8(s0)
+jal zero,3
+ld t0,168(gp)
+sd t0,-8(s0)
+jal ra,-5646
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-6698
+jal zero,2
+jal ra,-4586
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6707
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4626
+jal zero,3
+ld a0,-608(gp)
+jal ra,-4629
+ld t0,-16(s0)
+beq t0,zero,10
+ld t0,16(s0)
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,16(s0)
+ld a1,-24(s0)
+jal ra,-4524
+jal zero,9
+ld t0,16(s0)
+ld t1,-1072(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,16(s0)
+ld a1,-1072(gp)
+jal ra,-4533
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,1200(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,1008(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1008(gp)
+ld t1,-48(gp)
+sub a0,t0,t1
+jal zero,6
+ld t0,1000(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1000(gp)
+sub a0,zero,t0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,264(gp)
+addi s1,zero,0
+addi s2,zero,0
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+jal ra,-6781
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,53
+addi a0,zero,0
+jal ra,-200
+addi s3,a0,0
+addi s2,zero,1
+addi t0,s3,0
+ld t1,-48(gp)
+addi t2,zero,2
+mul t2,t1,t2
+addi t3,s2,-1
+mul t1,t3,t1
+add t1,t2,t1
+addi t0,t0,48
+sd t1,0(t0)
+addi a0,s1,0
+jal ra,-5632
+addi t0,a0,0
+beq t0,zero,25
+jal ra,-6804
+ld t0,200(gp)
+ld t1,-664(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6811
+addi s1,zero,1
+jal zero,14
+addi a0,zero,0
+jal ra,-227
+addi s3,a0,0
+addi s2,s2,1
+addi t0,s3,0
+ld t1,-48(gp)
+addi t2,zero,2
+mul t2,t1,t2
+addi t3,s2,-1
+mul t1,t3,t1
+add t1,t2,t1
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,-27
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6834
+jal zero,3
+ld a0,-544(gp)
+jal ra,-4753
+jal zero,2
+jal ra,-6839
+jal zero,3
+ld a0,-536(gp)
+jal ra,-4758
+addi t0,s1,0
+beq t0,zero,3
+addi t0,s2,0
+sub s2,zero,t0
+ld a0,16(s0)
+jal ra,-7701
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+ld a1,-1056(gp)
+jal ra,-6095
+addi s3,a0,0
+addi t0,s3,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld a0,-1104(gp)
+ld a1,16(s0)
+ld a2,-728(gp)
+ld a3,-1056(gp)
+ld a4,24(s0)
+addi a5,s2,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6294
+addi s3,a0,0
+jal zero,13
+addi a0,s3,0
+jal ra,-10898
+addi t0,a0,0
+ld t1,-1096(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,s3,0
+ld t1,24(s0)
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s1,0
+beq t0,zero,22
+addi a0,s3,0
+jal ra,-10909
+addi a1,zero,0
+jal ra,-9369
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi a0,s3,0
+jal ra,-10914
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+addi t0,t0,-688
+add a0,gp,t0
+jal ra,-7446
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-11380
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi a0,s3,0
+jal ra,-10939
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,5
+addi a0,s3,0
+jal ra,-10946
+ld a1,24(s0)
+jal ra,-4723
+jal ra,-6923
+jal zero,242
+ld t0,200(gp)
+ld t1,-552(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,235
+addi t0,zero,0
+sd t0,-48(s0)
+addi a0,s3,0
+jal ra,-6099
+addi t0,a0,0
+beq t0,zero,46
+addi t0,zero,1
+sd t0,-40(s0)
+addi t0,s3,0
+ld t1,-728(gp)
+addi t0,t0,16
+sd t1,0(t0)
+addi a0,s3,0
+jal ra,-10970
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+addi a0,s3,0
+jal ra,-10977
+ld a1,24(s0)
+jal ra,-4754
+addi t0,s3,0
+ld t1,24(s0)
+addi t0,t0,32
+sd t1,0(t0)
+addi a0,s3,0
+jal ra,-10979
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,5
+addi a0,s3,0
+jal ra,-10984
+addi t0,a0,0
+sd t0,-48(s0)
+addi t0,s3,0
+ld t1,976(gp)
+addi t0,t0,48
+sd t1,0(t0)
+ld a0,16(s0)
+ld a1,512(gp)
+jal ra,-9003
+addi t0,a0,0
+beq t0,zero,6
+ld t0,240(gp)
+sd t0,944(gp)
+ld t0,392(gp)
+addi t0,t0,1
+sd t0,392(gp)
+jal zero,17
+addi t0,zero,0
+sd t0,-40(s0)
+lui t0,0xFFFFF
+addi t0,t0,-696
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-7559
+lui t0,0xFFFFF
+addi t0,t0,-736
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-7918
+addi sp,sp,8
+jal ra,-6998
+addi s4,zero,0
+ld t0,200(gp)
+ld t1,-472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+addi t0,s4,0
+ld t1,-48(gp)
+add s4,t0,t1
+addi t0,s4,0
+sub a0,zero,t0
+jal ra,-423
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-7018
+jal zero,3
+ld a0,-528(gp)
+jal ra,-4937
+jal zero,-22
+addi t0,s1,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-5428
+ld t0,976(gp)
+sd t0,-56(s0)
+addi a0,s4,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-3122
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-3101
+ld t0,976(gp)
+sd t0,-64(s0)
+addi t0,zero,1
+sd t0,336(gp)
+addi t0,s3,0
+sd t0,360(gp)
+addi t0,zero,0
+sd t0,368(gp)
+ld t0,24(s0)
+sd t0,376(gp)
+jal ra,-6081
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-839
+jal zero,-4
+addi t0,zero,0
+sd t0,376(gp)
+ld t0,200(gp)
+ld t1,-560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,96
+ld t0,24(s0)
+ld t1,-1088(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,5
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,6970
+ld a0,368(gp)
+ld a1,976(gp)
+jal ra,7460
+addi t0,zero,0
+sd t0,368(gp)
+addi t0,s4,0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,336(gp)
+jal zero,24
+addi t0,s1,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,336(gp)
+jal zero,19
+ld t0,-1272(gp)
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,336(gp)
+jal zero,12
+ld a0,-64(s0)
+jal ra,6708
+jal ra,5674
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,336(gp)
+ld t0,336(gp)
+beq t0,zero,8
+ld a0,-64(s0)
+jal ra,-2984
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,7193
+jal zero,20
+ld a0,-56(s0)
+ld a1,-64(s0)
+jal ra,-5394
+addi t0,a0,0
+sd t0,-56(s0)
+addi t0,s1,0
+beq t0,zero,7
+addi t0,s2,0
+sub t0,zero,t0
+ld t1,-48(gp)
+mul a0,t0,t1
+jal ra,-3065
+jal zero,5
+addi t0,s2,0
+ld t1,-48(gp)
+mul a0,t0,t1
+jal ra,-3070
+ld t0,-56(s0)
+sd t0,-64(s0)
+ld t0,-40(s0)
+beq t0,zero,21
+ld t0,-48(s0)
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-48(s0)
+ld a1,-64(s0)
+jal ra,7393
+addi t0,s3,0
+ld t1,-64(s0)
+addi t0,t0,48
+sd t1,0(t0)
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s3,0
+jal ra,-4276
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+jal ra,-7156
+jal zero,7
+ld a0,-560(gp)
+jal ra,-5075
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-11638
+jal zero,2
+jal ra,-5051
+addi t0,zero,0
+sd t0,360(gp)
+addi t0,zero,0
+sd t0,264(gp)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,135
+jal ra,-5891
+addi t0,a0,0
+beq t0,zero,15
+jal ra,-5083
+ld t0,200(gp)
+ld t1,-440(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1168(t0)
+jal ra,-11682
+jal zero,2
+jal ra,-7209
+jal zero,-16
+ld t0,200(gp)
+ld t1,-496(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-7217
+ld t0,200(gp)
+ld t1,-584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7224
+ld s1,-1080(gp)
+jal zero,2
+ld s1,-1088(gp)
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld s2,144(gp)
+jal ra,-7235
+addi a0,s2,0
+addi a1,s1,0
+jal ra,-478
+jal zero,3
+ld a0,-464(gp)
+jal ra,-5157
+jal zero,85
+jal ra,-714
+addi s1,a0,0
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,75
+ld s2,144(gp)
+jal ra,-7252
+ld t0,200(gp)
+ld t1,-536(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi a0,s2,0
+addi a1,s1,0
+jal ra,-501
+jal zero,62
+ld s3,-728(gp)
+ld t0,200(gp)
+ld t1,-528(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7270
+addi s4,zero,0
+jal zero,4
+addi a0,s1,0
+jal ra,-635
+addi s4,a0,0
+addi a0,s2,0
+ld a1,-1032(gp)
+jal ra,-6520
+addi s5,a0,0
+addi t0,s5,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+ld a0,-1104(gp)
+addi a1,s2,0
+addi a2,s3,0
+ld a3,-1032(gp)
+addi a4,s1,0
+addi a5,s4,0
+addi sp,sp,-48
+sd a5,40(sp)
+sd a4,32(sp)
+sd a3,24(sp)
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s4,0
+jal ra,-559
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+ld a3,24(sp)
+ld a4,32(sp)
+ld a5,40(sp)
+addi sp,sp,40
+sd t0,0(sp)
+jal ra,-6734
+jal zero,15
+lui t0,0xFFFFF
+addi t0,t0,-744
+add a0,gp,t0
+addi a1,s3,0
+jal ra,-7885
+lui t0,0xFFFFF
+addi t0,t0,-792
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,s2,0
+sd t0,8(sp)
+jal ra,-8244
+addi sp,sp,8
+jal zero,3
+ld a0,-464(gp)
+jal ra,-5242
+jal zero,-138
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,448(gp)
+ld t0,-1264(gp)
+addi t0,t0,1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-7970
+addi t0,a0,0
+sd t0,456(gp)
+ld t0,-1264(gp)
+addi t0,t0,1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-7977
+addi t0,a0,0
+sd t0,464(gp)
+addi t0,zero,0
+sd t0,488(gp)
+addi t0,zero,0
+sd t0,496(gp)
+addi t0,zero,0
+sd t0,504(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-11336
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,448(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,16(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,32(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,40(s0)
+addi t0,t0,32
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,448(gp)
+ld t0,488(gp)
+addi t0,t0,1
+sd t0,488(gp)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld s1,448(gp)
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,39
+addi a0,s1,0
+jal ra,-11371
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-11376
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+addi a0,s1,0
+jal ra,-11381
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi a0,s1,0
+jal ra,-11386
+addi t0,a0,0
+ld t1,40(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s1,0
+jal zero,10
+addi a0,s1,0
+jal ra,-11408
+addi s1,a0,0
+jal zero,-40
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+ld a3,40(s0)
+jal ra,-105
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-11426
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld a0,16(s0)
+jal ra,-11425
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-11455
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,16(s0)
+jal ra,-11454
+addi a1,zero,12
+jal ra,-9896
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1144(gp)
+addi a1,zero,0
+addi a2,zero,0
+ld a3,16(s0)
+jal ra,-128
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,488(gp)
+sd t0,-8(s0)
+ld a0,-1152(gp)
+addi a1,zero,0
+addi a2,zero,0
+ld a3,16(s0)
+jal ra,-146
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,488(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,504(gp)
+addi t0,t0,1
+sd t0,504(gp)
+ld a0,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1160(gp)
+addi a1,zero,0
+addi a2,zero,0
+ld a3,16(s0)
+jal ra,-222
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,-1168(gp)
+addi a1,zero,0
+addi a2,zero,0
+ld a3,16(s0)
+jal ra,-238
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,16(s0)
+addi t0,t0,40
+sd t1,0(t0)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,34
+addi t0,a0,0
+sd t0,-16(s0)
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,496(gp)
+addi t0,t0,1
+sd t0,496(gp)
+ld a0,-16(s0)
+jal zero,20
+ld t0,488(gp)
+sd t0,-8(s0)
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+addi a3,zero,0
+jal ra,-228
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,488(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,504(gp)
+addi t0,t0,1
+sd t0,504(gp)
+ld a0,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+ld t1,-1176(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,365
+ld a0,24(s0)
+jal ra,-11619
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,88
+ld a0,32(s0)
+jal ra,-11627
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+ld a0,24(s0)
+jal ra,-11626
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,32(s0)
+jal ra,-11630
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+ld t1,-1184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+add a0,t0,t1
+jal ra,-176
+jal zero,330
+ld t0,16(s0)
+ld t1,-1192(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub a0,t0,t1
+jal ra,-187
+jal zero,319
+ld t0,16(s0)
+ld t1,-1200(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+mul a0,t0,t1
+jal ra,-198
+jal zero,308
+ld t0,16(s0)
+ld t1,-1224(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu a0,t0,t1
+jal ra,-209
+jal zero,297
+ld t0,-16(s0)
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,16(s0)
+ld t1,-1208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+divu a0,t0,t1
+jal ra,-223
+jal zero,283
+ld t0,16(s0)
+ld t1,-1216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+remu a0,t0,t1
+jal ra,-234
+jal zero,272
+addi a0,zero,0
+jal zero,270
+ld t0,16(s0)
+ld t1,-1184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+ld a0,24(s0)
+jal ra,-11720
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-1184(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+jal ra,-173
+jal zero,251
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-315
+addi t0,a0,0
+beq t0,zero,3
+ld a0,24(s0)
+jal zero,244
+ld a0,32(s0)
+jal ra,-11740
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+ld a0,24(s0)
+jal ra,-11748
+addi t0,a0,0
+ld t1,-1184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+ld a0,24(s0)
+jal ra,-11750
+jal ra,-11757
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld a0,-1184(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-11765
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-11771
+jal ra,-11769
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-11774
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal ra,-313
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-237
+jal zero,187
+jal zero,185
+ld t0,16(s0)
+ld t1,-1192(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,24(s0)
+ld t1,32(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,zero,0
+jal ra,-335
+jal zero,171
+ld a0,32(s0)
+jal ra,-11813
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld a0,-1184(gp)
+ld a1,24(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-11817
+addi t0,a0,0
+sub a0,zero,t0
+jal ra,-354
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-278
+jal zero,146
+jal zero,144
+ld t0,16(s0)
+ld t1,-1200(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+ld a0,24(s0)
+jal ra,-11845
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-1200(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+jal ra,-298
+jal zero,126
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-440
+addi t0,a0,0
+beq t0,zero,3
+ld a0,32(s0)
+jal zero,119
+ld a0,32(s0)
+addi a1,zero,1
+jal ra,-447
+addi t0,a0,0
+beq t0,zero,3
+ld a0,24(s0)
+jal zero,112
+ld a0,32(s0)
+jal ra,-11872
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+ld a0,24(s0)
+jal ra,-11880
+addi t0,a0,0
+ld t1,-1200(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+ld a0,24(s0)
+jal ra,-11882
+jal ra,-11889
+addi t0,a0,0
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld a0,-1200(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-11897
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-11903
+jal ra,-11901
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-11906
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul a0,t0,t1
+jal ra,-445
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-369
+jal zero,55
+jal zero,53
+ld t0,16(s0)
+ld t1,-1208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,32(s0)
+addi a1,zero,1
+jal ra,-518
+addi t0,a0,0
+beq t0,zero,3
+ld a0,24(s0)
+jal zero,41
+jal zero,39
+ld t0,16(s0)
+ld t1,-1216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld a0,32(s0)
+addi a1,zero,1
+jal ra,-532
+addi t0,a0,0
+beq t0,zero,4
+addi a0,zero,0
+jal ra,-480
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+ld t1,-1224(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,24(s0)
+ld t1,32(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,zero,0
+jal ra,-496
+jal zero,10
+ld a0,32(s0)
+addi a1,zero,0
+jal ra,-556
+addi t0,a0,0
+beq t0,zero,4
+addi a0,zero,0
+jal ra,-504
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,456(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,6
+ld a0,16(s0)
+jal ra,-6581
+jal ra,-471
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,456(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,320(gp)
+addi a0,t0,-1
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,320(gp)
+addi a0,t0,-1
+jal ra,-49
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,320(gp)
+jal ra,-58
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-494
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-42
+ld a0,320(gp)
+addi a1,zero,0
+jal ra,-45
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-1200(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-91
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-612
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-536
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-84
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-12098
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,1
+addi t0,t0,48
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-12106
+addi t0,a0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld a0,16(s0)
+jal ra,-12127
+addi t0,a0,0
+ld t1,-1168(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,23
+jal zero,17
+ld a0,16(s0)
+jal ra,-12135
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,12
+ld a0,16(s0)
+jal ra,-12140
+jal ra,-40
+ld a0,16(s0)
+jal ra,-12140
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-12145
+jal ra,-48
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-12165
+addi t0,a0,0
+ld t1,-1168(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld a0,16(s0)
+jal ra,-12164
+jal ra,-6735
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,464(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,464(gp)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jal zero,17
+ld a0,16(s0)
+jal ra,-12189
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,12
+ld a0,16(s0)
+jal ra,-12194
+jal ra,-40
+ld a0,16(s0)
+jal ra,-12194
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-12199
+jal ra,-48
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+ld t1,472(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,464(gp)
+ld t1,480(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,464(gp)
+ld t1,480(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld a0,480(gp)
+jal ra,-6818
+jal zero,38
+addi s1,zero,1
+addi t0,zero,1
+ld t1,-1264(gp)
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,22
+ld t0,464(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,464(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi a0,s1,0
+jal ra,-6844
+jal zero,12
+addi s1,s1,1
+jal zero,-26
+lui t0,0xFFFFF
+addi t0,t0,-816
+add a0,gp,t0
+jal ra,-8882
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-12816
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-12282
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,-1
+addi t0,t0,48
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-12290
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld a0,16(s0)
+jal ra,-12299
+jal ra,-6873
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,464(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,464(gp)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,-1
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-12331
+addi t0,a0,0
+ld t1,-1168(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,24(s0)
+jal ra,-12436
+addi a1,zero,0
+addi a2,zero,12
+jal ra,-10955
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,24(s0)
+jal ra,-12443
+addi a1,zero,12
+addi a2,zero,20
+jal ra,-10962
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,11
+jal ra,-11040
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,4
+ld t0,-16(s0)
+addi t0,t0,1
+sd t0,-16(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+addi a1,zero,20
+jal ra,-10775
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,5568
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-12476
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,16(s0)
+jal ra,5598
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,24(s0)
+jal ra,-12499
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,24(s0)
+jal ra,-12500
+jal ra,3990
+addi t0,a0,0
+beq t0,zero,15
+ld a0,24(s0)
+jal ra,-6837
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-12510
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,5542
+jal zero,38
+ld a0,-8(s0)
+addi a1,zero,12
+jal ra,-10872
+addi t0,a0,0
+beq t0,zero,13
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-12527
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-8(s0)
+jal ra,5685
+jal zero,21
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-112
+ld a0,16(s0)
+ld a1,16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+addi a1,zero,0
+addi a2,zero,12
+jal ra,-11065
+addi a1,zero,12
+jal ra,-10857
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5664
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,24(s0)
+addi a1,zero,32
+jal ra,-10921
+addi t0,a0,0
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-6326
+jal zero,44
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-712(gp)
+jal ra,-10744
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,10
+addi a3,zero,0
+addi a4,zero,0
+jal ra,-10425
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-1040(gp)
+jal ra,-7818
+addi t0,a0,0
+sd t0,-16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,1000(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1000(gp)
+ld a0,-1104(gp)
+ld a1,-8(s0)
+ld a2,-728(gp)
+ld a3,-1040(gp)
+ld a4,-1072(gp)
+ld a5,24(s0)
+ld t0,1000(gp)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8022
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+ld a1,-16(s0)
+jal ra,-130
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+ld a0,16(s0)
+jal ra,-12540
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-12545
+jal zero,297
+ld a0,16(s0)
+jal ra,-12560
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,-12561
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+jal ra,-12562
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-1144(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld a0,16(s0)
+jal ra,-12569
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,560(gp)
+sd t0,-56(s0)
+jal zero,15
+ld a0,16(s0)
+jal ra,-375
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-12585
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-118
+jal zero,250
+ld t0,-8(s0)
+ld t1,-1152(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld a0,16(s0)
+jal ra,-396
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,t0,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-12606
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-211
+jal zero,229
+ld t0,-8(s0)
+ld t1,-1160(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+ld a0,16(s0)
+jal ra,-417
+addi t0,a0,0
+sd t0,-56(s0)
+ld a0,16(s0)
+jal ra,-12624
+addi a1,zero,12
+jal ra,-11066
+addi t0,a0,0
+beq t0,zero,15
+ld a0,-56(s0)
+ld a1,-1304(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-12635
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5329
+jal zero,15
+ld a0,-56(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-12647
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-6492
+ld a0,-56(s0)
+ld a1,-1304(gp)
+ld a2,-56(s0)
+jal ra,5336
+jal zero,184
+ld t0,-8(s0)
+ld t1,-1176(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+addi t0,zero,0
+sd t0,-48(s0)
+ld a0,-16(s0)
+jal ra,-12676
+addi t0,a0,0
+ld t1,-1184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,-16(s0)
+jal ra,-12669
+addi t0,a0,-1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld a0,-16(s0)
+jal ra,-12684
+jal ra,-1242
+addi t0,a0,0
+beq t0,zero,15
+ld a0,-16(s0)
+jal ra,-12689
+jal ra,-12687
+addi t0,a0,0
+sd t0,-48(s0)
+ld a0,-16(s0)
+jal ra,-12694
+jal ra,-414
+ld a0,-16(s0)
+jal ra,-416
+ld a0,-16(s0)
+jal ra,-12702
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,-16(s0)
+jal ra,-164
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-16(s0)
+jal ra,-426
+ld a0,16(s0)
+jal ra,-503
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,t0,0
+ld a1,-32(s0)
+ld a2,-48(s0)
+jal ra,5418
+jal zero,128
+ld t0,-8(s0)
+ld t1,-1184(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+ld a0,-24(s0)
+jal ra,-1281
+addi t0,a0,0
+beq t0,zero,27
+ld a0,-16(s0)
+jal ra,-189
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-16(s0)
+jal ra,-451
+ld a0,-24(s0)
+jal ra,-453
+ld a0,16(s0)
+jal ra,-530
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,t0,0
+ld a1,-32(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-24(s0)
+jal ra,-12742
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5222
+jal zero,21
+ld a0,-16(s0)
+jal ra,-215
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-24(s0)
+jal ra,-219
+addi t0,a0,0
+sd t0,-40(s0)
+ld a0,-16(s0)
+jal ra,-481
+ld a0,-24(s0)
+jal ra,-483
+ld a0,16(s0)
+jal ra,-560
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,t0,0
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5223
+jal zero,71
+ld a0,-16(s0)
+jal ra,-236
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-24(s0)
+jal ra,-240
+addi t0,a0,0
+sd t0,-40(s0)
+ld a0,-16(s0)
+jal ra,-502
+ld a0,-24(s0)
+jal ra,-504
+ld a0,16(s0)
+jal ra,-581
+addi t0,a0,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+ld t1,-1192(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-56(s0)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5219
+jal zero,44
+ld t0,-8(s0)
+ld t1,-1200(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-56(s0)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5231
+jal zero,33
+ld t0,-8(s0)
+ld t1,-1208(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-56(s0)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5243
+jal zero,22
+ld t0,-8(s0)
+ld t1,-1216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,-56(s0)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5255
+jal zero,11
+ld t0,-8(s0)
+ld t1,-1224(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,-56(s0)
+ld a1,-32(s0)
+ld a2,-40(s0)
+jal ra,5267
+ld t0,16(s0)
+ld t1,-56(s0)
+addi t0,t0,40
+sd t1,0(t0)
+ld a0,-56(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+ld t0,456(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,121
+addi s3,zero,1
+addi t0,zero,1
+ld t1,-1264(gp)
+addi t2,s3,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,53
+addi t0,s3,0
+ld t1,16(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,464(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+jal zero,37
+ld t0,320(gp)
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,464(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+jal zero,25
+ld t0,456(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,464(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+jal zero,8
+ld t0,464(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-57
+addi s3,zero,1
+addi t0,zero,1
+ld t1,320(gp)
+addi t2,s3,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,23
+addi t0,s3,0
+ld t1,16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,456(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,456(gp)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,-805
+addi s3,s3,1
+jal zero,-27
+ld a0,-8(s0)
+jal ra,-863
+ld t0,-8(s0)
+sd t0,472(gp)
+ld t0,16(s0)
+sd t0,480(gp)
+ld a0,-8(s0)
+jal ra,-428
+addi t0,a0,0
+sd t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-7555
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,6
+ld a0,16(s0)
+jal ra,-7563
+ld a1,-16(s0)
+addi a2,zero,0
+jal ra,4989
+ld a0,-8(s0)
+jal ra,-705
+addi t0,zero,0
+sd t0,472(gp)
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-983
+ld s3,-24(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi s1,zero,1
+addi t0,zero,1
+ld t1,320(gp)
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,5
+addi a0,s1,0
+jal ra,-158
+addi s1,s1,1
+jal zero,-9
+addi t0,zero,0
+sd t0,448(gp)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld a0,360(gp)
+jal ra,-13124
+addi a1,zero,0
+jal ra,-11584
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+addi t0,t0,-880
+add a0,gp,t0
+jal ra,-9656
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+ld a0,264(gp)
+ld a1,144(gp)
+ld a2,-1032(gp)
+jal ra,-8416
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,57
+jal ra,-9126
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+jal ra,-9133
+ld t0,-48(gp)
+addi t1,zero,2
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,360(gp)
+jal ra,-13163
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-48(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,-16(s0)
+addi a0,t0,0
+jal ra,-6678
+jal ra,-7794
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-7797
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-1344(gp)
+jal ra,4904
+ld a0,-1344(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-13184
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-7816
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,5055
+addi a0,zero,1
+jal ra,-7723
+jal zero,4
+ld a0,144(gp)
+jal ra,-9671
+jal ra,-9184
+jal zero,3
+ld a0,-464(gp)
+jal ra,-7103
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,68
+ld a0,264(gp)
+ld a1,144(gp)
+ld a2,-1032(gp)
+jal ra,-8506
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,56
+jal ra,-9216
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+jal ra,-9223
+ld a0,-8(s0)
+jal ra,-13245
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-7897
+jal ra,-7873
+ld a1,-1344(gp)
+ld a2,-16(s0)
+jal ra,4969
+jal ra,-7842
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-7880
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,4959
+jal ra,-7887
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-7890
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-48(gp)
+jal ra,4789
+ld a0,-1344(gp)
+ld a1,-16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-7902
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,4969
+addi a0,zero,1
+jal ra,-7809
+jal zero,3
+ld a0,-544(gp)
+jal ra,-7185
+jal zero,4
+ld a0,144(gp)
+jal ra,-9760
+jal ra,-9273
+jal zero,3
+ld a0,-464(gp)
+jal ra,-7192
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,360(gp)
+jal ra,-13310
+addi a1,zero,0
+jal ra,-11770
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+addi t0,t0,-944
+add a0,gp,t0
+jal ra,-9842
+ld t0,200(gp)
+ld t1,-464(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-9304
+ld t0,200(gp)
+ld t1,-544(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-9311
+jal zero,3
+ld a0,-544(gp)
+jal ra,-7230
+jal zero,3
+ld a0,-464(gp)
+jal ra,-7233
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-7998
+ld a0,16(s0)
+ld a1,16(s0)
+ld t0,24(s0)
+addi a2,t0,-1
+jal ra,4707
+jal ra,-7979
+ld a1,560(gp)
+ld a2,24(s0)
+jal ra,4703
+jal ra,-7983
+ld a1,16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-7988
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,4805
+ld a0,16(s0)
+ld a1,16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-8000
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,4724
+addi a0,zero,1
+jal ra,-7907
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-7952
+ld a1,560(gp)
+ld a2,24(s0)
+jal ra,4662
+ld a0,16(s0)
+ld a1,16(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-7961
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,4718
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+addi t1,zero,22
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,4600
+addi s1,s1,1
+jal zero,-6
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,-1976(gp)
+sd t0,968(gp)
+ld t0,976(gp)
+ld t1,-48(gp)
+remu t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,4579
+ld t0,968(gp)
+ld t1,976(gp)
+add a0,t0,t1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-10179
+addi t0,a0,0
+sd t0,992(gp)
+ld t1,1000(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,976(gp)
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,976(gp)
+jal ra,-8553
+addi t0,a0,0
+beq t0,zero,6
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,4589
+jal zero,112
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,31
+jal ra,-12065
+addi t1,a0,0
+ld t0,0(sp)
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,11
+jal ra,-12072
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,-8(s0)
+jal ra,-7004
+jal zero,9
+lui t0,0xFFFFF
+addi t0,t0,-976
+add a0,gp,t0
+jal ra,-10025
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-13959
+ld a0,-1304(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-8132
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,4547
+addi a0,zero,1
+jal ra,-8039
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,4541
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1912(t0)
+jal ra,4535
+jal ra,4821
+ld a0,-1360(gp)
+ld a1,-48(gp)
+jal ra,-187
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1912(t0)
+jal ra,4525
+jal ra,4811
+ld a0,520(gp)
+ld a1,-1032(gp)
+jal ra,-8762
+addi t0,a0,0
+sd t0,-24(s0)
+addi a0,t0,0
+jal ra,-13541
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-24(s0)
+jal ra,-13548
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-1360(gp)
+jal ra,4699
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,4503
+ld a0,-1360(gp)
+ld a1,-1296(gp)
+addi a2,zero,0
+jal ra,4659
+ld a0,-1368(gp)
+ld a1,-1296(gp)
+ld a2,-48(gp)
+jal ra,4495
+ld a0,512(gp)
+ld a1,-1056(gp)
+jal ra,-8791
+addi t0,a0,0
+sd t0,-24(s0)
+addi a0,t0,0
+ld a1,512(gp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-24(s0)
+jal ra,-13581
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-6982
+ld t0,840(gp)
+ld t1,976(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sd t0,840(gp)
+ld t0,-16(s0)
+sd t0,976(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,256(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,18
+addi a0,s2,0
+jal ra,-13637
+jal ra,-8726
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-8774
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,8
+addi a0,s2,0
+jal ra,-13653
+addi s2,a0,0
+jal zero,-19
+addi s1,s1,1
+jal zero,-31
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,3135
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,3103
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-1824(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,832(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,832(gp)
+jal zero,147
+ld t0,-8(s0)
+ld t1,-1800(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,840(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,840(gp)
+jal zero,136
+ld t0,-8(s0)
+ld t1,-1816(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,65
+ld t0,-16(s0)
+ld t1,-1880(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,888(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,888(gp)
+jal zero,53
+ld t0,-16(s0)
+ld t1,-1864(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,872(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,872(gp)
+jal zero,42
+ld t0,-16(s0)
+ld t1,-1872(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,880(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,880(gp)
+jal zero,31
+ld a0,16(s0)
+jal ra,2996
+addi t0,a0,0
+ld t1,-1928(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,856(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,856(gp)
+jal zero,18
+ld a0,16(s0)
+jal ra,2983
+addi t0,a0,0
+ld t1,-1920(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,864(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,864(gp)
+jal zero,5
+ld t0,848(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,848(gp)
+jal zero,66
+ld t0,-8(s0)
+ld t1,-1792(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,896(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,896(gp)
+jal zero,55
+ld t0,-8(s0)
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,904(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,904(gp)
+jal zero,44
+ld t0,-8(s0)
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,912(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,912(gp)
+jal zero,33
+ld t0,-8(s0)
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,920(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,920(gp)
+jal zero,22
+ld t0,-8(s0)
+ld t1,-1840(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,928(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,928(gp)
+jal zero,11
+ld t0,-8(s0)
+ld t1,-1856(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,936(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,936(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,2959
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,-1824(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,41
+ld t0,-8(s0)
+ld t1,-1800(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,33
+ld t0,-8(s0)
+ld t1,-1816(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld a0,16(s0)
+jal ra,2906
+addi t0,a0,0
+ld t1,-1864(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,17
+ld a0,16(s0)
+jal ra,2896
+addi t0,a0,0
+ld t1,-1872(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,7
+addi a0,zero,1
+jal zero,5
+jal zero,3
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,2896
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,-1824(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,64
+ld t0,-8(s0)
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,56
+ld a0,16(s0)
+jal ra,2835
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,46
+ld t0,-8(s0)
+ld t1,-1816(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,16(s0)
+jal ra,2805
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu a0,t0,t1
+jal zero,32
+ld t0,-8(s0)
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,16(s0)
+jal ra,2791
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu a0,t0,t1
+jal zero,18
+ld t0,-8(s0)
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,16(s0)
+jal ra,2777
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu a0,t0,t1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,2810
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,26
+ld t0,-8(s0)
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,18
+ld t0,-8(s0)
+ld t1,-1856(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,10
+ld a0,16(s0)
+jal ra,2769
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+ld t0,528(gp)
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,2
+remu a0,t0,t1
+jalr zero,0(ra)
+ld t0,528(gp)
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,2
+divu a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+ld a0,16(s0)
+jal ra,-23
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,528(gp)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,528(gp)
+ld t2,16(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,2
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,172
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+ld a0,16(s0)
+jal ra,3719
+addi s1,a0,0
+addi a0,s1,0
+jal ra,2683
+addi s2,a0,0
+addi t0,s2,0
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,3008
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal ra,-78
+jal zero,17
+addi t0,s2,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,3146
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal ra,-95
+ld a0,16(s0)
+jal ra,89
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-47
+jal ra,8
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,256(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,16
+addi a0,s2,0
+jal ra,-14187
+addi t0,a0,0
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,s2,0
+jal ra,-14186
+jal ra,-140
+addi a0,s2,0
+jal ra,-14207
+addi s2,a0,0
+jal zero,-17
+addi s1,s1,1
+jal zero,-29
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t0,t1
+sd t0,16(s0)
+addi a0,t0,0
+jal ra,-197
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,4
+jal zero,-18
+ld a0,24(s0)
+jal ra,42
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,16
+ld a0,16(s0)
+jal ra,-228
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-18
+ld a0,976(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,16(s0)
+jal ra,-258
+addi t0,a0,0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-50
+jal zero,2
+ld a0,16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,3527
+addi a1,zero,-1
+jal ra,-651
+ld t0,528(gp)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,528(gp)
+ld t2,16(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,3491
+addi a1,zero,-1
+jal ra,-687
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,3511
+ld a0,24(s0)
+addi a1,zero,1
+jal ra,-693
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-8836
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,73
+ld a0,24(s0)
+jal ra,-96
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,24(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,64
+ld a0,24(s0)
+jal ra,-339
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,59
+ld a0,24(s0)
+jal ra,3445
+addi s1,a0,0
+addi a0,s1,0
+jal ra,2409
+addi s2,a0,0
+addi a0,s1,0
+ld a1,16(s0)
+jal ra,-499
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,46
+addi t0,s2,0
+ld t1,-1856(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,38
+addi t0,s2,0
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,30
+addi t0,s2,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,22
+addi t0,s2,0
+ld t1,-1840(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,14
+addi a0,s1,0
+ld a1,16(s0)
+jal ra,-452
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,7
+ld a0,24(s0)
+jal ra,-198
+addi t0,a0,0
+sd t0,24(s0)
+jal zero,-66
+addi a0,zero,1
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,24(s0)
+jal ra,2327
+addi t0,a0,0
+ld t1,560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+jal ra,-167
+addi a0,zero,1
+jal zero,34
+ld a0,24(s0)
+jal ra,2329
+addi t0,a0,0
+ld t1,-1800(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld a0,24(s0)
+jal ra,2279
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,2302
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld a0,24(s0)
+jal ra,2395
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+jal ra,-199
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,24(s0)
+jal ra,2271
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a1,t0,t1
+jal ra,-165
+addi t0,a0,0
+beq t0,zero,5
+ld a0,16(s0)
+jal ra,-225
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,24(s0)
+jal ra,2258
+addi t0,a0,0
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,2584
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,2728
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,-8(s0)
+ld a0,-8(s0)
+jal ra,-293
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-334
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+jal ra,-285
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+addi s1,zero,0
+ld a0,16(s0)
+jal ra,-361
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,16(s0)
+jal ra,-568
+addi t0,a0,0
+beq t0,zero,3
+addi a0,s1,0
+jal zero,10
+ld a0,16(s0)
+jal ra,-317
+addi s1,zero,1
+ld a0,16(s0)
+jal ra,-378
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-17
+addi a0,s1,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+jal ra,-397
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,976(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,105
+ld a0,-8(s0)
+jal ra,-607
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,99
+ld a0,-8(s0)
+jal ra,3177
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,24(s0)
+jal ra,2126
+addi t0,a0,0
+sd t0,-24(s0)
+ld a0,-16(s0)
+jal ra,2136
+addi t0,a0,0
+ld t1,-1800(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,82
+ld a0,-16(s0)
+jal ra,2113
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,73
+ld a0,-16(s0)
+jal ra,2076
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,64
+ld a0,24(s0)
+jal ra,2197
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-16(s0)
+jal ra,2192
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,-32(s0)
+addi a0,t0,0
+addi a1,zero,12
+jal ra,-13044
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,43
+ld t0,-32(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,24(s0)
+jal ra,2042
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld a0,16(s0)
+jal ra,-424
+ld a0,-8(s0)
+jal ra,-426
+addi a0,zero,1
+jal zero,25
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-32(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,2022
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,584(gp)
+ld a3,-24(s0)
+ld a4,-1800(gp)
+jal ra,2101
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-414
+ld a0,-8(s0)
+jal ra,-451
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,24(s0)
+jal ra,1992
+addi t0,a0,0
+ld t1,-1296(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,62
+ld a0,16(s0)
+jal ra,-533
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,976(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,51
+ld a0,-8(s0)
+jal ra,3047
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+jal ra,2010
+addi t0,a0,0
+ld t1,-1800(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,38
+ld a0,-16(s0)
+jal ra,1987
+addi t0,a0,0
+ld t1,-1296(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,29
+ld a0,-16(s0)
+jal ra,1950
+addi t0,a0,0
+ld t1,-1296(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,20
+ld a0,-16(s0)
+jal ra,2071
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,2173
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,-48(gp)
+add a1,t0,t1
+jal ra,-13279
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+ld a0,16(s0)
+jal ra,-533
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,-606
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,976(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,100
+ld a0,-8(s0)
+jal ra,-816
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,94
+ld a0,-8(s0)
+jal ra,2968
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+jal ra,1931
+addi t0,a0,0
+ld t1,-1792(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,81
+ld a0,-16(s0)
+jal ra,1880
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,1875
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,66
+ld a0,-16(s0)
+jal ra,1995
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,2096
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,51
+ld a0,-16(s0)
+jal ra,1878
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,1831
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,-8(s0)
+jal ra,-622
+jal zero,33
+ld a0,-8(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,zero,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,1813
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,584(gp)
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,1844
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+ld a4,-1800(gp)
+jal ra,1895
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-620
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld a0,24(s0)
+jal ra,1816
+addi t0,a0,0
+sd t0,-24(s0)
+addi a0,t0,0
+jal ra,-9444
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,93
+ld a0,16(s0)
+jal ra,-740
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,976(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,82
+ld a0,-8(s0)
+jal ra,-950
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,76
+ld a0,-8(s0)
+jal ra,2834
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+jal ra,1797
+addi t0,a0,0
+ld t1,-1800(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,63
+ld a0,-16(s0)
+jal ra,1746
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,54
+ld a0,-16(s0)
+jal ra,1867
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,47
+ld a0,-24(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a1,t0,t1
+jal ra,-677
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,34
+ld a0,16(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-24(s0)
+addi a1,zero,7
+jal ra,-13595
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,1726
+addi a1,zero,7
+jal ra,-13609
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+add a1,t0,t1
+jal ra,-734
+ld a0,-8(s0)
+jal ra,-771
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,2748
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+jal ra,1711
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-259
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,111
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-348
+jal zero,107
+jal zero,64
+ld t0,-16(s0)
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-583
+jal zero,96
+ld t0,-16(s0)
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld a0,-8(s0)
+jal ra,1660
+addi t0,a0,0
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,81
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-602
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,74
+ld a0,16(s0)
+jal ra,-548
+jal zero,71
+jal zero,28
+ld t0,-16(s0)
+ld t1,-1840(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld a0,-8(s0)
+jal ra,1634
+addi t0,a0,0
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,55
+ld a0,16(s0)
+jal ra,-567
+jal zero,52
+jal zero,9
+ld t0,-16(s0)
+ld t1,-1856(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,43
+ld a0,-8(s0)
+jal ra,-1339
+addi t0,a0,0
+beq t0,zero,8
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-726
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,32
+ld t0,-16(s0)
+ld t1,-1800(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-560
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,19
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-236
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+ld a0,-8(s0)
+jal ra,-1370
+addi t0,a0,0
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-701
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,104
+ld t0,256(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,93
+addi a0,s2,0
+jal ra,-15242
+addi t0,a0,0
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+addi a0,s2,0
+jal ra,-15241
+addi t0,a0,0
+addi t1,zero,1
+ld t2,16(s0)
+sltu t0,t0,t2
+sub t0,t1,t0
+beq t0,zero,73
+addi a0,s2,0
+jal ra,-15249
+addi t0,a0,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,67
+addi a0,s2,0
+jal ra,-15255
+jal ra,-1235
+addi t0,a0,0
+beq t0,zero,62
+addi a0,s2,0
+jal ra,-15260
+jal ra,-992
+jal ra,2562
+jal ra,1528
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+addi a0,s2,0
+jal ra,-15271
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,2739
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2570
+jal ra,2733
+addi a1,zero,1
+jal ra,-1634
+ld t0,528(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s2,0
+jal ra,-15287
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,528(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s2,0
+jal ra,-15304
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,-1
+sd t1,0(t0)
+addi a0,s2,0
+jal ra,-15339
+addi s2,a0,0
+jal zero,-94
+addi s1,s1,1
+jal zero,-106
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,528(gp)
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s2,zero,0
+addi s1,zero,0
+addi t0,zero,1
+ld t1,976(gp)
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,39
+ld t0,528(gp)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s3,0(t0)
+ld t0,528(gp)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s1,0
+addi t2,s2,0
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+mul t2,t2,t3
+sub t1,t1,t2
+sd t1,0(t0)
+addi t0,s3,0
+addi t1,zero,2
+remu t0,t0,t1
+beq t0,zero,2
+addi s2,s2,1
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-43
+addi t0,s2,0
+sd t0,552(gp)
+ld s1,16(s0)
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,139
+addi a0,s1,0
+jal ra,-78
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,-87
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,116
+addi a0,s1,0
+jal ra,2396
+addi s4,a0,0
+addi a0,s4,0
+jal ra,1360
+addi s5,a0,0
+addi t0,s5,0
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s4,0
+jal ra,1682
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal ra,-118
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-123
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s4,0
+jal ra,1271
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s4,0
+jal ra,1276
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s4,0
+jal ra,1279
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+ld a4,-1832(gp)
+jal ra,1553
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2352
+jal zero,44
+addi t0,s5,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s4,0
+jal ra,1771
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal ra,-184
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-189
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s4,0
+jal ra,1247
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-1848(gp)
+jal ra,1676
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2308
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-141
+ld s1,16(s0)
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,61
+addi a0,s1,0
+jal ra,-221
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,-230
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,38
+addi a0,s1,0
+jal ra,-238
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,2249
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2269
+ld t0,1016(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-252
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1016(gp)
+addi t2,s1,0
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-63
+ld a0,976(gp)
+jal ra,-281
+addi s1,a0,0
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+addi a0,s1,0
+addi a1,zero,0
+jal ra,2227
+ld t0,1016(gp)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-23
+addi s6,zero,0
+addi t0,s6,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,49
+ld t0,256(gp)
+addi t1,s6,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s7,0(t0)
+addi t0,s7,0
+sltu t0,zero,t0
+beq t0,zero,38
+addi a0,s7,0
+jal ra,-15664
+addi t0,a0,0
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+addi a0,s7,0
+jal ra,-15663
+addi t0,a0,0
+addi t1,zero,1
+ld t2,16(s0)
+sltu t0,t0,t2
+sub t0,t1,t0
+beq t0,zero,18
+addi a0,s7,0
+jal ra,-15671
+addi t0,a0,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,12
+addi t0,s7,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s7,0
+jal ra,-15680
+jal ra,-348
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+addi a0,s7,0
+jal ra,-15706
+addi s7,a0,0
+jal zero,-39
+addi s6,s6,1
+jal zero,-51
+ld a0,976(gp)
+jal ra,-361
+addi t0,a0,0
+sd t0,976(gp)
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-1629
+ld a0,16(s0)
+jal ra,-1450
+addi s1,a0,0
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+addi a0,s1,0
+jal ra,-657
+addi t0,a0,0
+beq t0,zero,6
+addi a0,s1,0
+ld a1,16(s0)
+jal ra,-1530
+addi s1,a0,0
+jal zero,4
+addi a0,s1,0
+jal ra,-1502
+addi s1,a0,0
+jal zero,-16
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+ld t0,16(s0)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+ld a0,16(s0)
+jal ra,-1726
+addi t0,a0,0
+beq t0,zero,3
+ld a0,16(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-16
+ld a0,976(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,72
+ld a0,16(s0)
+jal ra,-1772
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,65
+ld a0,16(s0)
+jal ra,-56
+addi s1,a0,0
+ld t0,16(s0)
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,528(gp)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,528(gp)
+ld t2,16(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1480(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,-1
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,1996
+addi s2,a0,0
+addi a0,s2,0
+jal ra,960
+addi t0,a0,0
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+addi a0,s2,0
+jal ra,938
+addi t0,a0,0
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s2,0
+jal ra,1434
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+ld a1,24(s0)
+jal ra,-77
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-60
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s1,-8(s0)
+ld s1,16(s0)
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,528(gp)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-20
+jal ra,-1743
+ld a0,512(gp)
+ld a1,-1056(gp)
+jal ra,-11124
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,t0,0
+jal ra,-15906
+ld a1,16(s0)
+jal ra,-130
+ld s1,16(s0)
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+addi a0,s1,0
+jal ra,-1894
+addi t0,a0,0
+beq t0,zero,15
+addi a0,s1,0
+jal ra,1905
+addi a1,zero,-1
+jal ra,-2273
+ld t0,544(gp)
+addi t0,t0,1
+sd t0,544(gp)
+addi a0,s1,0
+jal ra,-1892
+addi t0,a0,0
+beq t0,zero,4
+ld t0,536(gp)
+addi t0,t0,1
+sd t0,536(gp)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s1,t0,t1
+jal zero,-27
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,536(gp)
+addi t0,zero,0
+sd t0,544(gp)
+addi t0,zero,0
+sd t0,552(gp)
+jal ra,-2355
+addi t0,a0,0
+beq t0,zero,2
+jal zero,20
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+addi t0,t0,1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-12569
+addi t0,a0,0
+sd t0,528(gp)
+ld a0,16(s0)
+jal ra,-101
+ld a0,16(s0)
+jal ra,-264
+ld a0,16(s0)
+jal ra,-765
+ld a0,16(s0)
+jal ra,-633
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,-296(gp)
+addi a2,zero,0
+jal ra,-16438
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-14301
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,2008(gp)
+jal ra,20537
+addi t0,zero,0
+sd t0,-24(s0)
+addi s1,zero,1
+addi s2,zero,0
+lui t0,0xFFFFF
+addi t0,t0,-984
+add t0,gp,t0
+sd t0,240(gp)
+sd t0,944(gp)
+ld a0,-1960(gp)
+jal ra,-12622
+addi t0,a0,0
+sd t0,960(gp)
+addi t0,zero,0
+sd t0,968(gp)
+addi t0,zero,0
+sd t0,976(gp)
+ld a0,-1968(gp)
+jal ra,-12630
+addi t0,a0,0
+sd t0,984(gp)
+addi t0,zero,0
+sd t0,992(gp)
+addi t0,zero,0
+sd t0,1000(gp)
+addi t0,zero,0
+sd t0,1008(gp)
+ld t0,-1960(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-12646
+addi t0,a0,0
+sd t0,1016(gp)
+ld t0,-1968(gp)
+ld t1,-48(gp)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-12654
+addi t0,a0,0
+sd t0,1024(gp)
+jal ra,-16046
+jal ra,-15701
+jal ra,-2640
+jal ra,4656
+jal ra,4758
+jal ra,5062
+jal ra,5366
+jal ra,5713
+jal ra,6069
+jal ra,6352
+ld t0,1200(gp)
+beq t0,zero,7
+jal ra,7939
+jal ra,7967
+jal ra,7995
+ld t0,976(gp)
+sd t0,-24(s0)
+jal ra,8058
+ld a0,-1120(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1000
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1064(gp)
+ld a4,-1088(gp)
+addi a5,zero,1
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11490
+ld a0,-1120(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1008
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1064(gp)
+ld a4,-1072(gp)
+addi a5,zero,1
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11502
+ld a0,-1120(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1016
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1064(gp)
+ld a4,-1088(gp)
+addi a5,zero,1
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11514
+ld a0,-1104(gp)
+ld a1,512(gp)
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11524
+ld t0,976(gp)
+sd t0,-32(s0)
+sd t0,1040(gp)
+jal ra,4225
+addi t0,a0,0
+beq t0,zero,2
+addi s2,s2,1
+addi t0,s1,0
+beq t0,zero,179
+jal ra,19545
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s1,zero,0
+jal zero,171
+addi a0,zero,0
+jal ra,19541
+addi a1,zero,0
+jal ra,-14394
+addi t0,a0,-45
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s1,zero,0
+jal zero,161
+jal ra,19557
+addi t0,a0,0
+sd t0,240(gp)
+addi s2,s2,1
+lui t0,0xFFFFF
+addi t0,t0,-1056
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,240(gp)
+sd t0,16(sp)
+jal ra,-13060
+addi sp,sp,16
+ld a0,240(gp)
+jal ra,-178
+addi t0,a0,0
+sd t0,248(gp)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-14627
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,240(gp)
+sd t0,16(sp)
+jal ra,-13080
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-16638
+jal ra,-16241
+jal ra,-4827
+jal ra,-16148
+jal ra,-4988
+lui t0,0xFFFFF
+addi t0,t0,-1152
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,192(gp)
+sd t0,16(sp)
+ld t0,-728(gp)
+sd t0,24(sp)
+ld t0,216(gp)
+sd t0,32(sp)
+jal ra,-13103
+addi sp,sp,32
+lui t0,0xFFFFF
+addi t0,t0,-1216
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,192(gp)
+ld t1,208(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld a0,192(gp)
+ld t0,192(gp)
+ld t1,208(gp)
+sub a1,t0,t1
+jal ra,-13796
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,192(gp)
+ld t0,192(gp)
+ld t1,208(gp)
+sub a1,t0,t1
+jal ra,-13777
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,224(gp)
+sd t0,40(sp)
+jal ra,-13132
+addi sp,sp,40
+lui t0,0xFFFFF
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,280(gp)
+sd t0,16(sp)
+ld t0,288(gp)
+sd t0,24(sp)
+ld t0,296(gp)
+sd t0,32(sp)
+jal ra,-13147
+addi sp,sp,32
+lui t0,0xFFFFF
+addi t0,t0,-1360
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,392(gp)
+sd t0,16(sp)
+ld t0,400(gp)
+sd t0,24(sp)
+ld t0,408(gp)
+sd t0,32(sp)
+ld t0,416(gp)
+sd t0,40(sp)
+ld t0,424(gp)
+sd t0,48(sp)
+ld t0,432(gp)
+sd t0,56(sp)
+jal ra,-13168
+addi sp,sp,56
+ld t0,440(gp)
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,488(gp)
+sd t0,16(sp)
+ld t0,496(gp)
+sd t0,24(sp)
+ld t0,504(gp)
+sd t0,32(sp)
+jal ra,-13185
+addi sp,sp,32
+ld t0,232(gp)
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+addi t0,t0,-1488
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,232(gp)
+sd t0,16(sp)
+ld t0,240(gp)
+sd t0,24(sp)
+jal ra,-13201
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1152(t0)
+jal ra,-16759
+jal zero,-179
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+addi t0,t0,-1536
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-13219
+addi sp,sp,8
+ld t0,440(gp)
+beq t0,zero,29
+ld a0,-32(s0)
+jal ra,-378
+lui t0,0xFFFFF
+addi t0,t0,-1616
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,536(gp)
+sd t0,16(sp)
+ld t0,544(gp)
+sd t0,24(sp)
+jal ra,-13236
+addi sp,sp,24
+lui t0,0xFFFFF
+addi t0,t0,-1672
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,552(gp)
+ld t1,544(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-13249
+addi sp,sp,16
+ld t0,976(gp)
+sd t0,1048(gp)
+jal ra,-2914
+ld t0,1200(gp)
+beq t0,zero,3
+ld a0,-24(s0)
+jal ra,7803
+jal ra,2314
+jal ra,2430
+addi t0,a0,0
+sd t0,952(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1752
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,312(gp)
+ld t1,304(gp)
+divu t0,t0,t1
+sd t0,16(sp)
+ld t0,312(gp)
+sd t0,24(sp)
+jal ra,-13275
+addi sp,sp,24
+lui t0,0xFFFFF
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,976(gp)
+ld t1,1000(gp)
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,1000(gp)
+sd t0,32(sp)
+ld t0,1008(gp)
+sd t0,40(sp)
+jal ra,-13298
+addi sp,sp,40
+jal ra,1159
+ld a0,2008(gp)
+jal ra,20191
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,568(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-13
+jal ra,-13854
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+ld t1,-1296(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,20
+addi t0,a0,0
+ld t1,-1344(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,12
+addi t0,a0,0
+ld t1,-1288(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1304(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,5
+ld a0,16(s0)
+jal ra,-42
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1360(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+ld t1,-1416(gp)
+addi t2,a0,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,a0,0
+ld t1,-1352(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,16
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1424(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+ld t1,-1496(gp)
+addi t2,a0,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1320(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,20
+addi t0,zero,1
+ld t1,-1336(gp)
+addi t2,a0,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,15
+addi t0,zero,1
+addi t1,a0,0
+ld t2,-1504(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,7
+addi a0,zero,0
+jal zero,5
+jal zero,3
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,38
+ld t0,1760(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,1752(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1752(gp)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jal zero,16
+jal ra,12290
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add a0,gp,t0
+jal ra,-14015
+ld a0,16(s0)
+jal ra,-170
+jal ra,-13983
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1408(t0)
+ld a1,16(s0)
+jal ra,12899
+addi a0,zero,0
+jal zero,2
+addi a0,zero,1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,1760(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1760(gp)
+addi t2,a0,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,672(gp)
+jal ra,-72
+addi t0,a0,0
+beq t0,zero,7
+ld a0,680(gp)
+jal ra,-76
+addi t0,a0,0
+beq t0,zero,3
+ld a0,688(gp)
+jal ra,-27
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-14990
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add a0,gp,t0
+ld a1,-728(gp)
+jal ra,-13201
+lui t0,0xFFFFF
+addi t0,t0,-1936
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi a0,t0,-1
+jal ra,-15247
+addi t0,a0,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi a0,t0,-1
+jal ra,-15253
+addi t0,a0,-1
+sd t0,24(sp)
+jal ra,-13571
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-17129
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-64
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd a5,56(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,5
+jal ra,-15248
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15253
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi a1,zero,3
+jal ra,-15258
+addi t0,a0,0
+ld t1,40(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15263
+addi t0,a0,0
+ld t1,48(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15268
+addi t0,a0,0
+ld t1,56(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,25
+addi a2,zero,7
+jal ra,-15245
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,20
+addi a2,zero,5
+jal ra,-15259
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,15
+addi a2,zero,5
+jal ra,-15273
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,12
+addi a2,zero,3
+jal ra,-15287
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,7
+addi a2,zero,5
+jal ra,-15301
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,0
+addi a2,zero,7
+jal ra,-15315
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1520(gp)
+jal ra,-89
+addi t0,a0,0
+sd t0,712(gp)
+ld a0,1520(gp)
+jal ra,-79
+addi t0,a0,0
+sd t0,680(gp)
+ld a0,1520(gp)
+jal ra,-69
+addi t0,a0,0
+sd t0,672(gp)
+ld a0,1520(gp)
+jal ra,-59
+addi t0,a0,0
+sd t0,704(gp)
+ld a0,1520(gp)
+jal ra,-49
+addi t0,a0,0
+sd t0,688(gp)
+addi t0,zero,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,12
+jal ra,-214
+ld a0,16(s0)
+addi a1,zero,12
+jal ra,-15121
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+addi a1,zero,5
+jal ra,-15411
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,3
+jal ra,-15416
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15421
+addi t0,a0,0
+ld t1,40(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15426
+addi t0,a0,0
+ld t1,48(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,20
+addi a2,zero,12
+jal ra,-15403
+addi a1,zero,12
+jal ra,-15195
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,712(gp)
+ld t0,560(gp)
+sd t0,680(gp)
+ld a0,1520(gp)
+jal ra,-155
+addi t0,a0,0
+sd t0,672(gp)
+ld a0,1520(gp)
+jal ra,-145
+addi t0,a0,0
+sd t0,704(gp)
+ld a0,1520(gp)
+jal ra,-135
+addi t0,a0,0
+sd t0,688(gp)
+ld a0,1520(gp)
+jal ra,-37
+addi t0,a0,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+addi a1,zero,12
+jal ra,-303
+ld a0,16(s0)
+addi a1,zero,12
+jal ra,-15210
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+addi a1,zero,5
+addi a2,zero,7
+jal ra,-15461
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,0
+addi a2,zero,5
+jal ra,-15467
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,-8(s0)
+addi a1,zero,5
+jal ra,-15512
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15517
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi a1,zero,3
+jal ra,-15522
+addi t0,a0,0
+ld t1,40(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15527
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15532
+addi t0,a0,0
+ld t1,48(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+addi a1,zero,25
+addi a2,zero,7
+jal ra,-15510
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,7
+addi a2,zero,5
+jal ra,-15516
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,-8(s0)
+addi a1,zero,5
+jal ra,-15561
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,12
+jal ra,-15316
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,712(gp)
+ld a0,1520(gp)
+jal ra,-288
+addi t0,a0,0
+sd t0,680(gp)
+ld a0,1520(gp)
+jal ra,-278
+addi t0,a0,0
+sd t0,672(gp)
+ld a0,1520(gp)
+jal ra,-268
+addi t0,a0,0
+sd t0,704(gp)
+ld t0,560(gp)
+sd t0,688(gp)
+ld a0,1520(gp)
+jal ra,-52
+addi t0,a0,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+addi a1,zero,13
+jal ra,-424
+ld a0,16(s0)
+addi a1,zero,13
+jal ra,-15331
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+addi a1,zero,12
+addi a2,zero,1
+jal ra,-15582
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,5
+addi a2,zero,6
+jal ra,-15588
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+addi a1,zero,1
+addi a2,zero,4
+jal ra,-15594
+addi t0,a0,0
+sd t0,-24(s0)
+ld a0,16(s0)
+addi a1,zero,11
+addi a2,zero,1
+jal ra,-15600
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-8(s0)
+addi a1,zero,6
+jal ra,-15645
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15650
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15655
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi a1,zero,3
+jal ra,-15660
+addi t0,a0,0
+ld t1,40(s0)
+add a0,t0,t1
+addi a1,zero,4
+jal ra,-15665
+addi t0,a0,0
+ld t1,-24(s0)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-15670
+addi t0,a0,0
+ld t1,-32(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15675
+addi t0,a0,0
+ld t1,48(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+addi a1,zero,31
+addi a2,zero,1
+jal ra,-15653
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,25
+addi a2,zero,6
+jal ra,-15659
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+addi a1,zero,8
+addi a2,zero,4
+jal ra,-15665
+addi t0,a0,0
+sd t0,-24(s0)
+ld a0,16(s0)
+addi a1,zero,7
+addi a2,zero,1
+jal ra,-15671
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-8(s0)
+addi a1,zero,1
+jal ra,-15716
+addi t0,a0,0
+ld t1,-32(s0)
+add a0,t0,t1
+addi a1,zero,6
+jal ra,-15721
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,4
+jal ra,-15726
+addi t0,a0,0
+ld t1,-24(s0)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-15731
+addi a1,zero,13
+jal ra,-15483
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,712(gp)
+ld a0,1520(gp)
+jal ra,-455
+addi t0,a0,0
+sd t0,680(gp)
+ld a0,1520(gp)
+jal ra,-445
+addi t0,a0,0
+sd t0,672(gp)
+ld a0,1520(gp)
+jal ra,-435
+addi t0,a0,0
+sd t0,704(gp)
+ld t0,560(gp)
+sd t0,688(gp)
+ld a0,1520(gp)
+jal ra,-76
+addi t0,a0,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+addi a1,zero,21
+jal ra,-589
+ld a0,16(s0)
+addi a1,zero,21
+jal ra,-15496
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+addi a1,zero,20
+addi a2,zero,1
+jal ra,-15747
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,1
+addi a2,zero,10
+jal ra,-15753
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+addi a1,zero,11
+addi a2,zero,1
+jal ra,-15759
+addi t0,a0,0
+sd t0,-24(s0)
+ld a0,16(s0)
+addi a1,zero,12
+addi a2,zero,8
+jal ra,-15765
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-8(s0)
+addi a1,zero,10
+jal ra,-15810
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-15815
+addi t0,a0,0
+ld t1,-24(s0)
+add a0,t0,t1
+addi a1,zero,8
+jal ra,-15820
+addi t0,a0,0
+ld t1,-32(s0)
+add a0,t0,t1
+addi a1,zero,5
+jal ra,-15825
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15830
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld a0,16(s0)
+addi a1,zero,31
+addi a2,zero,1
+jal ra,-15808
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi a1,zero,21
+addi a2,zero,10
+jal ra,-15814
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+addi a1,zero,20
+addi a2,zero,1
+jal ra,-15820
+addi t0,a0,0
+sd t0,-24(s0)
+ld a0,16(s0)
+addi a1,zero,12
+addi a2,zero,8
+jal ra,-15826
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,-8(s0)
+addi a1,zero,8
+jal ra,-15871
+addi t0,a0,0
+ld t1,-32(s0)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-15876
+addi t0,a0,0
+ld t1,-24(s0)
+add a0,t0,t1
+addi a1,zero,10
+jal ra,-15881
+addi t0,a0,0
+ld t1,-16(s0)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-15886
+addi a1,zero,21
+jal ra,-15638
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,712(gp)
+ld t0,560(gp)
+sd t0,680(gp)
+ld t0,560(gp)
+sd t0,672(gp)
+addi t0,zero,0
+sd t0,704(gp)
+ld a0,1520(gp)
+jal ra,-574
+addi t0,a0,0
+sd t0,688(gp)
+ld a0,1520(gp)
+jal ra,-72
+addi t0,a0,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,20
+jal ra,-739
+ld a0,16(s0)
+addi a1,zero,20
+jal ra,-15646
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,t0,0
+addi a1,zero,5
+jal ra,-15936
+addi t0,a0,0
+ld t1,24(s0)
+add a0,t0,t1
+addi a1,zero,7
+jal ra,-15941
+addi t0,a0,0
+ld t1,32(s0)
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,12
+addi a2,zero,20
+jal ra,-15918
+addi a1,zero,20
+jal ra,-15710
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,712(gp)
+ld t0,560(gp)
+sd t0,680(gp)
+ld t0,560(gp)
+sd t0,672(gp)
+addi t0,zero,0
+sd t0,704(gp)
+ld a0,1520(gp)
+jal ra,-646
+addi t0,a0,0
+sd t0,688(gp)
+ld a0,1520(gp)
+jal ra,-33
+addi t0,a0,0
+sd t0,696(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,832(gp)
+ld t1,840(gp)
+add t0,t0,t1
+ld t1,848(gp)
+add t0,t0,t1
+ld t1,856(gp)
+add t0,t0,t1
+ld t1,864(gp)
+add t0,t0,t1
+ld t1,872(gp)
+add t0,t0,t1
+ld t1,880(gp)
+add t0,t0,t1
+ld t1,888(gp)
+add t0,t0,t1
+ld t1,896(gp)
+add t0,t0,t1
+ld t1,904(gp)
+add t0,t0,t1
+ld t1,912(gp)
+add t0,t0,t1
+ld t1,920(gp)
+add t0,t0,t1
+ld t1,928(gp)
+add t0,t0,t1
+ld t1,936(gp)
+add a0,t0,t1
+jalr zero,0(ra)
+ld t0,1568(gp)
+ld t1,1576(gp)
+add t0,t0,t1
+ld t1,1584(gp)
+add t0,t0,t1
+ld t1,1592(gp)
+add t0,t0,t1
+ld t1,1600(gp)
+add t0,t0,t1
+ld t1,1608(gp)
+add t0,t0,t1
+ld t1,1616(gp)
+add t0,t0,t1
+ld t1,1624(gp)
+add t0,t0,t1
+ld t1,1632(gp)
+add t0,t0,t1
+ld t1,1640(gp)
+add t0,t0,t1
+ld t1,1648(gp)
+add t0,t0,t1
+ld t1,1656(gp)
+add t0,t0,t1
+ld t1,1664(gp)
+add a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1960
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,11361
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-71
+ld a1,16(s0)
+jal ra,-15086
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-76
+ld a1,16(s0)
+jal ra,-15065
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-14418
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,32(s0)
+jal ra,-43
+ld t0,1432(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+addi t0,t0,-1976
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-15120
+addi t0,a0,0
+sd t0,8(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-15099
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-14452
+addi sp,sp,16
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14470
+addi sp,sp,8
+ld a0,832(gp)
+ld a1,1568(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1728(t0)
+jal ra,-52
+lui t0,0xFFFFF
+addi t0,t0,-2000
+add a0,gp,t0
+jal ra,-15011
+ld a0,840(gp)
+ld a1,1576(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1720(t0)
+jal ra,-62
+jal ra,-14983
+lui t0,0xFFFFF
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14496
+addi sp,sp,8
+ld a0,896(gp)
+ld a1,1632(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1664(t0)
+jal ra,-78
+lui t0,0xFFFFF
+addi t0,t0,-2024
+add a0,gp,t0
+jal ra,-15037
+ld a0,904(gp)
+ld a1,1640(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1656(t0)
+jal ra,-88
+jal ra,-15009
+lui t0,0xFFFFF
+addi t0,t0,-2040
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14522
+addi sp,sp,8
+ld a0,848(gp)
+ld a1,1584(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1712(t0)
+jal ra,-104
+lui t0,0xFFFFF
+addi t0,t0,-2048
+add a0,gp,t0
+jal ra,-15063
+ld a0,856(gp)
+ld a1,1592(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1704(t0)
+jal ra,-114
+lui t0,0xFFFFE
+addi t0,t0,2040
+add a0,gp,t0
+jal ra,-15073
+ld a0,864(gp)
+ld a1,1600(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1696(t0)
+jal ra,-124
+jal ra,-15045
+lui t0,0xFFFFE
+addi t0,t0,2024
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14558
+addi sp,sp,8
+ld a0,872(gp)
+ld a1,1608(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1688(t0)
+jal ra,-140
+lui t0,0xFFFFE
+addi t0,t0,2016
+add a0,gp,t0
+jal ra,-15099
+ld a0,880(gp)
+ld a1,1616(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1680(t0)
+jal ra,-150
+jal ra,-15071
+lui t0,0xFFFFE
+addi t0,t0,2000
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14584
+addi sp,sp,8
+ld a0,888(gp)
+ld a1,1624(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1672(t0)
+jal ra,-166
+jal ra,-15087
+lui t0,0xFFFFE
+addi t0,t0,1984
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14600
+addi sp,sp,8
+ld a0,912(gp)
+ld a1,1648(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1648(t0)
+jal ra,-182
+lui t0,0xFFFFE
+addi t0,t0,1976
+add a0,gp,t0
+jal ra,-15141
+ld a0,920(gp)
+ld a1,1656(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1640(t0)
+jal ra,-192
+lui t0,0xFFFFE
+addi t0,t0,1968
+add a0,gp,t0
+jal ra,-15151
+ld a0,928(gp)
+ld a1,1664(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1632(t0)
+jal ra,-202
+jal ra,-15123
+lui t0,0xFFFFE
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-14636
+addi sp,sp,8
+ld a0,936(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1624(t0)
+jal ra,-251
+jal ra,-15138
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi a1,zero,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1472(t0)
+jal ra,-16273
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1472(t0)
+jal ra,-16291
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,960(gp)
+addi t1,a0,0
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,16(s0)
+ld t2,-1960(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFE
+addi t0,t0,1920
+add a0,gp,t0
+jal ra,-14330
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-18264
+ld t0,960(gp)
+ld t1,16(s0)
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-48(gp)
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+jal ra,-55
+jal ra,-90
+jal zero,6
+ld a0,16(s0)
+jal ra,-59
+jal ra,-78
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+ld t1,-48(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-75
+jal zero,53
+ld t0,16(s0)
+ld t1,-48(gp)
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add a0,t0,t1
+jal ra,-57
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1472(t0)
+jal ra,-16441
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,24(s0)
+add a1,t0,t1
+jal ra,-101
+jal zero,27
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1472(t0)
+jal ra,-16456
+addi t0,a0,0
+ld a0,0(sp)
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub a0,t0,t1
+jal ra,-87
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+add a1,t0,t1
+jal ra,-128
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+ld t0,984(gp)
+addi t1,a0,0
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+ld t1,16(s0)
+ld t2,-1968(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFE
+addi t0,t0,1888
+add a0,gp,t0
+jal ra,-14473
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1160(t0)
+jal ra,-18407
+ld t0,984(gp)
+ld t1,16(s0)
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,976(gp)
+ld a1,16(s0)
+jal ra,-125
+ld t0,1016(gp)
+sltu t0,zero,t0
+beq t0,zero,25
+ld t0,1016(gp)
+ld t1,976(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,1016(gp)
+ld t1,976(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-728(gp)
+sd t1,0(t0)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,976(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi a0,zero,0
+ld a1,560(gp)
+ld a2,576(gp)
+ld a3,560(gp)
+ld a4,-1800(gp)
+jal ra,-1186
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-19
+jal ra,-66
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,24(s0)
+ld a1,16(s0)
+ld a2,-1824(gp)
+jal ra,-688
+jal ra,-85
+ld t0,832(gp)
+addi t0,t0,1
+sd t0,832(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,584(gp)
+ld a3,16(s0)
+ld a4,-1800(gp)
+jal ra,-1237
+jal ra,-107
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,640(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,592(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1416
+jal ra,-130
+ld t0,848(gp)
+addi t0,t0,1
+sd t0,848(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1928(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,600(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1439
+jal ra,-153
+ld t0,856(gp)
+addi t0,t0,1
+sd t0,856(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1920(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,608(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1462
+jal ra,-176
+ld t0,864(gp)
+addi t0,t0,1
+sd t0,864(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1936(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,-1864(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1485
+jal ra,-199
+ld t0,872(gp)
+addi t0,t0,1
+sd t0,872(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1944(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,-1872(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1508
+jal ra,-222
+ld t0,880(gp)
+addi t0,t0,1
+sd t0,880(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,648(gp)
+ld a1,32(s0)
+ld a2,24(s0)
+ld a3,-1880(gp)
+ld a4,16(s0)
+ld a5,-1816(gp)
+jal ra,-1531
+jal ra,-245
+ld t0,888(gp)
+addi t0,t0,1
+sd t0,888(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-64(gp)
+beq t0,zero,9
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,-1888(gp)
+ld a3,16(s0)
+ld a4,-1792(gp)
+jal ra,-1399
+jal ra,-269
+jal zero,8
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,-1904(gp)
+ld a3,16(s0)
+ld a4,-1792(gp)
+jal ra,-1407
+jal ra,-277
+ld t0,896(gp)
+addi t0,t0,1
+sd t0,896(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-64(gp)
+beq t0,zero,9
+ld a0,24(s0)
+ld a1,32(s0)
+ld a2,16(s0)
+ld a3,-1896(gp)
+ld a4,-1808(gp)
+jal ra,-1343
+jal ra,-301
+jal zero,8
+ld a0,24(s0)
+ld a1,32(s0)
+ld a2,16(s0)
+ld a3,-1912(gp)
+ld a4,-1808(gp)
+jal ra,-1351
+jal ra,-309
+ld t0,904(gp)
+addi t0,t0,1
+sd t0,904(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,16(s0)
+ld a3,616(gp)
+ld a4,-1832(gp)
+jal ra,-1252
+jal ra,-331
+ld t0,912(gp)
+addi t0,t0,1
+sd t0,912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,24(s0)
+ld a1,16(s0)
+ld a2,-1848(gp)
+jal ra,-1104
+jal ra,-350
+ld t0,920(gp)
+addi t0,t0,1
+sd t0,920(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,624(gp)
+ld a3,16(s0)
+ld a4,-1840(gp)
+jal ra,-1502
+jal ra,-372
+ld t0,928(gp)
+addi t0,t0,1
+sd t0,928(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,656(gp)
+ld a1,560(gp)
+ld a2,632(gp)
+ld a3,560(gp)
+ld a4,-1856(gp)
+jal ra,-1521
+jal ra,-391
+ld t0,936(gp)
+addi t0,t0,1
+sd t0,936(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-550
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,976(gp)
+ld t1,16(s0)
+sub a0,t0,t1
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1651
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1646
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1643
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+addi sp,sp,-32
+sd a3,24(sp)
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1628
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+ld a3,24(sp)
+addi sp,sp,32
+addi a4,t0,0
+jal ra,-1382
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-583
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-622
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub a0,t0,t1
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1681
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1676
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1261
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-629
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-668
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1753
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1748
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+addi sp,sp,-24
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1745
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+addi sp,sp,24
+addi a3,t0,0
+addi sp,sp,-32
+sd a3,24(sp)
+sd a2,16(sp)
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-1744
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+ld a2,16(sp)
+ld a3,24(sp)
+addi sp,sp,32
+addi a4,t0,0
+jal ra,-1707
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-699
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,11
+ld a0,16(s0)
+jal ra,-742
+jal ra,-1284
+addi s1,a0,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-133
+addi t0,s1,0
+sd t0,16(s0)
+jal zero,-12
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1000(gp)
+ld t1,24(s0)
+add a0,t0,t1
+ld a1,16(s0)
+jal ra,-659
+ld t0,1024(gp)
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,1024(gp)
+ld t1,1000(gp)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-18637
+addi s1,a0,0
+addi s2,zero,0
+addi a0,s1,0
+jal ra,-16774
+addi a0,a0,1
+ld a1,-48(gp)
+jal ra,-15352
+addi s3,a0,0
+addi t0,s2,0
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,28
+addi t0,s1,0
+ld a0,0(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-18640
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi t1,s2,0
+add a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-18662
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-75
+addi s1,s1,8
+addi t0,s2,0
+ld t1,-48(gp)
+add s2,t0,t1
+jal zero,-30
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,86
+ld t0,256(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,75
+addi a0,s2,0
+jal ra,-18701
+addi t0,a0,0
+ld t1,-1032(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+addi a0,s2,0
+jal ra,-18703
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-18704
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-18725
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-138
+jal zero,41
+addi a0,s2,0
+jal ra,-18731
+addi t0,a0,0
+ld t1,-1040(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+addi a0,s2,0
+jal ra,-18733
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-18734
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-18755
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-168
+jal zero,11
+addi a0,s2,0
+jal ra,-18761
+addi t0,a0,0
+ld t1,-1048(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s2,0
+jal ra,-148
+addi a0,s2,0
+jal ra,-18780
+addi s2,a0,0
+jal zero,-76
+addi s1,s1,1
+jal zero,-88
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1952(gp)
+jal ra,-15381
+ld a1,-1952(gp)
+jal ra,972
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-18
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-64(gp)
+beq t0,zero,242
+ld t0,-8(s0)
+ld t1,-1984(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-1992(gp)
+addi a1,zero,8
+jal ra,-17361
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2000(gp)
+addi a1,zero,16
+jal ra,-17374
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2008(gp)
+addi a1,zero,24
+jal ra,-17387
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2024(gp)
+addi a1,zero,32
+jal ra,-17400
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2032(gp)
+addi a1,zero,40
+jal ra,-17413
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2040(gp)
+addi a1,zero,48
+jal ra,-17426
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,720(gp)
+addi a1,zero,56
+jal ra,-17439
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,8
+ld t1,728(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,736(gp)
+addi a1,zero,8
+jal ra,-17456
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,16
+ld t1,-2048(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2040(t0)
+addi a1,zero,16
+jal ra,-17475
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2032(t0)
+addi a1,zero,32
+jal ra,-17490
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,24
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2024(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,32
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2016(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,40
+ld t1,744(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,48
+ld t1,752(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2008(t0)
+addi a1,zero,32
+jal ra,-17525
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2000(t0)
+addi a1,zero,48
+jal ra,-17540
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,56
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,760(gp)
+addi a1,zero,16
+jal ra,-17559
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,768(gp)
+addi a1,zero,32
+jal ra,-17572
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,776(gp)
+addi a1,zero,48
+jal ra,-17585
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,196
+ld t0,-8(s0)
+ld t1,-1984(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-1992(gp)
+addi a1,zero,8
+jal ra,-17602
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2000(gp)
+addi a1,zero,16
+jal ra,-17615
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2008(gp)
+addi a1,zero,24
+jal ra,-17628
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,8
+ld t1,-2024(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2032(gp)
+addi a1,zero,8
+jal ra,-17645
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-2040(gp)
+addi a1,zero,16
+jal ra,-17658
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,720(gp)
+addi a1,zero,24
+jal ra,-17671
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,16
+ld t1,728(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,24
+ld t1,736(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,32
+ld t1,-2048(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2040(t0)
+addi a1,zero,16
+jal ra,-17698
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,40
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2032(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,48
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2024(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,56
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2016(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,64
+ld t1,744(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,72
+ld t1,752(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,80
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2008(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,2000(t0)
+addi a1,zero,16
+jal ra,-17745
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,88
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,760(gp)
+addi a1,zero,16
+jal ra,-17764
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t0,t0,96
+ld t1,768(gp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,776(gp)
+addi a1,zero,16
+jal ra,-17781
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+addi t0,zero,5
+sd t0,784(gp)
+ld t0,-1952(gp)
+sd t0,792(gp)
+ld t0,968(gp)
+sd t0,800(gp)
+ld t0,976(gp)
+sd t0,816(gp)
+ld t0,976(gp)
+sd t0,824(gp)
+ld a0,-8(s0)
+addi a1,zero,0
+jal ra,45
+addi t0,zero,6
+sd t0,784(gp)
+ld t0,-1952(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,976(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-15978
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,792(gp)
+ld t0,992(gp)
+sd t0,800(gp)
+ld t0,1000(gp)
+sd t0,816(gp)
+ld t0,1000(gp)
+ld t1,1008(gp)
+add t0,t0,t1
+sd t0,824(gp)
+ld a0,-8(s0)
+addi a1,zero,1
+jal ra,19
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2008(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2000(t1)
+addi t2,a0,0
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(gp)
+divu a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,24(s0)
+jal ra,-20
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-64(gp)
+beq t0,zero,74
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,784(gp)
+addi a1,zero,32
+jal ra,-17873
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,8
+ld t1,792(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,16
+ld t1,800(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,24
+ld t1,808(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,32
+ld t1,816(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,40
+ld t1,824(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,48
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sd t1,0(t0)
+jal zero,68
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,8
+ld t1,792(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,16
+ld t1,800(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,24
+ld t1,808(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,32
+ld t1,816(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,40
+ld t1,824(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,48
+ld t1,784(gp)
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t0,t0,56
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-180
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,32(t0)
+sd t0,816(gp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-193
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,40(t0)
+sd t0,824(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,-1976(gp)
+sd t0,968(gp)
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-49
+ld t0,816(gp)
+sd t0,976(gp)
+ld a0,16(s0)
+addi a1,zero,1
+jal ra,-54
+ld t0,816(gp)
+sd t0,1000(gp)
+ld t0,824(gp)
+ld t1,816(gp)
+sub t0,t0,t1
+sd t0,1008(gp)
+ld t0,968(gp)
+ld t1,976(gp)
+add a0,t0,t1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-16238
+addi t0,a0,0
+sd t0,992(gp)
+ld t0,-1960(gp)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,33
+ld t0,-1968(gp)
+ld t1,1000(gp)
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,27
+jal ra,-743
+addi s1,a0,0
+addi s2,zero,0
+addi t0,s2,0
+ld t1,-1952(gp)
+ld t2,-16(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t2,s1,0
+add t1,t2,t1
+ld t1,0(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,4
+addi s2,s2,1
+jal zero,-21
+addi a0,zero,1
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,-328(gp)
+ld a2,24(s0)
+jal ra,-20019
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-17882
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+sd t0,944(gp)
+ld t0,976(gp)
+ld t1,1000(gp)
+add t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16507
+addi sp,sp,16
+jal zero,141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,992(t0)
+jal ra,16935
+ld a0,944(gp)
+ld a1,-392(gp)
+jal ra,-51
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-18080
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1800
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16533
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20091
+ld a0,-8(s0)
+ld a1,952(gp)
+ld a2,-1952(gp)
+jal ra,-20090
+addi t0,a0,0
+ld t1,-1952(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16557
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20115
+ld a0,976(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-16388
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,960(gp)
+ld a1,-16(s0)
+jal ra,83
+ld a0,-8(s0)
+ld a1,960(gp)
+ld a2,-16(s0)
+jal ra,-20124
+addi t0,a0,0
+ld t1,-16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16591
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20149
+ld a0,-8(s0)
+ld a1,984(gp)
+ld a2,1000(gp)
+jal ra,-20148
+addi t0,a0,0
+ld t1,1000(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16615
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20173
+lui t0,0xFFFFE
+addi t0,t0,1544
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,-1952(gp)
+ld t1,976(gp)
+add t0,t0,t1
+ld t1,1000(gp)
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,1000(gp)
+sd t0,32(sp)
+ld t0,944(gp)
+sd t0,40(sp)
+jal ra,-16644
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,992(t0)
+jal ra,16844
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld s1,16(s0)
+ld t0,24(s0)
+sltu t0,zero,t0
+beq t0,zero,3
+addi t0,s1,0
+ld s2,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+ld t2,-16(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add s1,t0,t1
+addi t0,s1,0
+ld s2,0(t0)
+jal zero,-23
+ld t0,24(s0)
+sltu t0,zero,t0
+beq t0,zero,11
+addi t0,s1,0
+ld t1,24(s0)
+addi t1,t1,-1
+ld t2,-16(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add s1,t0,t1
+addi t0,s1,0
+ld s2,0(t0)
+addi s2,zero,1
+ld a0,16(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,984(t0)
+jal ra,16724
+jal ra,15879
+addi t0,a0,0
+sd t0,944(gp)
+addi a0,t0,0
+jal ra,-3844
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-18293
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16746
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20304
+jal ra,-1076
+addi t0,a0,0
+sd t0,952(gp)
+addi t0,zero,0
+sd t0,968(gp)
+addi t0,zero,0
+sd t0,976(gp)
+addi t0,zero,0
+sd t0,992(gp)
+addi t0,zero,0
+sd t0,1000(gp)
+addi t0,zero,0
+sd t0,1008(gp)
+addi t0,zero,0
+sd t0,1016(gp)
+addi t0,zero,0
+sd t0,1024(gp)
+addi t0,zero,0
+sd t0,1048(gp)
+ld a0,-8(s0)
+ld a1,952(gp)
+ld a2,-1952(gp)
+jal ra,-20325
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,-1952(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld a0,952(gp)
+jal ra,-396
+addi t0,a0,0
+beq t0,zero,97
+ld a0,976(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-16611
+addi t0,a0,0
+sd t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add a0,t0,t1
+jal ra,-16568
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1800(t0)
+jal ra,-16622
+ld a1,-24(s0)
+jal ra,-148
+addi t0,a0,0
+sd t0,960(gp)
+ld a0,1000(gp)
+jal ra,-16578
+ld a1,1000(gp)
+jal ra,-154
+addi t0,a0,0
+sd t0,984(gp)
+ld a0,-8(s0)
+ld a1,960(gp)
+ld a2,-24(s0)
+jal ra,-20366
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-18223
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,-24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+ld a0,-8(s0)
+ld a1,984(gp)
+ld a2,1000(gp)
+jal ra,-20381
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-18238
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,1000(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,41
+ld a0,-8(s0)
+ld a1,72(gp)
+ld a2,-16(gp)
+jal ra,-20396
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,-1952(gp)
+ld t1,976(gp)
+add t0,t0,t1
+ld t1,1000(gp)
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,1000(gp)
+sd t0,32(sp)
+ld t0,1008(gp)
+sd t0,40(sp)
+ld t0,944(gp)
+sd t0,48(sp)
+jal ra,-16875
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,984(t0)
+jal ra,16613
+jal zero,16
+lui t0,0xFFFFE
+addi t0,t0,1360
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+jal ra,-16891
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20449
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-20460
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1312
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-16927
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20485
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-20499
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-18356
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1264
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-16967
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20525
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+sd t0,1032(gp)
+ld t0,1048(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1224
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-17004
+addi sp,sp,16
+jal zero,233
+ld a0,1032(gp)
+ld a1,-384(gp)
+jal ra,-544
+addi s1,a0,0
+addi a0,s1,0
+addi a1,zero,0
+jal ra,-18572
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1176
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-17025
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20583
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1952(t0)
+jal ra,-16805
+addi s2,a0,0
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sd t1,0(t0)
+addi t0,s2,8
+ld t1,1040(gp)
+sd t1,0(t0)
+addi t0,s2,16
+ld t1,1048(gp)
+sd t1,0(t0)
+addi t0,s2,24
+ld t1,1000(gp)
+sd t1,0(t0)
+addi t0,s2,32
+ld t1,1008(gp)
+sd t1,0(t0)
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1960(t0)
+jal ra,-156
+ld t0,1040(gp)
+ld t1,-48(gp)
+remu t1,t0,t1
+sub t0,t0,t1
+sd t0,-24(s0)
+addi a0,s1,0
+ld t0,960(gp)
+ld t1,-24(s0)
+add a1,t0,t1
+ld t0,1048(gp)
+ld t1,-24(s0)
+sub a2,t0,t1
+jal ra,-169
+addi a0,s1,0
+ld t0,1016(gp)
+ld t1,1040(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add a1,t0,t1
+ld t0,1048(gp)
+ld t1,1040(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a2,t0,t1
+jal ra,-189
+addi s4,zero,0
+addi s5,zero,0
+addi t0,s5,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,110
+ld t0,256(gp)
+addi t1,s5,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s6,0(t0)
+addi t0,s6,0
+sltu t0,zero,t0
+beq t0,zero,99
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20221
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,8
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20227
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,16
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20233
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,24
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20239
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,32
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20245
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,40
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20248
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,48
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s6,0
+jal ra,-20278
+jal ra,-18412
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1952(t0)
+jal ra,-274
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s6,0
+jal ra,-20294
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s2,0
+ld t0,48(t0)
+addi a0,t0,1
+ld a1,-48(gp)
+jal ra,-17014
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-297
+addi s4,s4,1
+addi a0,s6,0
+jal ra,-20318
+addi s6,a0,0
+jal zero,-100
+addi s5,s5,1
+jal zero,-112
+addi t0,s2,8
+addi t1,zero,0
+sd t1,0(t0)
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1952(t0)
+jal ra,-313
+lui t0,0xFFFFE
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1048(gp)
+ld t1,1040(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,16(sp)
+ld t0,1000(gp)
+sd t0,24(sp)
+addi t0,s4,0
+sd t0,32(sp)
+ld t0,1032(gp)
+sd t0,40(sp)
+jal ra,-17237
+addi sp,sp,40
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+jal ra,15315
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,339
+addi a0,zero,0
+jal ra,15311
+addi a1,zero,0
+jal ra,-18624
+addi t0,a0,-45
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,329
+addi a0,zero,0
+jal ra,15301
+jal ra,-4394
+addi s1,a0,0
+addi a0,s1,0
+addi a1,zero,0
+jal ra,-18842
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,318
+addi a0,s1,0
+ld a1,72(gp)
+ld a2,-16(gp)
+jal ra,-20842
+addi t0,a0,0
+ld t1,-16(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,307
+ld t0,72(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,297
+jal ra,15295
+addi t0,a0,0
+sd t0,1032(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1952(t0)
+jal ra,-17086
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1952(t0)
+jal ra,-664
+addi s2,a0,0
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+ld t1,-16(gp)
+sub a2,t0,t1
+jal ra,-390
+addi t0,s2,0
+ld t0,0(t0)
+ld t1,1040(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1032
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-17344
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-20902
+addi t0,s2,0
+ld t0,8(t0)
+sd t0,976(gp)
+addi t0,s2,0
+ld t0,16(t0)
+sd t0,1000(gp)
+addi t0,s2,0
+ld t0,24(t0)
+sd t0,1008(gp)
+ld t0,1040(gp)
+ld t1,-48(gp)
+remu t1,t0,t1
+sub t0,t0,t1
+sd t0,-24(s0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,960(gp)
+ld t1,-24(s0)
+add a0,t0,t1
+ld t0,976(gp)
+ld t1,-24(s0)
+sub a1,t0,t1
+jal ra,-718
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,976(gp)
+ld t1,-24(s0)
+sub a2,t0,t1
+jal ra,-443
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld t0,1016(gp)
+ld t1,1040(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+ld t0,976(gp)
+ld t1,1040(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a1,t0,t1
+jal ra,-748
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld t0,976(gp)
+ld t1,1040(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-16(gp)
+mul a2,t0,t1
+jal ra,-479
+ld s4,1040(gp)
+addi t0,s4,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,11
+addi a0,s4,0
+jal ra,-2698
+addi a1,zero,1
+jal ra,-6876
+addi t0,s4,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add s4,t0,t1
+jal zero,-13
+addi s5,zero,0
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1952(t0)
+jal ra,-501
+addi t0,s2,0
+ld t0,8(t0)
+sltu t0,zero,t0
+beq t0,zero,116
+addi t0,s2,0
+ld a0,48(t0)
+jal ra,-18705
+addi s6,a0,0
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s6,0
+addi sp,sp,-8
+sd a0,0(sp)
+addi t0,s2,0
+ld t0,48(t0)
+addi a0,t0,1
+ld a1,-48(gp)
+jal ra,-17279
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-808
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s2,0
+ld t0,48(t0)
+addi a0,t0,1
+ld a1,-48(gp)
+jal ra,-17296
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-543
+addi t0,s2,0
+ld t0,8(t0)
+ld t1,-1040(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s7,zero,0
+jal zero,15
+addi t0,s2,0
+ld t0,8(t0)
+ld t1,-1048(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s7,zero,0
+jal zero,6
+addi a0,s6,0
+addi t0,s2,0
+ld a1,8(t0)
+jal ra,-15823
+addi s7,a0,0
+addi t0,s7,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld a0,-1104(gp)
+addi a1,s6,0
+addi t0,s2,0
+ld a2,0(t0)
+addi t0,s2,0
+ld a3,8(t0)
+addi t0,s2,0
+ld a4,16(t0)
+addi t0,s2,0
+ld a5,24(t0)
+addi t0,s2,0
+ld t0,32(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16027
+addi s7,a0,0
+jal zero,21
+addi t0,s7,0
+addi t1,s2,0
+ld t1,0(t1)
+addi t0,t0,16
+sd t1,0(t0)
+addi t0,s7,0
+addi t1,s2,0
+ld t1,16(t1)
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s7,0
+addi t1,s2,0
+ld t1,24(t1)
+addi t0,t0,40
+sd t1,0(t0)
+addi t0,s7,0
+addi t1,s2,0
+ld t1,32(t1)
+addi t0,t0,48
+sd t1,0(t0)
+addi t0,s7,0
+addi t1,s2,0
+ld t1,40(t1)
+addi t0,t0,64
+sd t1,0(t0)
+addi s5,s5,1
+addi a0,s1,0
+addi a1,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1952(t0)
+jal ra,-619
+jal zero,-118
+addi a0,s1,0
+ld a1,72(gp)
+ld a2,-16(gp)
+jal ra,-21113
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,984
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1032(gp)
+sd t0,16(sp)
+jal ra,-17575
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-21133
+lui t0,0xFFFFE
+addi t0,t0,904
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,976(gp)
+ld t1,1040(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,16(sp)
+ld t0,1000(gp)
+sd t0,24(sp)
+addi t0,s5,0
+sd t0,32(sp)
+ld t0,1032(gp)
+sd t0,40(sp)
+jal ra,-17602
+addi sp,sp,40
+addi a0,zero,1
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,896
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1088(gp)
+addi a5,zero,1
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16135
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1944(t0)
+jal ra,-2674
+jal ra,-2388
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1448(gp)
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,880
+add a0,gp,t0
+jal ra,-18185
+ld a0,-1360(gp)
+jal ra,8497
+lui t0,0xFFFFE
+addi t0,t0,872
+add a0,gp,t0
+jal ra,-18191
+ld a0,16(s0)
+jal ra,-19581
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19047
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFE
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-17691
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,744
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,16(s0)
+jal ra,-19568
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,16(s0)
+jal ra,-19581
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19113
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-17712
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,736
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,3
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16238
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1936(t0)
+jal ra,-2777
+jal ra,-2491
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-2517
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s8,-64(s0)
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,1448(gp)
+beq t0,zero,25
+lui t0,0xFFFFE
+addi t0,t0,720
+add a0,gp,t0
+jal ra,-18300
+ld a0,-1360(gp)
+jal ra,8438
+lui t0,0xFFFFE
+addi t0,t0,712
+add a0,gp,t0
+jal ra,-18306
+ld a0,-1368(gp)
+jal ra,8376
+lui t0,0xFFFFE
+addi t0,t0,704
+add a0,gp,t0
+jal ra,-18312
+ld a0,-1376(gp)
+jal ra,8426
+lui t0,0xFFFFE
+addi t0,t0,696
+add a0,gp,t0
+jal ra,-18318
+ld a0,-1360(gp)
+jal ra,8420
+ld a0,16(s0)
+jal ra,-19710
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s1,0(t0)
+ld a0,16(s0)
+jal ra,-19718
+addi t0,a0,0
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+ld a0,16(s0)
+jal ra,-19726
+addi t0,a0,0
+ld t1,-1376(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s3,0(t0)
+ld t0,1056(gp)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,592
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+addi t0,s2,0
+sd t0,32(sp)
+jal ra,-17830
+addi sp,sp,32
+addi s4,zero,0
+ld s5,-16(gp)
+addi s6,zero,0
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,106
+addi t0,s3,0
+addi t1,s5,0
+sltu t0,t0,t1
+beq t0,zero,2
+addi s5,s3,0
+addi a0,s2,0
+ld a1,-48(gp)
+jal ra,2843
+addi t0,a0,0
+beq t0,zero,82
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,12577
+addi t0,a0,0
+beq t0,zero,63
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,13021
+addi t0,a0,0
+beq t0,zero,44
+ld a0,16(s0)
+jal ra,-19774
+addi a1,s2,0
+jal ra,2872
+addi s7,a0,0
+addi a0,s1,0
+addi a1,s7,0
+addi a2,s5,0
+jal ra,-21417
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19274
+addi s8,a0,0
+addi t0,s8,0
+addi t1,s5,0
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,s4,0
+addi t1,s8,0
+add s4,t0,t1
+addi t0,s3,0
+addi t1,s8,0
+sub s3,t0,t1
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,s2,0
+ld t1,-16(gp)
+add s2,t0,t1
+jal zero,10
+addi a0,zero,0
+addi a1,s8,0
+jal ra,-19452
+addi t0,a0,0
+beq t0,zero,4
+addi t0,s4,0
+addi t1,s8,0
+add s4,t0,t1
+addi s3,zero,0
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17912
+addi sp,sp,16
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,408
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17926
+addi sp,sp,16
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,328
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-17940
+addi sp,sp,16
+jal zero,-107
+addi t0,s6,0
+beq t0,zero,20
+ld a0,16(s0)
+jal ra,-19864
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19327
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,10
+ld a0,16(s0)
+jal ra,-19883
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-19898
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,1056(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,264
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s4,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+jal ra,-18000
+addi sp,sp,24
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,256
+add a0,gp,t0
+jal ra,-18537
+ld a0,-1360(gp)
+jal ra,8201
+jal ra,-18505
+ld s8,-64(s0)
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,248
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,3
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16543
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1928(t0)
+jal ra,-3082
+jal ra,-2796
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-2822
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s8,-64(s0)
+sd s7,-56(s0)
+sd s6,-48(s0)
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,1448(gp)
+beq t0,zero,25
+lui t0,0xFFFFE
+addi t0,t0,232
+add a0,gp,t0
+jal ra,-18605
+ld a0,-1360(gp)
+jal ra,8133
+lui t0,0xFFFFE
+addi t0,t0,224
+add a0,gp,t0
+jal ra,-18611
+ld a0,-1368(gp)
+jal ra,8071
+lui t0,0xFFFFE
+addi t0,t0,216
+add a0,gp,t0
+jal ra,-18617
+ld a0,-1376(gp)
+jal ra,8121
+lui t0,0xFFFFE
+addi t0,t0,208
+add a0,gp,t0
+jal ra,-18623
+ld a0,-1360(gp)
+jal ra,8115
+ld a0,16(s0)
+jal ra,-20015
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s1,0(t0)
+ld a0,16(s0)
+jal ra,-20023
+addi t0,a0,0
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+ld a0,16(s0)
+jal ra,-20031
+addi t0,a0,0
+ld t1,-1376(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s3,0(t0)
+ld t0,1064(gp)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,104
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+addi t0,s2,0
+sd t0,24(sp)
+addi t0,s1,0
+sd t0,32(sp)
+jal ra,-18135
+addi sp,sp,32
+addi s4,zero,0
+ld s5,-16(gp)
+addi s6,zero,0
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,106
+addi t0,s3,0
+addi t1,s5,0
+sltu t0,t0,t1
+beq t0,zero,2
+addi s5,s3,0
+addi a0,s2,0
+ld a1,-48(gp)
+jal ra,2538
+addi t0,a0,0
+beq t0,zero,82
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,12272
+addi t0,a0,0
+beq t0,zero,63
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,12716
+addi t0,a0,0
+beq t0,zero,44
+ld a0,16(s0)
+jal ra,-20079
+addi a1,s2,0
+jal ra,2567
+addi s7,a0,0
+addi a0,s1,0
+addi a1,s7,0
+addi a2,s5,0
+jal ra,-21719
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19579
+addi s8,a0,0
+addi t0,s8,0
+addi t1,s5,0
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,s4,0
+addi t1,s8,0
+add s4,t0,t1
+addi t0,s3,0
+addi t1,s8,0
+sub s3,t0,t1
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,s2,0
+ld t1,-16(gp)
+add s2,t0,t1
+jal zero,10
+addi a0,zero,0
+addi a1,s8,0
+jal ra,-19757
+addi t0,a0,0
+beq t0,zero,4
+addi t0,s4,0
+addi t1,s8,0
+add s4,t0,t1
+addi s3,zero,0
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,16
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18217
+addi sp,sp,16
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18231
+addi sp,sp,16
+jal zero,14
+addi s6,zero,1
+addi s3,zero,0
+lui t0,0xFFFFE
+addi t0,t0,-160
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s2,0
+sd t0,16(sp)
+jal ra,-18245
+addi sp,sp,16
+jal zero,-107
+addi t0,s6,0
+beq t0,zero,20
+ld a0,16(s0)
+jal ra,-20169
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-19632
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,10
+ld a0,16(s0)
+jal ra,-20188
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-20203
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,1064(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s4,0
+sd t0,16(sp)
+addi t0,s1,0
+sd t0,24(sp)
+jal ra,-18305
+addi sp,sp,24
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-232
+add a0,gp,t0
+jal ra,-18842
+ld a0,-1360(gp)
+jal ra,7896
+jal ra,-18810
+ld s8,-64(s0)
+ld s7,-56(s0)
+ld s6,-48(s0)
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-240
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,3
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16848
+ld a0,-1384(gp)
+ld a1,-1376(gp)
+addi a2,zero,0
+jal ra,-3385
+ld a0,-1376(gp)
+ld a1,-1368(gp)
+addi a2,zero,0
+jal ra,-3389
+ld a0,-1368(gp)
+ld a1,-1360(gp)
+addi a2,zero,0
+jal ra,-3393
+ld a0,-1360(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1896(t0)
+jal ra,-3399
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1920(t0)
+jal ra,-3405
+jal ra,-3119
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-3145
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-288(gp)
+ld t2,-16(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,99
+ld a0,24(s0)
+ld a1,-48(gp)
+jal ra,2290
+addi t0,a0,0
+beq t0,zero,80
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,12024
+addi t0,a0,0
+beq t0,zero,61
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,12468
+addi t0,a0,0
+beq t0,zero,17
+ld t0,32(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-20334
+ld a1,24(s0)
+jal ra,2363
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,14
+lui t0,0xFFFFE
+addi t0,t0,-320
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18436
+addi sp,sp,16
+addi a0,zero,0
+jal zero,67
+addi s2,zero,0
+addi t0,s2,0
+ld t1,-16(gp)
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,32(s0)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+addi a1,s2,0
+jal ra,-19805
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,49
+addi s2,s2,1
+jal zero,-18
+ld t0,24(s0)
+ld t1,-16(gp)
+add t0,t0,t1
+sd t0,24(s0)
+addi s1,s1,1
+jal zero,14
+lui t0,0xFFFFE
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18475
+addi sp,sp,16
+addi a0,zero,0
+jal zero,28
+jal zero,14
+lui t0,0xFFFFE
+addi t0,t0,-488
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18489
+addi sp,sp,16
+addi a0,zero,0
+jal zero,14
+jal zero,-103
+lui t0,0xFFFFE
+addi t0,t0,-568
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18503
+addi sp,sp,16
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,1448(gp)
+beq t0,zero,31
+lui t0,0xFFFFE
+addi t0,t0,-584
+add a0,gp,t0
+jal ra,-19054
+ld a0,-1360(gp)
+jal ra,7628
+lui t0,0xFFFFE
+addi t0,t0,-592
+add a0,gp,t0
+jal ra,-19060
+ld a0,-1368(gp)
+jal ra,7622
+lui t0,0xFFFFE
+addi t0,t0,-600
+add a0,gp,t0
+jal ra,-19066
+ld a0,-1376(gp)
+jal ra,7616
+lui t0,0xFFFFE
+addi t0,t0,-608
+add a0,gp,t0
+jal ra,-19072
+ld a0,-1384(gp)
+jal ra,7638
+lui t0,0xFFFFE
+addi t0,t0,-616
+add a0,gp,t0
+jal ra,-19078
+ld a0,-1368(gp)
+jal ra,7660
+ld a0,16(s0)
+jal ra,-20470
+addi t0,a0,0
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,-20479
+addi t0,a0,0
+ld t1,-1376(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld a0,16(s0)
+jal ra,-20488
+addi t0,a0,0
+ld t1,-1384(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld a0,16(s0)
+ld a1,-8(s0)
+ld a2,64(gp)
+jal ra,-202
+addi t0,a0,0
+beq t0,zero,48
+ld t0,-16(s0)
+ld t1,-304(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-328(gp)
+sd t0,-16(s0)
+ld a0,64(gp)
+ld a1,-16(s0)
+ld a2,-24(s0)
+jal ra,-22140
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20003
+addi t0,a0,0
+sd t0,-32(s0)
+ld a0,16(s0)
+jal ra,-20521
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,1072(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-704
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,64(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,-32(s0)
+sd t0,40(sp)
+jal ra,-18628
+addi sp,sp,40
+jal zero,19
+ld a0,16(s0)
+jal ra,-20550
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20013
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-20574
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-712
+add a0,gp,t0
+jal ra,-19198
+ld a0,-1360(gp)
+jal ra,7540
+jal ra,-19166
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-720
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1080(gp)
+addi a5,zero,1
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17197
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-728
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1080(gp)
+addi a5,zero,1
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17209
+ld t0,1000(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1000(gp)
+ld a0,-1104(gp)
+ld a1,520(gp)
+addi a2,zero,1
+ld a3,-1032(gp)
+ld a4,-1072(gp)
+addi a5,zero,0
+ld t0,1000(gp)
+sub t0,zero,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17224
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,280(gp)
+addi t0,t0,-1
+sd t0,280(gp)
+jal ra,-16473
+jal ra,-16449
+ld a1,-1360(gp)
+addi a2,zero,0
+jal ra,-3767
+jal ra,-16453
+ld a1,-48(gp)
+jal ra,-8488
+jal ra,-16481
+jal ra,-16457
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-21834
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-21846
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-3631
+ld a0,-1360(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16480
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-16453
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-3787
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1912(t0)
+jal ra,-3815
+jal ra,-3529
+ld a0,-1360(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16505
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,2
+mul a2,t0,t1
+jal ra,-3606
+ld a0,560(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,4
+mul a2,t0,t1
+jal ra,-3614
+ld a0,560(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16492
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,3
+mul a2,t0,t1
+jal ra,-3628
+ld a0,-1360(gp)
+ld a1,560(gp)
+addi a2,zero,0
+jal ra,-3856
+ld a0,560(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,3
+mul a2,t0,t1
+jal ra,-3640
+ld a0,-8(s0)
+jal ra,-21924
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-21931
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-1360(gp)
+jal ra,-3684
+ld a0,-1360(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-16565
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi a2,zero,0
+jal ra,-3886
+addi a0,zero,2
+jal ra,-16472
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-3627
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-20754
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,24(s0)
+ld a1,-48(gp)
+jal ra,1814
+addi t0,a0,0
+beq t0,zero,31
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,11507
+addi t0,a0,0
+beq t0,zero,26
+ld t0,1080(gp)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-768
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-18893
+addi sp,sp,16
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,112
+sd t1,0(t0)
+ld t0,1160(gp)
+ld t1,24(s0)
+ld t2,-8(s0)
+sub t1,t1,t2
+add t0,t0,t1
+sd t0,1160(gp)
+ld a0,24(s0)
+jal zero,15
+ld t0,1080(gp)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-816
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-18918
+addi sp,sp,16
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,-20851
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,-20827
+addi t0,a0,0
+sd t0,-16(s0)
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-86
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,1448(gp)
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-824
+add a0,gp,t0
+jal ra,-19485
+ld a0,-1360(gp)
+jal ra,7197
+lui t0,0xFFFFE
+addi t0,t0,-832
+add a0,gp,t0
+jal ra,-19491
+ld a0,-1360(gp)
+jal ra,7191
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-20886
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-1360(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld a0,16(s0)
+jal ra,-20900
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,4
+ld t0,1088(gp)
+addi t0,t0,1
+sd t0,1088(gp)
+jal zero,10
+ld a0,16(s0)
+jal ra,-20916
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-840
+add a0,gp,t0
+jal ra,-19541
+ld a0,-1360(gp)
+jal ra,7141
+jal ra,-19509
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-20940
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-856
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,2
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17553
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1904(t0)
+jal ra,-4092
+jal ra,-3806
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-3832
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+ld t0,1448(gp)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-880
+add a0,gp,t0
+jal ra,-19610
+ld a0,-1360(gp)
+jal ra,7128
+lui t0,0xFFFFE
+addi t0,t0,-888
+add a0,gp,t0
+jal ra,-19616
+ld a0,-1368(gp)
+jal ra,7066
+lui t0,0xFFFFE
+addi t0,t0,-896
+add a0,gp,t0
+jal ra,-19622
+ld a0,-1360(gp)
+jal ra,7116
+ld a0,16(s0)
+jal ra,-21014
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld a0,16(s0)
+jal ra,-21023
+addi t0,a0,0
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+ld t0,-8(s0)
+ld t1,-336(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-368(gp)
+sd t0,-8(s0)
+jal zero,9
+ld t0,-8(s0)
+ld t1,-344(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-376(gp)
+sd t0,-8(s0)
+ld s3,80(gp)
+ld a0,16(s0)
+jal ra,-21049
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-8(s0)
+addi a1,s3,0
+jal ra,-22662
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20549
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi s4,zero,0
+addi t0,s4,0
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,101
+addi t0,s2,0
+addi t1,s4,0
+ld t2,-48(gp)
+mul t1,t1,t2
+add a0,t0,t1
+ld a1,-48(gp)
+jal ra,1527
+addi t0,a0,0
+beq t0,zero,72
+ld a0,16(s0)
+addi t0,s2,0
+addi t1,s4,0
+ld t2,-48(gp)
+mul t1,t1,t2
+add a1,t0,t1
+jal ra,11257
+addi t0,a0,0
+beq t0,zero,44
+ld a0,16(s0)
+addi t0,s2,0
+addi t1,s4,0
+ld t2,-48(gp)
+mul t1,t1,t2
+add a1,t0,t1
+jal ra,11697
+addi t0,a0,0
+beq t0,zero,16
+ld a0,16(s0)
+jal ra,-21098
+addi t0,s2,0
+addi t1,s4,0
+ld t2,-48(gp)
+mul t1,t1,t2
+add a1,t0,t1
+addi t0,s3,0
+addi t1,s4,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,1604
+jal zero,19
+ld a0,16(s0)
+jal ra,-21116
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20579
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,19
+ld a0,16(s0)
+jal ra,-21135
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20598
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,19
+ld a0,16(s0)
+jal ra,-21154
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,zero,-1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-20617
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi s4,s4,1
+jal zero,-103
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-21180
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-904
+add a0,gp,t0
+jal ra,-19804
+ld a0,-1360(gp)
+jal ra,6934
+jal ra,-19772
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi a0,zero,0
+jal ra,-22830
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,zero,0
+jal ra,-22834
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,9
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-920
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1080(gp)
+addi a5,zero,2
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17837
+ld a0,-1416(gp)
+ld a1,560(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1888(t0)
+jal ra,-4376
+jal ra,-4090
+ld a0,-1360(gp)
+ld a1,-1408(gp)
+addi a2,zero,0
+jal ra,-4381
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-4120
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,24(s0)
+jal ra,10509
+ld a0,16(s0)
+jal ra,-21237
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,1536(gp)
+ld t1,-1408(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-21248
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+jal zero,8
+ld t0,1536(gp)
+ld t1,-1408(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,32(s0)
+sd t0,1552(gp)
+ld t0,1096(gp)
+beq t0,zero,29
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-19406
+addi sp,sp,24
+ld t0,1552(gp)
+ld t1,1504(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1008
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1552(gp)
+sd t0,8(sp)
+jal ra,-19420
+addi sp,sp,8
+jal ra,-19917
+ld a0,24(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,1448(gp)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-1024
+add a0,gp,t0
+jal ra,-19969
+ld a0,-1360(gp)
+jal ra,6713
+lui t0,0xFFFFE
+addi t0,t0,-1032
+add a0,gp,t0
+jal ra,-19975
+ld a0,-1368(gp)
+jal ra,6763
+lui t0,0xFFFFE
+addi t0,t0,-1040
+add a0,gp,t0
+jal ra,-19981
+ld a0,-1408(gp)
+jal ra,6757
+ld t0,1536(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,-1368(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld a0,1896(gp)
+jal ra,9919
+ld a0,-8(s0)
+jal ra,9892
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,1896(gp)
+ld a1,-8(s0)
+ld a2,-16(s0)
+jal ra,-123
+addi t0,a0,0
+sd t0,1896(gp)
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-1048
+add a0,gp,t0
+jal ra,-20015
+ld a0,-1408(gp)
+jal ra,6667
+jal ra,-19983
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1896(gp)
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-149
+addi t0,a0,0
+sd t0,1896(gp)
+jal ra,8073
+ld a0,1896(gp)
+jal ra,9880
+ld a0,1896(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,zero,0
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,a0,0
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1104(gp)
+beq t0,zero,5
+ld a0,1128(gp)
+jal ra,-16
+ld a0,1120(gp)
+jal ra,-18
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-22246
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22245
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu s1,t0,t1
+addi t0,s1,0
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-19334
+addi s2,a0,0
+ld t0,16(s0)
+addi t1,s2,0
+sd t1,0(t0)
+addi s3,zero,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-22251
+addi s4,a0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s4,0
+sd t1,0(t0)
+addi t0,s4,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22276
+jal ra,-19358
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-25
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,32(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,40(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-86
+ld a0,16(s0)
+jal ra,-112
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-22351
+addi t0,a0,0
+sd t0,1128(gp)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1864(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a3,1848(t0)
+jal ra,-46
+jal ra,-22365
+addi t0,a0,0
+sd t0,1120(gp)
+addi a0,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1872(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a2,1856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a3,1840(t0)
+jal ra,-60
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-22377
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22376
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu s1,t0,t1
+ld a0,16(s0)
+jal ra,-22391
+addi s2,a0,0
+addi s3,zero,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s4,0(t0)
+addi t0,s4,0
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,s4,0
+addi t1,zero,0
+addi t0,t0,24
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-18
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,48
+sd t1,0(t0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1104(gp)
+beq t0,zero,5
+ld a0,1128(gp)
+jal ra,-64
+ld a0,1120(gp)
+jal ra,-66
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-22444
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22446
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-31
+addi t1,a0,0
+ld t0,0(sp)
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-59
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22502
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22522
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22530
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+mul a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-39
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-22577
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-101
+addi t1,a0,0
+ld t0,0(sp)
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22584
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-22594
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t1,t1,1
+addi t0,t0,48
+sd t1,0(t0)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+ld a1,32(s0)
+jal ra,-180
+addi s1,a0,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-76
+addi s2,a0,0
+addi s3,zero,0
+addi t0,s2,0
+ld s4,0(t0)
+addi t0,s3,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22649
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,59
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s5,0(t0)
+addi a0,s5,0
+jal ra,-22623
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s4,0
+jal ra,-22628
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,2
+addi s4,s5,0
+addi a0,s5,0
+jal ra,-22645
+addi t0,a0,0
+beq t0,zero,34
+addi a0,s5,0
+jal ra,-22646
+addi t0,a0,0
+addi t1,s1,0
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,40(s0)
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22686
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,1
+addi t0,t0,32
+sd t1,0(t0)
+addi t0,s5,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-104
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+addi a0,s5,0
+jal zero,7
+addi s3,s3,1
+jal zero,-67
+addi t0,s4,0
+addi t1,zero,0
+sd t1,0(t0)
+addi a0,s4,0
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-22736
+addi t0,a0,0
+ld t1,-48(gp)
+divu s1,t0,t1
+ld a0,24(s0)
+jal ra,-22708
+addi s2,a0,0
+ld a0,16(s0)
+ld a1,32(s0)
+jal ra,-233
+addi t0,a0,0
+sd t0,32(s0)
+addi s3,zero,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,20
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+jal ra,371
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-22
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,40(s0)
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22788
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,1
+addi t0,t0,40
+sd t1,0(t0)
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-80
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,32(s0)
+jal ra,-357
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-224
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,24(s0)
+addi t1,zero,1
+sd t1,0(t0)
+ld a0,24(s0)
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+ld a3,40(s0)
+jal ra,-235
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+jal ra,-22829
+addi t0,a0,0
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,8
+ld a0,16(s0)
+ld a1,-8(s0)
+ld a2,32(s0)
+ld a3,40(s0)
+jal ra,-85
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-22885
+addi t0,a0,0
+ld t1,-48(gp)
+divu s1,t0,t1
+ld a0,24(s0)
+jal ra,-22857
+addi s2,a0,0
+ld a0,16(s0)
+ld a1,32(s0)
+jal ra,-382
+addi t0,a0,0
+sd t0,32(s0)
+addi s3,zero,0
+addi t0,s3,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a1,0(t0)
+jal ra,226
+addi s3,s3,1
+jal zero,-17
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+addi a3,zero,1
+jal ra,-97
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+jal ra,-22907
+addi t0,a0,0
+sd t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-407
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+addi a3,zero,1
+jal ra,-136
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+jal ra,-22946
+addi t0,a0,0
+sd t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-446
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-48(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld a0,16(s0)
+ld a1,-8(s0)
+ld a2,32(s0)
+jal ra,-127
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1120(gp)
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-91
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1128(gp)
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-106
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,1128(gp)
+ld a1,16(s0)
+ld a2,24(s0)
+ld a3,32(s0)
+jal ra,-86
+ld t0,1112(gp)
+beq t0,zero,20
+ld a0,1120(gp)
+ld a1,16(s0)
+ld a2,24(s0)
+addi a3,zero,0
+jal ra,-216
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-8(s0)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,1136(gp)
+addi t0,t0,1
+sd t0,1136(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-20408
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-1104
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld a0,-8(s0)
+ld a1,16(s0)
+jal ra,-21095
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,-8(s0)
+ld a1,16(s0)
+jal ra,-21074
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld a0,-8(s0)
+ld a1,24(s0)
+jal ra,-21107
+addi t0,a0,0
+sd t0,40(sp)
+ld a0,-8(s0)
+ld a1,24(s0)
+jal ra,-21086
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-20439
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi t0,a0,0
+ld a0,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,a1,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+divu a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-15
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1784(t2)
+mul t1,t1,t2
+sub a0,t0,t1
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+jal zero,57
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-57
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,20
+ld a0,16(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-74
+addi t1,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add a1,t0,t1
+jal ra,248
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,32(s0)
+jal ra,-90
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi a0,zero,0
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-91
+addi t0,a0,0
+sd t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,5
+ld t0,-8(s0)
+ld a0,0(t0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,38
+ld a0,24(s0)
+jal ra,-160
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,9978
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-181
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-99
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+divu a0,t0,t1
+jalr zero,0(ra)
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+mul a0,t0,t1
+jalr zero,0(ra)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1816(t2)
+mul t1,t1,t2
+addi t2,a1,0
+sub t1,t1,t2
+addi t2,a0,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,9
+addi t0,a0,0
+addi t1,a1,0
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-46
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-73
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld a0,24(s0)
+jal ra,-65
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-183
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1800(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,1144(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-20776
+addi sp,sp,40
+ld a0,-24(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-59
+jal ra,-347
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-75
+addi t0,a0,0
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1104(gp)
+beq t0,zero,13
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-97
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-504
+jal zero,6
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-55
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1104(gp)
+beq t0,zero,14
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-128
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,32(s0)
+jal ra,-521
+jal zero,5
+ld a0,16(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-73
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1104(gp)
+beq t0,zero,13
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-158
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-580
+jal zero,6
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-116
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1208
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,0
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19427
+ld a0,-1360(gp)
+ld a1,560(gp)
+ld a2,-1296(gp)
+jal ra,-5942
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-5703
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1232
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,0
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19456
+ld a0,-1360(gp)
+ld a1,560(gp)
+ld a2,-1304(gp)
+jal ra,-5971
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-5732
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1256
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1080(gp)
+addi a5,zero,0
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19487
+ld t0,1000(gp)
+ld t1,-1280(gp)
+ld t2,-48(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,1000(gp)
+addi s1,zero,1
+addi t0,zero,1
+ld t1,-1280(gp)
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,21
+ld a0,-1304(gp)
+ld t0,1000(gp)
+sub t0,zero,t0
+addi t1,s1,-1
+ld t2,-48(gp)
+mul t1,t1,t2
+add a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,-18530
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-5859
+addi s1,s1,1
+jal zero,-25
+ld a0,-1360(gp)
+ld a1,-1304(gp)
+ld t0,1000(gp)
+sub a2,zero,t0
+jal ra,-6058
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-5797
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,-1120(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1280
+add a1,gp,t0
+addi a2,zero,0
+ld a3,-1056(gp)
+ld a4,-1072(gp)
+addi a5,zero,0
+ld t0,976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19551
+jal ra,-6118
+jal ra,-6119
+jal ra,-6120
+ld a0,560(gp)
+ld a1,-1288(gp)
+addi a2,zero,0
+jal ra,-5826
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,976(gp)
+sd t0,-8(s0)
+ld t0,16(s0)
+sd t0,976(gp)
+ld a0,-1360(gp)
+ld a1,1000(gp)
+jal ra,-17919
+ld t0,840(gp)
+ld t1,976(gp)
+ld t2,16(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sd t0,840(gp)
+ld t0,-8(s0)
+sd t0,976(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,-23015
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-22993
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t1,t0
+beq t0,zero,99
+ld t0,1448(gp)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,-1296
+add a0,gp,t0
+jal ra,-21649
+ld a0,-1360(gp)
+jal ra,5033
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-23011
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,1448(gp)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,-1304
+add a0,gp,t0
+jal ra,-21667
+ld a0,-1360(gp)
+jal ra,5015
+ld a0,16(s0)
+jal ra,-23059
+addi t0,a0,0
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+ld a1,-16(s0)
+jal ra,834
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,1448(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,-1312
+add a0,gp,t0
+jal ra,-21691
+ld a0,-1360(gp)
+jal ra,4991
+jal ra,-21659
+ld a0,16(s0)
+jal ra,-23081
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-23088
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+ld t1,-1304(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(gp)
+sub a1,t0,t1
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-23070
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-392
+ld t0,1088(gp)
+addi t0,t0,1
+sd t0,1088(gp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-23120
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+addi t0,t0,16
+sd t1,0(t0)
+jal zero,3
+ld a0,16(s0)
+jal ra,-2287
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-16
+addi t0,a0,0
+beq t0,zero,7
+ld a0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1744(t0)
+jal ra,553
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1744(t0)
+jal ra,-21018
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-42
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-23884
+jal zero,11
+ld a0,16(s0)
+jal ra,-23185
+addi t0,a0,0
+ld t1,-1296(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-68
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1224(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23187
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-88
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1232(gp)
+jal zero,14
+ld a0,16(s0)
+jal ra,-23207
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-23209
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add a0,t0,t1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-117
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1240(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23230
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-137
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1248(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23247
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-157
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1256(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23246
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-177
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1264(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23263
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-197
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1272(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23280
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-217
+addi t0,a0,0
+beq t0,zero,3
+ld a0,1208(gp)
+jal zero,5
+ld a0,16(s0)
+jal ra,-23297
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-237
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-24077
+addi t0,a0,0
+sd t0,1232(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24080
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+sd t0,1224(gp)
+addi a0,zero,0
+jal ra,-21193
+addi t0,a0,0
+sd t0,1240(gp)
+sd t0,1248(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-268
+addi t0,a0,0
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,1256(gp)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,168
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-290
+addi t0,a0,0
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,1264(gp)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,176
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-312
+addi t0,a0,0
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,1272(gp)
+jal zero,5
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,184
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-333
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,1208(gp)
+jal zero,7
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+addi t0,t0,192
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,6
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-24219
+jal ra,-24176
+ld t0,-16(gp)
+addi t1,zero,2
+mul t0,t0,t1
+ld t2,-32(gp)
+mul t1,t2,t1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1744(t1)
+ld a0,16(s0)
+jal ra,-150
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-123
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-104
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-85
+ld a0,16(s0)
+jal ra,-65
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+ld a0,16(s0)
+jal ra,-238
+addi s2,a0,0
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,52
+addi a0,s2,0
+jal ra,-24240
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+addi t0,s1,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-24261
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-152
+jal zero,10
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s2,0
+jal ra,-24272
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-299
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-196
+addi a0,s2,0
+jal zero,7
+addi s1,s2,0
+addi a0,s2,0
+jal ra,-24293
+addi s2,a0,0
+jal zero,-53
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-480
+addi t0,a0,0
+beq t0,zero,4
+ld t0,24(s0)
+ld a0,0(t0)
+jal zero,15
+ld a0,16(s0)
+jal ra,-23621
+ld a1,24(s0)
+jal ra,-996
+addi t0,a0,0
+beq t0,zero,6
+ld a0,16(s0)
+jal ra,-23627
+ld a1,24(s0)
+jal ra,-930
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-513
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,12
+ld a0,16(s0)
+jal ra,-23655
+ld a1,24(s0)
+jal ra,-1030
+addi t0,a0,0
+beq t0,zero,6
+ld a0,16(s0)
+jal ra,-23661
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-950
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,24(s0)
+jal ra,-24374
+addi s1,a0,0
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-24377
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add s2,t0,t1
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,9
+ld a0,16(s0)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-59
+addi t0,s1,0
+ld t1,-16(gp)
+add s1,t0,t1
+jal zero,-11
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,-584
+addi t0,a0,0
+beq t0,zero,17
+ld a0,24(s0)
+jal ra,-21529
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,1248(gp)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,1248(gp)
+ld a0,-8(s0)
+jal zero,22
+ld a0,16(s0)
+jal ra,-23708
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add a1,t0,t1
+jal ra,-2969
+addi t0,a0,0
+sd t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,-8(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-240
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,7
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-109
+ld a0,-8(s0)
+jal ra,-24475
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,6
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,1280(gp)
+addi t0,t0,1
+sd t0,1280(gp)
+ld t0,1320(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,1320(gp)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-56
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,1304(gp)
+addi t0,t0,1
+sd t0,1304(gp)
+ld t0,1344(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,1344(gp)
+ld a0,-8(s0)
+jal zero,63
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-125
+addi t0,a0,0
+sd t0,-8(s0)
+sltu t0,zero,t0
+beq t0,zero,51
+ld a0,16(s0)
+jal ra,-697
+addi t0,a0,0
+sd t0,-16(s0)
+sltu t0,zero,t0
+beq t0,zero,42
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-565
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld a0,16(s0)
+ld a1,-16(s0)
+jal ra,-462
+ld t0,-16(s0)
+ld t1,-8(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-16(s0)
+ld t1,24(s0)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,-16(s0)
+ld t1,1216(gp)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,1288(gp)
+addi t0,t0,1
+sd t0,1288(gp)
+ld t0,1296(gp)
+addi t0,t0,1
+sd t0,1296(gp)
+ld t0,1328(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,1328(gp)
+ld t0,1336(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+add t0,t0,t1
+sd t0,1336(gp)
+jal zero,3
+addi a0,zero,0
+jal zero,7
+jal zero,5
+ld t0,1320(gp)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,1320(gp)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-582
+addi t0,a0,0
+addi t1,zero,1
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1760(t2)
+sltu t0,t0,t2
+sub t0,t1,t0
+beq t0,zero,7
+ld a0,16(s0)
+jal ra,493
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-481
+jal zero,11
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-601
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,1
+jal ra,-492
+ld a0,24(s0)
+ld a1,-16(gp)
+jal ra,-21840
+addi t0,a0,0
+sd t0,24(s0)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-150
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-713
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,69
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-705
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,55
+ld a0,16(s0)
+jal ra,-696
+addi s1,a0,0
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,48
+addi t0,zero,1
+ld t1,24(s0)
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,11
+ld t0,24(s0)
+addi t1,s1,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,0
+jal zero,33
+addi a0,s1,0
+jal ra,-24697
+addi s2,a0,0
+addi t0,zero,1
+ld t1,24(s0)
+addi t2,s2,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,19
+ld t0,24(s0)
+addi t1,s2,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+jal ra,-24709
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s1,0
+jal zero,6
+addi a0,s1,0
+jal ra,-24727
+addi s1,a0,0
+jal zero,-49
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-443
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,6
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+ld a0,24(s0)
+ld a1,-48(gp)
+jal ra,-1469
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,49
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-135
+addi t0,a0,0
+sd t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,40
+ld a0,-8(s0)
+jal ra,-24776
+addi t0,a0,0
+ld t1,1216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t0,t0,24
+sd t1,0(t0)
+jal zero,2
+jal zero,24
+ld a0,-8(s0)
+jal ra,-24798
+addi s2,a0,0
+addi t0,s2,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-8(s0)
+jal ra,-24801
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add s3,t0,t1
+addi t0,s2,0
+addi t1,s3,0
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-80
+addi t0,s2,0
+ld t1,-16(gp)
+add s2,t0,t1
+jal zero,-10
+ld s3,-24(s0)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-80
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+ld t1,-16(gp)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+ld t2,-48(gp)
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,11
+ld a0,16(s0)
+ld t0,24(s0)
+ld t1,-16(gp)
+add a1,t0,t1
+jal ra,-127
+ld t0,24(s0)
+ld t1,-16(gp)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+ld a0,16(s0)
+jal ra,-1053
+addi t0,a0,0
+beq t0,zero,13
+jal ra,-24889
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+ld a1,-8(s0)
+ld t0,-8(s0)
+ld t1,-1280(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add a2,t0,t1
+jal ra,-53
+jal zero,26
+addi s2,zero,1
+addi t0,s2,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+addi a0,s2,0
+jal ra,-8897
+addi t0,a0,0
+beq t0,zero,15
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-24218
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a1,0(t0)
+jal ra,-91
+addi s2,s2,1
+jal zero,-23
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-954
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,40
+ld a0,16(s0)
+jal ra,-67
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-1081
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+mul a2,t0,t1
+jal ra,-116
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-1072
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-1061
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-136
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-25001
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-914
+jal zero,10
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-25012
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-1023
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-918
+ld t0,1352(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-25031
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+add t0,t0,t1
+sd t0,1352(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,6
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi s1,zero,0
+ld a0,16(s0)
+jal ra,-1089
+addi s2,a0,0
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,24
+addi a0,s2,0
+jal ra,-25077
+addi s3,a0,0
+addi a0,s2,0
+jal ra,-25071
+addi t0,a0,0
+ld t1,1216(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,16(s0)
+addi a1,s2,0
+addi a2,s1,0
+jal ra,-104
+jal zero,6
+addi t0,s2,0
+ld t1,1216(gp)
+addi t0,t0,24
+sd t1,0(t0)
+addi s1,s2,0
+addi s2,s3,0
+jal zero,-25
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-183
+ld a0,16(s0)
+jal ra,-67
+ld t0,1312(gp)
+addi t0,t0,1
+sd t0,1312(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1392
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1320(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23238
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1320(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23228
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,1280(gp)
+sd t0,32(sp)
+ld t0,1288(gp)
+sd t0,40(sp)
+ld t0,1304(gp)
+sd t0,48(sp)
+jal ra,-22544
+addi sp,sp,48
+lui t0,0xFFFFE
+addi t0,t0,-1464
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1344(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23267
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1344(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23257
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1320(gp)
+ld a1,1344(gp)
+jal ra,-23245
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1320(gp)
+ld a1,1344(gp)
+jal ra,-23224
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,1304(gp)
+sd t0,48(sp)
+jal ra,-22579
+addi sp,sp,48
+lui t0,0xFFFFE
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1352(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23302
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1352(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23292
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,1312(gp)
+sd t0,32(sp)
+jal ra,-22604
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,-1608
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1328(gp)
+ld t1,1336(gp)
+add a0,t0,t1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23329
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,1328(gp)
+ld t1,1336(gp)
+add a0,t0,t1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23321
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1320(gp)
+ld t0,1328(gp)
+ld t1,1336(gp)
+add a1,t0,t1
+jal ra,-23311
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1320(gp)
+ld t0,1328(gp)
+ld t1,1336(gp)
+add a1,t0,t1
+jal ra,-23292
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,1288(gp)
+ld t1,1296(gp)
+add t0,t0,t1
+sd t0,48(sp)
+ld t0,1288(gp)
+sd t0,56(sp)
+ld t0,1296(gp)
+sd t0,64(sp)
+jal ra,-22653
+addi sp,sp,64
+lui t0,0xFFFFE
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1328(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23376
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1328(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23366
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1320(gp)
+ld a1,1328(gp)
+jal ra,-23354
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1320(gp)
+ld a1,1328(gp)
+jal ra,-23333
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,1288(gp)
+sd t0,48(sp)
+jal ra,-22688
+addi sp,sp,48
+lui t0,0xFFFFE
+addi t0,t0,-1752
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1336(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23411
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1336(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-23401
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1320(gp)
+ld a1,1336(gp)
+jal ra,-23389
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1320(gp)
+ld a1,1336(gp)
+jal ra,-23368
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,1296(gp)
+sd t0,48(sp)
+jal ra,-22723
+addi sp,sp,48
+ld a0,16(s0)
+jal ra,-1507
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFE
+addi t0,t0,-1768
+add a0,gp,t0
+jal ra,-23264
+jal ra,-23230
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1992(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1776
+add a1,gp,t0
+jal ra,-23857
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,1200(gp)
+jal ra,9848
+jal zero,33
+ld a0,1992(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1784
+add a1,gp,t0
+jal ra,-23870
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+sd t0,1200(gp)
+ld t0,1192(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+jal ra,9831
+jal zero,16
+ld a0,1992(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1792
+add a1,gp,t0
+jal ra,-23887
+addi t0,a0,0
+beq t0,zero,7
+ld t0,1192(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+jal ra,9818
+jal zero,3
+ld t0,1192(gp)
+sd t0,1200(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1016(gp)
+sltu t0,zero,t0
+beq t0,zero,25
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1800
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1016(gp)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-22801
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-22711
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1432(gp)
+beq t0,zero,27
+ld t0,56(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1816
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-22828
+addi sp,sp,16
+ld a0,56(gp)
+jal ra,-22738
+ld a0,16(s0)
+ld a1,968(gp)
+jal ra,-62
+ld t0,1488(gp)
+beq t0,zero,2
+jal zero,60
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add a0,gp,t0
+jal ra,-23394
+jal zero,55
+ld t0,1496(gp)
+beq t0,zero,22
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1832
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22854
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-22764
+ld a0,16(s0)
+ld a1,968(gp)
+jal ra,-88
+lui t0,0xFFFFE
+addi t0,t0,-1840
+add a0,gp,t0
+jal ra,-23417
+jal zero,32
+ld t0,1472(gp)
+beq t0,zero,30
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1848
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22877
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-22787
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-111
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1864
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1520(gp)
+sd t0,16(sp)
+jal ra,-22893
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-22803
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-97
+ld t0,56(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1880
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,2825
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-9633
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,696(gp)
+addi a1,zero,20
+jal ra,-24317
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-22928
+addi sp,sp,24
+ld a0,56(gp)
+jal ra,-22838
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add a0,gp,t0
+jal ra,-23497
+ld a0,688(gp)
+jal ra,3185
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1896
+add a0,gp,t0
+jal ra,-23512
+ld a0,688(gp)
+jal ra,3170
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,3060
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-9495
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,28
+ld a0,696(gp)
+addi a1,zero,12
+jal ra,-24673
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1568(gp)
+addi t0,t0,1
+sd t0,1568(gp)
+jal zero,4
+ld t0,1568(gp)
+addi t0,t0,1
+sd t0,1568(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,832(gp)
+addi t0,t0,1
+sd t0,832(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1400(gp)
+ld t2,1384(gp)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-250
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,672(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,696(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,56(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1904
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23084
+ld a0,56(gp)
+jal ra,-22993
+jal zero,26
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1920
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,2645
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-9813
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,672(gp)
+jal ra,-9817
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,696(gp)
+sd t0,40(sp)
+jal ra,-23109
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-23019
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1928
+add a0,gp,t0
+jal ra,-23678
+ld a0,672(gp)
+jal ra,3060
+lui t0,0xFFFFE
+addi t0,t0,-1936
+add a0,gp,t0
+jal ra,-23684
+ld a0,688(gp)
+jal ra,3054
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1944
+add a0,gp,t0
+jal ra,-23699
+ld a0,688(gp)
+jal ra,3039
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-9666
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1576(gp)
+addi t0,t0,1
+sd t0,1576(gp)
+jal zero,4
+ld t0,1576(gp)
+addi t0,t0,1
+sd t0,1576(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-408
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1960
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,2514
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-9944
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,672(gp)
+jal ra,-9948
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,680(gp)
+jal ra,-9952
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-23242
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-23152
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1968
+add a0,gp,t0
+jal ra,-23811
+ld a0,672(gp)
+jal ra,2927
+lui t0,0xFFFFE
+addi t0,t0,-1976
+add a0,gp,t0
+jal ra,-23817
+ld a0,680(gp)
+jal ra,2921
+lui t0,0xFFFFE
+addi t0,t0,-1984
+add a0,gp,t0
+jal ra,-23823
+ld a0,688(gp)
+jal ra,2915
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-9790
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+add t0,t1,t0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1584(gp)
+addi t0,t0,1
+sd t0,1584(gp)
+jal zero,4
+ld t0,1584(gp)
+addi t0,t0,1
+sd t0,1584(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,848(gp)
+addi t0,t0,1
+sd t0,848(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-9852
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+sub t0,t1,t0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1592(gp)
+addi t0,t0,1
+sd t0,1592(gp)
+jal zero,4
+ld t0,1592(gp)
+addi t0,t0,1
+sd t0,1592(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,856(gp)
+addi t0,t0,1
+sd t0,856(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-9914
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+mul t0,t1,t0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1600(gp)
+addi t0,t0,1
+sd t0,1600(gp)
+jal zero,4
+ld t0,1600(gp)
+addi t0,t0,1
+sd t0,1600(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,864(gp)
+addi t0,t0,1
+sd t0,864(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,54
+jal ra,-9984
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+divu t0,t1,t0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1608(gp)
+addi t0,t0,1
+sd t0,1608(gp)
+jal zero,4
+ld t0,1608(gp)
+addi t0,t0,1
+sd t0,1608(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,872(gp)
+addi t0,t0,1
+sd t0,872(gp)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1432(t0)
+ld a1,1512(gp)
+jal ra,2835
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,54
+jal ra,-10060
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+remu t0,t1,t0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1616(gp)
+addi t0,t0,1
+sd t0,1616(gp)
+jal zero,4
+ld t0,1616(gp)
+addi t0,t0,1
+sd t0,1616(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,880(gp)
+addi t0,t0,1
+sd t0,880(gp)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1432(t0)
+ld a1,1512(gp)
+jal ra,2759
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-10128
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,40
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1624(gp)
+addi t0,t0,1
+sd t0,1624(gp)
+jal zero,4
+ld t0,1624(gp)
+addi t0,t0,1
+sd t0,1624(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,888(gp)
+addi t0,t0,1
+sd t0,888(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-878
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2000
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,2044
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-10414
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,696(gp)
+sd t0,32(sp)
+ld a0,672(gp)
+jal ra,-10420
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-23710
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-23620
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-2008
+add a0,gp,t0
+jal ra,-24289
+ld a0,672(gp)
+jal ra,2393
+ld a0,-8(s0)
+ld a1,-48(gp)
+jal ra,-3076
+addi t0,a0,0
+beq t0,zero,42
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3057
+addi t0,a0,0
+beq t0,zero,37
+ld a0,688(gp)
+jal ra,-10415
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3001
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-23788
+addi sp,sp,16
+jal zero,15
+lui t0,0xFFFFD
+addi t0,t0,2040
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3016
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-23803
+addi sp,sp,16
+ld a0,688(gp)
+jal ra,2404
+jal zero,5
+lui t0,0xFFFFD
+addi t0,t0,2032
+add a0,gp,t0
+jal ra,-24341
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,-48(gp)
+jal ra,-3136
+addi t0,a0,0
+beq t0,zero,21
+ld a0,1544(gp)
+ld a1,16(s0)
+jal ra,-3117
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,2024
+add a0,gp,t0
+jal ra,-24365
+ld a0,688(gp)
+jal ra,2373
+lui t0,0xFFFFD
+addi t0,t0,2008
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-23845
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-3180
+addi t0,a0,0
+beq t0,zero,13
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3161
+addi t0,a0,0
+beq t0,zero,8
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,2178
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-3216
+addi t0,a0,0
+beq t0,zero,96
+ld a0,-8(s0)
+jal ra,6554
+addi t0,a0,0
+beq t0,zero,86
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3201
+addi t0,a0,0
+beq t0,zero,68
+jal ra,-10400
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,28
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3107
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,4
+ld t0,1632(gp)
+addi t0,t0,1
+sd t0,1632(gp)
+jal zero,4
+ld t0,1632(gp)
+addi t0,t0,1
+sd t0,1632(gp)
+ld t0,1512(gp)
+ld t1,968(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,896(gp)
+addi t0,t0,1
+sd t0,896(gp)
+ld t0,1704(gp)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1704(gp)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1464(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-3313
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2398
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1456(t0)
+ld a1,-8(s0)
+jal ra,2392
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1424(t0)
+ld a1,-8(s0)
+jal ra,2386
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-1185
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1992
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,1737
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,680(gp)
+jal ra,-10721
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,696(gp)
+sd t0,32(sp)
+ld a0,672(gp)
+jal ra,-10727
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24017
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-23927
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1984
+add a0,gp,t0
+jal ra,-24596
+ld a0,672(gp)
+jal ra,2086
+ld a0,-8(s0)
+ld a1,-48(gp)
+jal ra,-3383
+addi t0,a0,0
+beq t0,zero,46
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3364
+addi t0,a0,0
+beq t0,zero,41
+lui t0,0xFFFFD
+addi t0,t0,1976
+add a0,gp,t0
+jal ra,-24612
+ld a0,680(gp)
+jal ra,2126
+ld a0,688(gp)
+jal ra,-10728
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3314
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24101
+addi sp,sp,16
+jal zero,15
+lui t0,0xFFFFD
+addi t0,t0,1928
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3329
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24116
+addi sp,sp,16
+jal zero,5
+lui t0,0xFFFFD
+addi t0,t0,1920
+add a0,gp,t0
+jal ra,-24652
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,-48(gp)
+jal ra,-3447
+addi t0,a0,0
+beq t0,zero,17
+ld a0,1544(gp)
+ld a1,16(s0)
+jal ra,-3428
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1896
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-24150
+addi sp,sp,8
+ld a0,680(gp)
+jal ra,2057
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-3487
+addi t0,a0,0
+beq t0,zero,10
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3468
+addi t0,a0,0
+beq t0,zero,5
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3401
+jal ra,1874
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-3520
+addi t0,a0,0
+beq t0,zero,98
+ld a0,-8(s0)
+jal ra,6293
+addi t0,a0,0
+beq t0,zero,88
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3505
+addi t0,a0,0
+beq t0,zero,70
+jal ra,-10704
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-3439
+addi t0,a0,0
+ld t1,1536(gp)
+ld t2,680(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,11
+ld a0,1544(gp)
+ld a1,-8(s0)
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-3395
+jal zero,15
+ld t0,1640(gp)
+addi t0,t0,1
+sd t0,1640(gp)
+ld t0,1104(gp)
+beq t0,zero,10
+ld a0,1544(gp)
+ld a1,-8(s0)
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-3410
+ld t0,1512(gp)
+ld t1,968(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,904(gp)
+addi t0,t0,1
+sd t0,904(gp)
+ld t0,1712(gp)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1712(gp)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1464(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-3619
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,2092
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1456(t0)
+ld a1,-8(s0)
+jal ra,2086
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1424(t0)
+ld a1,-8(s0)
+jal ra,2080
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+ld a0,1544(gp)
+ld a1,-8(s0)
+ld t0,1400(gp)
+ld t1,1384(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-3546
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-1523
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1880
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,1399
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,672(gp)
+jal ra,-11059
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,680(gp)
+jal ra,-11063
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,696(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1480(t0)
+jal ra,-25932
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24360
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-24270
+ld t0,1472(gp)
+beq t0,zero,16
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-24377
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-24287
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1864
+add a0,gp,t0
+jal ra,-24946
+ld a0,672(gp)
+jal ra,1792
+lui t0,0xFFFFD
+addi t0,t0,1856
+add a0,gp,t0
+jal ra,-24952
+ld a0,680(gp)
+jal ra,1786
+lui t0,0xFFFFD
+addi t0,t0,1840
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1512(gp)
+sd t0,8(sp)
+jal ra,-24432
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1512(gp)
+sd t0,8(sp)
+jal ra,-24450
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi a0,zero,0
+jal ra,1598
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-10956
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+jal zero,10
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,1648(gp)
+addi t0,t0,1
+sd t0,1648(gp)
+ld t0,912(gp)
+addi t0,t0,1
+sd t0,912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-1681
+ld t0,56(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1808
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,1241
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-11217
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,696(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1480(t0)
+jal ra,-26086
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-24514
+addi sp,sp,24
+ld a0,56(gp)
+jal ra,-24424
+ld t0,1472(gp)
+beq t0,zero,16
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1800
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-24531
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-24441
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1792
+add a0,gp,t0
+jal ra,-25100
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+ld a0,688(gp)
+jal ra,1577
+lui t0,0xFFFFD
+addi t0,t0,1784
+add a0,gp,t0
+jal ra,-25111
+lui t0,0xFFFFD
+addi t0,t0,1768
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1512(gp)
+sd t0,8(sp)
+jal ra,-24589
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-161
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1760
+add a0,gp,t0
+jal ra,-25139
+ld a0,688(gp)
+jal ra,1543
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-11106
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1512(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t1,968(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,1672(gp)
+addi t0,t0,1
+sd t0,1672(gp)
+ld t0,1680(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1680(gp)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+ld t0,1728(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,1512(gp)
+jal ra,3854
+jal zero,49
+ld a0,696(gp)
+addi a1,zero,0
+jal ra,-26233
+addi t0,a0,0
+beq t0,zero,29
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t1,968(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,1688(gp)
+addi t0,t0,1
+sd t0,1688(gp)
+ld t0,1696(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1696(gp)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+jal zero,16
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,696(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,1656(gp)
+addi t0,t0,1
+sd t0,1656(gp)
+ld t0,920(gp)
+addi t0,t0,1
+sd t0,920(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-1900
+ld t0,56(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1744
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,1022
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,688(gp)
+jal ra,-11436
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,696(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1480(t0)
+jal ra,-26305
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,672(gp)
+jal ra,-11447
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24737
+addi sp,sp,32
+ld a0,56(gp)
+jal ra,-24647
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1736
+add a0,gp,t0
+jal ra,-25306
+ld a0,672(gp)
+jal ra,1376
+lui t0,0xFFFFD
+addi t0,t0,1728
+add a0,gp,t0
+jal ra,-25312
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+ld a0,688(gp)
+jal ra,1365
+lui t0,0xFFFFD
+addi t0,t0,1720
+add a0,gp,t0
+jal ra,-25323
+lui t0,0xFFFFD
+addi t0,t0,1704
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1512(gp)
+sd t0,8(sp)
+jal ra,-24801
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-11297
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-26457
+addi a1,zero,1
+jal ra,-26479
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-8(s0)
+ld t1,1512(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,1664(gp)
+addi t0,t0,1
+sd t0,1664(gp)
+ld t0,-8(s0)
+sd t0,1512(gp)
+ld t0,1728(gp)
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,672(gp)
+ld t1,-1288(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,3681
+jal zero,19
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1512(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,1512(gp)
+ld t0,1728(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,1512(gp)
+jal ra,3647
+ld t0,928(gp)
+addi t0,t0,1
+sd t0,928(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+jal ra,-2058
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,1528(gp)
+jal ra,864
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24880
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-24790
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1536(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,1138
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,936(gp)
+addi t0,t0,1
+sd t0,936(gp)
+ld t0,1464(gp)
+beq t0,zero,25
+ld t0,1536(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1400(gp)
+ld t2,1384(gp)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-25448
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+jal zero,64
+ld t0,1536(gp)
+ld t1,-1416(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,41
+ld t0,1456(gp)
+beq t0,zero,15
+lui t0,0xFFFFD
+addi t0,t0,1640
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-24983
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1104(t0)
+jal ra,-28541
+jal zero,24
+ld t0,1488(gp)
+beq t0,zero,15
+lui t0,0xFFFFD
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-24999
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1104(t0)
+jal ra,-28557
+jal zero,8
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+jal ra,-5583
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1448(t0)
+ld t0,1536(gp)
+ld t1,-1416(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a1,0(t0)
+jal ra,1369
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,1536(gp)
+ld t1,-1360(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1400(gp)
+ld t2,1384(gp)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1488(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,1400(gp)
+ld t1,1384(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,696(gp)
+addi a1,zero,12
+jal ra,-26745
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,832(gp)
+addi t0,t0,1
+sd t0,832(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+ld t2,696(gp)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,840(gp)
+addi t0,t0,1
+sd t0,840(gp)
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t2,t1,t2
+ld t2,0(t2)
+ld t4,680(gp)
+mul t3,t4,t3
+add t1,t1,t3
+ld t1,0(t1)
+add t1,t2,t1
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,848(gp)
+addi t0,t0,1
+sd t0,848(gp)
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t2,t1,t2
+ld t2,0(t2)
+ld t4,680(gp)
+mul t3,t4,t3
+add t1,t1,t3
+ld t1,0(t1)
+sub t1,t2,t1
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,856(gp)
+addi t0,t0,1
+sd t0,856(gp)
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t2,t1,t2
+ld t2,0(t2)
+ld t4,680(gp)
+mul t3,t4,t3
+add t1,t1,t3
+ld t1,0(t1)
+mul t1,t2,t1
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,864(gp)
+addi t0,t0,1
+sd t0,864(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t2,t1,t2
+ld t2,0(t2)
+ld t4,680(gp)
+mul t3,t4,t3
+add t1,t1,t3
+ld t1,0(t1)
+divu t1,t2,t1
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,872(gp)
+addi t0,t0,1
+sd t0,872(gp)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1432(t0)
+ld a1,1512(gp)
+jal ra,1109
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1536(gp)
+ld t2,672(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t2,t1,t2
+ld t2,0(t2)
+ld t4,680(gp)
+mul t3,t4,t3
+add t1,t1,t3
+ld t1,0(t1)
+remu t1,t2,t1
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,880(gp)
+addi t0,t0,1
+sd t0,880(gp)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1432(t0)
+ld a1,1512(gp)
+jal ra,1055
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+sltu t0,t1,t0
+beq t0,zero,9
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+jal zero,8
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,888(gp)
+addi t0,t0,1
+sd t0,888(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-4713
+addi t0,a0,0
+beq t0,zero,58
+ld a0,-8(s0)
+jal ra,5057
+addi t0,a0,0
+beq t0,zero,48
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-4698
+addi t0,a0,0
+beq t0,zero,30
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-4610
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,896(gp)
+addi t0,t0,1
+sd t0,896(gp)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1464(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-4772
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,939
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1456(t0)
+ld a1,-8(s0)
+jal ra,933
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1424(t0)
+ld a1,-8(s0)
+jal ra,927
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,-48(gp)
+jal ra,-4799
+addi t0,a0,0
+beq t0,zero,48
+ld a0,-8(s0)
+jal ra,5014
+addi t0,a0,0
+beq t0,zero,38
+ld a0,1544(gp)
+ld a1,-8(s0)
+jal ra,-4784
+addi t0,a0,0
+beq t0,zero,20
+ld a0,1544(gp)
+ld a1,-8(s0)
+ld t0,1536(gp)
+ld t1,680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-4660
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,904(gp)
+addi t0,t0,1
+sd t0,904(gp)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1464(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-4848
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,863
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1456(t0)
+ld a1,-8(s0)
+jal ra,857
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1424(t0)
+ld a1,-8(s0)
+jal ra,851
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t1,t0,t1
+ld t1,0(t1)
+ld t3,680(gp)
+mul t2,t3,t2
+add t0,t0,t2
+ld t0,0(t0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+jal zero,7
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,912(gp)
+addi t0,t0,1
+sd t0,912(gp)
+jalr zero,0(ra)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1512(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,1512(gp)
+ld t1,696(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+ld t0,920(gp)
+addi t0,t0,1
+sd t0,920(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1536(gp)
+ld t1,672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,696(gp)
+add a0,t0,t1
+addi a1,zero,1
+jal ra,-27248
+addi a1,zero,1
+jal ra,-27270
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,688(gp)
+ld t1,560(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,1536(gp)
+ld t1,688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1512(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,1512(gp)
+ld t0,928(gp)
+addi t0,t0,1
+sd t0,928(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1024(gp)
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1024(gp)
+ld t1,1512(gp)
+ld t2,976(gp)
+sub t1,t1,t2
+ld t2,-16(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-25647
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-25557
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1560
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,1512(gp)
+sd t0,16(sp)
+jal ra,-25670
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-25580
+ld t0,1472(gp)
+beq t0,zero,16
+jal ra,-54
+lui t0,0xFFFFD
+addi t0,t0,1552
+add a0,gp,t0
+jal ra,-26233
+ld a0,16(s0)
+ld t0,-16(gp)
+addi t1,zero,2
+mul a1,t0,t1
+jal ra,-26080
+lui t0,0xFFFFD
+addi t0,t0,1544
+add a0,gp,t0
+jal ra,-26242
+jal zero,5
+lui t0,0xFFFFD
+addi t0,t0,1536
+add a0,gp,t0
+jal ra,-26247
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1472(gp)
+beq t0,zero,3
+ld a0,16(s0)
+jal ra,-52
+ld t0,-64(gp)
+beq t0,zero,13
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1520
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-25720
+addi sp,sp,8
+jal zero,12
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1504
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-25732
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-25642
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,1360(gp)
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2705
+jal zero,130
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2087
+jal zero,120
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1790
+jal zero,110
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2577
+jal zero,100
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2587
+jal zero,90
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2597
+jal zero,80
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2607
+jal zero,70
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2617
+jal zero,60
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2627
+jal zero,50
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1522
+jal zero,40
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1374
+jal zero,30
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1165
+jal zero,20
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2978
+jal zero,10
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-1027
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+jal ra,6678
+addi t0,a0,0
+sd t0,1368(gp)
+ld t0,976(gp)
+ld t1,1000(gp)
+add t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,1456
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1368(gp)
+sd t0,16(sp)
+jal ra,-25944
+addi sp,sp,16
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,976(t0)
+jal ra,7498
+ld a0,1368(gp)
+ld a1,-384(gp)
+jal ra,-9488
+addi t0,a0,0
+sd t0,1376(gp)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-27517
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1368(gp)
+sd t0,16(sp)
+jal ra,-25970
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-29528
+ld t0,1368(gp)
+sd t0,104(gp)
+ld t0,1376(gp)
+sd t0,-400(gp)
+jal ra,-29388
+jal ra,-28180
+addi t0,zero,0
+sd t0,1432(gp)
+ld t0,16(s0)
+sd t0,1472(gp)
+ld t0,1512(gp)
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,1512(gp)
+jal ra,-11265
+addi t0,a0,0
+sd t0,1520(gp)
+jal ra,561
+jal ra,-224
+jal ra,-26491
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,1512(gp)
+jal zero,-17
+ld t0,1512(gp)
+ld t1,976(gp)
+sub t0,t0,t1
+ld t1,1000(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,1512(gp)
+ld t1,976(gp)
+sub a0,t0,t1
+jal ra,-11187
+addi s1,a0,0
+addi a0,s1,0
+jal ra,-293
+jal ra,-26512
+ld t0,1512(gp)
+ld t1,-48(gp)
+add t0,t0,t1
+sd t0,1512(gp)
+jal zero,-18
+addi t0,zero,0
+sd t0,1472(gp)
+addi t0,zero,0
+sd t0,104(gp)
+addi t0,zero,1
+sd t0,-400(gp)
+lui t0,0xFFFFD
+addi t0,t0,1312
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,88(gp)
+sd t0,16(sp)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,1000(gp)
+sd t0,32(sp)
+ld t0,1368(gp)
+sd t0,40(sp)
+jal ra,-26048
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,976(t0)
+jal ra,7440
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,1392(gp)
+ld t1,1384(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,1512(gp)
+sd t1,0(t0)
+ld t0,1400(gp)
+ld t1,1384(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,1384(gp)
+addi t0,t0,1
+sd t0,1384(gp)
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+ld t0,1384(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1488(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,1384(gp)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,1456(gp)
+ld s2,-8(s0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,1384(gp)
+addi t0,t0,-1
+sd t0,1384(gp)
+ld t0,1392(gp)
+ld t1,1384(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1488(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,1512(gp)
+jal ra,353
+jal ra,429
+jal ra,1052
+addi s2,s2,-1
+jal zero,-21
+addi t0,zero,1
+sd t0,1464(gp)
+ld s2,-8(s0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,9
+jal ra,342
+jal ra,418
+jal ra,1080
+ld t0,1384(gp)
+addi t0,t0,1
+sd t0,1384(gp)
+addi s2,s2,-1
+jal zero,-10
+addi t0,zero,0
+sd t0,1464(gp)
+addi t0,zero,1
+sd t0,1456(gp)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1296
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-12855
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,1536(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-26175
+addi sp,sp,16
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1280
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-12883
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,1536(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-26203
+addi sp,sp,16
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-12858
+addi t0,a0,0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-66
+jal zero,26
+lui t0,0xFFFFD
+addi t0,t0,1264
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-12918
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,1536(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+ld t0,1536(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-26245
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1416(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal ra,-26794
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1240
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26280
+addi sp,sp,8
+jal zero,105
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1216
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26298
+addi sp,sp,8
+jal zero,87
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26316
+addi sp,sp,8
+jal zero,69
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1184
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26334
+addi sp,sp,8
+jal zero,51
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1424(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26352
+addi sp,sp,8
+jal zero,33
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1416(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26370
+addi sp,sp,8
+jal zero,15
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1136
+add a0,gp,t0
+jal ra,-26914
+ld a0,24(s0)
+jal ra,-13069
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1896(gp)
+jal ra,-28281
+addi t0,a0,0
+ld t1,1408(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,42
+ld a0,1896(gp)
+jal ra,-28288
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFD
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1896(gp)
+sd t0,16(sp)
+jal ra,-26421
+addi sp,sp,16
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-173
+lui t0,0xFFFFD
+addi t0,t0,1056
+add a0,gp,t0
+jal ra,-26959
+ld a0,1896(gp)
+jal ra,-28313
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,1896(gp)
+jal ra,-28314
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-188
+jal ra,-26936
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1096(t0)
+jal ra,-29998
+ld t0,1896(gp)
+ld t1,16(s0)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,1896(gp)
+ld t1,24(s0)
+addi t0,t0,128
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,1560(gp)
+ld t0,1424(gp)
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1896(gp)
+sd t0,16(sp)
+jal ra,-26467
+addi sp,sp,16
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-219
+jal ra,-26967
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1512(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1480(t0)
+jal ra,-5798
+addi t0,a0,0
+beq t0,zero,54
+ld a0,1896(gp)
+ld a1,1512(gp)
+jal ra,3722
+addi t0,a0,0
+beq t0,zero,43
+ld a0,1544(gp)
+ld a1,1512(gp)
+jal ra,-5784
+addi t0,a0,0
+beq t0,zero,25
+ld t0,1512(gp)
+ld t1,-48(gp)
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,1544(gp)
+ld a1,1512(gp)
+jal ra,-5629
+jal ra,-11859
+addi t0,a0,0
+sd t0,1520(gp)
+jal zero,11
+ld a0,1544(gp)
+ld t0,1512(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub a1,t0,t1
+jal ra,-5640
+jal ra,-11854
+addi t0,a0,0
+sd t0,1520(gp)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1464(t0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,1512(gp)
+jal ra,-5853
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-142
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1456(t0)
+ld a1,1512(gp)
+jal ra,-148
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1424(t0)
+ld a1,1512(gp)
+jal ra,-154
+jal ra,-11632
+addi t0,a0,0
+sd t0,1520(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1520(gp)
+jal ra,-12867
+addi t0,a0,0
+sd t0,664(gp)
+addi t0,zero,0
+sd t0,1528(gp)
+ld t0,664(gp)
+ld t1,-1800(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-12774
+ld t0,704(gp)
+ld t1,584(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,1528(gp)
+jal zero,237
+ld t0,664(gp)
+ld t1,-1792(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-12792
+ld t0,-64(gp)
+beq t0,zero,12
+ld t0,704(gp)
+ld t1,-1888(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+sd t0,1528(gp)
+jal zero,11
+ld t0,704(gp)
+ld t1,-1904(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+sd t0,1528(gp)
+jal zero,206
+ld t0,664(gp)
+ld t1,-1808(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-12702
+ld t0,-64(gp)
+beq t0,zero,12
+ld t0,704(gp)
+ld t1,-1896(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+sd t0,1528(gp)
+jal zero,11
+ld t0,704(gp)
+ld t1,-1912(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+sd t0,1528(gp)
+jal zero,175
+ld t0,664(gp)
+ld t1,-1816(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+jal ra,-12944
+ld t0,704(gp)
+ld t1,592(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+ld t0,712(gp)
+ld t1,640(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,1528(gp)
+jal zero,22
+ld t0,712(gp)
+ld t1,-1928(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+sd t0,1528(gp)
+jal zero,11
+ld t0,712(gp)
+ld t1,-1920(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,1528(gp)
+jal zero,51
+ld t0,704(gp)
+ld t1,-1864(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,712(gp)
+ld t1,-1936(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+sd t0,1528(gp)
+jal zero,34
+ld t0,704(gp)
+ld t1,-1872(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,712(gp)
+ld t1,-1944(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+sd t0,1528(gp)
+jal zero,17
+ld t0,704(gp)
+ld t1,-1880(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,712(gp)
+ld t1,648(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+sd t0,1528(gp)
+jal zero,78
+ld t0,664(gp)
+ld t1,-1832(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-12663
+ld t0,704(gp)
+ld t1,616(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+sd t0,1528(gp)
+jal zero,60
+ld t0,664(gp)
+ld t1,-1848(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-12526
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1640(t0)
+sd t0,1528(gp)
+jal zero,48
+ld t0,664(gp)
+ld t1,-1840(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-12981
+ld t0,704(gp)
+ld t1,624(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+sd t0,1528(gp)
+jal zero,30
+ld t0,664(gp)
+ld t1,-1824(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-12484
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,1528(gp)
+jal zero,18
+ld t0,664(gp)
+ld t1,-1856(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-13011
+ld t0,704(gp)
+ld t1,632(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1624(t0)
+sd t0,1528(gp)
+ld t0,1528(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,1432(gp)
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1416(t0)
+ld a1,1512(gp)
+jal ra,-437
+jal zero,22
+addi t0,zero,1
+sd t0,-400(gp)
+lui t0,0xFFFFD
+addi t0,t0,936
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1512(gp)
+sd t0,16(sp)
+ld t0,1520(gp)
+sd t0,24(sp)
+ld t0,664(gp)
+sd t0,32(sp)
+jal ra,-26846
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1120(t0)
+jal ra,-30404
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1440(gp)
+beq t0,zero,7
+ld t0,1456(gp)
+beq t0,zero,3
+jal ra,152
+jal zero,2
+jal ra,351
+jal zero,144
+ld t0,1480(gp)
+beq t0,zero,3
+jal ra,524
+jal zero,140
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3704
+jal zero,130
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3003
+jal zero,120
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2709
+jal zero,110
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3610
+jal zero,100
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3558
+jal zero,90
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3506
+jal zero,80
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3454
+jal zero,70
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3388
+jal zero,60
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3322
+jal zero,50
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2503
+jal zero,40
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2364
+jal zero,30
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2183
+jal zero,20
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3995
+jal zero,10
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2083
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4039
+jal ra,-3853
+jal zero,143
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3188
+jal ra,-3153
+jal zero,132
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2892
+jal ra,-2860
+jal zero,121
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4072
+jal ra,-3762
+jal zero,110
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4083
+jal ra,-3711
+jal zero,99
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4094
+jal ra,-3660
+jal zero,88
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4105
+jal ra,-3609
+jal zero,77
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4116
+jal ra,-3544
+jal zero,66
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4127
+jal ra,-3479
+jal zero,55
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-2671
+jal ra,-2661
+jal zero,44
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4149
+jal ra,-2523
+jal zero,33
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4160
+jal ra,-2343
+jal zero,22
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4171
+jal ra,-4156
+jal zero,11
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2260
+jal ra,-2245
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2872
+jal zero,21
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,12
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2181
+jal zero,2
+jal ra,-4151
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1451
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4090
+jal ra,-4055
+jal ra,-4071
+jal zero,155
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3501
+jal ra,-3356
+jal ra,-3428
+jal zero,143
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3206
+jal ra,-3064
+jal ra,-3129
+jal zero,131
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3993
+jal ra,-3967
+jal ra,-4107
+jal zero,119
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4005
+jal ra,-3917
+jal ra,-4119
+jal zero,107
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4017
+jal ra,-3867
+jal ra,-4131
+jal zero,95
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4029
+jal ra,-3817
+jal ra,-4143
+jal zero,83
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4041
+jal ra,-3753
+jal ra,-4155
+jal zero,71
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4053
+jal ra,-3689
+jal ra,-4167
+jal zero,59
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2930
+jal ra,-2872
+jal ra,-2902
+jal zero,47
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2788
+jal ra,-2735
+jal ra,-2757
+jal zero,35
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2594
+jal ra,-2556
+jal ra,-2769
+jal zero,23
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4415
+jal ra,-4370
+jal ra,-4402
+jal zero,11
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2459
+jal zero,2
+jal ra,-27884
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2297
+jal zero,130
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2032
+jal zero,120
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1956
+jal zero,110
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2298
+jal zero,100
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2276
+jal zero,90
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2254
+jal zero,80
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2232
+jal zero,70
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2188
+jal zero,60
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2144
+jal zero,50
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1950
+jal zero,40
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1931
+jal zero,30
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1917
+jal zero,20
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2454
+jal zero,10
+ld t0,1528(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2609
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,1552(gp)
+ld t1,1504(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,1552(gp)
+addi t0,t0,-1
+sd t0,1552(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld a0,1896(gp)
+jal ra,-29441
+addi t0,a0,0
+ld t1,1408(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1440(t0)
+addi a1,zero,0
+jal ra,-1178
+jal zero,3
+addi t0,zero,1
+sd t0,1552(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,1560(gp)
+ld t0,1560(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+jal ra,-1111
+ld t0,1560(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1039
+ld t0,1728(gp)
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,1736(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,1736(gp)
+jal ra,-29918
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,t1,1
+addi t0,t0,32
+sd t1,0(t0)
+jal ra,-752
+jal ra,-67
+jal zero,-26
+addi t0,zero,0
+sd t0,1560(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld s1,16(gp)
+addi s2,zero,0
+addi s3,zero,0
+addi t0,s3,0
+ld t1,976(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,16(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s4,0(t0)
+addi t0,s2,0
+addi t1,s4,0
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,s4,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,4
+addi s2,s4,0
+addi s1,s3,0
+jal zero,7
+addi t0,s3,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+mul a0,t0,t1
+jal zero,17
+addi s3,s3,1
+jal zero,-32
+addi t0,s1,0
+ld t1,16(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+mul a0,t0,t1
+jal zero,4
+ld a0,16(gp)
+jal zero,2
+addi a0,zero,0
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,24(s0)
+ld a1,32(s0)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t1,16(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,49
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld a0,16(s0)
+ld a1,-16(s0)
+jal ra,-28413
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,16(s0)
+ld a1,-16(s0)
+jal ra,-28392
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-27747
+addi sp,sp,32
+ld a0,-8(s0)
+addi a1,zero,0
+jal ra,-4956
+ld a0,-16(s0)
+jal zero,8
+lui t0,0xFFFFD
+addi t0,t0,896
+add a0,gp,t0
+jal ra,-28287
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,880
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-27784
+addi sp,sp,24
+ld a0,24(s0)
+ld a1,32(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,24(s0)
+ld a1,32(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,24(s0)
+ld a1,32(s0)
+ld a2,16(gp)
+jal ra,-110
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-116
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-122
+jal ra,-28307
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-48
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,38
+ld t0,40(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,848
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld a0,32(s0)
+ld a1,40(s0)
+jal ra,-28568
+addi t0,a0,0
+sd t0,56(sp)
+ld a0,32(s0)
+ld a1,40(s0)
+jal ra,-28556
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-27866
+addi sp,sp,64
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-14569
+lui t0,0xFFFFD
+addi t0,t0,832
+add a1,gp,t0
+ld t0,1752(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+ld t0,1760(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a3,0(t0)
+jal ra,-77
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-27914
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,752
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,744
+add a1,gp,t0
+ld a2,1864(gp)
+ld a3,1872(gp)
+jal ra,-106
+ld a0,-1304(gp)
+jal ra,-53
+lui t0,0xFFFFD
+addi t0,t0,728
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,720
+add a1,gp,t0
+ld a2,1832(gp)
+ld a3,1840(gp)
+jal ra,-117
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-14612
+addi t0,a0,0
+beq t0,zero,21
+ld t0,1768(gp)
+ld t1,1752(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1768(gp)
+ld t0,1776(gp)
+ld t1,1760(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1776(gp)
+addi a0,s1,0
+jal ra,-91
+addi s1,s1,1
+jal zero,-29
+lui t0,0xFFFFD
+addi t0,t0,704
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,696
+add a1,gp,t0
+ld a2,1768(gp)
+ld a3,1776(gp)
+jal ra,-157
+lui t0,0xFFFFD
+addi t0,t0,680
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,672
+add a1,gp,t0
+ld a2,1848(gp)
+ld a3,1856(gp)
+jal ra,-166
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-14611
+addi t0,a0,0
+beq t0,zero,21
+ld t0,1784(gp)
+ld t1,1752(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1784(gp)
+ld t0,1792(gp)
+ld t1,1760(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1792(gp)
+addi a0,s1,0
+jal ra,-140
+addi s1,s1,1
+jal zero,-29
+lui t0,0xFFFFD
+addi t0,t0,656
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,648
+add a1,gp,t0
+ld a2,1784(gp)
+ld a3,1792(gp)
+jal ra,-206
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-14635
+addi t0,a0,0
+beq t0,zero,21
+ld t0,1800(gp)
+ld t1,1752(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1800(gp)
+ld t0,1808(gp)
+ld t1,1760(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1808(gp)
+addi a0,s1,0
+jal ra,-180
+addi s1,s1,1
+jal zero,-29
+lui t0,0xFFFFD
+addi t0,t0,632
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,624
+add a1,gp,t0
+ld a2,1800(gp)
+ld a3,1808(gp)
+jal ra,-246
+addi s1,zero,1
+addi t0,s1,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+addi a0,s1,0
+jal ra,-14651
+addi t0,a0,0
+beq t0,zero,21
+ld t0,1816(gp)
+ld t1,1752(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1816(gp)
+ld t0,1824(gp)
+ld t1,1760(gp)
+addi t2,s1,0
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,1824(gp)
+addi a0,s1,0
+jal ra,-220
+addi s1,s1,1
+jal zero,-29
+lui t0,0xFFFFD
+addi t0,t0,608
+add a0,gp,t0
+lui t0,0xFFFFD
+addi t0,t0,600
+add a1,gp,t0
+ld a2,1816(gp)
+ld a3,1824(gp)
+jal ra,-286
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,512
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28123
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,448
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-13795
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-13798
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-13773
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-28819
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-13809
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,-13784
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-28804
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-28157
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28880
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28870
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,1088(gp)
+sd t0,32(sp)
+jal ra,-28182
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,320
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1168(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28905
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,1168(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28895
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1800(t0)
+jal ra,-28030
+ld a1,1168(gp)
+jal ra,-28887
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1800(t0)
+jal ra,-28039
+ld a1,1168(gp)
+jal ra,-28870
+addi t0,a0,0
+sd t0,40(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28937
+addi t0,a0,0
+sd t0,48(sp)
+ld a0,1160(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28927
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-28237
+addi sp,sp,56
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,2354
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28960
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,2347
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1824(t0)
+jal ra,-28950
+addi t0,a0,0
+sd t0,24(sp)
+ld a0,1152(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,2337
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-28944
+addi t0,a0,0
+sd t0,32(sp)
+ld a0,1152(gp)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,2326
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-28929
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,1152(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-28288
+addi sp,sp,48
+lui t0,0xFFFFD
+addi t0,t0,200
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1176(gp)
+sd t0,16(sp)
+ld t0,1184(gp)
+sd t0,24(sp)
+jal ra,-28301
+addi sp,sp,24
+ld t0,1200(gp)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28312
+addi sp,sp,8
+ld a0,16(s0)
+jal ra,-5803
+ld t0,1480(gp)
+beq t0,zero,16
+jal ra,-13981
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,24
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28329
+addi sp,sp,8
+jal ra,-13872
+jal zero,62
+jal ra,-13996
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFD
+addi t0,t0,-64
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28344
+addi sp,sp,8
+jal ra,-13887
+ld t0,1016(gp)
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-128
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28357
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,-184
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28367
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-200
+add a0,gp,t0
+ld a1,1672(gp)
+ld a2,1680(gp)
+jal ra,-608
+lui t0,0xFFFFD
+addi t0,t0,-216
+add a0,gp,t0
+ld a1,1688(gp)
+ld a2,1696(gp)
+jal ra,-614
+lui t0,0xFFFFD
+addi t0,t0,-232
+add a0,gp,t0
+ld a1,896(gp)
+ld a2,1704(gp)
+jal ra,-620
+lui t0,0xFFFFD
+addi t0,t0,-248
+add a0,gp,t0
+ld a1,904(gp)
+ld a2,1712(gp)
+jal ra,-626
+jal ra,-492
+ld t0,1104(gp)
+beq t0,zero,51
+lui t0,0xFFFFD
+addi t0,t0,-296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28403
+addi sp,sp,8
+ld a0,1128(gp)
+jal ra,-31093
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,1128(gp)
+jal ra,-31094
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-312
+add a2,gp,t0
+jal ra,-8033
+jal ra,-28914
+ld a0,1120(gp)
+jal ra,-31108
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,1120(gp)
+jal ra,-31109
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+lui t0,0xFFFFD
+addi t0,t0,-328
+add a2,gp,t0
+jal ra,-8048
+ld t0,1112(gp)
+beq t0,zero,10
+lui t0,0xFFFFD
+addi t0,t0,-360
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,1136(gp)
+sd t0,8(sp)
+jal ra,-28443
+addi sp,sp,8
+jal ra,-28940
+lui t0,0xFFFFD
+addi t0,t0,-448
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-28453
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,21
+ld a0,16(s0)
+jal ra,-30797
+addi s1,a0,0
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,15
+addi a0,s1,0
+jal ra,-30797
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s1,0
+jal zero,32
+addi a0,s1,0
+jal ra,-30810
+addi s1,a0,0
+jal zero,-16
+jal ra,-30836
+addi s1,a0,0
+addi t0,s1,0
+ld t1,16(s0)
+sd t1,0(t0)
+addi t0,s1,0
+ld t1,24(s0)
+addi t0,t0,24
+sd t1,0(t0)
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,15
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-30832
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,s1,0
+addi t0,t0,8
+sd t1,0(t0)
+addi a0,s1,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1736(gp)
+ld a1,16(s0)
+jal ra,-71
+addi t0,a0,0
+sd t0,1736(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1736(gp)
+jal ra,-30872
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,5
+ld a0,1736(gp)
+jal ra,-30877
+addi t0,a0,0
+sd t0,1736(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-31670
+addi t0,a0,0
+ld t1,-1056(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+ld a0,16(s0)
+jal ra,-31669
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,30
+ld a0,16(s0)
+jal ra,-31674
+addi t0,a0,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,1744(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31683
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31712
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld t0,976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+divu t0,t0,t1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-28323
+addi t0,a0,0
+sd t0,1744(gp)
+ld t0,1016(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,38
+ld s2,272(gp)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-79
+addi a0,s2,0
+jal ra,-31754
+addi s2,a0,0
+jal zero,-8
+ld t0,256(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,23
+addi s1,zero,0
+addi t0,s1,0
+ld t1,-1128(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,256(gp)
+addi t1,s1,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld s2,0(t0)
+addi t0,s2,0
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-104
+addi a0,s2,0
+jal ra,-31779
+addi s2,a0,0
+jal zero,-8
+addi s1,s1,1
+jal zero,-20
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld a0,16(s0)
+jal ra,-31010
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,944(gp)
+jal ra,-29218
+jal zero,58
+ld a0,16(s0)
+jal ra,-31019
+jal ra,-17
+lui t0,0xFFFFD
+addi t0,t0,-456
+add a0,gp,t0
+jal ra,-29226
+ld a0,16(s0)
+jal ra,-31017
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+ld t1,-8(s0)
+ld t2,968(gp)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,20
+ld t0,-8(s0)
+ld t1,968(gp)
+sub t0,t0,t1
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,1744(gp)
+ld t1,-8(s0)
+ld t2,968(gp)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1480(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+sltu t0,zero,t0
+beq t0,zero,4
+ld a0,-16(s0)
+jal ra,-29262
+jal zero,14
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-464
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-28720
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-28630
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+sltu t0,zero,t0
+beq t0,zero,32
+ld a0,16(s0)
+jal ra,-31077
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,19
+ld a0,16(s0)
+jal ra,-91
+ld t0,56(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-472
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,16(s0)
+jal ra,-31091
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-28755
+addi sp,sp,8
+ld a0,56(gp)
+jal ra,-28665
+jal ra,-29277
+ld a0,16(s0)
+jal ra,-31109
+jal ra,-33
+ld a0,16(s0)
+jal ra,-31109
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-33
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,1720(gp)
+ld a1,-384(gp)
+jal ra,-12338
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+addi a1,zero,0
+jal ra,-30367
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-528
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,1720(gp)
+sd t0,16(sp)
+jal ra,-28820
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal ra,-32378
+jal ra,-217
+jal ra,-32235
+ld t0,1720(gp)
+sd t0,104(gp)
+ld t0,-8(s0)
+sd t0,-400(gp)
+ld a0,1728(gp)
+jal ra,-81
+addi t0,zero,0
+sd t0,104(gp)
+addi t0,zero,1
+sd t0,-400(gp)
+lui t0,0xFFFFD
+addi t0,t0,-592
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,88(gp)
+sd t0,16(sp)
+ld t0,1720(gp)
+sd t0,24(sp)
+jal ra,-28849
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,2032(gp)
+ld t1,2024(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-600
+add a0,gp,t0
+jal ra,-29399
+jal zero,57
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,904(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-608
+add a0,gp,t0
+jal ra,-29412
+jal zero,44
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-616
+add a0,gp,t0
+jal ra,-29425
+jal zero,31
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,888(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-624
+add a0,gp,t0
+jal ra,-29438
+jal zero,18
+ld t0,2032(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,880(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-640
+add a0,gp,t0
+jal ra,-29451
+jal zero,5
+lui t0,0xFFFFD
+addi t0,t0,-648
+add a0,gp,t0
+jal ra,-29456
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,1912(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-30925
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,1912(gp)
+sd t0,-8(s0)
+ld a0,1912(gp)
+jal ra,-30875
+addi t0,a0,0
+sd t0,1912(gp)
+ld t0,-8(s0)
+ld t1,1904(gp)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,0
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,1904(gp)
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,1904(gp)
+ld t1,-8(s0)
+addi t0,t0,8
+sd t1,0(t0)
+ld t0,-8(s0)
+sd t0,1904(gp)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1256(gp)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-28757
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,24
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-30911
+ld t0,-1256(gp)
+ld t1,-16(gp)
+mul a1,t0,t1
+jal ra,-28803
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-28712
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,32
+sd t1,0(t0)
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+divu t0,t0,t1
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-28731
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,32
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-30957
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+mul t0,t0,t1
+ld t1,-48(gp)
+sub a0,t0,t1
+jal ra,-8387
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-30979
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+ld t0,24(s0)
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,101
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-31003
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-31045
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8313
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,72
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-31022
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-31062
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8332
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,80
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-31041
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-31079
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8351
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,88
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-31060
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-31096
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8370
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,96
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+jal ra,-31079
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+jal ra,-31113
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8389
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,104
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,160
+sd t1,0(t0)
+jal zero,13
+ld t0,16(s0)
+ld t1,1408(gp)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,128
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,1936(gp)
+addi t0,t0,136
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,24(s0)
+addi t0,t0,144
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,32(s0)
+addi t0,t0,152
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,168
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,176
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,184
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,1192(gp)
+addi t0,t0,192
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld s1,1904(gp)
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,23
+addi a0,s1,0
+jal ra,-31111
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+addi a0,s1,0
+jal ra,-31116
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s1,0
+jal zero,6
+addi a0,s1,0
+jal ra,-31183
+addi s1,a0,0
+jal zero,-24
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi t0,a0,0
+ld t1,1912(gp)
+sd t1,0(t0)
+addi t0,a0,0
+sd t0,1912(gp)
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-31206
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,13
+ld a0,16(s0)
+jal ra,-31211
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31213
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,8
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-31220
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,17
+ld a0,16(s0)
+jal ra,-31225
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31233
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+ld t0,16(s0)
+addi t1,zero,0
+addi t0,t0,8
+sd t1,0(t0)
+jal zero,5
+ld a0,16(s0)
+jal ra,-31244
+addi t0,a0,0
+sd t0,24(s0)
+ld a0,16(s0)
+jal ra,-55
+ld a0,24(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-403
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,16(s0)
+ld a2,24(s0)
+jal ra,-368
+ld t0,1880(gp)
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,-712
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,1904(gp)
+sd t0,24(sp)
+jal ra,-29355
+addi sp,sp,24
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-146
+addi t0,a0,0
+sd t0,-8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-51
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s1,-8(s0)
+ld t0,16(s0)
+ld t1,1512(gp)
+addi t0,t0,16
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-31276
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,223
+ld a0,16(s0)
+jal ra,-31283
+jal ra,-31326
+addi s1,a0,0
+ld a0,16(s0)
+jal ra,-31284
+addi t0,a0,0
+sd t0,-16(s0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31388
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31351
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8637
+addi s3,zero,0
+ld a0,16(s0)
+jal ra,-31357
+addi s4,a0,0
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31410
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-8666
+addi s5,a0,0
+addi t0,s3,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,16
+addi a0,s1,0
+addi t0,s5,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add a1,t0,t1
+addi t0,s4,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-8669
+addi s3,s3,1
+jal zero,-18
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31418
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31369
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8691
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31436
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31386
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8711
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31454
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31403
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8731
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31472
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31420
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8751
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31490
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31428
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8771
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31508
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31445
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8791
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31526
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31462
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8811
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31544
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31479
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-8831
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+addi t1,a1,0
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,4
+addi a0,a1,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi t0,zero,1
+addi t1,a0,0
+addi t2,a1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,a0,1
+jal zero,4
+addi a0,a1,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,32(s0)
+sltu t0,zero,t0
+beq t0,zero,105
+ld a0,16(s0)
+jal ra,-31588
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+ld a1,24(s0)
+jal ra,-9115
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+ld a0,-8(s0)
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-9096
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-31576
+addi t0,a0,0
+ld t1,-48(gp)
+sub a0,t0,t1
+jal ra,-9019
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t1,t0
+sub t0,t2,t0
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31622
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-75
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31637
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-84
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+jal zero,37
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31653
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-112
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,56
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,24(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-31668
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-121
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,64
+sd t1,0(t0)
+ld t0,1888(gp)
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-776
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+jal ra,-29791
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-56
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd a3,40(sp)
+sd a4,48(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,53
+ld a0,32(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,40(s0)
+jal ra,-9337
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9112
+addi t0,a0,0
+beq t0,zero,35
+ld a0,32(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,32(s0)
+ld a1,24(s0)
+ld a2,40(s0)
+jal ra,-9351
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9054
+addi s1,a0,0
+ld a0,16(s0)
+ld a1,40(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,32(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s1,0
+jal ra,-9173
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9291
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-199
+ld t0,40(s0)
+addi t0,t0,1
+sd t0,40(s0)
+jal zero,-55
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+sd s5,-40(s0)
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-31755
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,304
+ld a0,16(s0)
+jal ra,-31762
+jal ra,-31805
+addi s1,a0,0
+ld a0,16(s0)
+jal ra,-31763
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31870
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9124
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,16
+sd t1,0(t0)
+addi s3,zero,0
+ld a0,16(s0)
+jal ra,-31834
+addi s4,a0,0
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31887
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9143
+addi s5,a0,0
+addi t0,s3,0
+ld t1,-1256(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+addi t0,s4,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi t0,s5,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add a1,t0,t1
+jal ra,-9162
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-23
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31903
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9181
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,112
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31919
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9199
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31935
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9217
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,128
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31951
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9235
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,136
+sd t1,0(t0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-31992
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9250
+addi t0,a0,0
+sd t0,-48(s0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32002
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9262
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32012
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9274
+addi t0,a0,0
+sd t0,-64(s0)
+ld a0,16(s0)
+ld a1,-48(s0)
+addi a2,s1,0
+ld a3,-56(s0)
+ld a4,-64(s0)
+jal ra,-268
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32032
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-64(s0)
+jal ra,-9278
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32039
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9303
+addi t0,a0,0
+sd t0,-56(s0)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32049
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9315
+addi t0,a0,0
+sd t0,-64(s0)
+ld a0,16(s0)
+ld a1,-48(s0)
+addi a2,s1,0
+ld a3,-56(s0)
+ld a4,-64(s0)
+jal ra,-309
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32067
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+ld a2,-56(s0)
+jal ra,-9319
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32061
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9347
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,168
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32077
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9365
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,176
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32093
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9383
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,184
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi a0,s1,0
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-16(s0)
+jal ra,-32109
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-9401
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,192
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-32113
+addi t0,a0,0
+sd t0,1512(gp)
+ld a0,16(s0)
+jal ra,-32114
+addi t0,a0,0
+sd t0,1536(gp)
+ld a0,16(s0)
+jal ra,-32115
+addi t0,a0,0
+sd t0,1544(gp)
+jal ra,-10476
+ld s5,-40(s0)
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32123
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,23
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32135
+addi t1,a0,0
+ld t0,0(sp)
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32139
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32163
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,23
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32175
+addi t1,a0,0
+ld t0,0(sp)
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32179
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32233
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+ld t3,-1296(gp)
+addi t4,zero,8
+mul t3,t3,t4
+add t1,t1,t3
+ld t1,0(t1)
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,17
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1816(t2)
+mul t1,t1,t2
+ld t2,-48(gp)
+sub t1,t1,t2
+ld t2,24(s0)
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32248
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32257
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32281
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t2,zero,1
+sltu t0,t0,t1
+sub t0,t2,t0
+beq t0,zero,18
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32326
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,-1296(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-176
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,18
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-137
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,11
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-99
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-210
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1832(gp)
+addi t0,t0,1
+sd t0,1832(gp)
+addi a0,zero,1
+jal zero,24
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-174
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1848(gp)
+addi t0,t0,1
+sd t0,1848(gp)
+addi a0,zero,1
+jal zero,14
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-139
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1864(gp)
+addi t0,t0,1
+sd t0,1864(gp)
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-253
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1840(gp)
+addi t0,t0,1
+sd t0,1840(gp)
+addi a0,zero,1
+jal zero,24
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-217
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1856(gp)
+addi t0,t0,1
+sd t0,1856(gp)
+addi a0,zero,1
+jal zero,14
+ld a0,1896(gp)
+ld a1,16(s0)
+jal ra,-182
+addi t0,a0,0
+beq t0,zero,6
+ld t0,1872(gp)
+addi t0,t0,1
+sd t0,1872(gp)
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld t0,1968(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,16
+addi t0,zero,1
+ld t1,1152(gp)
+ld t2,1960(gp)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1824(t3)
+add t2,t2,t3
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-25
+addi t0,a0,0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,18
+addi t0,zero,1
+ld t1,1152(gp)
+addi t2,zero,2
+mul t1,t1,t2
+ld t2,1960(gp)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1824(t3)
+add t2,t2,t3
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,1960(gp)
+ld t1,1968(gp)
+sub a0,t0,t1
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,1968(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-44
+addi t0,a0,0
+beq t0,zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+sd t0,1968(gp)
+addi a0,t0,0
+jal ra,-30321
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,1960(gp)
+ld t1,1968(gp)
+add t0,t0,t1
+sd t0,1960(gp)
+ld a0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1800(t0)
+jal ra,-30453
+addi t0,a0,0
+sd t0,1952(gp)
+ld t0,-8(s0)
+ld t1,1952(gp)
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,1968(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t0,t1
+sd t0,1968(gp)
+jal zero,14
+lui t0,0xFFFFD
+addi t0,t0,-816
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-30653
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1136(t0)
+jal ra,-34211
+ld t0,1952(gp)
+sd t0,-16(s0)
+ld t0,1952(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add t0,t0,t1
+sd t0,1952(gp)
+ld t0,1968(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t0,t1
+sd t0,1968(gp)
+ld a0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1800(t0)
+jal ra,-14022
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-32606
+ld a1,24(s0)
+jal ra,-9981
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-10026
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-106
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1055
+ld a0,16(s0)
+jal ra,-32633
+ld a1,24(s0)
+ld a2,32(s0)
+jal ra,-9922
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,24(s0)
+jal ra,-10055
+addi s1,a0,0
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-528
+addi t0,a0,0
+beq t0,zero,34
+ld t0,960(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+remu t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld a0,16(s0)
+ld a1,24(s0)
+ld t0,960(gp)
+addi t1,s1,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-32664
+addi t2,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+sub t1,t1,t2
+add a2,t0,t1
+jal ra,-1114
+jal zero,93
+ld a0,16(s0)
+ld a1,24(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-178
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1127
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add s2,t0,t1
+addi t0,s1,0
+addi t1,s2,0
+sltu t0,t0,t1
+beq t0,zero,72
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-587
+addi t0,a0,0
+beq t0,zero,24
+ld a0,16(s0)
+jal ra,-32719
+addi a1,s1,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32713
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+jal ra,-16135
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-10025
+jal zero,40
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-569
+addi t0,a0,0
+beq t0,zero,35
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32729
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub t0,t0,t1
+ld t1,1000(gp)
+sltu t0,t0,t1
+beq t0,zero,23
+ld a0,16(s0)
+jal ra,-32759
+addi a1,s1,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+addi t0,s1,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32747
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sub a0,t0,t1
+jal ra,-16032
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-10065
+addi t0,s1,0
+ld t1,-48(gp)
+add s1,t0,t1
+jal zero,-74
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-32798
+ld a1,24(s0)
+jal ra,-10173
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-633
+addi t0,a0,0
+beq t0,zero,14
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,24(s0)
+jal ra,-10223
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-177
+ld t0,1176(gp)
+addi t0,t0,1
+sd t0,1176(gp)
+ld a0,16(s0)
+jal ra,-32824
+ld a1,24(s0)
+jal ra,-10199
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2024(t1)
+addi t0,t0,16
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,968(gp)
+jal ra,-10258
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,40
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32856
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,48
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,968(gp)
+addi t0,t0,72
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,976(gp)
+addi t0,t0,80
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,992(gp)
+addi t0,t0,88
+sd t1,0(t0)
+ld t0,16(s0)
+ld t1,1000(gp)
+ld t2,1008(gp)
+add t1,t1,t2
+addi t0,t0,96
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,992(gp)
+ld t1,1000(gp)
+add t0,t0,t1
+ld t1,1008(gp)
+add a0,t0,t1
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1976(t0)
+jal ra,-30800
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,104
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-32877
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,112
+sd t1,0(t0)
+ld t0,1944(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,53
+addi s1,zero,0
+addi t0,s1,0
+ld t1,976(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-32908
+addi t0,a0,0
+addi t1,s1,0
+add a0,t0,t1
+jal ra,-10336
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-290
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add s1,t0,t1
+jal zero,-23
+addi s1,zero,0
+addi t0,s1,0
+ld t1,1000(gp)
+ld t2,1008(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,21
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-32929
+addi t0,a0,0
+addi t1,s1,0
+add a0,t0,t1
+jal ra,-10363
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-317
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add s1,t0,t1
+jal zero,-25
+ld t0,16(s0)
+ld t1,944(gp)
+addi t0,t0,160
+sd t1,0(t0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,24(s0)
+jal ra,-32318
+addi a0,a0,1
+ld a1,-48(gp)
+jal ra,-30896
+addi s1,a0,0
+ld t0,32(s0)
+addi t1,s1,0
+sub t0,t0,t1
+sd t0,32(s0)
+addi s2,zero,0
+addi t0,s2,0
+addi t1,s1,0
+sltu t0,t0,t1
+beq t0,zero,15
+ld a0,16(s0)
+ld t0,32(s0)
+addi t1,s2,0
+add a1,t0,t1
+ld t0,24(s0)
+ld a2,0(t0)
+jal ra,-409
+ld t0,24(s0)
+addi t0,t0,8
+sd t0,24(s0)
+addi t0,s2,0
+ld t1,-48(gp)
+add s2,t0,t1
+jal zero,-17
+ld a0,32(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-40
+sd a0,16(sp)
+sd a1,24(sp)
+sd a2,32(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+mul s1,t0,t1
+ld t0,24(s0)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-30900
+addi s2,a0,0
+addi s3,zero,0
+addi t0,s3,0
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+ld a0,16(s0)
+ld t0,32(s0)
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a1,0(t0)
+addi a2,s1,0
+jal ra,-83
+addi s1,a0,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s1,0
+sd t1,0(t0)
+addi s3,s3,1
+jal zero,-22
+addi t0,s1,0
+ld t1,-48(gp)
+sub s1,t0,t1
+ld a0,16(s0)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-478
+addi t0,s1,0
+ld t1,-48(gp)
+sub s1,t0,t1
+ld a0,16(s0)
+addi a1,s1,0
+addi a2,zero,0
+jal ra,-485
+addi t0,s3,0
+sltu t0,zero,t0
+beq t0,zero,15
+addi t0,s1,0
+ld t1,-48(gp)
+sub s1,t0,t1
+addi s3,s3,-1
+ld a0,16(s0)
+addi a1,s1,0
+addi t0,s2,0
+addi t1,s3,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a2,0(t0)
+jal ra,-501
+jal zero,-16
+addi t0,s1,0
+ld t1,-48(gp)
+sub s1,t0,t1
+ld a0,16(s0)
+addi a1,s1,0
+ld a2,24(s0)
+jal ra,-509
+ld a0,16(s0)
+jal ra,-33112
+addi t0,a0,0
+ld t1,-1296(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s1,0
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-33121
+addi t0,a0,0
+ld t1,-1344(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,1408(gp)
+addi t0,t0,120
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-33148
+addi t0,a0,0
+ld t1,-1416(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1912(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,928(t0)
+jal ra,2200
+ld a0,16(s0)
+jal ra,-9820
+addi t0,a0,0
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-10164
+jal zero,3
+ld a0,16(s0)
+jal ra,-12331
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,928(t0)
+jal ra,2232
+jal zero,112
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,952(t0)
+jal ra,2174
+ld a0,16(s0)
+jal ra,-13525
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,952(t0)
+jal ra,2213
+jal zero,93
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1928(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,944(t0)
+jal ra,2155
+ld a0,16(s0)
+jal ra,-13239
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,944(t0)
+jal ra,2194
+jal zero,74
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,936(t0)
+jal ra,2136
+ld a0,16(s0)
+jal ra,-12801
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,936(t0)
+jal ra,2175
+jal zero,55
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1904(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-12263
+jal zero,44
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,960(t0)
+jal ra,2106
+ld a0,16(s0)
+jal ra,-13700
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,960(t0)
+jal ra,2145
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1224(t0)
+jal zero,23
+lui t0,0xFFFFD
+addi t0,t0,-848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-31362
+addi sp,sp,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1112(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1224(t0)
+jal zero,2
+ld a0,1928(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,1408(gp)
+addi t0,t0,120
+sd t1,0(t0)
+ld a0,16(s0)
+jal ra,-33270
+addi t0,a0,0
+sd t0,-8(s0)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-10716
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1190
+addi t0,a0,0
+beq t0,zero,8
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-681
+ld t0,1176(gp)
+addi t0,t0,1
+sd t0,1176(gp)
+jal zero,83
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-10735
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1163
+addi t0,a0,0
+beq t0,zero,38
+ld a0,-8(s0)
+jal ra,-10744
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,16(s0)
+jal ra,-33325
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t2,1000(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+ld a0,16(s0)
+ld a1,-8(s0)
+jal ra,-714
+ld t0,1176(gp)
+addi t0,t0,1
+sd t0,1176(gp)
+jal zero,16
+ld a0,16(s0)
+ld a1,-8(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-847
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1796
+ld t0,1184(gp)
+addi t0,t0,1
+sd t0,1184(gp)
+jal zero,34
+ld a0,16(s0)
+ld a1,-8(s0)
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,-863
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1812
+ld t0,1184(gp)
+addi t0,t0,1
+sd t0,1184(gp)
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,-8(s0)
+jal ra,-10799
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-1136
+addi t0,a0,0
+beq t0,zero,7
+ld t0,1168(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+add t0,t0,t1
+sd t0,1168(gp)
+ld a0,1928(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,1408(gp)
+addi t0,t0,120
+sd t1,0(t0)
+ld t0,1456(gp)
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-888
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-31519
+addi sp,sp,8
+jal ra,-5435
+ld t0,16(s0)
+ld t1,1936(gp)
+addi t0,t0,136
+sd t1,0(t0)
+jal zero,16
+lui t0,0xFFFFD
+addi t0,t0,-912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-31534
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1128(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1224(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,a0,0
+ld t1,1408(gp)
+addi t0,t0,120
+sd t1,0(t0)
+ld a0,1928(gp)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+jal ra,-33445
+addi t0,a0,0
+sd t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-355
+jal zero,69
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-205
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1432(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-95
+jal zero,47
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld a0,16(s0)
+jal ra,-57
+jal zero,36
+lui t0,0xFFFFD
+addi t0,t0,-960
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,16(s0)
+jal ra,-33484
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-31620
+addi sp,sp,16
+ld a0,-8(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,16(s0)
+jal ra,-33505
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-5379
+jal ra,-32127
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+addi t0,t0,136
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1224(t0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-33584
+addi s1,a0,0
+addi t0,s1,0
+ld t1,16(s0)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,21
+addi t0,s1,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld s1,1904(gp)
+jal zero,14
+addi a0,s1,0
+jal ra,-33544
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,s1,0
+jal zero,6
+addi a0,s1,0
+jal ra,-33608
+addi s1,a0,0
+jal zero,-24
+ld a0,16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-976
+add a0,gp,t0
+jal ra,-32232
+lui t0,0xFFFFD
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-31710
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s1,1400(t0)
+addi t0,zero,1
+beq t0,zero,50
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-12225
+addi s2,a0,0
+addi a0,s2,0
+jal ra,-33595
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-33602
+addi t0,a0,0
+sd t0,16(s0)
+ld s1,1504(gp)
+jal zero,32
+addi a0,s2,0
+jal ra,-86
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,s2,0
+jal ra,-183
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,s2,0
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,s2,0
+jal ra,-33631
+jal zero,11
+addi a0,s2,0
+ld a1,1904(gp)
+jal ra,-2487
+addi t0,a0,0
+sd t0,1904(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s1,1400(t0)
+jal zero,-50
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1080
+add a0,gp,t0
+jal ra,-32314
+lui t0,0xFFFFD
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-31792
+addi sp,sp,8
+addi t0,zero,1
+beq t0,zero,36
+ld a0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1400(t0)
+jal ra,-35318
+addi s1,a0,0
+addi a0,s1,0
+jal ra,-154
+addi t0,a0,0
+sd t0,16(s0)
+addi a0,s1,0
+jal ra,-251
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,s1,0
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,s1,0
+jal ra,-33699
+jal zero,8
+addi a0,s1,0
+ld a1,1904(gp)
+jal ra,-2555
+addi t0,a0,0
+sd t0,1904(gp)
+jal zero,-36
+addi a0,zero,0
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1208
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,100
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-31859
+addi sp,sp,16
+lui t0,0xFFFFD
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-31868
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s1,1400(t0)
+addi t0,zero,1
+ld t1,16(gp)
+addi t2,zero,100
+divu t1,t1,t2
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,7
+addi t0,s1,0
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu s1,t0,t1
+jal zero,21
+addi t0,zero,1
+ld t1,16(gp)
+addi t2,zero,10
+divu t1,t1,t2
+addi t2,s1,0
+sltu t1,t1,t2
+sub t0,t0,t1
+beq t0,zero,8
+addi t0,s1,0
+addi t1,zero,10
+divu t0,t0,t1
+ld t2,24(s0)
+divu t1,t2,t1
+mul s1,t0,t1
+jal zero,6
+addi t0,s1,0
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul s1,t0,t1
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+addi s2,s1,0
+jal zero,6
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s2,1400(t0)
+addi t0,zero,1
+beq t0,zero,64
+ld t0,24(s0)
+beq t0,zero,6
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-12431
+addi s3,a0,0
+jal zero,5
+ld a0,16(s0)
+addi a1,s2,0
+jal ra,-35448
+addi s3,a0,0
+addi a0,s3,0
+jal ra,-33806
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,s3,0
+jal ra,-33813
+addi t0,a0,0
+sd t0,16(s0)
+ld s2,1504(gp)
+jal zero,39
+addi a0,s3,0
+jal ra,-390
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,s3,0
+jal ra,-33832
+jal zero,28
+addi t0,s3,0
+sd t0,16(s0)
+ld t0,24(s0)
+beq t0,zero,16
+addi t0,s1,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,8
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+addi t1,s1,0
+sub s2,t0,t1
+jal zero,7
+addi t0,s1,0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+sd t0,24(s0)
+addi s2,s1,0
+jal zero,-64
+addi a0,zero,0
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s1,1400(t0)
+addi t0,zero,1
+beq t0,zero,95
+ld a0,16(s0)
+addi a1,s1,0
+jal ra,-12515
+addi s2,a0,0
+addi a0,s2,0
+jal ra,-33885
+addi t0,a0,0
+ld t1,1920(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,7
+addi a0,s2,0
+jal ra,-33892
+addi t0,a0,0
+sd t0,16(s0)
+ld s1,1504(gp)
+jal zero,77
+addi a0,s2,0
+jal ra,-33907
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,24(s0)
+beq t0,zero,4
+jal ra,-1488
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,24(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+addi a0,s2,0
+jal ra,-33926
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFD
+addi t0,t0,-1344
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi a0,s2,0
+jal ra,-33928
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-32064
+addi sp,sp,16
+addi a0,s2,0
+jal ra,-33949
+addi sp,sp,-8
+sd a0,0(sp)
+addi a0,s2,0
+jal ra,-33950
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+jal ra,-5824
+jal ra,-32572
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1088(t0)
+jal zero,21
+addi a0,s2,0
+jal ra,-527
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi a0,s2,0
+jal ra,-33969
+jal zero,8
+addi t0,s2,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld s1,1400(t0)
+jal zero,-95
+addi a0,zero,0
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-1360
+add a0,gp,t0
+jal ra,-32647
+lui t0,0xFFFFD
+addi t0,t0,-1448
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-32125
+addi sp,sp,8
+ld a0,16(s0)
+addi a1,zero,1
+jal ra,-136
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-1464
+add a0,gp,t0
+jal ra,-32673
+lui t0,0xFFFFD
+addi t0,t0,-1552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-32151
+addi sp,sp,8
+ld a0,16(s0)
+addi a1,zero,0
+jal ra,-162
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-1250
+ld a0,944(gp)
+jal ra,459
+ld a0,16(s0)
+addi sp,sp,-8
+sd a0,0(sp)
+jal ra,402
+addi t0,a0,0
+ld a0,0(sp)
+addi sp,sp,8
+addi a1,t0,0
+addi sp,sp,-16
+sd a1,8(sp)
+sd a0,0(sp)
+jal ra,396
+addi t0,a0,0
+ld a0,0(sp)
+ld a1,8(sp)
+addi sp,sp,16
+addi a2,t0,0
+jal ra,-1079
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+ld t0,976(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,-1600
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-32211
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal zero,353
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,2032(gp)
+ld t1,2024(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,-1640
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-32237
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal zero,327
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,968(t0)
+jal ra,1202
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1024(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-12622
+addi t0,zero,1
+sd t0,1104(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(s0)
+jal zero,17
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sd t0,1480(gp)
+addi t0,zero,0
+sd t0,1720(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(s0)
+jal ra,-34478
+jal ra,-34280
+jal ra,-34133
+addi a0,zero,0
+jal ra,296
+jal ra,-33334
+jal ra,-34936
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,1944(gp)
+jal zero,3
+addi t0,zero,1
+sd t0,1944(gp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1072(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1008(t1)
+addi s2,zero,0
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1008(t1)
+sltu t0,t0,t1
+beq t0,zero,14
+ld a0,1920(gp)
+addi a1,zero,0
+jal ra,-3005
+addi t0,a0,0
+sd t0,1896(gp)
+addi a0,t0,0
+jal ra,-176
+ld t0,1200(gp)
+beq t0,zero,3
+ld a0,1896(gp)
+jal ra,-10770
+addi s2,s2,1
+jal zero,-18
+addi t0,zero,1
+sd t0,1432(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1696
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,944(gp)
+sd t0,16(sp)
+ld t0,1152(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-32361
+addi sp,sp,24
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1008(t1)
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+sd t0,8(sp)
+jal ra,-32378
+addi sp,sp,8
+ld t0,1200(gp)
+beq t0,zero,25
+lui t0,0xFFFFD
+addi t0,t0,-1752
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+sd t0,8(sp)
+jal ra,-32391
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+beq t0,zero,6
+lui t0,0xFFFFD
+addi t0,t0,-1768
+add a0,gp,t0
+jal ra,-32930
+jal zero,5
+lui t0,0xFFFFD
+addi t0,t0,-1792
+add a0,gp,t0
+jal ra,-32935
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+sd t0,1440(gp)
+addi t0,zero,1
+sd t0,1448(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1808
+add a0,gp,t0
+jal ra,-32951
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(s0)
+jal zero,22
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+addi t0,zero,1
+sd t0,1440(gp)
+addi t0,zero,1
+sd t0,1456(gp)
+jal ra,-34809
+lui t0,0xFFFFD
+addi t0,t0,-1824
+add a0,gp,t0
+jal ra,-32973
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1832
+add a0,gp,t0
+jal ra,-32981
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1072(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,1896(gp)
+jal ra,-770
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,45
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1040(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,1896(gp)
+jal ra,-365
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,32
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,1896(gp)
+jal ra,-352
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld a0,1896(gp)
+jal ra,-726
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,6
+ld a0,1896(gp)
+addi a1,zero,0
+jal ra,-668
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,968(t0)
+jal ra,981
+addi t0,zero,0
+sd t0,1456(gp)
+addi t0,zero,0
+sd t0,1448(gp)
+addi t0,zero,0
+sd t0,1440(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1880
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld a0,1896(gp)
+jal ra,-34394
+addi t0,a0,0
+sd t0,16(sp)
+ld a0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-33938
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-32537
+addi sp,sp,24
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,8
+ld a0,1896(gp)
+jal ra,-4436
+ld t0,1728(gp)
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-3755
+jal zero,14
+ld t0,1200(gp)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+jal ra,-32562
+addi sp,sp,8
+ld a0,1896(gp)
+jal ra,-10053
+addi t0,zero,0
+sd t0,1432(gp)
+ld a0,-8(s0)
+ld s2,-16(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+ld a0,1976(gp)
+jalr zero,0(ra)
+ld a0,1984(gp)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-9
+addi t0,a0,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,8
+ld t0,1984(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld a0,0(t0)
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-16
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi a0,zero,0
+jal ra,-30
+addi t0,a0,0
+sd t0,1992(gp)
+jal ra,-37
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,1976(gp)
+addi t0,t0,-1
+sd t0,1976(gp)
+ld t0,1984(gp)
+addi t0,t0,8
+sd t0,1984(gp)
+ld a0,1992(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+ld t0,1984(gp)
+addi t1,a0,0
+sd t1,0(t0)
+jalr zero,0(ra)
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,24
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,14
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi a0,zero,1
+jal zero,4
+addi a0,zero,0
+jal zero,2
+addi a0,zero,0
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,2024
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-32680
+addi sp,sp,16
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-117
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,255
+jal ra,-92
+jal ra,-9956
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,2016
+add a1,gp,t0
+jal ra,-33810
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-19802
+jal zero,243
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,2008
+add a1,gp,t0
+jal ra,-33819
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+sd t0,440(gp)
+jal zero,233
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,2000
+add a1,gp,t0
+jal ra,-33829
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,440(gp)
+jal zero,223
+jal ra,-152
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal zero,216
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1992
+add a1,gp,t0
+jal ra,-33848
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-139
+jal ra,-16260
+jal zero,204
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1984
+add a1,gp,t0
+jal ra,-33858
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-149
+jal ra,-15776
+jal zero,194
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1976
+add a1,gp,t0
+jal ra,-33868
+addi t0,a0,0
+beq t0,zero,4
+addi a0,zero,0
+jal ra,-6845
+jal zero,184
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1968
+add a1,gp,t0
+jal ra,-33878
+addi t0,a0,0
+beq t0,zero,4
+addi a0,zero,1
+jal ra,-6855
+jal zero,174
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1960
+add a1,gp,t0
+jal ra,-33888
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-16067
+jal zero,165
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1952
+add a1,gp,t0
+jal ra,-33897
+addi t0,a0,0
+beq t0,zero,5
+jal ra,-188
+addi t0,a0,0
+sd t0,1720(gp)
+jal zero,154
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1944
+add a1,gp,t0
+jal ra,-33908
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-199
+jal ra,438
+jal zero,144
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1936
+add a1,gp,t0
+jal ra,-33918
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-209
+jal ra,-33864
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1008(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1008(t1)
+jal zero,120
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,112
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1928
+add a1,gp,t0
+jal ra,-33946
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1072(t0)
+jal ra,-651
+jal zero,106
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1920
+add a1,gp,t0
+jal ra,-33958
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1064(t0)
+jal ra,-663
+jal zero,94
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1912
+add a1,gp,t0
+jal ra,-33970
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1056(t0)
+jal ra,-675
+jal zero,82
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1904
+add a1,gp,t0
+jal ra,-33982
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1048(t0)
+jal ra,-687
+jal zero,70
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1896
+add a1,gp,t0
+jal ra,-33994
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1040(t0)
+jal ra,-699
+jal zero,58
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1888
+add a1,gp,t0
+jal ra,-34006
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1032(t0)
+jal ra,-711
+jal zero,46
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1880
+add a1,gp,t0
+jal ra,-34018
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1024(t0)
+jal ra,-723
+jal zero,34
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1872
+add a1,gp,t0
+jal ra,-34030
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1016(t0)
+jal ra,-735
+jal zero,22
+ld a0,1992(gp)
+lui t0,0xFFFFC
+addi t0,t0,1864
+add a1,gp,t0
+jal ra,-34042
+addi t0,a0,0
+beq t0,zero,4
+jal ra,-333
+jal ra,202
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal zero,8
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1200(t0)
+jal zero,3
+jal zero,-257
+ld a0,1936(gp)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi t0,zero,0
+sd t0,440(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1752(t1)
+addi t0,zero,1
+lui t1,0xFFFFF
+add t1,gp,t1
+sd t0,1008(t1)
+addi t0,zero,0
+sd t0,1720(gp)
+addi t0,zero,0
+sd t0,1480(gp)
+addi t0,zero,0
+sd t0,1104(gp)
+addi t0,zero,0
+sd t0,976(gp)
+addi t0,zero,0
+sd t0,1000(gp)
+addi t0,zero,0
+sd t0,1008(gp)
+addi t0,zero,0
+sd t0,1048(gp)
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+sd s4,-32(s0)
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+addi t0,zero,0
+sd t0,1976(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-32771
+addi t0,a0,0
+sd t0,1984(gp)
+ld a0,-16(gp)
+jal ra,-32775
+addi s1,a0,0
+addi s3,zero,0
+addi s4,zero,0
+addi t0,zero,1
+beq t0,zero,121
+addi t0,s1,0
+addi t1,zero,0
+sd t1,0(t0)
+ld a0,16(s0)
+addi a1,s1,0
+addi a2,zero,1
+jal ra,-36567
+addi t0,a0,-1
+sltu t0,zero,t0
+beq t0,zero,4
+ld t0,1976(gp)
+sltu a0,zero,t0
+jal zero,109
+addi t0,s1,0
+ld s2,0(t0)
+addi t0,s2,0
+ld t1,-96(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,1976(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,1
+jal zero,96
+jal zero,93
+addi t0,s2,0
+ld t1,-112(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s3,zero,0
+jal zero,85
+addi t0,s2,0
+ld t1,-88(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi s3,zero,0
+jal zero,77
+addi t0,s2,0
+ld t1,-104(gp)
+sub t0,t0,t1
+sltu t0,zero,t0
+beq t0,zero,72
+addi t0,s3,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,1976(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1000(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFC
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+sd t0,16(sp)
+jal ra,-33081
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal ra,-36639
+ld a0,-288(gp)
+jal ra,-34347
+addi s3,a0,0
+addi s4,zero,0
+ld t0,1984(gp)
+ld t1,1976(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,s3,0
+sd t1,0(t0)
+ld t0,1976(gp)
+addi t0,t0,1
+sd t0,1976(gp)
+addi t0,s4,0
+ld t1,-288(gp)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFC
+addi t0,t0,1776
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+ld t0,-288(gp)
+sd t0,24(sp)
+jal ra,-33118
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal ra,-36676
+addi a0,s3,0
+addi a1,s4,0
+addi a2,s2,0
+jal ra,-34452
+addi s4,s4,1
+jal zero,-121
+addi a0,zero,0
+ld s4,-32(s0)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+sd s3,-24(s0)
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,16(s0)
+jal ra,-20265
+addi s1,a0,0
+addi a0,s1,0
+addi a1,zero,0
+jal ra,-34713
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFC
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-33166
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1184(t0)
+jal zero,63
+lui t0,0xFFFFC
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-33181
+addi sp,sp,16
+addi s3,zero,0
+addi a0,s1,0
+jal ra,-202
+addi t0,a0,0
+beq t0,zero,33
+jal ra,-232
+addi a0,zero,0
+jal ra,-503
+addi s2,a0,0
+addi a0,s2,0
+jal ra,-561
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFC
+addi t0,t0,1656
+add a0,gp,t0
+jal ra,-533
+addi s3,s3,1
+lui t0,0xFFFFC
+addi t0,t0,1608
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+addi a0,s2,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-34618
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-33217
+addi sp,sp,24
+jal zero,-35
+lui t0,0xFFFFC
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+addi t0,s3,0
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-33231
+addi sp,sp,24
+ld a0,1936(gp)
+ld s3,-24(s0)
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+sd t0,2040(gp)
+ld t0,2016(gp)
+sltu t0,zero,t0
+beq t0,zero,2
+jal zero,166
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-32(gp)
+mul a0,t0,t1
+jal ra,-33029
+addi t0,a0,0
+sd t0,2016(gp)
+ld t1,2008(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1568
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,992(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1560
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1552
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,976(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1536
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,968(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1528
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1520
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1512
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,944(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1504
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,936(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1496
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,2016(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFC
+addi t1,t1,1488
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-33073
+addi t0,a0,0
+lui t1,0x1
+add t1,gp,t1
+sd t0,-2048(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-33083
+addi t0,a0,0
+lui t1,0x1
+add t1,gp,t1
+sd t0,-2040(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-33093
+addi t0,a0,0
+lui t1,0x1
+add t1,gp,t1
+sd t0,-2032(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-33103
+addi t0,a0,0
+lui t1,0x1
+add t1,gp,t1
+sd t0,-2024(t1)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+ld t1,-16(gp)
+mul a0,t0,t1
+jal ra,-33113
+addi t0,a0,0
+lui t1,0x1
+add t1,gp,t1
+sd t0,-2016(t1)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+ld a1,80(gp)
+jal ra,-36951
+addi t0,a0,0
+sltu t0,zero,t0
+beq t0,zero,3
+addi a0,zero,0
+jal zero,8
+ld t0,80(gp)
+ld t1,0(t0)
+lui t2,0x3B9AD
+addi t2,t2,-1536
+mul t1,t1,t2
+ld t0,8(t0)
+add a0,t1,t0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,2040(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,31
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2024(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-368(gp)
+jal ra,-45
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2016(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-376(gp)
+jal ra,-60
+addi t1,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,2040(gp)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,92
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2040(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0x1
+add t1,gp,t1
+ld t1,-2040(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-368(gp)
+jal ra,-100
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+lui t3,0x1
+add t3,gp,t3
+ld t3,-2024(t3)
+ld t4,16(s0)
+addi t5,zero,8
+mul t4,t4,t5
+add t3,t3,t4
+ld t3,0(t3)
+sub t2,t2,t3
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2032(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0x1
+add t1,gp,t1
+ld t1,-2032(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld a0,-376(gp)
+jal ra,-137
+addi t2,a0,0
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+lui t3,0x1
+add t3,gp,t3
+ld t3,-2016(t3)
+ld t4,16(s0)
+addi t5,zero,8
+mul t4,t4,t5
+add t3,t3,t4
+ld t3,0(t3)
+sub t2,t2,t3
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2048(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0x1
+add t1,gp,t1
+ld t1,-2048(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t1,t1,1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+sd s2,-16(s0)
+sd s1,-8(s0)
+ld a0,2040(gp)
+ld a1,-384(gp)
+jal ra,-17144
+addi s1,a0,0
+addi a0,s1,0
+addi a1,zero,0
+jal ra,-35172
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFC
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,2040(gp)
+sd t0,16(sp)
+jal ra,-33625
+addi sp,sp,16
+jal zero,126
+addi t0,s1,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1416
+add t0,gp,t0
+sd t0,8(sp)
+ld a0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a1,1080(t0)
+jal ra,-35043
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-33596
+addi sp,sp,8
+addi s2,zero,0
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,920(t1)
+sltu t0,t0,t1
+beq t0,zero,84
+addi t0,s2,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,s1,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1400
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-33616
+jal zero,26
+addi t0,s2,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,912(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,s1,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1376
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-33633
+jal zero,9
+addi t0,s1,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1368
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-33642
+addi t0,s1,0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1304
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,2016(gp)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2048(t0)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2040(t0)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,32(sp)
+lui t0,0x1
+add t0,gp,t0
+ld t0,-2032(t0)
+addi t1,s2,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,40(sp)
+jal ra,-33684
+addi sp,sp,32
+addi s2,s2,1
+jal zero,-88
+addi t0,s1,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1296
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-33695
+lui t0,0xFFFFC
+addi t0,t0,1256
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,2040(gp)
+sd t0,16(sp)
+jal ra,-33751
+addi sp,sp,16
+ld s2,-16(s0)
+ld s1,-8(s0)
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-24
+sd a0,16(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1190
+addi t0,a0,0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1216(t0)
+jal zero,36
+lui t0,0xFFFFC
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,0(gp)
+sd t0,16(sp)
+jal ra,-33783
+addi sp,sp,16
+lui t0,0xFFFFC
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,2000(gp)
+sd t0,8(sp)
+ld t0,-24(gp)
+sd t0,16(sp)
+ld t0,-40(gp)
+sd t0,24(sp)
+jal ra,-33796
+addi sp,sp,24
+jal ra,-4942
+jal ra,-34294
+jal ra,-37205
+jal ra,-36799
+jal ra,-36783
+jal ra,-36369
+jal ra,-36117
+ld a0,16(s0)
+jal ra,-1119
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+ld a0,16(s0)
+jal ra,-1189
+addi t0,a0,0
+beq t0,zero,3
+ld a0,24(s0)
+jal ra,-1159
+ld t0,2040(gp)
+sltu t0,zero,t0
+beq t0,zero,3
+ld a0,16(s0)
+jal ra,-231
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld a0,1208(t0)
+jal zero,14
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+sub t0,t0,t1
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld a0,1936(gp)
+jal zero,4
+ld a0,16(s0)
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-32
+sd a0,16(sp)
+sd a1,24(sp)
+sd ra,8(sp)
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld a0,16(s0)
+ld a1,24(s0)
+jal ra,-35702
+jal ra,-37385
+jal ra,-35686
+addi a0,zero,0
+jal ra,-114
+addi t0,a0,0
+sd t0,-8(s0)
+addi a0,t0,0
+lui t0,0xFFFFC
+addi t0,t0,1104
+add a1,gp,t0
+jal ra,-67
+addi sp,s0,0
+ld s0,0(sp)
+ld ra,8(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x696D6974203A7325
+.8byte 0x616D6D757320676E
+.8byte 0x7474697277207972
+.8byte 0x206F746E69206E65
+.8byte 0xA7325
+.8byte 0xA7D0A7D20200A
+.8byte 0x2273252220202020
+.8byte 0x756F6322207B203A
+.8byte 0x756C25203A22746E
+.8byte 0x5F6C6C617722202C
+.8byte 0x756C25203A22736E
+.8byte 0x6E5F75706322202C
+.8byte 0x20756C25203A2273
+.8byte 0x7D
+.8byte 0xA2C
+.8byte 0x20200A2C7D20200A
+.8byte 0x6C6C616373797322
+.8byte 0xA7B203A2273
+.8byte 0x6573616870222020
+.8byte 0xA7B203A2273
+.8byte 0x6978652220200A7B
+.8byte 0x3A2265646F635F74
+.8byte 0xA2C646C2520
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6D69742065746165
+.8byte 0x7074756F20676E69
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x6B7262
+.8byte 0x74616E65706F
+.8byte 0x6574697277
+.8byte 0x64616572
+.8byte 0x74697865
+.8byte 0x6E7572
+.8byte 0x6D65737361736964
+.8byte 0x656C62
+.8byte 0x64616F6C
+.8byte 0x74757074756F
+.8byte 0x656C69706D6F63
+.8byte 0x20756C25203A7325
+.8byte 0x7265732073626F6A
+.8byte 0x6D6F726620646576
+.8byte 0xA732520
+.8byte 0x20626F6A203A7325
+.8byte 0x6D72657420756C25
+.8byte 0x7720646574616E69
+.8byte 0x7469786520687469
+.8byte 0x6C252065646F6320
+.8byte 0xA64
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x666C6573203A7325
+.8byte 0x6976726573206569
+.8byte 0x2073626F6A20676E
+.8byte 0xA7325206D6F7266
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x2073626F6A206E65
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x20626F6A203A7325
+.8byte 0x746E656D75677261
+.8byte 0x676E6F6C20732520
+.8byte 0x206E616874207265
+.8byte 0x7261686320756C25
+.8byte 0xA737265746361
+.8byte 0x20626F6A203A7325
+.8byte 0x726F6D2068746977
+.8byte 0x25206E6168742065
+.8byte 0x6D7567726120756C
+.8byte 0xA73746E65
+.8byte 0x65767265732D
+.8byte 0x6E61656C2D
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x782D
+.8byte 0x742D
+.8byte 0x702D
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6A2D
+.8byte 0x6F2D
+.8byte 0x304F2D
+.8byte 0x4F2D
+.8byte 0x632D
+.8byte 0x736973706F6E7973
+.8byte 0x2D207B207325203A
+.8byte 0x72756F73207B2063
+.8byte 0x6A626F207C206563
+.8byte 0x207C207D20746365
+.8byte 0x72616E6962206F2D
+.8byte 0x6F206A2D207C2079
+.8byte 0x207C207463656A62
+.8byte 0x2D207C20732D2028
+.8byte 0x6573736120292053
+.8byte 0x2D207C20796C626D
+.8byte 0x7972616E6962206C
+.8byte 0xA73257D20
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x666C6573203A7325
+.8byte 0x696D726574206569
+.8byte 0x2520676E6974616E
+.8byte 0x6520687469772073
+.8byte 0x65646F6320746978
+.8byte 0xA646C2520
+.8byte 0x206E6F20
+.8byte 0x79616C706572202C
+.8byte 0x0
+.8byte 0x676775626564202C
+.8byte 0x7265
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x20756C25206E6920
+.8byte 0x73747865746E6F63
+.8byte 0x0
+.8byte 0x666C6573203A7325
+.8byte 0x7563657865206569
+.8byte 0x20732520676E6974
+.8byte 0x756C252068746977
+.8byte 0x697379687020424D
+.8byte 0x6F6D656D206C6163
+.8byte 0x7972
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x73252E7325
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473626F6D
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA726574736E696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0x282072657478696D
+.8byte 0x696D202525756C25
+.8byte 0x6C252F7265747370
+.8byte 0x7370796820252575
+.8byte 0xA29726574
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA72657473707968
+.8byte 0x0
+.8byte 0x3E3E3E3E203A7325
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA3E3E3E3E
+.8byte 0xA7265747370696D
+.8byte 0x0
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0x3025783020747865
+.8byte 0xA586C38
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x3830257830207478
+.8byte 0x746165726320586C
+.8byte 0x646C696863206465
+.8byte 0x747865746E6F6320
+.8byte 0x586C383025783020
+.8byte 0xA
+.8byte 0x6E776F6E6B6E75
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x6F6620666F207372
+.8byte 0x6C6163206465646C
+.8byte 0x736B63617473206C
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6C61632065746165
+.8byte 0x206B63617473206C
+.8byte 0x20656C69666F7270
+.8byte 0x662074757074756F
+.8byte 0xA732520656C69
+.8byte 0x756C2520
+.8byte 0x586C257830
+.8byte 0x3B
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6120726F6A616D20
+.8byte 0x6D20756C2520646E
+.8byte 0x67617020726F6E69
+.8byte 0x73746C7561662065
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6D2029424D756C25
+.8byte 0x656D206465707061
+.8byte 0xA79726F6D
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x20666F202525756C
+.8byte 0x6C322E252E756C25
+.8byte 0x7463612029424D75
+.8byte 0x636120796C6C6175
+.8byte 0xA646573736563
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0xA73
+.8byte 0x6D6D7573203A7325
+.8byte 0x756C25203A797261
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x73706F6E20252575
+.8byte 0xA5D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x0
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x6F74206465766173
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x0
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x0
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x0
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x0
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x29
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x3025783020747865
+.8byte 0x6F72687420586C38
+.8byte 0x7065637865207377
+.8byte 0x203A6E6F6974
+.8byte 0x20
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x7463757274736E69
+.8byte 0x646E6120736E6F69
+.8byte 0x74796220756C2520
+.8byte 0x616420666F207365
+.8byte 0x7474697277206174
+.8byte 0x206F746E69206E65
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x302065747962342E
+.8byte 0x586C2578
+.8byte 0x302065747962382E
+.8byte 0x586C2578
+.8byte 0x203A
+.8byte 0x20
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x7325
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x2C
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x2C
+.8byte 0x202D7C203A
+.8byte 0x5D586C2578305B
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x5D586C2578305B
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x2D7C20
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x646C25
+.8byte 0x5B6D656D202D7C20
+.8byte 0x3D3D5D586C257830
+.8byte 0x586C257830
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x203E2D20
+.8byte 0x2D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x646C253D3D5D586C
+.8byte 0x202D7C20
+.8byte 0x2578305B6D656D2C
+.8byte 0x2578303D3D5D586C
+.8byte 0x202D7C20586C
+.8byte 0x203A
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x203E2D20
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x61735F6863746566
+.8byte 0x696765725F646576
+.8byte 0x7372657473
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x20626C74203A7325
+.8byte 0xA3A737365636361
+.8byte 0x203A726464617620
+.8byte 0xA586C3830257830
+.8byte 0x30203A6567617020
+.8byte 0x200A586C34302578
+.8byte 0x30203A656D617266
+.8byte 0x200A586C38302578
+.8byte 0x30203A7264646170
+.8byte 0xA586C38302578
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x6F72662064656863
+.8byte 0x7865746E6F63206D
+.8byte 0x6C38302578302074
+.8byte 0x6E6F63206F742058
+.8byte 0x2578302074786574
+.8byte 0x586C3830
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x675F6B636F6C6328
+.8byte 0x3A29656D69747465
+.8byte 0x20
+.8byte 0x65675F6B636F6C63
+.8byte 0x656D697474
+.8byte 0x203E2D20
+.8byte 0x202D7C20
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C617A
+.8byte 0x636F6C6C616D
+.8byte 0x203E2D20
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x736920656D616E20
+.8byte 0x6E6F6C206F6F7420
+.8byte 0x6464612074612067
+.8byte 0x2578302073736572
+.8byte 0xA586C3830
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x64696C61766E6920
+.8byte 0xA
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x69206E61206E6920
+.8byte 0x732064696C61766E
+.8byte 0xA746E656D6765
+.8byte 0x6E65706F203A7325
+.8byte 0x656C696620676E69
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x656C696620656874
+.8byte 0x646120656D616E20
+.8byte 0x7830207373657264
+.8byte 0x736920586C383025
+.8byte 0x657070616D6E7520
+.8byte 0xA64
+.8byte 0x6E65706F
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74697277203A7325
+.8byte 0x6D6F726620676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0xA64696C61766E
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x6920736920737365
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x64616572203A7325
+.8byte 0x6F746E6920676E69
+.8byte 0x6C61757472697620
+.8byte 0x7373657264646120
+.8byte 0x586C383025783020
+.8byte 0x2064656C69616620
+.8byte 0x2065737561636562
+.8byte 0x7264646120656874
+.8byte 0x7520736920737365
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x2C
+.8byte 0x2C
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0x65207325203A7325
+.8byte 0x7720676E69746978
+.8byte 0x7469786520687469
+.8byte 0x6C252065646F6320
+.8byte 0xA64
+.8byte 0x3C3C3C3C203A7325
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x20756C25203A7325
+.8byte 0x7463757274736E69
+.8byte 0x6C25202C736E6F69
+.8byte 0x2073657479622075
+.8byte 0x2C6174616420666F
+.8byte 0x756C2520646E6120
+.8byte 0x736C6F626D797320
+.8byte 0x20646564616F6C20
+.8byte 0xA7325206D6F7266
+.8byte 0x0
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x63656A626F206461
+.8byte 0x69206D6F72662074
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x656A626F203A7325
+.8byte 0x20656C6966207463
+.8byte 0x6320736177207325
+.8byte 0x2064656C69706D6F
+.8byte 0x6420612068746977
+.8byte 0x746E657265666669
+.8byte 0x7972617262696C20
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x7463757274736E69
+.8byte 0x6C25202C736E6F69
+.8byte 0x2073657479622075
+.8byte 0x2C6174616420666F
+.8byte 0x756C2520646E6120
+.8byte 0x736C6F626D797320
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6A626F2065746165
+.8byte 0x7074756F20746365
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207463656A62
+.8byte 0xA732520656C
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x63656A626F206461
+.8byte 0x69206D6F72662074
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6F746E6920657469
+.8byte 0x207463656A626F20
+.8byte 0x662074757074756F
+.8byte 0xA732520656C69
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x72616E6962206461
+.8byte 0x69206D6F72662079
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x756C25202C736E6F
+.8byte 0x6F20736574796220
+.8byte 0x202C617461642066
+.8byte 0x20756C2520646E61
+.8byte 0x666F207365747962
+.8byte 0x616F6C2073736220
+.8byte 0x6D6F726620646564
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6920756C25206874
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x202C
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x202C
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x25202C736E6F6974
+.8byte 0x736574796220756C
+.8byte 0x6174616420666F20
+.8byte 0x6C2520646E61202C
+.8byte 0x2073657479622075
+.8byte 0xA73736220666F
+.8byte 0x626D7973203A7325
+.8byte 0x656C626174206C6F
+.8byte 0x2068637261657320
+.8byte 0x73617720656D6974
+.8byte 0x65746920756C2520
+.8byte 0x20736E6F69746172
+.8byte 0x6172657661206E6F
+.8byte 0x2520646E61206567
+.8byte 0x6F74206E6920756C
+.8byte 0xA6C6174
+.8byte 0x20756C25203A7325
+.8byte 0x7463757274736E69
+.8byte 0x6D657220736E6F69
+.8byte 0x207962206465766F
+.8byte 0x656C6F6870656570
+.8byte 0x7A696D6974706F20
+.8byte 0xA6E6F697461
+.8byte 0x20756C25203A7325
+.8byte 0x72756465636F7270
+.8byte 0x2068746977207365
+.8byte 0x74736E6920756C25
+.8byte 0x736E6F6974637572
+.8byte 0x6465766F6D657220
+.8byte 0x65726E7520736120
+.8byte 0x20656C6261686361
+.8byte 0x69616D206D6F7266
+.8byte 0xA6E
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x62696C20796C6E6F
+.8byte 0x6E65672079726172
+.8byte 0xA646574617265
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x6973736572707865
+.8byte 0x7365646F6E206E6F
+.8byte 0x6F6620756C25202C
+.8byte 0x6C25202C6465646C
+.8byte 0x6465726168732075
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x252820736C6C6163
+.8byte 0x6E696C6E6920756C
+.8byte 0x756C25202C296465
+.8byte 0x6D6E676973736120
+.8byte 0x6C25202C73746E65
+.8byte 0x2C656C6968772075
+.8byte 0x2C666920756C2520
+.8byte 0x74657220756C2520
+.8byte 0xA6E7275
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x6174732068746977
+.8byte 0xA6372
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x7972617262696C
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x6465636F7270206E
+.8byte 0x6874697720657275
+.8byte 0x7261762D6E6F6E20
+.8byte 0x6170206369646169
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x636F7270206E6920
+.8byte 0x6977206572756465
+.8byte 0x762D6E6F6E206874
+.8byte 0x2063696461697261
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x676E696E726177
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x676E696E726177
+.8byte 0x6369646169726176
+.8byte 0x756465636F727020
+.8byte 0x656C6C6163206572
+.8byte 0x65726F6665622064
+.8byte 0x6572616C63656420
+.8byte 0x64
+.8byte 0x656D616E5F6F6E
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x64696F76
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x2072656765746E69
+.8byte 0x6220666F2074756F
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6666756220657469
+.8byte 0x756F206F74207265
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x7325
+.8byte 0x7325
+.8byte 0x66746E69727064
+.8byte 0x645F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x66746E69727073
+.8byte 0x735F6569666C6573
+.8byte 0x66746E697270
+.8byte 0x2066746E697270
+.8byte 0x705F6569666C6573
+.8byte 0x66746E6972
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x6567616972726163
+.8byte 0x6E727574657220
+.8byte 0x65656620656E696C
+.8byte 0x64
+.8byte 0x6F74616C75626174
+.8byte 0x72
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x6325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x40
+.8byte 0x1
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x1
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x989680
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x20
+.8byte 0x4
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x1
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x191
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0x71
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x38
+.8byte 0x28
+.8byte 0x4A424F5543534952
+.8byte 0x1000
+.8byte 0x1
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x10000
+.8byte 0x8000
+.8byte 0x80000
+.8byte 0x1000
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0xB
+.8byte 0x6
+.8byte 0x7
+.8byte 0x20
+.8byte 0x2020706D75625F
+.8byte 0x2020206E69616D
+.8byte 0x0
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0xC
+.8byte 0x400
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x1
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x1
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x2
+.8byte 0x1
+.8byte 0xC
+.8byte 0x6
+.8byte 0x2
+.8byte 0x1
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x80
+.8byte 0x20
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x1
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
@@ -24,6 +24,7 @@ in both syscall and library variants.
 
 void gc_init_boehm(uint64_t* context);
 uint64_t* allocate_memory_boehm(uint64_t* context, uint64_t size);
+void mark_pointer(uint64_t* context, uint64_t gc_address);
 uint64_t mark_object_boehm(uint64_t* context, uint64_t gc_address);
 void sweep_boehm(uint64_t* context);
 
@@ -706,10 +707,10 @@ uint64_t* allocate_memory_boehm(uint64_t* context, uint64_t size) {
 }
 
 void mark_object(uint64_t* context, uint64_t address) {
-  uint64_t gc_address;
-
-  gc_address = gc_load_memory(context, address);
+  mark_pointer(context, gc_load_memory(context, address));
+}
 
+void mark_pointer(uint64_t* context, uint64_t gc_address) {
   if (gc_address >= (uint64_t) get_chunk_heap_start_gc(context)) {
     if (gc_address < (uint64_t) get_chunk_heap_bump_gc(context))
       mark_object_boehm(context, gc_address);
@@ -1736,7 +1736,7 @@ void modeler() {
   // 100*4 lines per 32-bit instruction (pc increments by 4) and
   // 100*8 lines per 64-bit machine word in data segment
   pcs_nid = ten_to_the_power_of(
-    log_ten(data_start + data_size +
+    log_ten(data_start + data_size + bss_size +
       (VIRTUALMEMORYSIZE * GIGABYTE - *(registers + REG_SP))) + 3);
 
   while (pc < code_start + code_size) {
@@ -1772,7 +1772,7 @@ void modeler() {
   // assert: pc == code_start + code_size
 
   while (pc < VIRTUALMEMORYSIZE * GIGABYTE) {
-    if (pc == data_start + data_size) {
+    if (pc == data_start + data_size + bss_size) {
       // assert: stack pointer < VIRTUALMEMORYSIZE * GIGABYTE
       pc = *(registers + REG_SP);
 
@@ -1784,7 +1784,13 @@ void modeler() {
       current_nid,     // nid of this line
       pc, pc); // address of current machine word
 
-    machine_word = load_virtual_memory(pt, pc);
+    if (pc < data_start + data_size)
+      machine_word = load_virtual_memory(pt, pc);
+    else if (pc < data_start + data_size + bss_size)
+      // bss pages are mapped on first access
+      machine_word = 0;
+    else
+      machine_word = load_virtual_memory(pt, pc);
 
     if (machine_word == 0) {
       // load machine word == 0
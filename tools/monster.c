@@ -26,6 +26,10 @@ satisfiable if and only if there is input to the code such that the
 code exits with non-zero exit codes or performs division by zero when
 executing no more instructions than the maximum execution depth and no
 more conditional branch instructions than the branching limit.
+SMT-LIB terms are hash-consed: identical terms are created only once,
+and long terms are given names through define-fun right before their
+first use, so that the size of the SMT-LIB file remains linear in the
+number of generated terms.
 
 The first console argument is interpreted as maximum execution depth
 where value zero means that the depth is unbounded. The following
@@ -35,6 +39,19 @@ makes the engine backtrack. The following optional console argument
 --merge-enabled instructs monster to generate a single SMT-LIB
 formula for bounded model checking by merging all code paths (rather
 than one SMT-LIB formula for each code path as in symbolic execution).
+The following optional console argument --prune instructs monster to
+also keep the SMT-LIB formulae as terms in memory, bit-blast them to
+CNF using Tseitin encoding, and solve them with babysat incrementally:
+conditional branches whose path conditions are unsatisfiable are not
+explored, and each check is annotated with its result in the SMT-LIB
+file.
+The following optional console arguments --shard worker workers
+instruct monster to explore only one of that many shards of the code
+paths: all workers explore the same code paths until enough of them
+are waiting to be explored, and then each worker keeps its share of
+the waiting code paths only. Each worker writes its shard into its own
+SMT-LIB file, so that workers may run in parallel as separate
+processes. Code paths are only merged within a shard.
 
 Any remaining console arguments are uninterpreted and passed on as
 console arguments to the modeled RISC-U binary.
@@ -77,16 +94,20 @@ uint64_t* mipster_symbolic_switch(uint64_t* to_context, uint64_t timeout);
 
 uint64_t* load_symbolic_memory(uint64_t vaddr);
 void      store_symbolic_memory(uint64_t vaddr, uint64_t val, char* sym, char* var, uint64_t bits);
-uint64_t* find_word_in_unshared_symbolic_memory(uint64_t vaddr);
-void      update_begin_of_shared_symbolic_memory(uint64_t* context);
 
 uint64_t is_symbolic_value(uint64_t* sword);
 
 void print_symbolic_memory(uint64_t* sword);
 
+// symbolic memory is a persistent big-endian patricia trie indexed by
+// word address: memory words are its leaves, they are never modified
+// after being inserted, and stores copy only the path from the root
+// to the new word, so that forking a context shares its symbolic
+// memory in constant time and loads take at most one step per bit
+
 // symbolic memory word struct:
 // +---+-----------+
-// | 0 | next word | pointer to next memory word
+// | 0 | level     | always 0 for memory words, see trie node struct below
 // | 1 | address   | address of memory word
 // | 2 | value     | concrete value of memory word
 // | 3 | symbolic  | symbolic value of memory word
@@ -94,21 +115,53 @@ void print_symbolic_memory(uint64_t* sword);
 // +---+-----------+
 
 uint64_t* allocate_symbolic_memory_word() {
-  return smalloc(2 * SIZEOFUINT64STAR + 3 * SIZEOFUINT64);
+  return smalloc(3 * SIZEOFUINT64 + SIZEOFUINT64STAR + SIZEOFUINT64);
 }
 
-uint64_t* get_next_word(uint64_t* word)      { return (uint64_t*) *word; }
 uint64_t  get_word_address(uint64_t* word)   { return             *(word + 1); }
 uint64_t  get_word_value(uint64_t* word)     { return             *(word + 2); }
 char*     get_word_symbolic(uint64_t* word)  { return (char*)     *(word + 3); }
 uint64_t  get_number_of_bits(uint64_t* word) { return             *(word + 4); }
 
-void set_next_word(uint64_t* word, uint64_t* next)      { *word       = (uint64_t) next; }
 void set_word_address(uint64_t* word, uint64_t address) { *(word + 1) =            address; }
 void set_word_value(uint64_t* word, uint64_t value)     { *(word + 2) =            value; }
 void set_word_symbolic(uint64_t* word, char* sym)       { *(word + 3) = (uint64_t) sym; }
 void set_number_of_bits(uint64_t* word, uint64_t bits)  { *(word + 4) =            bits; }
 
+uint64_t* new_symbolic_memory_word(uint64_t vaddr, uint64_t val, char* sym, uint64_t bits);
+
+// symbolic memory trie node struct:
+// +---+--------+
+// | 0 | level  | 1 + position of the bit in which the addresses in the two subtries differ
+// | 1 | prefix | address bits above that bit shared by all words in this subtrie
+// | 2 | left   | pointer to subtrie of words with that address bit cleared
+// | 3 | right  | pointer to subtrie of words with that address bit set
+// +---+--------+
+
+uint64_t* allocate_symbolic_memory_node() {
+  return smalloc(2 * SIZEOFUINT64 + 2 * SIZEOFUINT64STAR);
+}
+
+uint64_t  get_trie_level(uint64_t* trie)  { return             *trie; }
+uint64_t  get_trie_prefix(uint64_t* trie) { return             *(trie + 1); }
+uint64_t* get_left_trie(uint64_t* trie)   { return (uint64_t*) *(trie + 2); }
+uint64_t* get_right_trie(uint64_t* trie)  { return (uint64_t*) *(trie + 3); }
+
+void set_trie_level(uint64_t* trie, uint64_t level)   { *trie       =            level; }
+void set_trie_prefix(uint64_t* trie, uint64_t prefix) { *(trie + 1) =            prefix; }
+void set_left_trie(uint64_t* trie, uint64_t* left)    { *(trie + 2) = (uint64_t) left; }
+void set_right_trie(uint64_t* trie, uint64_t* right)  { *(trie + 3) = (uint64_t) right; }
+
+uint64_t* new_symbolic_memory_node(uint64_t prefix, uint64_t level, uint64_t* left, uint64_t* right);
+
+uint64_t is_symbolic_memory_word(uint64_t* trie);
+
+uint64_t mask_address(uint64_t vaddr, uint64_t level);
+uint64_t is_left_address(uint64_t vaddr, uint64_t level);
+
+uint64_t* join_symbolic_memory(uint64_t prefix1, uint64_t* trie1, uint64_t prefix2, uint64_t* trie2);
+uint64_t* insert_symbolic_memory_word(uint64_t* trie, uint64_t* sword);
+
 // -----------------------------------------------------------------
 // ------------------------- INSTRUCTIONS --------------------------
 // -----------------------------------------------------------------
@@ -155,12 +208,13 @@ uint64_t* copy_symbolic_context(uint64_t* original, uint64_t location, char* con
 // | 27 | symbolic memory | pointer to symbolic memory
 // | 28 | symbolic regs   | pointer to symbolic registers
 // | 29 | beq counter     | number of executed symbolic beq instructions
-// | 30 | merge partner   | pointer to the context from which this context was created
-// | 31 | call stack      | pointer to the corresponding node in the call stack tree
+// | 30 | call stack      | pointer to the corresponding node in the call stack tree
+// | 31 | queue position  | 1 + index of context in queue of waiting contexts, 0 if not waiting
+// | 32 | next waiting    | pointer to next waiting context with same hash of pc and call stack
 // +----+-----------------+
 
 uint64_t* allocate_symbolic_context() {
-  return smalloc(9 * SIZEOFUINT64STAR + 16 * SIZEOFUINT64 + 5 * SIZEOFUINT64STAR + 2 * SIZEOFUINT64);
+  return smalloc(9 * SIZEOFUINT64STAR + 16 * SIZEOFUINT64 + 5 * SIZEOFUINT64STAR + 3 * SIZEOFUINT64);
 }
 
 uint64_t  get_execution_depth(uint64_t* context) { return             *(context + 25); }
@@ -168,16 +222,18 @@ char*     get_path_condition(uint64_t* context)  { return (char*)     *(context
 uint64_t* get_symbolic_memory(uint64_t* context) { return (uint64_t*) *(context + 27); }
 uint64_t* get_symbolic_regs(uint64_t* context)   { return (uint64_t*) *(context + 28); }
 uint64_t  get_beq_counter(uint64_t* context)     { return             *(context + 29); }
-uint64_t* get_merge_partner(uint64_t* context)   { return (uint64_t*) *(context + 30); }
-uint64_t* get_call_stack(uint64_t* context)      { return (uint64_t*) *(context + 31); }
+uint64_t* get_call_stack(uint64_t* context)      { return (uint64_t*) *(context + 30); }
+uint64_t  get_queue_position(uint64_t* context)  { return             *(context + 31); }
+uint64_t* get_next_waiting(uint64_t* context)    { return (uint64_t*) *(context + 32); }
 
 void set_execution_depth(uint64_t* context, uint64_t depth)   { *(context + 25) =            depth; }
 void set_path_condition(uint64_t* context, char* condition)   { *(context + 26) = (uint64_t) condition; }
 void set_symbolic_memory(uint64_t* context, uint64_t* memory) { *(context + 27) = (uint64_t) memory; }
 void set_symbolic_regs(uint64_t* context, uint64_t* regs)     { *(context + 28) = (uint64_t) regs; }
 void set_beq_counter(uint64_t* context, uint64_t counter)     { *(context + 29) =            counter; }
-void set_merge_partner(uint64_t* context, uint64_t* partner)  { *(context + 30) = (uint64_t) partner; }
-void set_call_stack(uint64_t* context, uint64_t* stack)       { *(context + 31) = (uint64_t) stack; }
+void set_call_stack(uint64_t* context, uint64_t* stack)       { *(context + 30) = (uint64_t) stack; }
+void set_queue_position(uint64_t* context, uint64_t position) { *(context + 31) =            position; }
+void set_next_waiting(uint64_t* context, uint64_t* next)      { *(context + 32) = (uint64_t) next; }
 
 // -----------------------------------------------------------------
 // -------------------------- MICROKERNEL --------------------------
@@ -201,6 +257,132 @@ uint64_t EXITCODE_SYMBOLICEXECUTIONERROR = 1;
 
 uint64_t SCHEDULE = 100; // extends DONOTEXIT and EXIT
 
+// -----------------------------------------------------------------
+// ------------------------- BIT BLASTING --------------------------
+// -----------------------------------------------------------------
+
+uint64_t* new_term(uint64_t operator, uint64_t width, uint64_t* op1, uint64_t* op2, uint64_t* op3);
+
+uint64_t* find_term(char* sym);
+void      bind_term(char* sym, uint64_t* term);
+void      define_term(char* var, char* sym);
+
+void bind_unary_term(char* string, char* opt, char* op);
+void bind_binary_term(char* string, char* opt, char* op1, char* op2);
+
+uint64_t new_gate();
+void     add_gate_clause(uint64_t l1, uint64_t l2, uint64_t l3);
+
+uint64_t and_gate(uint64_t a, uint64_t b);
+uint64_t or_gate(uint64_t a, uint64_t b);
+uint64_t xor_gate(uint64_t a, uint64_t b);
+uint64_t ite_gate(uint64_t c, uint64_t t, uint64_t e);
+
+uint64_t* blast_add(uint64_t* a, uint64_t* b, uint64_t carry, uint64_t width);
+uint64_t* blast_not(uint64_t* a, uint64_t width);
+uint64_t* blast_and(uint64_t* a, uint64_t* b, uint64_t width);
+uint64_t* blast_ite(uint64_t c, uint64_t* t, uint64_t* e, uint64_t width);
+uint64_t  blast_ult(uint64_t* a, uint64_t* b, uint64_t width);
+uint64_t  blast_eq(uint64_t* a, uint64_t* b, uint64_t width);
+uint64_t* blast_mul(uint64_t* a, uint64_t* b, uint64_t width);
+uint64_t* blast_udiv_urem(uint64_t* a, uint64_t* b, uint64_t width, uint64_t remainder);
+
+uint64_t* blast_operand(uint64_t* term, uint64_t width);
+uint64_t* bit_blast(uint64_t* term);
+
+void set_cone_decisions(uint64_t* term, uint64_t decision, uint64_t stamp);
+
+uint64_t solve_condition(char* condition);
+uint64_t is_feasible(char* condition);
+void     check_condition(char* condition);
+
+void init_bit_blasting();
+
+// term struct:
+// +---+----------+
+// | 0 | operator | operator of term, see TERM_* constants
+// | 1 | width    | number of bits of bit vector
+// | 2 | operand  | first operand term or value of constant
+// | 3 | operand  | second operand term
+// | 4 | operand  | third operand term
+// | 5 | bits     | literals of bits, least significant first, once blasted
+// | 6 | gates    | first SAT variable introduced when blasting the term
+// | 7 | end      | SAT variable following the variables of the term
+// | 8 | stamp    | number of query that most recently visited the term
+// +---+----------+
+
+uint64_t* allocate_term() {
+  return zmalloc(4 * SIZEOFUINT64STAR + 5 * SIZEOFUINT64);
+}
+
+uint64_t  get_term_operator(uint64_t* term) { return             *term; }
+uint64_t  get_term_width(uint64_t* term)    { return             *(term + 1); }
+uint64_t  get_term_value(uint64_t* term)    { return             *(term + 2); }
+uint64_t* get_term_op1(uint64_t* term)      { return (uint64_t*) *(term + 2); }
+uint64_t* get_term_op2(uint64_t* term)      { return (uint64_t*) *(term + 3); }
+uint64_t* get_term_op3(uint64_t* term)      { return (uint64_t*) *(term + 4); }
+uint64_t* get_term_bits(uint64_t* term)     { return (uint64_t*) *(term + 5); }
+uint64_t  get_term_gates(uint64_t* term)    { return             *(term + 6); }
+uint64_t  get_term_end(uint64_t* term)      { return             *(term + 7); }
+uint64_t  get_term_stamp(uint64_t* term)    { return             *(term + 8); }
+
+void set_term_operator(uint64_t* term, uint64_t operator) { *term       = operator; }
+void set_term_width(uint64_t* term, uint64_t width)       { *(term + 1) = width; }
+void set_term_value(uint64_t* term, uint64_t value)       { *(term + 2) = value; }
+void set_term_op1(uint64_t* term, uint64_t* op1)          { *(term + 2) = (uint64_t) op1; }
+void set_term_op2(uint64_t* term, uint64_t* op2)          { *(term + 3) = (uint64_t) op2; }
+void set_term_op3(uint64_t* term, uint64_t* op3)          { *(term + 4) = (uint64_t) op3; }
+void set_term_bits(uint64_t* term, uint64_t* bits)        { *(term + 5) = (uint64_t) bits; }
+void set_term_gates(uint64_t* term, uint64_t gates)       { *(term + 6) = gates; }
+void set_term_end(uint64_t* term, uint64_t end)           { *(term + 7) = end; }
+void set_term_stamp(uint64_t* term, uint64_t stamp)       { *(term + 8) = stamp; }
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t TERM_CONSTANT = 0;
+uint64_t TERM_VARIABLE = 1;
+uint64_t TERM_NOT      = 2;
+uint64_t TERM_ZEXT     = 3;
+uint64_t TERM_AND      = 4;
+uint64_t TERM_OR       = 5;
+uint64_t TERM_ITE      = 6;
+uint64_t TERM_ADD      = 7;
+uint64_t TERM_SUB      = 8;
+uint64_t TERM_MUL      = 9;
+uint64_t TERM_UDIV     = 10;
+uint64_t TERM_UREM     = 11;
+uint64_t TERM_ULT      = 12;
+uint64_t TERM_EQ       = 13;
+
+uint64_t TERM_TABLE_SIZE = 65536; // number of buckets of term table
+
+// literals of a SAT variable that is always true
+uint64_t LITERAL_TRUE  = 0;
+uint64_t LITERAL_FALSE = 1;
+
+uint64_t CONFLICTS_PER_QUERY = 10000; // path conditions are assumed feasible beyond
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t prune = 0; // enable or disable bit-blasting for pruning infeasible paths
+
+// hash table of terms represented by SMT-LIB strings,
+// bucket entries are [next entry, string, term]
+uint64_t* term_table = (uint64_t*) 0;
+
+uint64_t* gate_clause = (uint64_t*) 0; // literals of gate clause
+
+uint64_t carry_literal = 0; // carry out of most recent adder
+
+// bit-blasting statistics
+
+uint64_t number_of_terms           = 0;
+uint64_t number_of_queries         = 0;
+uint64_t number_of_pruned_branches = 0;
+uint64_t number_of_checks          = 0;
+uint64_t number_of_sat_checks      = 0;
+uint64_t number_of_unknowns        = 0;
+
 // -----------------------------------------------------------------
 // ------------------- SYMBOLIC EXECUTION ENGINE -------------------
 // -----------------------------------------------------------------
@@ -216,15 +398,81 @@ char* smt_unary(char* opt, char* op);
 char* smt_binary(char* opt, char* op1, char* op2);
 char* smt_ternary(char* opt, char* op1, char* op2, char* op3);
 
+uint64_t  hash_smt_term(char* opt, char* op1, char* op2, char* op3);
+char*     find_smt_term(char* opt, char* op1, char* op2, char* op3);
+uint64_t* new_smt_term(char* opt, char* op1, char* op2, char* op3, char* string, uint64_t width);
+uint64_t* find_smt_string(char* sym);
+uint64_t  get_smt_width(char* sym);
+char*     compose_smt_term(char* opt, char* op1, char* op2, char* op3, uint64_t width);
+void      name_smt_operand(char* sym);
+char*     define_smt_terms(char* sym);
+
+// smt term struct:
+// +---+------------+
+// | 0 | next       | next term with same hash of operator and operands
+// | 1 | alias      | next term with same hash of string
+// | 2 | operator   | SMT-LIB operator, _ for constants, declare-fun for variables
+// | 3 | operand    | first operand string or value of constant
+// | 4 | operand    | second operand string
+// | 5 | operand    | third operand string
+// | 6 | string     | SMT-LIB string denoting the term, possibly its name
+// | 7 | definition | SMT-LIB string defining the term once named
+// | 8 | width      | number of bits of bit vector
+// | 9 | defined    | flag indicating if definitions have been printed
+// +---+------------+
+
+uint64_t* allocate_smt_term() {
+  return zmalloc(8 * SIZEOFUINT64STAR + 2 * SIZEOFUINT64);
+}
+
+uint64_t* get_smt_next(uint64_t* term)       { return (uint64_t*) *term; }
+uint64_t* get_smt_alias(uint64_t* term)      { return (uint64_t*) *(term + 1); }
+char*     get_smt_operator(uint64_t* term)   { return (char*)     *(term + 2); }
+char*     get_smt_op1(uint64_t* term)        { return (char*)     *(term + 3); }
+char*     get_smt_op2(uint64_t* term)        { return (char*)     *(term + 4); }
+char*     get_smt_op3(uint64_t* term)        { return (char*)     *(term + 5); }
+char*     get_smt_string(uint64_t* term)     { return (char*)     *(term + 6); }
+char*     get_smt_definition(uint64_t* term) { return (char*)     *(term + 7); }
+uint64_t  get_smt_width_of(uint64_t* term)   { return             *(term + 8); }
+uint64_t  get_smt_defined(uint64_t* term)    { return             *(term + 9); }
+
+void set_smt_next(uint64_t* term, uint64_t* next)          { *term       = (uint64_t) next; }
+void set_smt_alias(uint64_t* term, uint64_t* alias)        { *(term + 1) = (uint64_t) alias; }
+void set_smt_operator(uint64_t* term, char* opt)           { *(term + 2) = (uint64_t) opt; }
+void set_smt_op1(uint64_t* term, char* op1)                { *(term + 3) = (uint64_t) op1; }
+void set_smt_op2(uint64_t* term, char* op2)                { *(term + 4) = (uint64_t) op2; }
+void set_smt_op3(uint64_t* term, char* op3)                { *(term + 5) = (uint64_t) op3; }
+void set_smt_string(uint64_t* term, char* string)          { *(term + 6) = (uint64_t) string; }
+void set_smt_definition(uint64_t* term, char* definition)  { *(term + 7) = (uint64_t) definition; }
+void set_smt_width(uint64_t* term, uint64_t width)         { *(term + 8) = width; }
+void set_smt_defined(uint64_t* term, uint64_t defined)     { *(term + 9) = defined; }
+
 void merge(uint64_t* active_context, uint64_t* mergeable_context, uint64_t location);
 void merge_symbolic_memory_and_registers(uint64_t* active_context, uint64_t* mergeable_context);
-void merge_symbolic_memory_of_active_context(uint64_t* active_context, uint64_t* mergeable_context);
-void merge_symbolic_memory_of_mergeable_context(uint64_t* active_context, uint64_t* mergeable_context);
+uint64_t* merge_symbolic_memory(uint64_t* active_context, uint64_t* active_trie, uint64_t* mergeable_trie);
+uint64_t* merge_symbolic_memory_of_one_context(uint64_t* active_context, uint64_t* trie, uint64_t active);
+uint64_t* merge_symbolic_memory_words(uint64_t* active_context, uint64_t* active_word, uint64_t* mergeable_word);
+char*     merged_memory_value(uint64_t* sword, uint64_t bits);
 void merge_registers(uint64_t* active_context, uint64_t* mergeable_context);
+char* merged_register_value(char* sym);
+
+uint64_t  get_call_stack_depth(uint64_t* context);
+uint64_t  is_scheduled_before(uint64_t* context1, uint64_t* context2);
+uint64_t* get_queued_context(uint64_t position);
+void      set_queued_context(uint64_t position, uint64_t* context);
+void      swap_queued_contexts(uint64_t position1, uint64_t position2);
+void      sift_up_symbolic_context(uint64_t position);
+void      sift_down_symbolic_context(uint64_t position);
+uint64_t  hash_symbolic_context(uint64_t* context);
+void      enqueue_symbolic_context(uint64_t* context);
+void      dequeue_symbolic_context(uint64_t* context);
 
 uint64_t* schedule_next_symbolic_context();
 void      check_if_mergeable_and_merge_if_possible(uint64_t* context);
 
+void     split_symbolic_contexts();
+uint64_t is_checked_here();
+
 void add_child(uint64_t* parent, uint64_t* child);
 void step_into_call(uint64_t* context, uint64_t address);
 void step_out_of_call(uint64_t* context);
@@ -242,8 +490,31 @@ uint64_t max_execution_depth = 1; // in number of instructions, unbounded with 0
 
 uint64_t variable_version = 0; // generates unique SMT-LIB variable names
 
+// SMT-LIB terms are hash-consed so that shared
+// terms are defined once and then referred to by name
+uint64_t* smt_terms   = (uint64_t*) 0; // terms hashed by operator and operands
+uint64_t* smt_symbols = (uint64_t*) 0; // terms hashed by string
+
+uint64_t number_of_smt_terms       = 0;
+uint64_t number_of_smt_shares      = 0;
+uint64_t number_of_smt_names       = 0; // generates unique SMT-LIB term names
+uint64_t number_of_smt_definitions = 0;
+
 uint64_t* symbolic_contexts = (uint64_t*) 0;
 
+// contexts waiting to be scheduled are kept in a binary heap ordered
+// by call stack depth and program counter, and are hashed by program
+// counter and call stack to find merge candidates without search
+uint64_t* context_queue         = (uint64_t*) 0;
+uint64_t  context_queue_size    = 0;
+uint64_t  context_queue_maximum = 0;
+uint64_t* waiting_contexts      = (uint64_t*) 0;
+
+uint64_t number_of_symbolic_contexts  = 0;
+uint64_t number_of_merged_contexts    = 0;
+uint64_t number_of_live_contexts      = 0;
+uint64_t peak_number_of_live_contexts = 0;
+
 char* path_condition = (char*) 0;
 
 uint64_t* symbolic_memory = (uint64_t*) 0;
@@ -256,16 +527,30 @@ uint64_t smt_fd   = 0;         // file descriptor of open SMT-LIB file
 uint64_t merge_enabled  = 0; // enable or disable the merging of paths
 uint64_t debug_merge    = 0; // enable or disable the debugging of merging in monster
 
+// with more than one worker, each monster process explores one shard of
+// the code paths: all workers explore the same contexts until enough of
+// them are waiting, and then keep every n-th waiting context only
+uint64_t worker            = 0; // shard explored by this process
+uint64_t number_of_workers = 1;
+
+uint64_t split = 0; // contexts have been split among workers
+
+uint64_t number_of_split_contexts = 0;
+
 uint64_t* call_stack_tree = (uint64_t*) 0; // tree representing the program structure (each node represents a procedure call)
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
-uint64_t DELETED                         = -1; // indicates that a symbolic memory word has been deleted
-uint64_t MERGED                          = -2; // indicates that a symbolic memory word has been merged
-uint64_t BEGIN_OF_SHARED_SYMBOLIC_MEMORY = -3; // indicates the beginning of the shared symbolic memory space
-
 uint64_t beq_limit = 35; // limit of symbolic beq instructions on each path
 
+uint64_t SPLIT_FACTOR = 4; // waiting contexts per worker before splitting
+
+uint64_t SMT_TABLE_SIZE = 65536; // number of buckets of hash tables of SMT-LIB terms
+
+uint64_t MAX_SMT_OPERAND_LENGTH = 32; // longer operands are referred to by name
+
+uint64_t CONTEXT_TABLE_SIZE = 4096; // number of buckets of hash table of waiting contexts
+
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
 // -----------------------------------------------------------------
 // -------------------     I N T E R F A C E     -------------------
@@ -284,6 +569,12 @@ void implement_symbolic_exit(uint64_t* context) {
 
   set_exit_code(context, sign_shrink(signed_int_exit_code, SYSCALL_BITWIDTH));
 
+  if (is_checked_here() == 0)
+    return;
+
+  define_smt_terms(path_condition);
+  define_smt_terms(smt_value(*(registers + REG_A0), (char*) *(reg_sym + REG_A0)));
+
   dprintf(output_fd, "\n(push 1)\n");
 
   dprintf(output_fd, "(assert (and %s (not (= %s (_ bv0 64))))); exit in ",
@@ -295,6 +586,10 @@ void implement_symbolic_exit(uint64_t* context) {
     dprintf(output_fd, " -> exiting context: %lu", context);
 
   dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+
+  if (prune)
+    check_condition(smt_binary("and", path_condition,
+      smt_unary("not", smt_binary("=", smt_value(*(registers + REG_A0), (char*) *(reg_sym + REG_A0)), bv_constant(0)))));
 }
 
 void implement_symbolic_read(uint64_t* context) {
@@ -575,15 +870,20 @@ uint64_t* mipster_symbolic_switch(uint64_t* to_context, uint64_t timeout) {
 // -----------------------------------------------------------------
 
 uint64_t* load_symbolic_memory(uint64_t vaddr) {
-  uint64_t* sword;
+  uint64_t* trie;
 
-  sword = symbolic_memory;
-
-  while (sword != (uint64_t*) 0) {
-    if (get_word_address(sword) == vaddr)
-      return sword;
+  trie = symbolic_memory;
 
-    sword = get_next_word(sword);
+  while (trie != (uint64_t*) 0) {
+    if (is_symbolic_memory_word(trie)) {
+      if (get_word_address(trie) == vaddr)
+        return trie;
+      else
+        return (uint64_t*) 0;
+    } else if (is_left_address(vaddr, get_trie_level(trie)))
+      trie = get_left_trie(trie);
+    else
+      trie = get_right_trie(trie);
   }
 
   return (uint64_t*) 0;
@@ -592,66 +892,111 @@ uint64_t* load_symbolic_memory(uint64_t vaddr) {
 void store_symbolic_memory(uint64_t vaddr, uint64_t val, char* sym, char* var, uint64_t bits) {
   uint64_t* sword;
 
-  // we overwrite values, if they already exist in the unshared symbolic memory space, so that there are no duplicates in any unshared symbolic memory space
-  sword = find_word_in_unshared_symbolic_memory(vaddr);
-
-  // new value in this unshared symbolic memory space
-  if (sword == (uint64_t*) 0) {
-    sword = allocate_symbolic_memory_word();
-    set_next_word(sword, symbolic_memory);
-    symbolic_memory = sword;
-  }
-
-  set_word_address(sword, vaddr);
-  set_word_value(sword, val);
-
   if (var)
-    set_word_symbolic(sword, var);
+    sword = new_symbolic_memory_word(vaddr, val, var, bits);
   else if (sym) {
-    set_word_symbolic(sword, smt_variable("m", SIZEOFUINT64 * 8));
+    sword = new_symbolic_memory_word(vaddr, val, smt_variable("m", SIZEOFUINT64 * 8), bits);
 
-    dprintf(output_fd, "(assert (= %s %s)); sd in ", get_word_symbolic(sword), sym);
+    dprintf(output_fd, "(assert (= %s %s)); sd in ", get_word_symbolic(sword), define_smt_terms(sym));
     print_code_context_for_instruction(pc);
     println();
+
+    define_term(get_word_symbolic(sword), sym);
   } else
-    set_word_symbolic(sword, 0);
+    sword = new_symbolic_memory_word(vaddr, val, (char*) 0, bits);
 
-  set_number_of_bits(sword, bits);
+  // words are immutable, other contexts may still share the overwritten one
+  symbolic_memory = insert_symbolic_memory_word(symbolic_memory, sword);
 }
 
-uint64_t* find_word_in_unshared_symbolic_memory(uint64_t vaddr) {
+uint64_t* new_symbolic_memory_word(uint64_t vaddr, uint64_t val, char* sym, uint64_t bits) {
   uint64_t* sword;
 
-  sword = get_symbolic_memory(current_context);
+  sword = allocate_symbolic_memory_word();
 
-  while (sword) {
-    if (get_word_address(sword) == BEGIN_OF_SHARED_SYMBOLIC_MEMORY)
-      return (uint64_t*) 0;
-    if (get_word_address(sword) == vaddr)
-      return sword;
+  set_trie_level(sword, 0);
+  set_word_address(sword, vaddr);
+  set_word_value(sword, val);
+  set_word_symbolic(sword, sym);
+  set_number_of_bits(sword, bits);
 
-    sword = get_next_word(sword);
-  }
+  return sword;
+}
 
-  return (uint64_t*) 0;
+uint64_t* new_symbolic_memory_node(uint64_t prefix, uint64_t level, uint64_t* left, uint64_t* right) {
+  uint64_t* node;
+
+  node = allocate_symbolic_memory_node();
+
+  set_trie_level(node, level);
+  set_trie_prefix(node, prefix);
+  set_left_trie(node, left);
+  set_right_trie(node, right);
+
+  return node;
 }
 
-void update_begin_of_shared_symbolic_memory(uint64_t* context) {
-  uint64_t* sword;
+uint64_t is_symbolic_memory_word(uint64_t* trie) {
+  return get_trie_level(trie) == 0;
+}
 
-  if (context == (uint64_t*) 0)
-    return;
+uint64_t mask_address(uint64_t vaddr, uint64_t level) {
+  // clear the address bits below level
+  return vaddr - vaddr % two_to_the_power_of(level);
+}
 
-  sword = get_symbolic_memory(context);
+uint64_t is_left_address(uint64_t vaddr, uint64_t level) {
+  // check if the address bit at level - 1 is cleared
+  return vaddr / two_to_the_power_of(level - 1) % 2 == 0;
+}
 
-  while (sword) {
-    if (get_word_address(sword) == BEGIN_OF_SHARED_SYMBOLIC_MEMORY) {
-      set_word_address(sword, DELETED);
-      return;
-    }
+uint64_t* join_symbolic_memory(uint64_t prefix1, uint64_t* trie1, uint64_t prefix2, uint64_t* trie2) {
+  uint64_t level;
+
+  // find the highest address bit in which the two disjoint subtries differ
+  level = get_trie_level(trie1);
+
+  if (level < get_trie_level(trie2))
+    level = get_trie_level(trie2);
+
+  level = level + 1;
 
-    sword = get_next_word(sword);
+  while (mask_address(prefix1, level) != mask_address(prefix2, level))
+    level = level + 1;
+
+  if (is_left_address(prefix1, level))
+    return new_symbolic_memory_node(mask_address(prefix1, level), level, trie1, trie2);
+  else
+    return new_symbolic_memory_node(mask_address(prefix1, level), level, trie2, trie1);
+}
+
+uint64_t* insert_symbolic_memory_word(uint64_t* trie, uint64_t* sword) {
+  uint64_t vaddr;
+  uint64_t level;
+
+  if (trie == (uint64_t*) 0)
+    return sword;
+
+  vaddr = get_word_address(sword);
+
+  if (is_symbolic_memory_word(trie)) {
+    if (get_word_address(trie) == vaddr)
+      // replace the word in the copy, not in the trie
+      return sword;
+    else
+      return join_symbolic_memory(vaddr, sword, get_word_address(trie), trie);
   }
+
+  level = get_trie_level(trie);
+
+  if (mask_address(vaddr, level) != get_trie_prefix(trie))
+    return join_symbolic_memory(vaddr, sword, get_trie_prefix(trie), trie);
+  else if (is_left_address(vaddr, level))
+    return new_symbolic_memory_node(get_trie_prefix(trie), level,
+      insert_symbolic_memory_word(get_left_trie(trie), sword), get_right_trie(trie));
+  else
+    return new_symbolic_memory_node(get_trie_prefix(trie), level,
+      get_left_trie(trie), insert_symbolic_memory_word(get_right_trie(trie), sword));
 }
 
 uint64_t is_symbolic_value(uint64_t* sword) {
@@ -686,6 +1031,7 @@ void constrain_addi() {
 void constrain_add_sub_mul_divu_remu_sltu(char* operator) {
   char* op1;
   char* op2;
+  char* sym;
 
   if (rd != REG_ZR) {
     op1 = (char*) *(reg_sym + rs1);
@@ -704,11 +1050,16 @@ void constrain_add_sub_mul_divu_remu_sltu(char* operator) {
     *(reg_sym + rd) = (uint64_t) smt_binary(operator, op1, op2);
 
     // checking for division by zero
-    if (string_compare(operator, "bvudiv")) {
-      dprintf(output_fd, "(push 1)\n");
-      dprintf(output_fd, "(assert (and %s %s)); check if a division by zero is possible", path_condition, smt_binary("=", op2, bv_constant(0)));
-      dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
-    }
+    if (string_compare(operator, "bvudiv"))
+      if (is_checked_here()) {
+        sym = define_smt_terms(smt_binary("and", path_condition, smt_binary("=", op2, bv_constant(0))));
+
+        dprintf(output_fd, "(push 1)\n");
+        dprintf(output_fd, "(assert %s); check if a division by zero is possible", sym);
+        dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+
+        check_condition(sym);
+      }
   }
 }
 
@@ -830,6 +1181,9 @@ void constrain_beq() {
   char* op2;
   char* bvar;
   char* pvar;
+  char* sym;
+  char* true_condition;
+  char* false_condition;
 
   op1 = (char*) *(reg_sym + rs1);
   op2 = (char*) *(reg_sym + rs2);
@@ -845,30 +1199,51 @@ void constrain_beq() {
     op2 = bv_constant(*(registers + rs2));
 
   bvar = smt_variable("b", 1);
+  sym  = smt_binary("bvcomp", op1, op2);
 
-  dprintf(output_fd, "(assert (= %s %s)); beq in ", bvar, smt_binary("bvcomp", op1, op2));
+  dprintf(output_fd, "(assert (= %s %s)); beq in ", bvar, define_smt_terms(sym));
   print_code_context_for_instruction(pc);
   println();
 
+  define_term(bvar, sym);
+
   pvar = smt_variable("p", 1);
 
-  dprintf(output_fd, "(assert (= %s %s)); path condition in ", pvar, path_condition);
+  dprintf(output_fd, "(assert (= %s %s)); path condition in ", pvar, define_smt_terms(path_condition));
   print_code_context_for_instruction(pc);
   println();
 
+  define_term(pvar, path_condition);
+
   // increase the number of executed symbolic beq instructions
   set_beq_counter(current_context, get_beq_counter(current_context) + 1);
 
   if (get_beq_counter(current_context) < beq_limit) {
-    // save symbolic memory so that it is copied correctly afterwards
-    set_symbolic_memory(current_context, symbolic_memory);
+    true_condition  = smt_binary("and", pvar, bvar);
+    false_condition = smt_binary("and", pvar, smt_unary("not", bvar));
+
+    // with pruning enabled, paths with unsatisfiable conditions are not explored
+    if (is_feasible(true_condition)) {
+      if (is_feasible(false_condition)) {
+        // save symbolic memory so that it is shared correctly afterwards
+        set_symbolic_memory(current_context, symbolic_memory);
+
+        // the copied context is executed later and takes the other path
+        copy_symbolic_context(current_context, pc + imm, true_condition);
+
+        path_condition = false_condition;
 
-    // the copied context is executed later and takes the other path
-    copy_symbolic_context(current_context, pc + imm, smt_binary("and", pvar, bvar));
+        pc = pc + INSTRUCTIONSIZE;
+      } else {
+        path_condition = true_condition;
 
-    path_condition = smt_binary("and", pvar, smt_unary("not", bvar));
+        pc = pc + imm;
+      }
+    } else {
+      path_condition = false_condition;
 
-    pc = pc + INSTRUCTIONSIZE;
+      pc = pc + INSTRUCTIONSIZE;
+    }
   }
 }
 
@@ -974,7 +1349,6 @@ uint64_t* new_symbolic_context() {
 
 uint64_t* copy_symbolic_context(uint64_t* original, uint64_t location, char* condition) {
   uint64_t* context;
-  uint64_t* begin_of_shared_symbolic_memory;
   uint64_t r;
 
   context = new_symbolic_context();
@@ -1016,31 +1390,15 @@ uint64_t* copy_symbolic_context(uint64_t* original, uint64_t location, char* con
   set_path_condition(context, condition);
   set_beq_counter(context, get_beq_counter(original));
 
-  begin_of_shared_symbolic_memory = allocate_symbolic_memory_word();
-
-  // mark begin of shared symbolic memory space in the copied context
-  set_next_word(begin_of_shared_symbolic_memory, get_symbolic_memory(original));
-  set_word_address(begin_of_shared_symbolic_memory, BEGIN_OF_SHARED_SYMBOLIC_MEMORY);
-
-  // begin of the unshared symbolic memory space of the copied context
-  set_symbolic_memory(context, begin_of_shared_symbolic_memory);
-
-  begin_of_shared_symbolic_memory = allocate_symbolic_memory_word();
-
-  // mark begin of shared symbolic memory space in the original context
-  set_next_word(begin_of_shared_symbolic_memory, get_symbolic_memory(original));
-  set_word_address(begin_of_shared_symbolic_memory, BEGIN_OF_SHARED_SYMBOLIC_MEMORY);
-
-  // begin of the unshared symbolic memory space of the original context
-  set_symbolic_memory(original, begin_of_shared_symbolic_memory);
+  // persistent symbolic memory is shared, not copied
+  set_symbolic_memory(context, get_symbolic_memory(original));
 
   symbolic_memory = get_symbolic_memory(original);
 
   set_symbolic_regs(context, smalloc(NUMBEROFREGISTERS * SIZEOFUINT64STAR));
 
-  set_merge_partner(context, original);
-
   set_call_stack(context, get_call_stack(original));
+  set_queue_position(context, 0);
 
   r = 0;
 
@@ -1056,6 +1414,15 @@ uint64_t* copy_symbolic_context(uint64_t* original, uint64_t location, char* con
 
   symbolic_contexts = context;
 
+  number_of_symbolic_contexts = number_of_symbolic_contexts + 1;
+  number_of_live_contexts     = number_of_live_contexts + 1;
+
+  if (number_of_live_contexts > peak_number_of_live_contexts)
+    peak_number_of_live_contexts = number_of_live_contexts;
+
+  // the copied context waits to be scheduled
+  enqueue_symbolic_context(context);
+
   return context;
 }
 
@@ -1076,8 +1443,9 @@ uint64_t* create_symbolic_context(uint64_t* parent, uint64_t* vctxt) {
   set_symbolic_memory(context, (uint64_t*) 0);
   set_symbolic_regs(context, zmalloc(NUMBEROFREGISTERS * SIZEOFUINT64STAR));
   set_beq_counter(context, 0);
-  set_merge_partner(context, (uint64_t*) 0);
   set_call_stack(context, call_stack_tree);
+  set_queue_position(context, 0);
+  set_next_waiting(context, (uint64_t*) 0);
 
   if (debug_create)
     printf("%s: parent context 0x%08lX created child context 0x%08lX\n", selfie_name,
@@ -1127,10 +1495,16 @@ uint64_t handle_symbolic_system_call(uint64_t* context) {
 uint64_t handle_symbolic_division_by_zero(uint64_t* context) {
   set_exception(context, EXCEPTION_NOEXCEPTION);
 
-  // check if this division by zero is reachable
-  dprintf(output_fd, "(push 1)\n");
-  dprintf(output_fd, "(assert %s); division by zero detected; check if this division by zero is reachable", path_condition);
-  dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+  if (is_checked_here()) {
+    // check if this division by zero is reachable
+    define_smt_terms(path_condition);
+
+    dprintf(output_fd, "(push 1)\n");
+    dprintf(output_fd, "(assert %s); division by zero detected; check if this division by zero is reachable", path_condition);
+    dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+
+    check_condition(path_condition);
+  }
 
   // we terminate the execution of the context, because if the location is not reachable,
   // the rest of the path is not reachable either, and otherwise
@@ -1181,10 +1555,16 @@ uint64_t handle_symbolic_exception(uint64_t* context) {
   else if (exception == EXCEPTION_TIMER)
     return handle_symbolic_timer(context);
   else if (exception == EXCEPTION_INVALIDADDRESS) {
-    // check if this invalid memory access is reachable
-    dprintf(output_fd, "(push 1)\n");
-    dprintf(output_fd, "(assert %s); invalid memory access detected; check if this invalid memory access is reachable", path_condition);
-    dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+    if (is_checked_here()) {
+      // check if this invalid memory access is reachable
+      define_smt_terms(path_condition);
+
+      dprintf(output_fd, "(push 1)\n");
+      dprintf(output_fd, "(assert %s); invalid memory access detected; check if this invalid memory access is reachable", path_condition);
+      dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+
+      check_condition(path_condition);
+    }
 
     set_exit_code(context, EXITCODE_SYMBOLICEXECUTIONERROR);
 
@@ -1193,10 +1573,16 @@ uint64_t handle_symbolic_exception(uint64_t* context) {
     // the execution would be terminated by this error anyway
     return EXIT;
   } else if (exception == EXCEPTION_SEGMENTATIONFAULT) {
-    // check if this memory access is reachable
-    dprintf(output_fd, "(push 1)\n");
-    dprintf(output_fd, "(assert %s); segmentation fault detected; check if this memory access is reachable", path_condition);
-    dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+    if (is_checked_here()) {
+      // check if this memory access is reachable
+      define_smt_terms(path_condition);
+
+      dprintf(output_fd, "(push 1)\n");
+      dprintf(output_fd, "(assert %s); segmentation fault detected; check if this memory access is reachable", path_condition);
+      dprintf(output_fd, "\n(check-sat)\n(get-model)\n(pop 1)\n");
+
+      check_condition(path_condition);
+    }
 
     set_exit_code(context, EXITCODE_SYMBOLICEXECUTIONERROR);
 
@@ -1220,447 +1606,1201 @@ uint64_t handle_symbolic_exception(uint64_t* context) {
 }
 
 // -----------------------------------------------------------------
-// ------------------- SYMBOLIC EXECUTION ENGINE -------------------
+// ------------------------- BIT BLASTING --------------------------
 // -----------------------------------------------------------------
 
-char* bv_constant(uint64_t value) {
-  char* string;
+uint64_t* new_term(uint64_t operator, uint64_t width, uint64_t* op1, uint64_t* op2, uint64_t* op3) {
+  uint64_t* term;
 
-  string = string_alloc(5 + 20 + 4); // 64-bit numbers require up to 20 decimal digits
+  term = allocate_term();
 
-  sprintf(string, "(_ bv%lu 64)", value);
+  set_term_operator(term, operator);
+  set_term_width(term, width);
+  set_term_op1(term, op1);
+  set_term_op2(term, op2);
+  set_term_op3(term, op3);
 
-  return string;
+  return term;
 }
 
-char* bv_variable(uint64_t bits) {
-  char* string;
+uint64_t* find_term(char* sym) {
+  uint64_t* entry;
 
-  string = string_alloc(10 + 2); // up to 64-bit variables require up to 2 decimal digits
+  entry = (uint64_t*) *(term_table + (uint64_t) sym / SIZEOFUINT64 % TERM_TABLE_SIZE);
 
-  sprintf(string, "(_ BitVec %lu)", bits);
+  // most recently bound terms come first
+  while (entry) {
+    if ((char*) *(entry + 1) == sym)
+      return (uint64_t*) *(entry + 2);
 
-  return string;
-}
+    entry = (uint64_t*) *entry;
+  }
 
-char* bv_zero_extension(uint64_t bits) {
-  char* string;
+  if (string_compare(sym, "true")) {
+    // the initial path condition is the only string not created by the engine
+    bind_term(sym, new_term(TERM_CONSTANT, 1, (uint64_t*) 1, (uint64_t*) 0, (uint64_t*) 0));
 
-  string = string_alloc(15 + 2); // up to 64-bit variables require up to 2 decimal digits
+    return find_term(sym);
+  }
 
-  sprintf(string, "(_ zero_extend %lu)", WORDSIZEINBITS - bits);
+  use_stdout();
 
-  return string;
-}
+  printf("%s: no term for SMT-LIB string %s\n", selfie_name, sym);
 
-char* smt_value(uint64_t val, char* sym) {
-  if (sym)
-    return sym;
-  else
-    return bv_constant(val);
+  exit(EXITCODE_SYMBOLICEXECUTIONERROR);
 }
 
-char* smt_variable(char* prefix, uint64_t bits) {
-  char* svar;
-
-  svar = string_alloc(string_length(prefix) + 20); // 64-bit numbers require up to 20 decimal digits
+void bind_term(char* sym, uint64_t* term) {
+  uint64_t* bucket;
+  uint64_t* entry;
 
-  sprintf(svar, "%s%lu", prefix, variable_version);
+  bucket = term_table + (uint64_t) sym / SIZEOFUINT64 % TERM_TABLE_SIZE;
 
-  dprintf(output_fd, "(declare-fun %s () (_ BitVec %lu)); variable for ", svar, bits);
-  print_code_context_for_instruction(pc);
-  println();
+  entry = smalloc(3 * SIZEOFUINT64STAR);
 
-  variable_version = variable_version + 1;
+  *entry       = *bucket;
+  *(entry + 1) = (uint64_t) sym;
+  *(entry + 2) = (uint64_t) term;
 
-  return svar;
+  *bucket = (uint64_t) entry;
 }
 
-char* smt_unary(char* opt, char* op) {
-  char* string;
+void define_term(char* var, char* sym) {
+  // variables defined by assertions are bound to the terms of their
+  // definitions so that only input variables remain free
+  if (prune)
+    bind_term(var, find_term(sym));
+}
 
-  string = string_alloc(1 + string_length(opt) + 1 + string_length(op) + 1);
+void bind_unary_term(char* string, char* opt, char* op) {
+  uint64_t* operand;
 
-  sprintf(string, "(%s %s)", opt, op);
+  operand = find_term(op);
 
-  return string;
+  if (string_compare(opt, "not"))
+    bind_term(string, new_term(TERM_NOT, get_term_width(operand), operand, (uint64_t*) 0, (uint64_t*) 0));
+  else
+    // any other unary operator is a zero extension to a machine word
+    bind_term(string, new_term(TERM_ZEXT, WORDSIZEINBITS, operand, (uint64_t*) 0, (uint64_t*) 0));
 }
 
-char* smt_binary(char* opt, char* op1, char* op2) {
-  char* string;
-
-  string = string_alloc(1 + string_length(opt) + 1 + string_length(op1) + 1 + string_length(op2) + 1);
+void bind_binary_term(char* string, char* opt, char* op1, char* op2) {
+  uint64_t operator;
+  uint64_t width;
+
+  width = get_term_width(find_term(op1));
+
+  if (string_compare(opt, "bvadd"))
+    operator = TERM_ADD;
+  else if (string_compare(opt, "bvsub"))
+    operator = TERM_SUB;
+  else if (string_compare(opt, "bvmul"))
+    operator = TERM_MUL;
+  else if (string_compare(opt, "bvudiv"))
+    operator = TERM_UDIV;
+  else if (string_compare(opt, "bvurem"))
+    operator = TERM_UREM;
+  else if (string_compare(opt, "and"))
+    operator = TERM_AND;
+  else if (string_compare(opt, "or"))
+    operator = TERM_OR;
+  else {
+    if (string_compare(opt, "bvult"))
+      operator = TERM_ULT;
+    else
+      // bvcomp and = are both equality of bit vectors
+      operator = TERM_EQ;
 
-  sprintf(string, "(%s %s %s)", opt, op1, op2);
+    width = 1;
+  }
 
-  return string;
+  bind_term(string, new_term(operator, width, find_term(op1), find_term(op2), (uint64_t*) 0));
 }
 
-char* smt_ternary(char* opt, char* op1, char* op2, char* op3) {
-  char* string;
+uint64_t new_gate() {
+  uint64_t variable;
 
-  string = string_alloc(1 + string_length(opt) + 1 + string_length(op1) + 1 + string_length(op2) + 1 + string_length(op3) + 1);
+  variable = new_sat_variable();
 
-  sprintf(string, "(%s %s %s %s)", opt, op1, op2, op3);
+  // only variables in the cone of a query are decided, see solve_condition
+  set_decision_variable(variable, 0);
 
-  return string;
+  return 2 * variable;
 }
 
-// node struct of the call stack tree:
-// +---+----------+
-// | 0 | parent   | pointer to parent node
-// | 1 | children | pointer to list of children
-// | 2 | sibling  | pointer to next sibling node
-// | 3 | address  | address of the method call
-// | 4 | depth    | size of the call stack represented by the given node
-// +---+----------+
+void add_gate_clause(uint64_t l1, uint64_t l2, uint64_t l3) {
+  // LITERAL_FALSE as third literal makes a binary clause
+  // since false literals are removed when clauses are added
+  *gate_clause       = l1;
+  *(gate_clause + 1) = l2;
+  *(gate_clause + 2) = l3;
 
-uint64_t* allocate_node() {
-  return zmalloc(3 * SIZEOFUINT64STAR + 2 * SIZEOFUINT64);
+  add_sat_clause(gate_clause, 3);
 }
 
-uint64_t* get_parent_node(uint64_t* node)  { return (uint64_t*) *(node + 0); }
-uint64_t* get_children(uint64_t* node)     { return (uint64_t*) *(node + 1); }
-uint64_t* get_sibling(uint64_t* node)      { return (uint64_t*) *(node + 2); }
-uint64_t  get_node_address(uint64_t* node) { return             *(node + 3); }
-uint64_t  get_depth(uint64_t* node)        { return             *(node + 4); }
+uint64_t and_gate(uint64_t a, uint64_t b) {
+  uint64_t g;
+
+  // fold constants and trivial cases rather than adding gates
+  if (a == LITERAL_FALSE)
+    return LITERAL_FALSE;
+  else if (b == LITERAL_FALSE)
+    return LITERAL_FALSE;
+  else if (a == LITERAL_TRUE)
+    return b;
+  else if (b == LITERAL_TRUE)
+    return a;
+  else if (a == b)
+    return a;
+  else if (a == negate(b))
+    return LITERAL_FALSE;
+
+  g = new_gate();
+
+  // Tseitin encoding of g <-> a and b
+  add_gate_clause(negate(g), a, LITERAL_FALSE);
+  add_gate_clause(negate(g), b, LITERAL_FALSE);
+  add_gate_clause(g, negate(a), negate(b));
+
+  return g;
+}
 
-void set_parent_node(uint64_t* node, uint64_t* parent)  { *(node + 0) = (uint64_t) parent; }
-void set_children(uint64_t* node, uint64_t* children)   { *(node + 1) = (uint64_t) children; }
-void set_sibling(uint64_t* node, uint64_t* sibling)     { *(node + 2) = (uint64_t) sibling; }
-void set_node_address(uint64_t* node, uint64_t address) { *(node + 3) = address; }
-void set_depth(uint64_t* node, uint64_t depth)          { *(node + 4) = depth; }
+uint64_t or_gate(uint64_t a, uint64_t b) {
+  return negate(and_gate(negate(a), negate(b)));
+}
 
-void merge(uint64_t* active_context, uint64_t* mergeable_context, uint64_t location) {
+uint64_t xor_gate(uint64_t a, uint64_t b) {
+  uint64_t g;
+
+  if (a == LITERAL_FALSE)
+    return b;
+  else if (b == LITERAL_FALSE)
+    return a;
+  else if (a == LITERAL_TRUE)
+    return negate(b);
+  else if (b == LITERAL_TRUE)
+    return negate(a);
+  else if (a == b)
+    return LITERAL_FALSE;
+  else if (a == negate(b))
+    return LITERAL_TRUE;
+
+  g = new_gate();
+
+  // Tseitin encoding of g <-> a xor b
+  add_gate_clause(negate(g), a, b);
+  add_gate_clause(negate(g), negate(a), negate(b));
+  add_gate_clause(g, negate(a), b);
+  add_gate_clause(g, a, negate(b));
+
+  return g;
+}
 
-  // do not merge if merging is disabled
-  if (merge_enabled == 0)
-    return;
+uint64_t ite_gate(uint64_t c, uint64_t t, uint64_t e) {
+  uint64_t g;
+
+  if (c == LITERAL_TRUE)
+    return t;
+  else if (c == LITERAL_FALSE)
+    return e;
+  else if (t == e)
+    return t;
+  else if (t == LITERAL_TRUE)
+    return or_gate(c, e);
+  else if (t == LITERAL_FALSE)
+    return and_gate(negate(c), e);
+  else if (e == LITERAL_TRUE)
+    return or_gate(negate(c), t);
+  else if (e == LITERAL_FALSE)
+    return and_gate(c, t);
+
+  g = new_gate();
+
+  // Tseitin encoding of g <-> (c ? t : e)
+  add_gate_clause(negate(g), negate(c), t);
+  add_gate_clause(negate(g), c, e);
+  add_gate_clause(g, negate(c), negate(t));
+  add_gate_clause(g, c, negate(e));
+
+  return g;
+}
 
-  dprintf(output_fd, "; merging two contexts at ");
-  print_code_context_for_instruction(location);
+uint64_t* blast_add(uint64_t* a, uint64_t* b, uint64_t carry, uint64_t width) {
+  uint64_t* sum;
+  uint64_t x;
+  uint64_t i;
 
-  if (debug_merge)
-    dprintf(output_fd, " -> active context: %lu, mergeable context: %lu", active_context, mergeable_context);
+  sum = smalloc(width * SIZEOFUINT64);
 
-  println();
+  // ripple-carry adder of full adders
+  i = 0;
 
-  // merging the symbolic store
-  merge_symbolic_memory_and_registers(active_context, mergeable_context);
+  while (i < width) {
+    x = xor_gate(*(a + i), *(b + i));
 
-  // merging the path condition
-  path_condition = smt_binary("or", get_path_condition(active_context), get_path_condition(mergeable_context));
-  set_path_condition(active_context, path_condition);
+    *(sum + i) = xor_gate(x, carry);
 
-  if (get_execution_depth(mergeable_context) < get_execution_depth(active_context))
-    set_execution_depth(active_context, get_execution_depth(mergeable_context));
+    carry = or_gate(and_gate(*(a + i), *(b + i)), and_gate(carry, x));
 
-  if (get_beq_counter(mergeable_context) < get_beq_counter(active_context))
-    set_beq_counter(active_context, get_beq_counter(mergeable_context));
+    i = i + 1;
+  }
 
-  symbolic_contexts = delete_context(mergeable_context, symbolic_contexts);
+  carry_literal = carry;
+
+  return sum;
 }
 
-void merge_symbolic_memory_and_registers(uint64_t* active_context, uint64_t* mergeable_context) {
-  // merging the symbolic memory
-  merge_symbolic_memory_of_active_context(active_context, mergeable_context);
-  merge_symbolic_memory_of_mergeable_context(active_context, mergeable_context);
+uint64_t* blast_not(uint64_t* a, uint64_t width) {
+  uint64_t* bits;
+  uint64_t i;
 
-  // merging the registers
-  merge_registers(active_context, mergeable_context);
+  bits = smalloc(width * SIZEOFUINT64);
 
-  // the shared symbolic memory space needs needs to be updated since the other context was merged into the active context
-  update_begin_of_shared_symbolic_memory(active_context);
-}
+  i = 0;
 
-void merge_symbolic_memory_of_active_context(uint64_t* active_context, uint64_t* mergeable_context) {
-  uint64_t* sword_from_active_context;
-  uint64_t* sword_from_mergeable_context;
-  uint64_t  in_unshared_symbolic_memory;
+  while (i < width) {
+    *(bits + i) = negate(*(a + i));
 
-  sword_from_active_context = symbolic_memory;
+    i = i + 1;
+  }
+
+  return bits;
+}
+
+uint64_t* blast_and(uint64_t* a, uint64_t* b, uint64_t width) {
+  uint64_t* bits;
+  uint64_t i;
+
+  bits = smalloc(width * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < width) {
+    *(bits + i) = and_gate(*(a + i), *(b + i));
+
+    i = i + 1;
+  }
+
+  return bits;
+}
+
+uint64_t* blast_ite(uint64_t c, uint64_t* t, uint64_t* e, uint64_t width) {
+  uint64_t* bits;
+  uint64_t i;
+
+  bits = smalloc(width * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < width) {
+    *(bits + i) = ite_gate(c, *(t + i), *(e + i));
+
+    i = i + 1;
+  }
+
+  return bits;
+}
+
+uint64_t blast_ult(uint64_t* a, uint64_t* b, uint64_t width) {
+  uint64_t carry;
+  uint64_t i;
+
+  // a < b if there is no carry out of a + not(b) + 1,
+  // only the carry chain of the adder is needed
+  carry = LITERAL_TRUE;
+
+  i = 0;
+
+  while (i < width) {
+    carry = or_gate(and_gate(*(a + i), negate(*(b + i))), and_gate(carry, or_gate(*(a + i), negate(*(b + i)))));
+
+    i = i + 1;
+  }
+
+  return negate(carry);
+}
+
+uint64_t blast_eq(uint64_t* a, uint64_t* b, uint64_t width) {
+  uint64_t equal;
+  uint64_t i;
+
+  equal = LITERAL_TRUE;
+
+  i = 0;
+
+  while (i < width) {
+    equal = and_gate(equal, negate(xor_gate(*(a + i), *(b + i))));
+
+    i = i + 1;
+  }
+
+  return equal;
+}
+
+uint64_t* blast_mul(uint64_t* a, uint64_t* b, uint64_t width) {
+  uint64_t* product;
+  uint64_t* partial;
+  uint64_t i;
+  uint64_t j;
+
+  product = smalloc(width * SIZEOFUINT64);
+  partial = smalloc(width * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < width) {
+    *(product + i) = LITERAL_FALSE;
+
+    i = i + 1;
+  }
+
+  // shift-and-add multiplier where additions of partial
+  // products that are known to be zero are skipped
+  i = 0;
+
+  while (i < width) {
+    if (*(b + i) != LITERAL_FALSE) {
+      j = 0;
+
+      while (j < width) {
+        if (j < i)
+          *(partial + j) = LITERAL_FALSE;
+        else
+          *(partial + j) = and_gate(*(a + j - i), *(b + i));
+
+        j = j + 1;
+      }
+
+      product = blast_add(product, partial, LITERAL_FALSE, width);
+    }
+
+    i = i + 1;
+  }
+
+  return product;
+}
+
+uint64_t* blast_udiv_urem(uint64_t* a, uint64_t* b, uint64_t width, uint64_t remainder) {
+  uint64_t* quotient;
+  uint64_t* rest;
+  uint64_t* shifted;
+  uint64_t* difference;
+  uint64_t* not_b;
+  uint64_t top;
+  uint64_t greater_or_equal;
+  uint64_t i;
+  uint64_t j;
+
+  quotient = smalloc(width * SIZEOFUINT64);
+  rest     = smalloc(width * SIZEOFUINT64);
+  shifted  = smalloc(width * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < width) {
+    *(rest + i) = LITERAL_FALSE;
+
+    i = i + 1;
+  }
+
+  not_b = blast_not(b, width);
+
+  // restoring division, most significant bit of the dividend first,
+  // which also yields the SMT-LIB semantics of division by zero:
+  // a quotient of all ones and the dividend as remainder
+  i = width;
+
+  while (i > 0) {
+    i = i - 1;
+
+    // shift the next bit of the dividend into the rest
+    top = *(rest + width - 1);
+
+    *shifted = *(a + i);
+
+    j = 1;
+
+    while (j < width) {
+      *(shifted + j) = *(rest + j - 1);
+
+      j = j + 1;
+    }
+
+    difference = blast_add(shifted, not_b, LITERAL_TRUE, width);
+
+    // the carry indicates shifted >= b unless the top bit was shifted out
+    greater_or_equal = or_gate(top, carry_literal);
+
+    *(quotient + i) = greater_or_equal;
+
+    rest = blast_ite(greater_or_equal, difference, shifted, width);
+  }
+
+  if (remainder)
+    return rest;
+  else
+    return quotient;
+}
+
+uint64_t* blast_operand(uint64_t* term, uint64_t width) {
+  uint64_t* bits;
+  uint64_t* extended;
+  uint64_t i;
+
+  bits = bit_blast(term);
+
+  if (get_term_width(term) >= width)
+    return bits;
+
+  // narrower operands are zero-extended
+  extended = smalloc(width * SIZEOFUINT64);
+
+  i = 0;
+
+  while (i < width) {
+    if (i < get_term_width(term))
+      *(extended + i) = *(bits + i);
+    else
+      *(extended + i) = LITERAL_FALSE;
+
+    i = i + 1;
+  }
+
+  return extended;
+}
+
+uint64_t* bit_blast(uint64_t* term) {
+  uint64_t* bits;
+  uint64_t* a;
+  uint64_t operator;
+  uint64_t width;
+  uint64_t i;
+
+  if (get_term_bits(term))
+    return get_term_bits(term);
+
+  operator = get_term_operator(term);
+  width    = get_term_width(term);
+
+  if (operator != TERM_CONSTANT)
+    if (operator != TERM_VARIABLE) {
+      // blast operands first so that the SAT variables
+      // introduced for this term are contiguous
+      bit_blast(get_term_op1(term));
+
+      if (get_term_op2(term))
+        bit_blast(get_term_op2(term));
+      if (get_term_op3(term))
+        bit_blast(get_term_op3(term));
+    }
+
+  set_term_gates(term, number_of_sat_variables);
+
+  if (operator == TERM_ULT) {
+    a = bit_blast(get_term_op1(term));
+
+    bits  = smalloc(SIZEOFUINT64);
+    *bits = blast_ult(a, blast_operand(get_term_op2(term), get_term_width(get_term_op1(term))), get_term_width(get_term_op1(term)));
+  } else if (operator == TERM_EQ) {
+    a = bit_blast(get_term_op1(term));
+
+    bits  = smalloc(SIZEOFUINT64);
+    *bits = blast_eq(a, blast_operand(get_term_op2(term), get_term_width(get_term_op1(term))), get_term_width(get_term_op1(term)));
+  } else if (operator == TERM_ADD)
+    bits = blast_add(blast_operand(get_term_op1(term), width), blast_operand(get_term_op2(term), width), LITERAL_FALSE, width);
+  else if (operator == TERM_SUB)
+    bits = blast_add(blast_operand(get_term_op1(term), width), blast_not(blast_operand(get_term_op2(term), width), width), LITERAL_TRUE, width);
+  else if (operator == TERM_MUL)
+    bits = blast_mul(blast_operand(get_term_op1(term), width), blast_operand(get_term_op2(term), width), width);
+  else if (operator == TERM_UDIV)
+    bits = blast_udiv_urem(blast_operand(get_term_op1(term), width), blast_operand(get_term_op2(term), width), width, 0);
+  else if (operator == TERM_UREM)
+    bits = blast_udiv_urem(blast_operand(get_term_op1(term), width), blast_operand(get_term_op2(term), width), width, 1);
+  else if (operator == TERM_ZEXT)
+    bits = blast_operand(get_term_op1(term), width);
+  else if (operator == TERM_NOT)
+    bits = blast_not(bit_blast(get_term_op1(term)), width);
+  else if (operator == TERM_AND)
+    bits = blast_and(blast_operand(get_term_op1(term), width), blast_operand(get_term_op2(term), width), width);
+  else if (operator == TERM_OR)
+    // De Morgan
+    bits = blast_not(blast_and(blast_not(blast_operand(get_term_op1(term), width), width),
+      blast_not(blast_operand(get_term_op2(term), width), width), width), width);
+  else if (operator == TERM_ITE)
+    bits = blast_ite(*bit_blast(get_term_op1(term)), blast_operand(get_term_op2(term), width), blast_operand(get_term_op3(term), width), width);
+  else {
+    // leaves
+    bits = smalloc(width * SIZEOFUINT64);
+
+    i = 0;
+
+    while (i < width) {
+      if (operator == TERM_CONSTANT) {
+        if (get_bits(get_term_value(term), i, 1))
+          *(bits + i) = LITERAL_TRUE;
+        else
+          *(bits + i) = LITERAL_FALSE;
+      } else {
+        // fresh SAT variables for the bits of input variables
+        *(bits + i) = new_gate();
+
+        // decide inputs first since they determine all gates
+        bump_activity(get_variable(*(bits + i)));
+      }
+
+      i = i + 1;
+    }
+  }
+
+  set_term_bits(term, bits);
+  set_term_end(term, number_of_sat_variables);
+
+  number_of_terms = number_of_terms + 1;
+
+  return bits;
+}
+
+void set_cone_decisions(uint64_t* term, uint64_t decision, uint64_t stamp) {
+  uint64_t variable;
+
+  if (get_term_stamp(term) == stamp)
+    return;
+
+  set_term_stamp(term, stamp);
+
+  variable = get_term_gates(term);
+
+  while (variable < get_term_end(term)) {
+    set_decision_variable(variable, decision);
+
+    variable = variable + 1;
+  }
+
+  if (get_term_operator(term) != TERM_CONSTANT)
+    if (get_term_operator(term) != TERM_VARIABLE) {
+      set_cone_decisions(get_term_op1(term), decision, stamp);
+
+      if (get_term_op2(term))
+        set_cone_decisions(get_term_op2(term), decision, stamp);
+      if (get_term_op3(term))
+        set_cone_decisions(get_term_op3(term), decision, stamp);
+    }
+}
+
+uint64_t solve_condition(char* condition) {
+  uint64_t* term;
+  uint64_t literal;
+  uint64_t result;
+
+  term = find_term(condition);
+
+  literal = *bit_blast(term);
+
+  if (literal == LITERAL_TRUE)
+    return SAT;
+  else if (literal == LITERAL_FALSE)
+    return UNSAT;
+
+  number_of_queries = number_of_queries + 1;
+
+  // Tseitin encoding determines all variables by the input variables,
+  // so deciding only variables in the cone of the condition is enough
+  set_cone_decisions(term, 1, 2 * number_of_queries);
+
+  // clauses learnt while solving one condition are kept for the next
+  conflict_budget = CONFLICTS_PER_QUERY;
+
+  result = solve_under_assumption(literal);
+
+  set_cone_decisions(term, 0, 2 * number_of_queries + 1);
+
+  if (result == UNKNOWN)
+    number_of_unknowns = number_of_unknowns + 1;
+
+  return result;
+}
+
+uint64_t is_feasible(char* condition) {
+  if (prune)
+    if (solve_condition(condition) == UNSAT) {
+      number_of_pruned_branches = number_of_pruned_branches + 1;
+
+      return 0;
+    }
+
+  // unknown conditions are considered feasible
+  return 1;
+}
+
+void check_condition(char* condition) {
+  uint64_t result;
+
+  if (prune) {
+    result = solve_condition(condition);
+
+    number_of_checks = number_of_checks + 1;
+
+    if (result == SAT) {
+      number_of_sat_checks = number_of_sat_checks + 1;
+
+      dprintf(output_fd, "; sat by bit-blasting\n");
+    } else if (result == UNSAT)
+      dprintf(output_fd, "; unsat by bit-blasting\n");
+    else
+      dprintf(output_fd, "; unknown by bit-blasting\n");
+  }
+}
+
+void init_bit_blasting() {
+  term_table = zmalloc(TERM_TABLE_SIZE * SIZEOFUINT64STAR);
+
+  gate_clause = smalloc(3 * SIZEOFUINT64);
+
+  init_incremental_solver();
+
+  // the first variable is true, see LITERAL_TRUE
+  *gate_clause = 2 * new_sat_variable();
+
+  add_sat_clause(gate_clause, 1);
+}
+
+// -----------------------------------------------------------------
+// ------------------- SYMBOLIC EXECUTION ENGINE -------------------
+// -----------------------------------------------------------------
+
+char* bv_constant(uint64_t value) {
+  char* string;
+
+  string = find_smt_term("_", (char*) value, (char*) 0, (char*) 0);
+
+  if (string == (char*) 0) {
+    string = string_alloc(5 + 20 + 4); // 64-bit numbers require up to 20 decimal digits
+
+    sprintf(string, "(_ bv%lu 64)", value);
+
+    new_smt_term("_", (char*) value, (char*) 0, (char*) 0, string, WORDSIZEINBITS);
+
+    if (prune)
+      bind_term(string, new_term(TERM_CONSTANT, WORDSIZEINBITS, (uint64_t*) value, (uint64_t*) 0, (uint64_t*) 0));
+  }
+
+  return string;
+}
+
+char* bv_variable(uint64_t bits) {
+  char* string;
+
+  string = string_alloc(10 + 2); // up to 64-bit variables require up to 2 decimal digits
+
+  sprintf(string, "(_ BitVec %lu)", bits);
+
+  return string;
+}
+
+char* bv_zero_extension(uint64_t bits) {
+  char* string;
+
+  string = string_alloc(15 + 2); // up to 64-bit variables require up to 2 decimal digits
+
+  sprintf(string, "(_ zero_extend %lu)", WORDSIZEINBITS - bits);
+
+  return string;
+}
+
+char* smt_value(uint64_t val, char* sym) {
+  if (sym)
+    return sym;
+  else
+    return bv_constant(val);
+}
+
+char* smt_variable(char* prefix, uint64_t bits) {
+  char* svar;
+
+  svar = string_alloc(string_length(prefix) + 20); // 64-bit numbers require up to 20 decimal digits
+
+  sprintf(svar, "%s%lu", prefix, variable_version);
+
+  dprintf(output_fd, "(declare-fun %s () (_ BitVec %lu)); variable for ", svar, bits);
+  print_code_context_for_instruction(pc);
+  println();
+
+  variable_version = variable_version + 1;
+
+  new_smt_term("declare-fun", svar, (char*) 0, (char*) 0, svar, bits);
+
+  if (prune)
+    bind_term(svar, new_term(TERM_VARIABLE, bits, (uint64_t*) 0, (uint64_t*) 0, (uint64_t*) 0));
+
+  return svar;
+}
+
+char* smt_unary(char* opt, char* op) {
+  char* string;
+
+  string = find_smt_term(opt, op, (char*) 0, (char*) 0);
+
+  if (string == (char*) 0) {
+    if (string_compare(opt, "not"))
+      string = compose_smt_term(opt, op, (char*) 0, (char*) 0, get_smt_width(op));
+    else
+      // any other unary operator is a zero extension to a machine word
+      string = compose_smt_term(opt, op, (char*) 0, (char*) 0, WORDSIZEINBITS);
+
+    if (prune)
+      bind_unary_term(string, opt, op);
+  }
+
+  return string;
+}
+
+char* smt_binary(char* opt, char* op1, char* op2) {
+  char* string;
+
+  string = find_smt_term(opt, op1, op2, (char*) 0);
+
+  if (string == (char*) 0) {
+    if (string_compare(opt, "bvult"))
+      string = compose_smt_term(opt, op1, op2, (char*) 0, 1);
+    else if (string_compare(opt, "bvcomp"))
+      string = compose_smt_term(opt, op1, op2, (char*) 0, 1);
+    else if (string_compare(opt, "="))
+      string = compose_smt_term(opt, op1, op2, (char*) 0, 1);
+    else
+      string = compose_smt_term(opt, op1, op2, (char*) 0, get_smt_width(op1));
+
+    if (prune)
+      bind_binary_term(string, opt, op1, op2);
+  }
+
+  return string;
+}
+
+char* smt_ternary(char* opt, char* op1, char* op2, char* op3) {
+  char* string;
+
+  string = find_smt_term(opt, op1, op2, op3);
+
+  if (string == (char*) 0) {
+    // ite is the only ternary operator
+    string = compose_smt_term(opt, op1, op2, op3, get_smt_width(op2));
+
+    if (prune)
+      bind_term(string, new_term(TERM_ITE, get_term_width(find_term(op2)), find_term(op1), find_term(op2), find_term(op3)));
+  }
+
+  return string;
+}
+
+uint64_t hash_smt_term(char* opt, char* op1, char* op2, char* op3) {
+  uint64_t key;
+  uint64_t i;
+
+  key = 0;
+
+  i = 0;
+
+  while (load_character(opt, i) != 0) {
+    key = key * 31 + load_character(opt, i);
+
+    i = i + 1;
+  }
+
+  key = key * 31 + (uint64_t) op1;
+  key = key * 31 + (uint64_t) op2;
+  key = key * 31 + (uint64_t) op3;
+
+  return key % SMT_TABLE_SIZE;
+}
+
+char* find_smt_term(char* opt, char* op1, char* op2, char* op3) {
+  uint64_t* term;
+
+  term = (uint64_t*) *(smt_terms + hash_smt_term(opt, op1, op2, op3));
+
+  while (term) {
+    // operands are hash-consed and thus equal if their strings are identical
+    if (get_smt_op1(term) == op1)
+      if (get_smt_op2(term) == op2)
+        if (get_smt_op3(term) == op3)
+          if (string_compare(get_smt_operator(term), opt)) {
+            number_of_smt_shares = number_of_smt_shares + 1;
+
+            return get_smt_string(term);
+          }
+
+    term = get_smt_next(term);
+  }
+
+  return (char*) 0;
+}
+
+uint64_t* new_smt_term(char* opt, char* op1, char* op2, char* op3, char* string, uint64_t width) {
+  uint64_t* term;
+  uint64_t* bucket;
+
+  term = allocate_smt_term();
+
+  number_of_smt_terms = number_of_smt_terms + 1;
+
+  set_smt_operator(term, opt);
+  set_smt_op1(term, op1);
+  set_smt_op2(term, op2);
+  set_smt_op3(term, op3);
+  set_smt_string(term, string);
+  set_smt_width(term, width);
+
+  bucket = smt_terms + hash_smt_term(opt, op1, op2, op3);
+
+  set_smt_next(term, (uint64_t*) *bucket);
+
+  *bucket = (uint64_t) term;
+
+  bucket = smt_symbols + (uint64_t) string / SIZEOFUINT64 % SMT_TABLE_SIZE;
+
+  set_smt_alias(term, (uint64_t*) *bucket);
+
+  *bucket = (uint64_t) term;
+
+  return term;
+}
+
+uint64_t* find_smt_string(char* sym) {
+  uint64_t* term;
+
+  term = (uint64_t*) *(smt_symbols + (uint64_t) sym / SIZEOFUINT64 % SMT_TABLE_SIZE);
+
+  while (term) {
+    if (get_smt_string(term) == sym)
+      return term;
+
+    term = get_smt_alias(term);
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t get_smt_width(char* sym) {
+  uint64_t* term;
+
+  term = find_smt_string(sym);
+
+  if (term)
+    return get_smt_width_of(term);
+  else
+    // the initial path condition true is the only
+    // string not created by the engine, see find_term
+    return 1;
+}
 
-  while (sword_from_active_context) {
-    // we need to stop at the end of the unshared symbolic memory space of the active context
-    if (get_word_address(sword_from_active_context) == BEGIN_OF_SHARED_SYMBOLIC_MEMORY)
-      return;
+char* compose_smt_term(char* opt, char* op1, char* op2, char* op3, uint64_t width) {
+  char* string;
 
-    // check if the word has not already been deleted
-    if (get_word_address(sword_from_active_context) != (uint64_t) DELETED) {
-      // check if the word has not already been merged
-      if (get_word_address(sword_from_active_context) != (uint64_t) MERGED) {
-        sword_from_mergeable_context = get_symbolic_memory(mergeable_context);
-        in_unshared_symbolic_memory = 1;
-
-        while (sword_from_mergeable_context) {
-          // we need to know if we are in the unshared symbolic memory space of the mergeable context
-          if (get_word_address(sword_from_mergeable_context) == BEGIN_OF_SHARED_SYMBOLIC_MEMORY)
-            in_unshared_symbolic_memory = 0;
-
-          if (get_word_address(sword_from_active_context) == get_word_address(sword_from_mergeable_context)) {
-            if (get_word_symbolic(sword_from_active_context) != (char*) 0) {
-              if (get_word_symbolic(sword_from_mergeable_context) != (char*) 0) {
-                if (get_word_symbolic(sword_from_active_context) != get_word_symbolic(sword_from_mergeable_context)) {
-                  // merge symbolic values if they are different
-                  set_word_symbolic(sword_from_active_context,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      get_word_symbolic(sword_from_active_context),
-                      get_word_symbolic(sword_from_mergeable_context)
-                    )
-                  );
-
-                  // we mark the word as merged so that we do not merge it again when merging from the side of the mergeable context
-                  if (in_unshared_symbolic_memory)
-                    set_word_address(sword_from_mergeable_context, MERGED);
-
-                  // we need to break out of the loop
-                  sword_from_mergeable_context = (uint64_t*) - 1;
-                }
-              } else {
-                // merge symbolic value and concrete value
-                set_word_symbolic(sword_from_active_context,
-                  smt_ternary("ite",
-                    get_path_condition(active_context),
-                    get_word_symbolic(sword_from_active_context),
-                    bv_constant(get_word_value(sword_from_mergeable_context))
-                  )
-                );
-
-                // we mark the word as merged so that we do not merge it again when merging from the side of the mergeable context
-                if (in_unshared_symbolic_memory)
-                  set_word_address(sword_from_mergeable_context, MERGED);
-
-                // we need to break out of the loop
-                sword_from_mergeable_context = (uint64_t*) - 1;
-              }
-            } else {
-              if (get_word_symbolic(sword_from_mergeable_context) != (char*) 0) {
-                // merge concrete value and symbolic value
-                set_word_symbolic(sword_from_active_context,
-                  smt_ternary("ite",
-                    get_path_condition(active_context),
-                    bv_constant(get_word_value(sword_from_active_context)),
-                    get_word_symbolic(sword_from_mergeable_context)
-                  )
-                );
-
-                // we mark the word as merged so that we do not merge it again when merging from the side of the mergeable context
-                if (in_unshared_symbolic_memory)
-                  set_word_address(sword_from_mergeable_context, MERGED);
-
-                // we need to break out of the loop
-                sword_from_mergeable_context = (uint64_t*) - 1;
-              } else {
-                if (get_word_value(sword_from_active_context) != get_word_value(sword_from_mergeable_context)) {
-                  // merge concrete values if they are different
-                  set_word_symbolic(sword_from_active_context,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      bv_constant(get_word_value(sword_from_active_context)),
-                      bv_constant(get_word_value(sword_from_mergeable_context))
-                    )
-                  );
-
-                  // we mark the word as merged so that we do not merge it again when merging from the side of the mergeable context
-                  if (in_unshared_symbolic_memory)
-                    set_word_address(sword_from_mergeable_context, MERGED);
-
-                  // we need to break out of the loop
-                  sword_from_mergeable_context = (uint64_t*) - 1;
-                }
-              }
-            }
-          }
-          if (sword_from_mergeable_context == (uint64_t*) - 1)
-            sword_from_mergeable_context = (uint64_t*) 0;
-          else
-            sword_from_mergeable_context = get_next_word(sword_from_mergeable_context);
-        }
-      }
-    }
+  // long operands are referred to by name,
+  // bounding the size of terms and thus keeping output linear
+  name_smt_operand(op1);
+  name_smt_operand(op2);
+  name_smt_operand(op3);
+
+  if (op3) {
+    string = string_alloc(1 + string_length(opt) + 1 + string_length(op1) + 1 + string_length(op2) + 1 + string_length(op3) + 1);
+
+    sprintf(string, "(%s %s %s %s)", opt, op1, op2, op3);
+  } else if (op2) {
+    string = string_alloc(1 + string_length(opt) + 1 + string_length(op1) + 1 + string_length(op2) + 1);
 
-    sword_from_active_context = get_next_word(sword_from_active_context);
+    sprintf(string, "(%s %s %s)", opt, op1, op2);
+  } else {
+    string = string_alloc(1 + string_length(opt) + 1 + string_length(op1) + 1);
+
+    sprintf(string, "(%s %s)", opt, op1);
   }
+
+  new_smt_term(opt, op1, op2, op3, string, width);
+
+  return string;
 }
 
-void merge_symbolic_memory_of_mergeable_context(uint64_t* active_context, uint64_t* mergeable_context) {
-  uint64_t* sword_from_active_context;
-  uint64_t* sword_from_mergeable_context;
-  uint64_t* sword;
-  uint64_t* additional_memory;
-  uint64_t  shared_symbolic_memory_depth;
+void name_smt_operand(char* sym) {
+  uint64_t* term;
+  char* definition;
 
-  additional_memory = symbolic_memory;
-  sword_from_mergeable_context = get_symbolic_memory(mergeable_context);
+  term = find_smt_string(sym);
 
-  while (sword_from_mergeable_context) {
-    // we need to stop at the end of the unshared symbolic memory space of the mergeable context
-    if (get_word_address(sword_from_mergeable_context) == BEGIN_OF_SHARED_SYMBOLIC_MEMORY) {
-      symbolic_memory = additional_memory;
+  if (term)
+    // composed terms begin with an opening parenthesis unless
+    // they have been named, constants also but are never long
+    if (load_character(sym, 0) == '(')
+      if (string_length(sym) > MAX_SMT_OPERAND_LENGTH) {
+        definition = string_alloc(string_length(sym));
 
-      // the active context contains now the merged symbolic memory
-      set_symbolic_memory(active_context, symbolic_memory);
-      return;
-    }
+        sprintf(definition, "%s", sym);
 
-    // check if the word has not already been deleted
-    if (get_word_address(sword_from_mergeable_context) != (uint64_t) DELETED) {
-      // check if the word has not already been merged
-      if (get_word_address(sword_from_mergeable_context) != (uint64_t) MERGED) {
-        sword_from_active_context = symbolic_memory;
-        shared_symbolic_memory_depth = 0;
-
-        while (sword_from_active_context) {
-          // we need to know how far we are into the shared symbolic memory space
-          if (get_word_address(sword_from_active_context) == (uint64_t) BEGIN_OF_SHARED_SYMBOLIC_MEMORY)
-            shared_symbolic_memory_depth = shared_symbolic_memory_depth + 1;
-
-          if (get_word_address(sword_from_active_context) == get_word_address(sword_from_mergeable_context)) {
-            if (get_word_symbolic(sword_from_active_context) != (char*) 0) {
-              if (get_word_symbolic(sword_from_mergeable_context) != (char*) 0) {
-                if (get_word_symbolic(sword_from_active_context) != get_word_symbolic(sword_from_mergeable_context)) {
-                  // merge symbolic values if they are different
-                  if (shared_symbolic_memory_depth < 2)
-                    set_word_symbolic(sword_from_active_context,
-                      smt_ternary("ite",
-                        get_path_condition(active_context),
-                        get_word_symbolic(sword_from_active_context),
-                        get_word_symbolic(sword_from_mergeable_context)
-                      )
-                    );
-                  else {
-                    // if we are too far into the shared symbolic memory space, we must not overwrite the value,
-                    // but insert it into the unshared symbolic memory space of the active context
-                    sword = allocate_symbolic_memory_word();
-                    set_word_address(sword, get_word_address(sword_from_active_context));
-                    set_word_value(sword, get_word_value(sword_from_active_context));
-                    set_number_of_bits(sword, get_number_of_bits(sword_from_active_context));
-                    set_word_symbolic(sword,
-                      smt_ternary("ite",
-                        get_path_condition(active_context),
-                        get_word_symbolic(sword_from_active_context),
-                        get_word_symbolic(sword_from_mergeable_context)
-                      )
-                    );
-                    set_next_word(sword, additional_memory);
-                  }
-
-                  // we need to break out of the loop
-                  sword_from_active_context = (uint64_t*) - 1;
-                }
-              } else {
-                // merge symbolic value and concrete value
-                if (shared_symbolic_memory_depth < 2)
-                  set_word_symbolic(sword_from_active_context,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      get_word_symbolic(sword_from_active_context),
-                      bv_constant(get_word_value(sword_from_mergeable_context))
-                    )
-                  );
-                else {
-                  // if we are too far into the shared symbolic memory space, we must not overwrite the value,
-                  // but insert it into the unshared symbolic memory space of the active context
-                  sword = allocate_symbolic_memory_word();
-                  set_word_address(sword, get_word_address(sword_from_active_context));
-                  set_word_value(sword, get_word_value(sword_from_active_context));
-                  set_number_of_bits(sword, get_number_of_bits(sword_from_active_context));
-                  set_word_symbolic(sword,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      get_word_symbolic(sword_from_active_context),
-                      bv_constant(get_word_value(sword_from_mergeable_context))
-                    )
-                  );
-                  set_next_word(sword, additional_memory);
-                }
-
-                // we need to break out of the loop
-                sword_from_active_context = (uint64_t*) - 1;
-              }
-            } else {
-              if (get_word_symbolic(sword_from_mergeable_context) != (char*) 0) {
-                // merge concrete value and symbolic value
-                if (shared_symbolic_memory_depth < 2)
-                  set_word_symbolic(sword_from_active_context,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      bv_constant(get_word_value(sword_from_active_context)),
-                      get_word_symbolic(sword_from_mergeable_context)
-                    )
-                  );
-                else {
-                  // if we are too far into the shared symbolic memory space, we must not overwrite the value,
-                  // but insert it into the unshared symbolic memory space of the active context
-                  sword = allocate_symbolic_memory_word();
-                  set_word_address(sword, get_word_address(sword_from_active_context));
-                  set_word_value(sword, get_word_value(sword_from_active_context));
-                  set_number_of_bits(sword, get_number_of_bits(sword_from_active_context));
-                  set_word_symbolic(sword,
-                    smt_ternary("ite",
-                      get_path_condition(active_context),
-                      bv_constant(get_word_value(sword_from_active_context)),
-                      get_word_symbolic(sword_from_mergeable_context)
-                    )
-                  );
-                  set_next_word(sword, additional_memory);
-                }
-
-                // we need to break out of the loop
-                sword_from_active_context = (uint64_t*) - 1;
-              } else {
-                if (get_word_value(sword_from_active_context) != get_word_value(sword_from_mergeable_context)) {
-                  // merge concrete values if they are different
-                  if (shared_symbolic_memory_depth < 2)
-                    set_word_symbolic(sword_from_active_context,
-                      smt_ternary("ite",
-                        get_path_condition(active_context),
-                        bv_constant(get_word_value(sword_from_active_context)),
-                        bv_constant(get_word_value(sword_from_mergeable_context))
-                      )
-                    );
-                  else {
-                    // if we are too far into the shared symbolic memory space, we must not overwrite the value,
-                    // but insert it into the unshared symbolic memory space of the active context
-                    sword = allocate_symbolic_memory_word();
-                    set_word_address(sword, get_word_address(sword_from_active_context));
-                    set_word_value(sword, get_word_value(sword_from_active_context));
-                    set_number_of_bits(sword, get_number_of_bits(sword_from_active_context));
-                    set_word_symbolic(sword,
-                      smt_ternary("ite",
-                        get_path_condition(active_context),
-                        bv_constant(get_word_value(sword_from_active_context)),
-                        bv_constant(get_word_value(sword_from_mergeable_context))
-                      )
-                    );
-                    set_next_word(sword, additional_memory);
-                  }
-
-                  // we need to break out of the loop
-                  sword_from_active_context = (uint64_t*) - 1;
-                }
-              }
-            }
+        set_smt_definition(term, definition);
+
+        // terms printed before being named still need to be defined
+        set_smt_defined(term, 0);
+
+        // the name fits into the string of the term which
+        // thus keeps its identity for hash-consing
+        sprintf(sym, "t%lu", number_of_smt_names);
+
+        number_of_smt_names = number_of_smt_names + 1;
+      }
+}
+
+char* define_smt_terms(char* sym) {
+  uint64_t* term;
+  char* opt;
+
+  term = find_smt_string(sym);
+
+  if (term)
+    if (get_smt_defined(term) == 0) {
+      set_smt_defined(term, 1);
+
+      opt = get_smt_operator(term);
+
+      if (string_compare(opt, "_") == 0)
+        if (string_compare(opt, "declare-fun") == 0) {
+          // named operands are defined before their first use
+          define_smt_terms(get_smt_op1(term));
+
+          if (get_smt_op2(term))
+            define_smt_terms(get_smt_op2(term));
+          if (get_smt_op3(term))
+            define_smt_terms(get_smt_op3(term));
+
+          if (get_smt_definition(term)) {
+            dprintf(output_fd, "(define-fun %s () ", sym);
+
+            // Boolean results are 1-bit bit vectors for the engine but Bool in SMT-LIB
+            if (string_compare(opt, "bvult"))
+              dprintf(output_fd, "Bool");
+            else if (string_compare(opt, "="))
+              dprintf(output_fd, "Bool");
+            else if (string_compare(opt, "and"))
+              dprintf(output_fd, "Bool");
+            else if (string_compare(opt, "or"))
+              dprintf(output_fd, "Bool");
+            else if (string_compare(opt, "not"))
+              dprintf(output_fd, "Bool");
+            else
+              dprintf(output_fd, "(_ BitVec %lu)", get_smt_width_of(term));
+
+            dprintf(output_fd, " %s)\n", get_smt_definition(term));
+
+            number_of_smt_definitions = number_of_smt_definitions + 1;
           }
-          if (sword_from_active_context == (uint64_t*) - 1)
-            sword_from_active_context = (uint64_t*) 0;
-          else
-            sword_from_active_context = get_next_word(sword_from_active_context);
         }
-      }
     }
-    sword_from_mergeable_context = get_next_word(sword_from_mergeable_context);
+
+  return sym;
+}
+
+// node struct of the call stack tree:
+// +---+----------+
+// | 0 | parent   | pointer to parent node
+// | 1 | children | pointer to list of children
+// | 2 | sibling  | pointer to next sibling node
+// | 3 | address  | address of the method call
+// | 4 | depth    | size of the call stack represented by the given node
+// +---+----------+
+
+uint64_t* allocate_node() {
+  return zmalloc(3 * SIZEOFUINT64STAR + 2 * SIZEOFUINT64);
+}
+
+uint64_t* get_parent_node(uint64_t* node)  { return (uint64_t*) *(node + 0); }
+uint64_t* get_children(uint64_t* node)     { return (uint64_t*) *(node + 1); }
+uint64_t* get_sibling(uint64_t* node)      { return (uint64_t*) *(node + 2); }
+uint64_t  get_node_address(uint64_t* node) { return             *(node + 3); }
+uint64_t  get_depth(uint64_t* node)        { return             *(node + 4); }
+
+void set_parent_node(uint64_t* node, uint64_t* parent)  { *(node + 0) = (uint64_t) parent; }
+void set_children(uint64_t* node, uint64_t* children)   { *(node + 1) = (uint64_t) children; }
+void set_sibling(uint64_t* node, uint64_t* sibling)     { *(node + 2) = (uint64_t) sibling; }
+void set_node_address(uint64_t* node, uint64_t address) { *(node + 3) = address; }
+void set_depth(uint64_t* node, uint64_t depth)          { *(node + 4) = depth; }
+
+void merge(uint64_t* active_context, uint64_t* mergeable_context, uint64_t location) {
+
+  // do not merge if merging is disabled
+  if (merge_enabled == 0)
+    return;
+
+  dprintf(output_fd, "; merging two contexts at ");
+  print_code_context_for_instruction(location);
+
+  if (debug_merge)
+    dprintf(output_fd, " -> active context: %lu, mergeable context: %lu", active_context, mergeable_context);
+
+  println();
+
+  // merging the symbolic store
+  merge_symbolic_memory_and_registers(active_context, mergeable_context);
+
+  // merging the path condition
+  path_condition = smt_binary("or", get_path_condition(active_context), get_path_condition(mergeable_context));
+  set_path_condition(active_context, path_condition);
+
+  if (get_execution_depth(mergeable_context) < get_execution_depth(active_context))
+    set_execution_depth(active_context, get_execution_depth(mergeable_context));
+
+  if (get_beq_counter(mergeable_context) < get_beq_counter(active_context))
+    set_beq_counter(active_context, get_beq_counter(mergeable_context));
+
+  dequeue_symbolic_context(mergeable_context);
+
+  symbolic_contexts = delete_context(mergeable_context, symbolic_contexts);
+
+  number_of_merged_contexts = number_of_merged_contexts + 1;
+  number_of_live_contexts   = number_of_live_contexts - 1;
+}
+
+void merge_symbolic_memory_and_registers(uint64_t* active_context, uint64_t* mergeable_context) {
+  // merging the symbolic memory of the active context which is not
+  // necessarily the current context, for example, if that has exited
+  set_symbolic_memory(active_context, merge_symbolic_memory(active_context,
+    get_symbolic_memory(active_context), get_symbolic_memory(mergeable_context)));
+
+  // merging the registers
+  merge_registers(active_context, mergeable_context);
+}
+
+uint64_t* merge_symbolic_memory(uint64_t* active_context, uint64_t* active_trie, uint64_t* mergeable_trie) {
+  uint64_t active_level;
+  uint64_t mergeable_level;
+  uint64_t active_prefix;
+  uint64_t mergeable_prefix;
+
+  // subtries shared by both contexts need no merging
+  if (active_trie == mergeable_trie)
+    return active_trie;
+  else if (active_trie == (uint64_t*) 0)
+    return merge_symbolic_memory_of_one_context(active_context, mergeable_trie, 0);
+  else if (mergeable_trie == (uint64_t*) 0)
+    return merge_symbolic_memory_of_one_context(active_context, active_trie, 1);
+
+  active_level     = get_trie_level(active_trie);
+  mergeable_level  = get_trie_level(mergeable_trie);
+  active_prefix    = get_trie_prefix(active_trie);
+  mergeable_prefix = get_trie_prefix(mergeable_trie);
+
+  if (active_level == mergeable_level) {
+    if (active_prefix == mergeable_prefix) {
+      if (is_symbolic_memory_word(active_trie))
+        return merge_symbolic_memory_words(active_context, active_trie, mergeable_trie);
+      else
+        return new_symbolic_memory_node(active_prefix, active_level,
+          merge_symbolic_memory(active_context, get_left_trie(active_trie), get_left_trie(mergeable_trie)),
+          merge_symbolic_memory(active_context, get_right_trie(active_trie), get_right_trie(mergeable_trie)));
+    }
+  } else if (active_level > mergeable_level) {
+    if (mask_address(mergeable_prefix, active_level) == active_prefix) {
+      // the mergeable subtrie lies within one half of the active subtrie
+      if (is_left_address(mergeable_prefix, active_level))
+        return new_symbolic_memory_node(active_prefix, active_level,
+          merge_symbolic_memory(active_context, get_left_trie(active_trie), mergeable_trie),
+          merge_symbolic_memory_of_one_context(active_context, get_right_trie(active_trie), 1));
+      else
+        return new_symbolic_memory_node(active_prefix, active_level,
+          merge_symbolic_memory_of_one_context(active_context, get_left_trie(active_trie), 1),
+          merge_symbolic_memory(active_context, get_right_trie(active_trie), mergeable_trie));
+    }
+  } else if (mask_address(active_prefix, mergeable_level) == mergeable_prefix) {
+    // the active subtrie lies within one half of the mergeable subtrie
+    if (is_left_address(active_prefix, mergeable_level))
+      return new_symbolic_memory_node(mergeable_prefix, mergeable_level,
+        merge_symbolic_memory(active_context, active_trie, get_left_trie(mergeable_trie)),
+        merge_symbolic_memory_of_one_context(active_context, get_right_trie(mergeable_trie), 0));
+    else
+      return new_symbolic_memory_node(mergeable_prefix, mergeable_level,
+        merge_symbolic_memory_of_one_context(active_context, get_left_trie(mergeable_trie), 0),
+        merge_symbolic_memory(active_context, active_trie, get_right_trie(mergeable_trie)));
+  }
+
+  // the two subtries are disjoint
+  return join_symbolic_memory(
+    active_prefix, merge_symbolic_memory_of_one_context(active_context, active_trie, 1),
+    mergeable_prefix, merge_symbolic_memory_of_one_context(active_context, mergeable_trie, 0));
+}
+
+uint64_t* merge_symbolic_memory_of_one_context(uint64_t* active_context, uint64_t* trie, uint64_t active) {
+  uint64_t* left;
+  uint64_t* right;
+  uint64_t* sword;
+
+  if (trie == (uint64_t*) 0)
+    return trie;
+  else if (is_symbolic_memory_word(trie)) {
+    // words stored in only one context are merged with the concrete value
+    // in memory which is what the other context would load from there
+    sword = new_symbolic_memory_word(get_word_address(trie),
+      load_virtual_memory(pt, get_word_address(trie)), (char*) 0, WORDSIZEINBITS);
+
+    if (active)
+      return merge_symbolic_memory_words(active_context, trie, sword);
+    else
+      return merge_symbolic_memory_words(active_context, sword, trie);
   }
 
-  symbolic_memory = additional_memory;
+  left  = merge_symbolic_memory_of_one_context(active_context, get_left_trie(trie), active);
+  right = merge_symbolic_memory_of_one_context(active_context, get_right_trie(trie), active);
+
+  if (left == get_left_trie(trie))
+    if (right == get_right_trie(trie))
+      return trie;
 
-  // the active context contains now the merged symbolic memory
-  set_symbolic_memory(active_context, symbolic_memory);
+  return new_symbolic_memory_node(get_trie_prefix(trie), get_trie_level(trie), left, right);
+}
+
+uint64_t* merge_symbolic_memory_words(uint64_t* active_context, uint64_t* active_word, uint64_t* mergeable_word) {
+  uint64_t bits;
+
+  if (is_symbolic_value(active_word)) {
+    if (is_symbolic_value(mergeable_word)) {
+      if (get_word_symbolic(active_word) == get_word_symbolic(mergeable_word))
+        // hash-consed symbolic values are equal if they are the same
+        return active_word;
+    }
+  } else if (is_symbolic_value(mergeable_word) == 0)
+    if (get_word_value(active_word) == get_word_value(mergeable_word))
+      return active_word;
+
+  // merged bit vectors are only narrower than machine words
+  // if both values are symbolic and equally narrow
+  bits = WORDSIZEINBITS;
+
+  if (is_symbolic_value(active_word))
+    if (is_symbolic_value(mergeable_word))
+      if (get_number_of_bits(active_word) == get_number_of_bits(mergeable_word))
+        bits = get_number_of_bits(active_word);
+
+  return new_symbolic_memory_word(get_word_address(active_word), get_word_value(active_word),
+    smt_ternary("ite",
+      get_path_condition(active_context),
+      merged_memory_value(active_word, bits),
+      merged_memory_value(mergeable_word, bits)),
+    bits);
+}
+
+char* merged_memory_value(uint64_t* sword, uint64_t bits) {
+  if (is_symbolic_value(sword) == 0)
+    return bv_constant(get_word_value(sword));
+  else if (get_number_of_bits(sword) < bits)
+    return smt_unary(bv_zero_extension(get_number_of_bits(sword)), get_word_symbolic(sword));
+  else
+    return get_word_symbolic(sword);
 }
 
 void merge_registers(uint64_t* active_context, uint64_t* mergeable_context) {
-  uint64_t i;
+  uint64_t* sym_regs;
+  uint64_t  i;
+
+  // merged values go into the registers of the active context which
+  // is not necessarily the current context, for example, if that has exited
+  sym_regs = get_symbolic_regs(active_context);
 
   i = 0;
 
@@ -1670,91 +2810,224 @@ void merge_registers(uint64_t* active_context, uint64_t* mergeable_context) {
       if (*(get_symbolic_regs(mergeable_context) + i) != 0) {
         if (*(get_symbolic_regs(active_context) + i) != *(get_symbolic_regs(mergeable_context) + i))
           // merge symbolic values if they are different
-          *(reg_sym + i) = (uint64_t) smt_ternary("ite",
-                                        get_path_condition(active_context),
-                                        (char*) *(get_symbolic_regs(active_context) + i),
-                                        (char*) *(get_symbolic_regs(mergeable_context) + i)
-                                      );
+          *(sym_regs + i) = (uint64_t) merged_register_value(smt_ternary("ite",
+                                         get_path_condition(active_context),
+                                         (char*) *(get_symbolic_regs(active_context) + i),
+                                         (char*) *(get_symbolic_regs(mergeable_context) + i)
+                                       ));
       } else
         // merge symbolic value and concrete value
-        *(reg_sym + i) = (uint64_t) smt_ternary("ite",
-                                      get_path_condition(active_context),
-                                      (char*) *(get_symbolic_regs(active_context) + i),
-                                      bv_constant(*(get_regs(mergeable_context) + i))
-                                    );
+        *(sym_regs + i) = (uint64_t) merged_register_value(smt_ternary("ite",
+                                       get_path_condition(active_context),
+                                       (char*) *(get_symbolic_regs(active_context) + i),
+                                       bv_constant(*(get_regs(mergeable_context) + i))
+                                     ));
     } else {
       if (*(get_symbolic_regs(mergeable_context) + i) != 0)
         // merge concrete value and symbolic value
-        *(reg_sym + i) = (uint64_t) smt_ternary("ite",
-                                      get_path_condition(active_context),
-                                      bv_constant(*(get_regs(active_context) + i)),
-                                      (char*) *(get_symbolic_regs(mergeable_context) + i)
-                                    );
+        *(sym_regs + i) = (uint64_t) merged_register_value(smt_ternary("ite",
+                                       get_path_condition(active_context),
+                                       bv_constant(*(get_regs(active_context) + i)),
+                                       (char*) *(get_symbolic_regs(mergeable_context) + i)
+                                     ));
       else
         if (*(get_regs(active_context) + i) != *(get_regs(mergeable_context) + i))
           // merge concrete values if they are different
-          *(reg_sym + i) = (uint64_t) smt_ternary("ite",
-                                        get_path_condition(active_context),
-                                        bv_constant(*(get_regs(active_context) + i)),
-                                        bv_constant(*(get_regs(mergeable_context) + i))
-                                      );
+          *(sym_regs + i) = (uint64_t) merged_register_value(smt_ternary("ite",
+                                         get_path_condition(active_context),
+                                         bv_constant(*(get_regs(active_context) + i)),
+                                         bv_constant(*(get_regs(mergeable_context) + i))
+                                       ));
     }
 
     i = i + 1;
   }
+}
+
+char* merged_register_value(char* sym) {
+  char* svar;
+
+  // bind merged register values to fresh variables, as sd does for memory,
+  // so that registers live across merges do not grow nested ite terms
+  svar = smt_variable("r", SIZEOFUINT64 * 8);
+
+  dprintf(output_fd, "(assert (= %s %s)); merge in ", svar, define_smt_terms(sym));
+  print_code_context_for_instruction(pc);
+  println();
 
-  set_symbolic_regs(active_context, reg_sym);
+  define_term(svar, sym);
+
+  return svar;
 }
 
-uint64_t* schedule_next_symbolic_context() {
+uint64_t get_call_stack_depth(uint64_t* context) {
+  if (get_call_stack(context))
+    return get_depth(get_call_stack(context));
+  else
+    return 0;
+}
+
+uint64_t is_scheduled_before(uint64_t* context1, uint64_t* context2) {
+  // contexts with higher call stacks and then lower program counters go first
+  if (get_call_stack_depth(context1) > get_call_stack_depth(context2))
+    return 1;
+  else if (get_call_stack_depth(context1) < get_call_stack_depth(context2))
+    return 0;
+  else
+    return get_pc(context1) < get_pc(context2);
+}
+
+uint64_t* get_queued_context(uint64_t position) {
+  return (uint64_t*) *(context_queue + position - 1);
+}
+
+void set_queued_context(uint64_t position, uint64_t* context) {
+  *(context_queue + position - 1) = (uint64_t) context;
+
+  set_queue_position(context, position);
+}
+
+void swap_queued_contexts(uint64_t position1, uint64_t position2) {
   uint64_t* context;
-  uint64_t  max_call_stack_size;
-  uint64_t* max_call_stack;
-  uint64_t  min_pc;
-  uint64_t* next_context;
 
-  context = symbolic_contexts;
-  max_call_stack_size = 0;
-  max_call_stack = (uint64_t*) 0;
-  min_pc = UINT64_MAX;
-  next_context = (uint64_t*) 0;
-
-  // find the currently highest call stack
-  while (context) {
-    if (get_call_stack(context) != (uint64_t*) 0)
-      if (get_depth(get_call_stack(context)) > max_call_stack_size) {
-        max_call_stack_size = get_depth(get_call_stack(context));
-        max_call_stack = get_call_stack(context);
-      }
+  context = get_queued_context(position1);
+
+  set_queued_context(position1, get_queued_context(position2));
+  set_queued_context(position2, context);
+}
+
+void sift_up_symbolic_context(uint64_t position) {
+  // the parent of the context at position p is at position p / 2
+  while (position > 1) {
+    if (is_scheduled_before(get_queued_context(position), get_queued_context(position / 2))) {
+      swap_queued_contexts(position, position / 2);
 
-    context = get_next_context(context);
+      position = position / 2;
+    } else
+      return;
   }
+}
 
-  context = symbolic_contexts;
+void sift_down_symbolic_context(uint64_t position) {
+  uint64_t child;
 
-  // find the context with the lowest program counter and the highest call stack
-  while (context) {
-    if (get_call_stack(context) == max_call_stack)
-      if (get_pc(context) < min_pc) {
-        min_pc = get_pc(context);
-        next_context = context;
-      }
+  // the children of the context at position p are at positions 2p and 2p + 1
+  while (2 * position <= context_queue_size) {
+    child = 2 * position;
+
+    if (child < context_queue_size)
+      if (is_scheduled_before(get_queued_context(child + 1), get_queued_context(child)))
+        child = child + 1;
+
+    if (is_scheduled_before(get_queued_context(child), get_queued_context(position))) {
+      swap_queued_contexts(position, child);
+
+      position = child;
+    } else
+      return;
+  }
+}
+
+uint64_t hash_symbolic_context(uint64_t* context) {
+  return (get_pc(context) / INSTRUCTIONSIZE + (uint64_t) get_call_stack(context) / SIZEOFUINT64) % CONTEXT_TABLE_SIZE;
+}
+
+void enqueue_symbolic_context(uint64_t* context) {
+  uint64_t* queue;
+  uint64_t  i;
+
+  if (context_queue_size == context_queue_maximum) {
+    // double the size of the queue
+    context_queue_maximum = 2 * context_queue_maximum + 1;
+
+    queue = smalloc(context_queue_maximum * SIZEOFUINT64STAR);
+
+    i = 0;
+
+    while (i < context_queue_size) {
+      *(queue + i) = *(context_queue + i);
+
+      i = i + 1;
+    }
+
+    context_queue = queue;
+  }
+
+  context_queue_size = context_queue_size + 1;
+
+  set_queued_context(context_queue_size, context);
+
+  sift_up_symbolic_context(context_queue_size);
+
+  // insert context at the beginning of its bucket
+  set_next_waiting(context, (uint64_t*) *(waiting_contexts + hash_symbolic_context(context)));
+
+  *(waiting_contexts + hash_symbolic_context(context)) = (uint64_t) context;
+}
 
-    context = get_next_context(context);
+void dequeue_symbolic_context(uint64_t* context) {
+  uint64_t  position;
+  uint64_t* waiting;
+
+  position = get_queue_position(context);
+
+  if (position == 0)
+    // context is not waiting
+    return;
+
+  set_queue_position(context, 0);
+
+  if (position < context_queue_size) {
+    // fill the gap with the last context in the queue
+    waiting = get_queued_context(context_queue_size);
+
+    set_queued_context(position, waiting);
+
+    context_queue_size = context_queue_size - 1;
+
+    sift_up_symbolic_context(position);
+    sift_down_symbolic_context(get_queue_position(waiting));
+  } else
+    context_queue_size = context_queue_size - 1;
+
+  waiting = (uint64_t*) *(waiting_contexts + hash_symbolic_context(context));
+
+  if (waiting == context)
+    *(waiting_contexts + hash_symbolic_context(context)) = (uint64_t) get_next_waiting(context);
+  else {
+    while (get_next_waiting(waiting) != context)
+      waiting = get_next_waiting(waiting);
+
+    set_next_waiting(waiting, get_next_waiting(context));
   }
+}
+
+uint64_t* schedule_next_symbolic_context() {
+  uint64_t* context;
+
+  if (context_queue_size == 0)
+    return (uint64_t*) 0;
 
   // the context with the highest call stack and the lowest program counter is returned
-  return next_context;
+  context = get_queued_context(1);
+
+  dequeue_symbolic_context(context);
+
+  return context;
 }
 
 void check_if_mergeable_and_merge_if_possible(uint64_t* context) {
   uint64_t* mergeable_context;
   uint64_t* next_context;
 
-  mergeable_context = symbolic_contexts;
+  if (context == (uint64_t*) 0)
+    return;
+
+  // only waiting contexts in the same bucket may be mergeable
+  mergeable_context = (uint64_t*) *(waiting_contexts + hash_symbolic_context(context));
 
   while (mergeable_context) {
-    next_context = get_next_context(mergeable_context);
+    next_context = get_next_waiting(mergeable_context);
     // a context cannot be merged with itself
     if (mergeable_context != context)
       // mergeable contexts must have the same program counter
@@ -1767,6 +3040,56 @@ void check_if_mergeable_and_merge_if_possible(uint64_t* context) {
   }
 }
 
+void split_symbolic_contexts() {
+  uint64_t* contexts;
+  uint64_t  i;
+
+  if (number_of_workers < 2)
+    return;
+  else if (split)
+    return;
+  else if (context_queue_size < SPLIT_FACTOR * number_of_workers)
+    return;
+
+  split = 1;
+
+  number_of_split_contexts = context_queue_size;
+
+  // all workers have the same queue, which changes when dequeueing though
+  contexts = smalloc(number_of_split_contexts * SIZEOFUINT64STAR);
+
+  i = 0;
+
+  while (i < number_of_split_contexts) {
+    *(contexts + i) = (uint64_t) get_queued_context(i + 1);
+
+    i = i + 1;
+  }
+
+  // each worker keeps every n-th waiting context only
+  i = 0;
+
+  while (i < number_of_split_contexts) {
+    if (i % number_of_workers != worker) {
+      dequeue_symbolic_context((uint64_t*) *(contexts + i));
+
+      symbolic_contexts = delete_context((uint64_t*) *(contexts + i), symbolic_contexts);
+
+      number_of_live_contexts = number_of_live_contexts - 1;
+    }
+
+    i = i + 1;
+  }
+}
+
+uint64_t is_checked_here() {
+  // properties are checked by the first worker only until contexts are split
+  if (split)
+    return 1;
+  else
+    return worker == 0;
+}
+
 void add_child(uint64_t* parent, uint64_t* child) {
   uint64_t* head;
 
@@ -1845,6 +3168,10 @@ void monster(uint64_t* to_context) {
 
   symbolic_contexts = to_context;
 
+  number_of_symbolic_contexts  = 1;
+  number_of_live_contexts      = 1;
+  peak_number_of_live_contexts = 1;
+
   if (debug_merge)
     from_context = (uint64_t*) 0;
 
@@ -1880,12 +3207,13 @@ void monster(uint64_t* to_context) {
       exception = handle_symbolic_exception(from_context);
 
       if (exception == EXIT) {
-        // we need to update the end of the shared symbolic memory of the corresponding context
-        update_begin_of_shared_symbolic_memory(get_merge_partner(from_context));
-
         // delete exited context
         symbolic_contexts = delete_context(from_context, symbolic_contexts);
 
+        number_of_live_contexts = number_of_live_contexts - 1;
+
+        split_symbolic_contexts();
+
         // schedule the context with the highest call stack and the lowest program counter
         to_context = schedule_next_symbolic_context();
 
@@ -1910,6 +3238,11 @@ void monster(uint64_t* to_context) {
         // check if contexts can be merged
         check_if_mergeable_and_merge_if_possible(from_context);
 
+        // the current context competes with all waiting contexts
+        enqueue_symbolic_context(from_context);
+
+        split_symbolic_contexts();
+
         // schedule the context with the highest call stack and the lowest program counter
         to_context = schedule_next_symbolic_context();
 
@@ -1931,12 +3264,14 @@ uint64_t selfie_run_symbolically() {
       // checking for the (optional) branching limit argument
       if (number_of_remaining_arguments() > 1)
         if (string_compare(peek_argument(1), "--merge-enabled") == 0)
-          if (string_compare(peek_argument(1), "--debug-merge") == 0) {
-            // assert: argument is an integer representing the branching limit
-            beq_limit = atoi(peek_argument(1));
+          if (string_compare(peek_argument(1), "--debug-merge") == 0)
+            if (string_compare(peek_argument(1), "--prune") == 0)
+              if (string_compare(peek_argument(1), "--shard") == 0) {
+                // assert: argument is an integer representing the branching limit
+                beq_limit = atoi(peek_argument(1));
 
-            get_argument();
-          }
+                get_argument();
+              }
 
       // checking for the (optional) argument whether to enable merging (in debug mode) or not
       if (number_of_remaining_arguments() > 1) {
@@ -1952,6 +3287,31 @@ uint64_t selfie_run_symbolically() {
         }
       }
 
+      // checking for the (optional) argument whether to prune infeasible paths or not
+      if (number_of_remaining_arguments() > 1)
+        if (string_compare(peek_argument(1), "--prune")) {
+          prune = 1;
+
+          get_argument();
+        }
+
+      // checking for the (optional) arguments selecting the shard explored by this worker
+      if (number_of_remaining_arguments() > 3)
+        if (string_compare(peek_argument(1), "--shard")) {
+          worker            = atoi(peek_argument(2));
+          number_of_workers = atoi(peek_argument(3));
+
+          get_argument();
+          get_argument();
+          get_argument();
+
+          if (worker >= number_of_workers) {
+            printf("%s: shard %lu of %lu workers does not exist\n", selfie_name, worker, number_of_workers);
+
+            return EXITCODE_BADARGUMENTS;
+          }
+        }
+
       if (code_size == 0) {
         printf("%s: nothing to run symbolically\n", selfie_name);
 
@@ -1959,7 +3319,15 @@ uint64_t selfie_run_symbolically() {
       }
 
       // use extension ".smt" in name of SMT-LIB file
-      smt_name = replace_extension(binary_name, "smt");
+      if (number_of_workers > 1) {
+        // each worker writes its own shard into a file with extension ".<worker>.smt"
+        smt_name = string_alloc(MAX_FILENAME_LENGTH);
+
+        sprintf(smt_name, "%lu.smt", worker);
+
+        smt_name = replace_extension(binary_name, smt_name);
+      } else
+        smt_name = replace_extension(binary_name, "smt");
 
       // assert: smt_name is mapped and not longer than MAX_FILENAME_LENGTH
 
@@ -1977,6 +3345,14 @@ uint64_t selfie_run_symbolically() {
 
       init_memory(1);
 
+      smt_terms   = zmalloc(SMT_TABLE_SIZE * SIZEOFUINT64STAR);
+      smt_symbols = zmalloc(SMT_TABLE_SIZE * SIZEOFUINT64STAR);
+
+      waiting_contexts = zmalloc(CONTEXT_TABLE_SIZE * SIZEOFUINT64STAR);
+
+      if (prune)
+        init_bit_blasting();
+
       current_context = create_symbolic_context(MY_CONTEXT, 0);
 
       // assert: number_of_remaining_arguments() > 0
@@ -2005,6 +3381,37 @@ uint64_t selfie_run_symbolically() {
 
       print_profile(current_context);
 
+      printf("%s: %lu SMT-LIB terms hash-consed and shared %lu times, %lu named and %lu defined\n", selfie_name,
+        number_of_smt_terms,
+        number_of_smt_shares,
+        number_of_smt_names,
+        number_of_smt_definitions);
+      printf("%s: %lu symbolic contexts explored, %lu merged, at most %lu live at once\n", selfie_name,
+        number_of_symbolic_contexts,
+        number_of_merged_contexts,
+        peak_number_of_live_contexts);
+
+      if (number_of_workers > 1)
+        printf("%s: shard %lu of %lu workers explored after splitting %lu waiting contexts\n", selfie_name,
+          worker,
+          number_of_workers,
+          number_of_split_contexts);
+
+      if (prune) {
+        printf("%s: %lu terms bit-blasted into %lu variables and %lu clauses\n", selfie_name,
+          number_of_terms,
+          number_of_sat_variables,
+          number_of_sat_clauses);
+        printf("%s: %lu SAT queries (%lu unknown) with %lu conflicts pruned %lu infeasible branches\n", selfie_name,
+          number_of_queries,
+          number_of_unknowns,
+          number_of_conflicts,
+          number_of_pruned_branches);
+        printf("%s: %lu of %lu checks satisfiable\n", selfie_name,
+          number_of_sat_checks,
+          number_of_checks);
+      }
+
       run = 0;
 
       printf("%s: %lu characters of SMT-LIB formulae written into %s\n", selfie_name,
@@ -2036,5 +3443,5 @@ int main(int argc, char** argv) {
   if (exit_code == EXITCODE_MOREARGUMENTS)
     exit_code = selfie_run_symbolically();
 
-  return exit_selfie(exit_code, " - maximum-execution-depth [ branching-limit ] [ --merge-enabled | --debug-merge ] ...");
+  return exit_selfie(exit_code, " - maximum-execution-depth [ branching-limit ] [ --merge-enabled | --debug-merge ] [ --prune ] [ --shard worker number-of-workers ] ...");
 }
\ No newline at end of file